@@ -0,0 +1,359 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "types.h"
+#include "globals.h"
+
+#include "aictx.h"
+#include "ai.h"
+
+/* globals */
+AICTX *vlpaictxCur = NULL;
+uint16_t vmsAiBudget = 0;
+
+static AICTX *rglpaictx[16];
+
+AICTX *LpaictxFromPlayer(int16_t iPlayer)
+{
+    AICTX *lpaictx;
+
+    if (iPlayer < 0 || iPlayer >= 16)
+    {
+        return NULL;
+    }
+    lpaictx = rglpaictx[iPlayer];
+    if (lpaictx == NULL)
+    {
+        lpaictx = (AICTX *)calloc(1, sizeof(AICTX));
+        if (lpaictx == NULL)
+        {
+            return NULL;
+        }
+        lpaictx->iPlayer = iPlayer;
+        lpaictx->msBudget = vmsAiBudget;
+        rglpaictx[iPlayer] = lpaictx;
+    }
+    return lpaictx;
+}
+
+void EnterAiCtx(AICTX *lpaictx)
+{
+    vclpplAi = lpaictx->cpl;
+    vrglpplAi = lpaictx->rglppl;
+    vlpbAiData = lpaictx->lpbData;
+    vlpbAiPlanet = lpaictx->lpbPlanet;
+    vAiMacRecycleSB = lpaictx->lpbMacRecycleSB;
+    memcpy(vrgAiArmadaPotency, lpaictx->rgArmadaPotency, sizeof(vrgAiArmadaPotency));
+    memcpy(vrgAiCyberArmadaPotency, lpaictx->rgCyberArmadaPotency, sizeof(vrgAiCyberArmadaPotency));
+    vlpaictxCur = lpaictx;
+}
+
+/* Take the scratch state back, including any buffer the AI reallocated,
+ * and clear the globals so a stale pointer can't leak into the next player. */
+void LeaveAiCtx(AICTX *lpaictx)
+{
+    lpaictx->cpl = vclpplAi;
+    lpaictx->rglppl = vrglpplAi;
+    lpaictx->lpbData = vlpbAiData;
+    lpaictx->lpbPlanet = vlpbAiPlanet;
+    lpaictx->lpbMacRecycleSB = vAiMacRecycleSB;
+    memcpy(lpaictx->rgArmadaPotency, vrgAiArmadaPotency, sizeof(vrgAiArmadaPotency));
+    memcpy(lpaictx->rgCyberArmadaPotency, vrgAiCyberArmadaPotency, sizeof(vrgAiCyberArmadaPotency));
+
+    vclpplAi = 0;
+    vrglpplAi = NULL;
+    vlpbAiData = NULL;
+    vlpbAiPlanet = NULL;
+    vAiMacRecycleSB = NULL;
+    memset(vrgAiArmadaPotency, 0, sizeof(vrgAiArmadaPotency));
+    memset(vrgAiCyberArmadaPotency, 0, sizeof(vrgAiCyberArmadaPotency));
+    vlpaictxCur = NULL;
+}
+
+void FreeAiCtxs(void)
+{
+    int16_t i;
+    AICTX *lpaictx;
+
+    for (i = 0; i < 16; i++)
+    {
+        lpaictx = rglpaictx[i];
+        if (lpaictx == NULL)
+        {
+            continue;
+        }
+        free(lpaictx->rglppl);
+        free(lpaictx->lpbData);
+        free(lpaictx->lpbPlanet);
+        free(lpaictx->lpbMacRecycleSB);
+        free(lpaictx->rgaiord);
+        FreeAiWorld(&lpaictx->world);
+        free(lpaictx);
+        rglpaictx[i] = NULL;
+    }
+}
+
+/* Set the budget for every computer player, existing contexts included. */
+void SetAiBudget(uint16_t msBudget)
+{
+    int16_t i;
+
+    vmsAiBudget = msBudget;
+    for (i = 0; i < 16; i++)
+    {
+        if (rglpaictx[i] != NULL)
+        {
+            rglpaictx[i]->msBudget = msBudget;
+        }
+    }
+}
+
+/* szBase.ai holds the computer players' world models, each as packed by
+ * CbPackAiWorld, back to back. */
+int16_t FWriteAiWorlds(void)
+{
+    FILE *fp;
+    AICTX *lpaictx;
+    uint8_t *pb;
+    uint8_t *pbNew;
+    uint32_t cb;
+    uint32_t cbMax;
+    int16_t fOk;
+    int16_t i;
+    char szFile[256 + 4];
+
+    (void)snprintf(szFile, sizeof(szFile), "%s.ai", szBase);
+    fp = fopen(szFile, "wb");
+    if (fp == NULL)
+    {
+        return 0;
+    }
+    fOk = 1;
+    pb = NULL;
+    cbMax = 0;
+    for (i = 0; i < 16 && fOk; i++)
+    {
+        lpaictx = rglpaictx[i];
+        if (lpaictx == NULL || lpaictx->world.rgplmod == NULL)
+        {
+            continue;
+        }
+        cb = CbPackAiWorld(&lpaictx->world, NULL, 0);
+        if (cb > cbMax)
+        {
+            pbNew = (uint8_t *)realloc(pb, cb);
+            if (pbNew == NULL)
+            {
+                fOk = 0;
+                break;
+            }
+            pb = pbNew;
+            cbMax = cb;
+        }
+        fOk = (int16_t)(CbPackAiWorld(&lpaictx->world, pb, cbMax) == cb && fwrite(pb, 1, cb, fp) == cb);
+    }
+    free(pb);
+    if (fclose(fp) != 0)
+    {
+        fOk = 0;
+    }
+    return fOk;
+}
+
+/* Load szBase.ai into the contexts. No file yet is not an error. */
+int16_t FReadAiWorlds(void)
+{
+    FILE *fp;
+    AICTX *lpaictx;
+    uint8_t *pb;
+    uint8_t *pbNew;
+    uint32_t cb;
+    uint32_t cbMax;
+    int16_t fOk;
+    int16_t iPlayer;
+    uint8_t rgbCb[4];
+    char szFile[256 + 4];
+
+    (void)snprintf(szFile, sizeof(szFile), "%s.ai", szBase);
+    fp = fopen(szFile, "rb");
+    if (fp == NULL)
+    {
+        return 1;
+    }
+    fOk = 1;
+    pb = NULL;
+    cbMax = 0;
+    while (fread(rgbCb, 1, 4, fp) == 4)
+    {
+        cb = (uint32_t)rgbCb[0] | ((uint32_t)rgbCb[1] << 8) | ((uint32_t)rgbCb[2] << 16) | ((uint32_t)rgbCb[3] << 24);
+        if (cb <= 8 || cb > 0x1000000)
+        {
+            fOk = 0;
+            break;
+        }
+        if (cb > cbMax)
+        {
+            pbNew = (uint8_t *)realloc(pb, cb);
+            if (pbNew == NULL)
+            {
+                fOk = 0;
+                break;
+            }
+            pb = pbNew;
+            cbMax = cb;
+        }
+        memcpy(pb, rgbCb, 4);
+        if (fread(pb + 4, 1, cb - 4, fp) != cb - 4)
+        {
+            fOk = 0;
+            break;
+        }
+        iPlayer = (int16_t)(pb[6] | (pb[7] << 8));
+        lpaictx = LpaictxFromPlayer(iPlayer);
+        if (lpaictx == NULL || !FUnpackAiWorld(&lpaictx->world, pb, cb))
+        {
+            fOk = 0;
+            break;
+        }
+    }
+    free(pb);
+    fclose(fp);
+    return fOk;
+}
+
+void StartAiBudget(AICTX *lpaictx)
+{
+    lpaictx->clkDeadline = clock() + (clock_t)((uint32_t)lpaictx->msBudget * CLOCKS_PER_SEC / 1000);
+}
+
+/* True once the current AI player has used up its turn budget. Always false
+ * outside an AI context or when the budget is unlimited. */
+int16_t FAiBudgetExpired(void)
+{
+    if (vlpaictxCur == NULL || vlpaictxCur->msBudget == 0)
+    {
+        return 0;
+    }
+    return clock() >= vlpaictxCur->clkDeadline;
+}
+
+AIORD *LpaiordFromAiCtx(AICTX *lpaictx, int16_t caiord)
+{
+    AIORD *rgaiord;
+
+    if (caiord > lpaictx->caiordMax)
+    {
+        rgaiord = (AIORD *)realloc(lpaictx->rgaiord, caiord * sizeof(AIORD));
+        if (rgaiord == NULL)
+        {
+            return NULL;
+        }
+        lpaictx->rgaiord = rgaiord;
+        lpaictx->caiordMax = caiord;
+    }
+    return lpaictx->rgaiord;
+}
+
+static int16_t FAiOrdLess(const AIORD *paiord1, const AIORD *paiord2)
+{
+    if (paiord1->d2 != paiord2->d2)
+    {
+        return paiord1->d2 < paiord2->d2;
+    }
+    return paiord1->i < paiord2->i;
+}
+
+static void SiftDownAiOrd(AIORD *rgaiord, int16_t caiord, int32_t i)
+{
+    AIORD aiordT;
+    int32_t iChild;
+
+    for (;;)
+    {
+        iChild = 2 * i + 1;
+        if (iChild >= caiord)
+        {
+            break;
+        }
+        if (iChild + 1 < caiord && FAiOrdLess(&rgaiord[iChild + 1], &rgaiord[iChild]))
+        {
+            iChild++;
+        }
+        if (!FAiOrdLess(&rgaiord[iChild], &rgaiord[i]))
+        {
+            break;
+        }
+        aiordT = rgaiord[i];
+        rgaiord[i] = rgaiord[iChild];
+        rgaiord[iChild] = aiordT;
+        i = iChild;
+    }
+}
+
+/* Arrange rgaiord as a min-heap in O(n), so a search pays only for the
+ * candidates it actually visits. */
+void HeapifyAiOrd(AIORD *rgaiord, int16_t caiord)
+{
+    int32_t i;
+
+    for (i = caiord / 2 - 1; i >= 0; i--)
+    {
+        SiftDownAiOrd(rgaiord, caiord, i);
+    }
+}
+
+/* Take the nearest candidate off the heap and return its index, or -1 when
+ * none are left. Equal distances come off in index order so ties resolve
+ * the same way a front-to-back scan would. */
+int16_t IPopAiOrd(AIORD *rgaiord, int16_t *pcaiord)
+{
+    int16_t i;
+
+    if (*pcaiord <= 0)
+    {
+        return -1;
+    }
+    i = rgaiord[0].i;
+    (*pcaiord)--;
+    rgaiord[0] = rgaiord[*pcaiord];
+    SiftDownAiOrd(rgaiord, *pcaiord, 0);
+    return i;
+}
+
+/* Run every computer player's turn, each inside its own context. Players
+ * go strictly in player order so the orders they leave behind (and the
+ * Random() stream they consume) are the same on every host. A player whose
+ * context can't be allocated is skipped and the result is false. */
+int16_t FDoAiTurns(void)
+{
+    int16_t iPlayer;
+    int16_t fAiSav;
+    int16_t fOk;
+    AICTX *lpaictx;
+
+    fAiSav = fAi;
+    fAi = 1;
+    fOk = 1;
+    for (iPlayer = 0; iPlayer < game.cPlayer; iPlayer++)
+    {
+        if (!rgplr[iPlayer].fAi)
+        {
+            continue;
+        }
+        lpaictx = LpaictxFromPlayer(iPlayer);
+        if (lpaictx == NULL)
+        {
+            fOk = 0;
+            continue;
+        }
+        EnterAiCtx(lpaictx);
+        StartAiBudget(lpaictx);
+        UpdateAiWorld(&lpaictx->world, iPlayer);
+        DoAiTurn(iPlayer, rgplr[iPlayer].wMdPlr);
+        LeaveAiCtx(lpaictx);
+    }
+    fAi = fAiSav;
+    return fOk;
+}
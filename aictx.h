@@ -0,0 +1,70 @@
+#ifndef AICTX_H_
+#define AICTX_H_
+
+#include <time.h>
+
+#include "types.h"
+#include "aiworld.h"
+
+/*
+ * Per-player AI working state.
+ *
+ * The AI modules keep their scratch data in globals (vrglpplAi, vclpplAi,
+ * vlpbAiData, the armada potency tables).
+ * AICTX owns one copy of that state per computer player; EnterAiCtx installs
+ * it into the globals for the duration of DoAiTurn and LeaveAiCtx takes it
+ * back, so no player ever sees another player's scratch and buffers are kept
+ * across turns instead of being rebuilt. FGenerateTurn runs the computer
+ * players through FDoAiTurns; DestroyCurGame frees the contexts.
+ *
+ * A context can also carry a time budget (ms of CPU per turn, SetAiBudget).
+ * With a budget the Find*Enum searches heap their candidates by distance,
+ * pop them nearest first and stop once the turn's deadline has passed,
+ * keeping the best answer found so far. With no budget (the default) they
+ * scan every candidate front to back.
+ */
+
+/* One search candidate: planet or fleet index and its squared distance. */
+typedef struct _aiord
+{
+    int32_t d2;
+    int16_t i;
+} AIORD;
+
+typedef struct _aictx
+{
+    int16_t iPlayer;
+    int16_t cpl;                     /* vclpplAi */
+    PLANET **rglppl;                 /* vrglpplAi */
+    uint8_t *lpbData;                /* vlpbAiData */
+    uint8_t *lpbPlanet;              /* vlpbAiPlanet */
+    uint8_t *lpbMacRecycleSB;        /* vAiMacRecycleSB */
+    uint8_t rgArmadaPotency[4];      /* vrgAiArmadaPotency */
+    uint8_t rgCyberArmadaPotency[4]; /* vrgAiCyberArmadaPotency */
+    uint16_t msBudget;               /* 0: unlimited */
+    clock_t clkDeadline;
+    int16_t caiordMax;
+    AIORD *rgaiord;                  /* candidate order scratch */
+    AIWORLD world;                   /* kept between turns, see aiworld.h */
+} AICTX;
+
+/* globals */
+extern AICTX *vlpaictxCur;
+extern uint16_t vmsAiBudget; /* default msBudget, see SetAiBudget */
+
+/* functions */
+AICTX *LpaictxFromPlayer(int16_t iPlayer);
+void EnterAiCtx(AICTX *lpaictx);
+void LeaveAiCtx(AICTX *lpaictx);
+void FreeAiCtxs(void);
+int16_t FWriteAiWorlds(void);
+int16_t FReadAiWorlds(void);
+void SetAiBudget(uint16_t msBudget);
+void StartAiBudget(AICTX *lpaictx);
+int16_t FAiBudgetExpired(void);
+AIORD *LpaiordFromAiCtx(AICTX *lpaictx, int16_t caiord);
+void HeapifyAiOrd(AIORD *rgaiord, int16_t caiord);
+int16_t IPopAiOrd(AIORD *rgaiord, int16_t *pcaiord);
+int16_t FDoAiTurns(void);
+
+#endif /* AICTX_H_ */
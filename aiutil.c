@@ -1,7 +1,9 @@
 
 #include "types.h"
+#include "globals.h"
 
 #include "aiutil.h"
+#include "aictx.h"
 
 /* globals */
 uint8_t vrgSBAip[85];  /* MEMORY_AIU:0x7688 */
@@ -31,6 +33,62 @@ int16_t FGetAIPart(int16_t aip, PART *ppart)
     return 0;
 }
 
+/* Not in the original: when the current AI has a time budget, a heap of
+ * the candidates by distance from pt for IPopAiOrd, otherwise NULL for a
+ * plain front-to-back scan. pfnPt gives the position of candidate i. */
+static AIORD *LpaiordByDistance(POINT pt, int16_t c, POINT (*pfnPt)(int16_t), int16_t *pcaiord)
+{
+    AIORD *rgaiord;
+    POINT ptT;
+    int32_t dx;
+    int32_t dy;
+    int16_t i;
+
+    if (vlpaictxCur == NULL || vlpaictxCur->msBudget == 0 || c <= 0)
+    {
+        return NULL;
+    }
+    rgaiord = LpaiordFromAiCtx(vlpaictxCur, c);
+    if (rgaiord == NULL)
+    {
+        return NULL;
+    }
+    for (i = 0; i < c; i++)
+    {
+        ptT = pfnPt(i);
+        dx = ptT.x - pt.x;
+        dy = ptT.y - pt.y;
+        rgaiord[i].d2 = dx * dx + dy * dy;
+        rgaiord[i].i = i;
+    }
+    HeapifyAiOrd(rgaiord, c);
+    *pcaiord = c;
+    return rgaiord;
+}
+
+static POINT PtFromIpl(int16_t ipl)
+{
+    return rgptPlan[lpPlanets[ipl].id];
+}
+
+static POINT PtFromIfl(int16_t ifl)
+{
+    POINT pt = {0, 0};
+
+    if (rglpfl[ifl] != NULL)
+    {
+        pt = rglpfl[ifl]->pt;
+    }
+    return pt;
+}
+
+/* Budget check, amortized over batches of candidates. */
+#define FAiSearchExpired(i) ((((i) + 1) & 0x0f) == 0 && FAiBudgetExpired())
+
+/* The Find*Enum searches are not decompiled. Their bodies are invented
+ * from the locals and the FEnumCalc* callbacks: pfn filters the candidates
+ * and the nearest one that passes wins, ties going to the lower index. */
+
 FLEET * LpflFindClosestEnum(FLEET *lpfl, int16_t (*pfn)(FLEET *, FLEET *))
 {
     FLEET * lpflT;
@@ -41,9 +99,37 @@ FLEET * LpflFindClosestEnum(FLEET *lpfl, int16_t (*pfn)(FLEET *, FLEET *))
     FLEET * lpflBest;
     int32_t l;
     int32_t lBest;
-
-    /* TODO: implement */
-    return NULL;
+    AIORD *rgaiord;
+    int16_t caiord;
+
+    pt = lpfl->pt;
+    rgaiord = LpaiordByDistance(pt, cFleet, PtFromIfl, &caiord);
+    lpflBest = NULL;
+    lBest = 0x7fffffff;
+    for (ish = 0; ish < cFleet; ish++)
+    {
+        lpflT = rglpfl[rgaiord != NULL ? IPopAiOrd(rgaiord, &caiord) : ish];
+        if (lpflT != NULL && lpflT != lpfl && pfn(lpfl, lpflT))
+        {
+            dx = (int16_t)(lpflT->pt.x - pt.x);
+            dy = (int16_t)(lpflT->pt.y - pt.y);
+            l = (int32_t)dx * dx + (int32_t)dy * dy;
+            if (l < lBest)
+            {
+                lBest = l;
+                lpflBest = lpflT;
+            }
+            if (rgaiord != NULL)
+            {
+                break; /* nearest first: the first hit is the answer */
+            }
+        }
+        if (rgaiord != NULL && FAiSearchExpired(ish))
+        {
+            break;
+        }
+    }
+    return lpflBest;
 }
 
 PLANET * LpplFindClosestEnum(PLANET *lppl, int16_t (*pfn)(PLANET *, PLANET *))
@@ -56,9 +142,40 @@ PLANET * LpplFindClosestEnum(PLANET *lppl, int16_t (*pfn)(PLANET *, PLANET *))
     int16_t dx;
     int32_t l;
     int32_t lBest;
-
-    /* TODO: implement */
-    return NULL;
+    AIORD *rgaiord;
+    int16_t caiord;
+    int16_t i;
+
+    pt = rgptPlan[lppl->id];
+    rgaiord = LpaiordByDistance(pt, cPlanet, PtFromIpl, &caiord);
+    lpplBest = NULL;
+    lBest = 0x7fffffff;
+    lpplTMac = &lpPlanets[cPlanet];
+    for (i = 0, lpplT = lpPlanets; lpplT < lpplTMac; i++, lpplT++)
+    {
+        PLANET *lpplCand = rgaiord != NULL ? &lpPlanets[IPopAiOrd(rgaiord, &caiord)] : lpplT;
+
+        if (pfn(lppl, lpplCand))
+        {
+            dx = (int16_t)(rgptPlan[lpplCand->id].x - pt.x);
+            dy = (int16_t)(rgptPlan[lpplCand->id].y - pt.y);
+            l = (int32_t)dx * dx + (int32_t)dy * dy;
+            if (l < lBest)
+            {
+                lBest = l;
+                lpplBest = lpplCand;
+            }
+            if (rgaiord != NULL)
+            {
+                break;
+            }
+        }
+        if (rgaiord != NULL && FAiSearchExpired(i))
+        {
+            break;
+        }
+    }
+    return lpplBest;
 }
 
 void AddItemToQueue(uint16_t iItem, uint16_t cItem, uint16_t grobj, int16_t mdAddItem)
@@ -815,6 +932,9 @@ int16_t CheckAiShdefStatus(int16_t ishBeg, int16_t ishEnd, uint16_t cRecyclePeri
     return 0;
 }
 
+/* Invented like the searches above: pfn scores each candidate, highest
+ * score wins, the nearer one on a tie, and a score of 0 means "not a
+ * candidate". */
 PLANET * LpplFindBestEnum(PLANET *lppl, int16_t (*pfn)(PLANET *, PLANET *))
 {
     int16_t iBest;
@@ -827,9 +947,39 @@ PLANET * LpplFindBestEnum(PLANET *lppl, int16_t (*pfn)(PLANET *, PLANET *))
     int16_t dx;
     int32_t l;
     int32_t lBest;
-
-    /* TODO: implement */
-    return NULL;
+    AIORD *rgaiord;
+    int16_t caiord;
+    int16_t i;
+
+    pt = rgptPlan[lppl->id];
+    rgaiord = LpaiordByDistance(pt, cPlanet, PtFromIpl, &caiord);
+    lpplBest = NULL;
+    iBest = 0;
+    lBest = 0x7fffffff;
+    lpplTMac = &lpPlanets[cPlanet];
+    for (i = 0, lpplT = lpPlanets; lpplT < lpplTMac; i++, lpplT++)
+    {
+        PLANET *lpplCand = rgaiord != NULL ? &lpPlanets[IPopAiOrd(rgaiord, &caiord)] : lpplT;
+
+        iCur = pfn(lppl, lpplCand);
+        if (iCur > 0 && iCur >= iBest)
+        {
+            dx = (int16_t)(rgptPlan[lpplCand->id].x - pt.x);
+            dy = (int16_t)(rgptPlan[lpplCand->id].y - pt.y);
+            l = (int32_t)dx * dx + (int32_t)dy * dy;
+            if (iCur > iBest || l < lBest)
+            {
+                iBest = iCur;
+                lBest = l;
+                lpplBest = lpplCand;
+            }
+        }
+        if (rgaiord != NULL && FAiSearchExpired(i))
+        {
+            break;
+        }
+    }
+    return lpplBest;
 }
 
 void FixPlanetsUnderAttack(PROD *rgprod)
@@ -0,0 +1,661 @@
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "types.h"
+#include "globals.h"
+
+#include "aiworld.h"
+#include "habmat.h"
+#include "util.h"
+#include "vcr.h"
+
+#define cbAiWorldHdr (4 + 2 + 2 + 2 + 2 + 2)
+#define cbAiPlmod (2 + 2 + 2 + 2 + 2)
+#define cbAiFlmod (2 + 2 + 2 + 2 + 2 + 2)
+
+#define dAiScanCell 128  /* ly per scanner grid cell */
+#define cAiScanCellMax 64 /* cells per side; dCell grows to fit */
+
+static void PutW(uint8_t *pb, uint16_t w)
+{
+    pb[0] = (uint8_t)w;
+    pb[1] = (uint8_t)(w >> 8);
+}
+
+static void PutL(uint8_t *pb, uint32_t l)
+{
+    PutW(pb, (uint16_t)l);
+    PutW(pb + 2, (uint16_t)(l >> 16));
+}
+
+static uint16_t WGet(const uint8_t *pb)
+{
+    return (uint16_t)(pb[0] | (pb[1] << 8));
+}
+
+static uint32_t LGet(const uint8_t *pb)
+{
+    return (uint32_t)WGet(pb) | ((uint32_t)WGet(pb + 2) << 16);
+}
+
+static int16_t IflmodFind(AIWORLD *pworld, int16_t id, int16_t cfl)
+{
+    int16_t iLo;
+    int16_t iHi;
+    int16_t iMid;
+
+    iLo = 0;
+    iHi = (int16_t)(cfl - 1);
+    while (iLo <= iHi)
+    {
+        iMid = (int16_t)((iLo + iHi) / 2);
+        if (pworld->rgflmod[iMid].id == id)
+        {
+            return iMid;
+        }
+        if (pworld->rgflmod[iMid].id < id)
+        {
+            iLo = (int16_t)(iMid + 1);
+        }
+        else
+        {
+            iHi = (int16_t)(iMid - 1);
+        }
+    }
+    return -1;
+}
+
+static int CompareFlmod(const void *pv1, const void *pv2)
+{
+    return ((const AIFLMOD *)pv1)->id - ((const AIFLMOD *)pv2)->id;
+}
+
+static AIPLMOD *LpplmodFromId(AIWORLD *pworld, int16_t idPlanet)
+{
+    PLANET *lppl;
+
+    if (idPlanet < 0)
+    {
+        return NULL;
+    }
+    lppl = LpplFromId(idPlanet);
+    return lppl != NULL ? LpplmodFromAiWorld(pworld, lppl) : NULL;
+}
+
+static void AddThreat(AIWORLD *pworld, int16_t idPlanet, int32_t dcsh)
+{
+    AIPLMOD *pplmod;
+    int32_t csh;
+
+    pplmod = LpplmodFromId(pworld, idPlanet);
+    if (pplmod == NULL)
+    {
+        return;
+    }
+    csh = (int32_t)pplmod->cshThreat + dcsh;
+    pplmod->cshThreat = (uint16_t)(csh < 0 ? 0 : csh > 0xffff ? 0xffff : csh);
+}
+
+static uint16_t CshFleet(FLEET *lpfl)
+{
+    int32_t csh;
+    int16_t i;
+
+    csh = 0;
+    for (i = 0; i < 16; i++)
+    {
+        csh += lpfl->rgcsh[i];
+    }
+    return (uint16_t)(csh > 0xffff ? 0xffff : csh);
+}
+
+static int16_t FResetAiWorld(AIWORLD *pworld, int16_t iPlayer)
+{
+    int16_t ipl;
+
+    FreeAiWorld(pworld);
+    if (cPlanet > 0)
+    {
+        pworld->rgplmod = (AIPLMOD *)calloc(cPlanet, sizeof(AIPLMOD));
+        if (pworld->rgplmod == NULL)
+        {
+            return 0;
+        }
+    }
+    for (ipl = 0; ipl < cPlanet; ipl++)
+    {
+        pworld->rgplmod[ipl].iPlayer = -2; /* never matches: value on first update */
+    }
+    pworld->iPlayer = iPlayer;
+    pworld->cpl = cPlanet;
+    return 1;
+}
+
+static int16_t FAddAiScan(AIWORLD *pworld, int16_t *pcscan, POINT pt, int16_t dRange)
+{
+    AISCAN *rgscan;
+    int16_t cscanMax;
+
+    if (*pcscan == pworld->cscanMax)
+    {
+        cscanMax = (int16_t)(pworld->cscanMax ? pworld->cscanMax * 2 : 64);
+        rgscan = (AISCAN *)realloc(pworld->rgscan, cscanMax * sizeof(AISCAN));
+        if (rgscan == NULL)
+        {
+            return 0;
+        }
+        pworld->rgscan = rgscan;
+        pworld->cscanMax = cscanMax;
+    }
+    pworld->rgscan[*pcscan].pt = pt;
+    pworld->rgscan[*pcscan].dRange = dRange;
+    pworld->rgscan[*pcscan].d2Range = (int32_t)dRange * dRange;
+    (*pcscan)++;
+    return 1;
+}
+
+/* Every scanner iPlayer has: its planets and its fleets. Returns how many,
+ * or -1 if out of memory. */
+static int16_t CBuildAiScans(AIWORLD *pworld, int16_t iPlayer)
+{
+    PLANET *lppl;
+    FLEET *lpfl;
+    int16_t cscan;
+    int16_t dRange;
+    int16_t dDeep;
+    int16_t dPlanRange;
+    int16_t pctDetect;
+    int16_t iSteal;
+    int16_t i;
+
+    cscan = 0;
+    for (i = 0; i < cPlanet; i++)
+    {
+        lppl = &lpPlanets[i];
+        if (lppl->iPlayer != iPlayer)
+        {
+            continue;
+        }
+        dRange = GetPlanetScannerRange(lppl, &dDeep);
+        if (!FAddAiScan(pworld, &cscan, rgptPlan[lppl->id], dRange > 0 ? dRange : 0))
+        {
+            return -1;
+        }
+    }
+    for (i = 0; i < cFleet; i++)
+    {
+        lpfl = rglpfl[i];
+        if (lpfl == NULL || lpfl->iPlayer != iPlayer || lpfl->fDead)
+        {
+            continue;
+        }
+        dRange = GetFleetScannerRange(lpfl, &dPlanRange, &pctDetect, &iSteal);
+        if (!FAddAiScan(pworld, &cscan, lpfl->pt, dRange > 0 ? dRange : 0))
+        {
+            return -1;
+        }
+    }
+    return cscan;
+}
+
+/* The cells a scanner's range touches, clipped to the grid. */
+static void GetAiScanCells(AISCANGRID *pgrid, AISCAN *pscan, int16_t *pcx0, int16_t *pcx1, int16_t *pcy0, int16_t *pcy1)
+{
+    *pcx0 = (int16_t)((pscan->pt.x - pscan->dRange - pgrid->xMin) / pgrid->dCell);
+    *pcx1 = (int16_t)((pscan->pt.x + pscan->dRange - pgrid->xMin) / pgrid->dCell);
+    *pcy0 = (int16_t)((pscan->pt.y - pscan->dRange - pgrid->yMin) / pgrid->dCell);
+    *pcy1 = (int16_t)((pscan->pt.y + pscan->dRange - pgrid->yMin) / pgrid->dCell);
+}
+
+/* Bucket the cscan scanners by the grid cells their ranges cover. The grid
+ * spans their bounding box, so a fleet outside it is out of sight. */
+static int16_t FBuildAiScanGrid(AIWORLD *pworld, int16_t cscan)
+{
+    AISCANGRID *pgrid;
+    AISCAN *pscan;
+    int32_t *rgiFirst;
+    int16_t *rgiscan;
+    int32_t xMin;
+    int32_t yMin;
+    int32_t xMax;
+    int32_t yMax;
+    int32_t ccell;
+    int32_t ciscan;
+    int32_t icell;
+    int16_t iscan;
+    int16_t cx0;
+    int16_t cx1;
+    int16_t cy0;
+    int16_t cy1;
+    int16_t cx;
+    int16_t cy;
+
+    pgrid = &pworld->grid;
+    pgrid->cx = 0;
+    pgrid->cy = 0;
+    if (cscan == 0)
+    {
+        return 1;
+    }
+
+    xMin = yMin = 0x7fff;
+    xMax = yMax = -0x8000;
+    for (iscan = 0; iscan < cscan; iscan++)
+    {
+        pscan = &pworld->rgscan[iscan];
+        if (pscan->pt.x - pscan->dRange < xMin)
+        {
+            xMin = pscan->pt.x - pscan->dRange;
+        }
+        if (pscan->pt.y - pscan->dRange < yMin)
+        {
+            yMin = pscan->pt.y - pscan->dRange;
+        }
+        if (pscan->pt.x + pscan->dRange > xMax)
+        {
+            xMax = pscan->pt.x + pscan->dRange;
+        }
+        if (pscan->pt.y + pscan->dRange > yMax)
+        {
+            yMax = pscan->pt.y + pscan->dRange;
+        }
+    }
+    pgrid->xMin = (int16_t)xMin;
+    pgrid->yMin = (int16_t)yMin;
+    pgrid->dCell = dAiScanCell;
+    while ((xMax - xMin) / pgrid->dCell >= cAiScanCellMax || (yMax - yMin) / pgrid->dCell >= cAiScanCellMax)
+    {
+        pgrid->dCell = (int16_t)(pgrid->dCell * 2);
+    }
+    pgrid->cx = (int16_t)((xMax - xMin) / pgrid->dCell + 1);
+    pgrid->cy = (int16_t)((yMax - yMin) / pgrid->dCell + 1);
+    ccell = (int32_t)pgrid->cx * pgrid->cy;
+
+    if (ccell + 1 > pgrid->ccellMax)
+    {
+        rgiFirst = (int32_t *)realloc(pgrid->rgiFirst, (ccell + 1) * sizeof(int32_t));
+        if (rgiFirst == NULL)
+        {
+            return 0;
+        }
+        pgrid->rgiFirst = rgiFirst;
+        pgrid->ccellMax = ccell + 1;
+    }
+    memset(pgrid->rgiFirst, 0, (ccell + 1) * sizeof(int32_t));
+
+    /* count, then turn the counts into end offsets */
+    for (iscan = 0; iscan < cscan; iscan++)
+    {
+        GetAiScanCells(pgrid, &pworld->rgscan[iscan], &cx0, &cx1, &cy0, &cy1);
+        for (cy = cy0; cy <= cy1; cy++)
+        {
+            for (cx = cx0; cx <= cx1; cx++)
+            {
+                pgrid->rgiFirst[(int32_t)cy * pgrid->cx + cx]++;
+            }
+        }
+    }
+    ciscan = 0;
+    for (icell = 0; icell < ccell; icell++)
+    {
+        ciscan += pgrid->rgiFirst[icell];
+        pgrid->rgiFirst[icell] = ciscan;
+    }
+    pgrid->rgiFirst[ccell] = ciscan;
+
+    if (ciscan > pgrid->ciscanMax)
+    {
+        rgiscan = (int16_t *)realloc(pgrid->rgiscan, ciscan * sizeof(int16_t));
+        if (rgiscan == NULL)
+        {
+            return 0;
+        }
+        pgrid->rgiscan = rgiscan;
+        pgrid->ciscanMax = ciscan;
+    }
+
+    /* fill back to front, which leaves rgiFirst at the starts */
+    for (iscan = 0; iscan < cscan; iscan++)
+    {
+        GetAiScanCells(pgrid, &pworld->rgscan[iscan], &cx0, &cx1, &cy0, &cy1);
+        for (cy = cy0; cy <= cy1; cy++)
+        {
+            for (cx = cx0; cx <= cx1; cx++)
+            {
+                pgrid->rgiscan[--pgrid->rgiFirst[(int32_t)cy * pgrid->cx + cx]] = iscan;
+            }
+        }
+    }
+    return 1;
+}
+
+/* A fleet in orbit of one of our planets is always seen; anything else
+ * has to be inside one of the scanners covering its cell. */
+static int16_t FAiSeesFleet(AIWORLD *pworld, FLEET *lpfl, int16_t iPlayer)
+{
+    AISCANGRID *pgrid;
+    AISCAN *pscan;
+    PLANET *lppl;
+    int32_t dx;
+    int32_t dy;
+    int32_t icell;
+    int32_t i;
+    int16_t cx;
+    int16_t cy;
+
+    if (lpfl->idPlanet >= 0)
+    {
+        lppl = LpplFromId(lpfl->idPlanet);
+        if (lppl != NULL && lppl->iPlayer == iPlayer)
+        {
+            return 1;
+        }
+    }
+    pgrid = &pworld->grid;
+    if (pgrid->cx == 0 || lpfl->pt.x < pgrid->xMin || lpfl->pt.y < pgrid->yMin)
+    {
+        return 0;
+    }
+    cx = (int16_t)((lpfl->pt.x - pgrid->xMin) / pgrid->dCell);
+    cy = (int16_t)((lpfl->pt.y - pgrid->yMin) / pgrid->dCell);
+    if (cx >= pgrid->cx || cy >= pgrid->cy)
+    {
+        return 0;
+    }
+    icell = (int32_t)cy * pgrid->cx + cx;
+    for (i = pgrid->rgiFirst[icell]; i < pgrid->rgiFirst[icell + 1]; i++)
+    {
+        pscan = &pworld->rgscan[pgrid->rgiscan[i]];
+        dx = lpfl->pt.x - pscan->pt.x;
+        dy = lpfl->pt.y - pscan->pt.y;
+        if (dx * dx + dy * dy <= pscan->d2Range)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Bring the model up to the current turn. Returns how many planet and
+ * fleet entries changed, or -1 if out of memory. */
+int16_t UpdateAiWorld(AIWORLD *pworld, int16_t iPlayer)
+{
+    PLANET *lppl;
+    AIPLMOD *pplmod;
+    FLEET *lpfl;
+    AIFLMOD *pflmod;
+    AIFLMOD *rgflmod;
+    HB *lphb;
+    BTLDATA *lpbd;
+    int16_t cChg;
+    int16_t cflOld;
+    int16_t cscan;
+    int16_t ifl;
+    int16_t iflWrite;
+    int16_t ipl;
+    int16_t i;
+    uint16_t csh;
+
+    if (pworld->rgplmod == NULL || pworld->cpl != cPlanet || pworld->iPlayer != iPlayer)
+    {
+        if (!FResetAiWorld(pworld, iPlayer))
+        {
+            return -1;
+        }
+    }
+    cChg = 0;
+
+    for (ipl = 0; ipl < cPlanet; ipl++)
+    {
+        lppl = &lpPlanets[ipl];
+        pplmod = &pworld->rgplmod[ipl];
+        if (pplmod->turn != lppl->turn || pplmod->iPlayer != lppl->iPlayer)
+        {
+            pplmod->iPlayer = lppl->iPlayer;
+            pplmod->turn = lppl->turn;
+            pplmod->pctValue = PctHabFromCache(lppl, iPlayer);
+            cChg++;
+        }
+    }
+
+    cscan = CBuildAiScans(pworld, iPlayer);
+    if (cscan < 0 || !FBuildAiScanGrid(pworld, cscan))
+    {
+        return -1;
+    }
+    cflOld = pworld->cfl;
+    for (ifl = 0; ifl < cflOld; ifl++)
+    {
+        pworld->rgflmod[ifl].fSeen = 0;
+    }
+    for (i = 0; i < cFleet; i++)
+    {
+        lpfl = rglpfl[i];
+        if (lpfl == NULL || lpfl->iPlayer == iPlayer || lpfl->fDead || !FAiSeesFleet(pworld, lpfl, iPlayer))
+        {
+            continue;
+        }
+        csh = CshFleet(lpfl);
+        ifl = IflmodFind(pworld, lpfl->id, cflOld);
+        if (ifl < 0)
+        {
+            if (pworld->cfl == pworld->cflMax)
+            {
+                int16_t cflMax = (int16_t)(pworld->cflMax ? pworld->cflMax * 2 : 64);
+
+                rgflmod = (AIFLMOD *)realloc(pworld->rgflmod, cflMax * sizeof(AIFLMOD));
+                if (rgflmod == NULL)
+                {
+                    return -1;
+                }
+                pworld->rgflmod = rgflmod;
+                pworld->cflMax = cflMax;
+            }
+            pflmod = &pworld->rgflmod[pworld->cfl++];
+            pflmod->id = lpfl->id;
+            pflmod->idPlanet = lpfl->idPlanet;
+            pflmod->pt = lpfl->pt;
+            pflmod->csh = csh;
+            AddThreat(pworld, lpfl->idPlanet, csh);
+            cChg++;
+        }
+        else
+        {
+            pflmod = &pworld->rgflmod[ifl];
+            if (pflmod->idPlanet != lpfl->idPlanet || pflmod->csh != csh || pflmod->pt.x != lpfl->pt.x ||
+                pflmod->pt.y != lpfl->pt.y)
+            {
+                AddThreat(pworld, pflmod->idPlanet, -(int32_t)pflmod->csh);
+                AddThreat(pworld, lpfl->idPlanet, csh);
+                pflmod->idPlanet = lpfl->idPlanet;
+                pflmod->pt = lpfl->pt;
+                pflmod->csh = csh;
+                cChg++;
+            }
+        }
+        pflmod->turnSeen = game.turn;
+        pflmod->fSeen = 1;
+    }
+
+    /* Drop the fleets we no longer see, threat and all; new ones were
+     * appended unsorted. */
+    iflWrite = 0;
+    for (ifl = 0; ifl < pworld->cfl; ifl++)
+    {
+        pflmod = &pworld->rgflmod[ifl];
+        if (!pflmod->fSeen)
+        {
+            AddThreat(pworld, pflmod->idPlanet, -(int32_t)pflmod->csh);
+            cChg++;
+            continue;
+        }
+        if (iflWrite != ifl)
+        {
+            pworld->rgflmod[iflWrite] = *pflmod;
+        }
+        iflWrite++;
+    }
+    if (pworld->cfl != cflOld || iflWrite != pworld->cfl)
+    {
+        pworld->cfl = iflWrite;
+        qsort(pworld->rgflmod, pworld->cfl, sizeof(AIFLMOD), CompareFlmod);
+    }
+
+    lphb = NULL;
+    for (lpbd = LpbdNextBattle(&lphb, NULL); lpbd != NULL; lpbd = LpbdNextBattle(&lphb, lpbd))
+    {
+        if (lpbd->idPlanet == 0xffff)
+        {
+            continue;
+        }
+        pplmod = LpplmodFromId(pworld, (int16_t)lpbd->idPlanet);
+        if (pplmod != NULL && pplmod->turnAttacked != game.turn)
+        {
+            pplmod->turnAttacked = game.turn;
+            cChg++;
+        }
+    }
+
+    pworld->turn = game.turn;
+    return cChg;
+}
+
+void FreeAiWorld(AIWORLD *pworld)
+{
+    free(pworld->rgplmod);
+    free(pworld->rgflmod);
+    free(pworld->rgscan);
+    free(pworld->grid.rgiFirst);
+    free(pworld->grid.rgiscan);
+    memset(pworld, 0, sizeof(AIWORLD));
+}
+
+AIPLMOD *LpplmodFromAiWorld(AIWORLD *pworld, PLANET *lppl)
+{
+    int32_t ipl;
+
+    ipl = lppl - lpPlanets;
+    if (pworld->rgplmod == NULL || ipl < 0 || ipl >= pworld->cpl)
+    {
+        return NULL;
+    }
+    return &pworld->rgplmod[ipl];
+}
+
+AIFLMOD *LpflmodFromAiWorld(AIWORLD *pworld, int16_t idFleet)
+{
+    int16_t ifl;
+
+    ifl = IflmodFind(pworld, idFleet, pworld->cfl);
+    return ifl < 0 ? NULL : &pworld->rgflmod[ifl];
+}
+
+/* Header (cb, version, iPlayer, turn, cpl, cfl) followed by the planet and
+ * fleet tables, every field little-endian. The fSeen scratch is not kept.
+ * With pb == NULL just returns the size. */
+uint32_t CbPackAiWorld(AIWORLD *pworld, uint8_t *pb, uint32_t cbMax)
+{
+    AIPLMOD *pplmod;
+    AIFLMOD *pflmod;
+    uint32_t cb;
+    int16_t i;
+
+    cb = cbAiWorldHdr + (uint32_t)pworld->cpl * cbAiPlmod + (uint32_t)pworld->cfl * cbAiFlmod;
+    pworld->cbAiWorld = cb;
+    if (pb == NULL)
+    {
+        return cb;
+    }
+    if (cb > cbMax)
+    {
+        return 0;
+    }
+    PutL(pb, cb);
+    PutW(pb + 4, wAiWorldVersion);
+    PutW(pb + 6, (uint16_t)pworld->iPlayer);
+    PutW(pb + 8, pworld->turn);
+    PutW(pb + 10, (uint16_t)pworld->cpl);
+    PutW(pb + 12, (uint16_t)pworld->cfl);
+    pb += cbAiWorldHdr;
+    for (i = 0; i < pworld->cpl; i++, pb += cbAiPlmod)
+    {
+        pplmod = &pworld->rgplmod[i];
+        PutW(pb, (uint16_t)pplmod->iPlayer);
+        PutW(pb + 2, (uint16_t)pplmod->turn);
+        PutW(pb + 4, (uint16_t)pplmod->pctValue);
+        PutW(pb + 6, pplmod->cshThreat);
+        PutW(pb + 8, pplmod->turnAttacked);
+    }
+    for (i = 0; i < pworld->cfl; i++, pb += cbAiFlmod)
+    {
+        pflmod = &pworld->rgflmod[i];
+        PutW(pb, (uint16_t)pflmod->id);
+        PutW(pb + 2, (uint16_t)pflmod->idPlanet);
+        PutW(pb + 4, (uint16_t)pflmod->pt.x);
+        PutW(pb + 6, (uint16_t)pflmod->pt.y);
+        PutW(pb + 8, pflmod->csh);
+        PutW(pb + 10, pflmod->turnSeen);
+    }
+    return cb;
+}
+
+int16_t FUnpackAiWorld(AIWORLD *pworld, const uint8_t *pb, uint32_t cb)
+{
+    AIPLMOD *pplmod;
+    AIFLMOD *pflmod;
+    uint32_t cbRec;
+    int16_t cpl;
+    int16_t cfl;
+    int16_t i;
+
+    if (cb < cbAiWorldHdr)
+    {
+        return 0;
+    }
+    cbRec = LGet(pb);
+    cpl = (int16_t)WGet(pb + 10);
+    cfl = (int16_t)WGet(pb + 12);
+    if (WGet(pb + 4) != wAiWorldVersion || cpl < 0 || cfl < 0 || cbRec > cb ||
+        cbRec != cbAiWorldHdr + (uint32_t)cpl * cbAiPlmod + (uint32_t)cfl * cbAiFlmod)
+    {
+        return 0;
+    }
+
+    FreeAiWorld(pworld);
+    pworld->rgplmod = (AIPLMOD *)malloc(cpl * sizeof(AIPLMOD) + 1);
+    pworld->rgflmod = (AIFLMOD *)malloc(cfl * sizeof(AIFLMOD) + 1);
+    if (pworld->rgplmod == NULL || pworld->rgflmod == NULL)
+    {
+        FreeAiWorld(pworld);
+        return 0;
+    }
+    pworld->cbAiWorld = cbRec;
+    pworld->iPlayer = (int16_t)WGet(pb + 6);
+    pworld->turn = WGet(pb + 8);
+    pworld->cpl = cpl;
+    pworld->cfl = cfl;
+    pworld->cflMax = cfl;
+    pb += cbAiWorldHdr;
+    for (i = 0; i < cpl; i++, pb += cbAiPlmod)
+    {
+        pplmod = &pworld->rgplmod[i];
+        pplmod->iPlayer = (int16_t)WGet(pb);
+        pplmod->turn = (int16_t)WGet(pb + 2);
+        pplmod->pctValue = (int16_t)WGet(pb + 4);
+        pplmod->cshThreat = WGet(pb + 6);
+        pplmod->turnAttacked = WGet(pb + 8);
+    }
+    for (i = 0; i < cfl; i++, pb += cbAiFlmod)
+    {
+        pflmod = &pworld->rgflmod[i];
+        memset(pflmod, 0, sizeof(AIFLMOD));
+        pflmod->id = (int16_t)WGet(pb);
+        pflmod->idPlanet = (int16_t)WGet(pb + 2);
+        pflmod->pt.x = (int16_t)WGet(pb + 4);
+        pflmod->pt.y = (int16_t)WGet(pb + 6);
+        pflmod->csh = WGet(pb + 8);
+        pflmod->turnSeen = WGet(pb + 10);
+    }
+    return 1;
+}
@@ -0,0 +1,101 @@
+#ifndef AIWORLD_H_
+#define AIWORLD_H_
+
+#include "types.h"
+
+/*
+ * Persistent per-AI world model.
+ *
+ * InitRandomPlanetList, MarkPlanetsUnderAttack, FEnumCalcEnemyPlanets and
+ * friends rebuild their picture of the galaxy every turn. AIWORLD keeps that
+ * picture between turns and UpdateAiWorld only touches what changed:
+ *
+ *   planets  re-valued (PctHabFromCache) when PLANET.turn or the owner
+ *            moved since the entry was built
+ *   fleets   enemy fleets the AI can see, kept sorted by id; one that
+ *            moved or lost ships shifts its threat from the old planet to
+ *            the new one, one that vanished or left its scanners takes its
+ *            threat with it
+ *   battles  every battle at a planet stamps turnAttacked
+ *
+ * A fleet is in view when it orbits one of the AI's planets or lies
+ * within the scanner range (GetPlanetScannerRange, GetFleetScannerRange)
+ * of one of the AI's planets or fleets. Cloaking is not modelled. The
+ * scanners are bucketed into a coarse grid first, so each fleet is only
+ * tested against the scanners whose range covers its cell.
+ *
+ * Like AIHIST the model packs into a single length-prefixed record, written
+ * field by field in little-endian order. FWriteAiWorlds keeps every computer
+ * player's record in szBase.ai between host runs and FReadAiWorlds brings
+ * them back; that file is ours, not a Stars! format.
+ */
+
+#define wAiWorldVersion 2
+
+typedef struct _aiplmod
+{
+    int16_t iPlayer;       /* owner when last valued, -1 if none */
+    int16_t turn;          /* PLANET.turn the entry was built from */
+    int16_t pctValue;      /* PctPlanetDesirability for this AI */
+    uint16_t cshThreat;    /* enemy ships in orbit */
+    uint16_t turnAttacked; /* game turn of the last battle here, 0 if never */
+} AIPLMOD;
+
+typedef struct _aiflmod
+{
+    int16_t id;       /* FLEET.id */
+    int16_t idPlanet; /* orbiting, -1 in deep space */
+    POINT pt;
+    uint16_t csh;
+    uint16_t turnSeen;
+    uint8_t fSeen; /* scratch for UpdateAiWorld */
+    uint8_t unused;
+} AIFLMOD;
+
+/* One of the AI's scanners, for UpdateAiWorld. */
+typedef struct _aiscan
+{
+    POINT pt;
+    int16_t dRange;
+    int32_t d2Range;
+} AISCAN;
+
+/* The scanners by cell: cell i's are rgiscan[rgiFirst[i]] up to
+ * rgiFirst[i + 1]. Scratch, rebuilt by every update. */
+typedef struct _aiscangrid
+{
+    int16_t xMin;
+    int16_t yMin;
+    int16_t dCell;
+    int16_t cx;
+    int16_t cy;
+    int32_t ccellMax;
+    int32_t *rgiFirst;
+    int32_t ciscanMax;
+    int16_t *rgiscan;
+} AISCANGRID;
+
+typedef struct _aiworld
+{
+    uint32_t cbAiWorld; /* packed size, see CbPackAiWorld */
+    int16_t iPlayer;
+    uint16_t turn;      /* game.turn the model is current for */
+    int16_t cpl;
+    int16_t cfl;
+    int16_t cflMax;
+    AIPLMOD *rgplmod;   /* parallel to lpPlanets */
+    AIFLMOD *rgflmod;   /* sorted by id */
+    int16_t cscanMax;   /* scratch, not packed */
+    AISCAN *rgscan;
+    AISCANGRID grid;
+} AIWORLD;
+
+/* functions */
+int16_t UpdateAiWorld(AIWORLD *pworld, int16_t iPlayer);
+void FreeAiWorld(AIWORLD *pworld);
+AIPLMOD *LpplmodFromAiWorld(AIWORLD *pworld, PLANET *lppl);
+AIFLMOD *LpflmodFromAiWorld(AIWORLD *pworld, int16_t idFleet);
+uint32_t CbPackAiWorld(AIWORLD *pworld, uint8_t *pb, uint32_t cbMax);
+int16_t FUnpackAiWorld(AIWORLD *pworld, const uint8_t *pb, uint32_t cb);
+
+#endif /* AIWORLD_H_ */
@@ -2,6 +2,7 @@
 #include "types.h"
 
 #include "battle.h"
+#include "econsnap.h"
 
 #define BrcFromXY(x, y) ((uint8_t)((((y) & 0x0F) << 4) | ((x) & 0x0F)))
 
@@ -534,6 +535,9 @@ void DoBombing(void)
     /* label GenericBombMsg @ MEMORY_BATTLE:0xbac4 */
 
     /* TODO: implement */
+
+    /* bombs kill colonists and can empty a planet */
+    InvalidateEconTable(&vecon);
 }
 
 void InitializeBoard(FLEET *lpfl, int16_t ibrc, uint16_t grfPlayer, uint8_t *pinit, int16_t *pinitMin, int16_t *pinitMac)
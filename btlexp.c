@@ -0,0 +1,221 @@
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "types.h"
+
+#include "btlexp.h"
+#include "utilgen.h"
+
+#define cbBattleMax 0x10000 /* BTLDATA.cbData is 16 bits */
+
+static uint16_t WGet(const uint8_t *pb)
+{
+    return (uint16_t)(pb[0] | (pb[1] << 8));
+}
+
+static uint32_t LGet(const uint8_t *pb)
+{
+    return (uint32_t)pb[0] | ((uint32_t)pb[1] << 8) | ((uint32_t)pb[2] << 16) | ((uint32_t)pb[3] << 24);
+}
+
+/* Emit one battle (header line plus one line per BTLREC) from the on-disk
+ * bytes. Returns the number of actions written, or -1 if the blob is short
+ * or a record runs past cbData. */
+int32_t CWriteBattleNdjson(FILE *pfOut, const uint8_t *pb, uint16_t cb, int32_t iBattle, int16_t turn, int16_t iPlayer)
+{
+    const uint8_t *pbTok;
+    const uint8_t *pbRec;
+    const uint8_t *pbMac;
+    const uint8_t *pbKill;
+    uint8_t ctok;
+    uint16_t idPlanet;
+    int16_t ctokRec;
+    uint16_t wRound;
+    uint8_t itok;
+    int32_t cAction;
+    int32_t cKill;
+    int32_t dpShield;
+    int16_t i;
+
+    if (cb < cbBtlDataDisk)
+    {
+        return -1;
+    }
+    ctok = pb[3];
+    if (WGet(pb + 6) > cb || cbBtlDataDisk + ctok * cbTokDisk > WGet(pb + 6))
+    {
+        return -1;
+    }
+    pbTok = pb + cbBtlDataDisk;
+    pbMac = pb + WGet(pb + 6);
+
+    idPlanet = WGet(pb + 8);
+    fprintf(pfOut, "{\"type\":\"battle\",\"turn\":%d,\"player\":%d,\"battle\":%ld,\"id\":%u,\"planet\":%d,"
+                   "\"x\":%d,\"y\":%d,\"players\":%u,\"tokens\":[",
+            turn, iPlayer, (long)iBattle, WGet(pb), idPlanet == 0xffff ? -1 : (int)idPlanet,
+            (int16_t)WGet(pb + 10), (int16_t)WGet(pb + 12), WGet(pb + 4));
+    for (i = 0; i < ctok; i++)
+    {
+        const uint8_t *pt = pbTok + i * cbTokDisk;
+        fprintf(pfOut, "%s{\"itok\":%d,\"owner\":%u,\"id\":%u,\"design\":%u,\"ships\":%u}",
+                i ? "," : "", i, pt[2], WGet(pt), pt[4], WGet(pt + 0x13));
+    }
+    fputs("]}\n", pfOut);
+
+    cAction = 0;
+    pbRec = pbTok + ctok * cbTokDisk;
+    while (pbRec + cbBtlRecDisk <= pbMac)
+    {
+        ctokRec = (int16_t)WGet(pbRec + 2);
+        if (ctokRec < 0 || pbRec + cbBtlRecDisk + ctokRec * cbKillDisk > pbMac)
+        {
+            return -1;
+        }
+        wRound = WGet(pbRec + 4);
+        itok = pbRec[0];
+
+        cKill = 0;
+        dpShield = 0;
+        for (i = 0; i < ctokRec; i++)
+        {
+            pbKill = pbRec + cbBtlRecDisk + i * cbKillDisk;
+            cKill += WGet(pbKill + 2);
+            dpShield += WGet(pbKill + 4);
+        }
+
+        fprintf(pfOut, "{\"type\":\"action\",\"battle\":%ld,\"round\":%u,\"attacker\":{\"itok\":%u",
+                (long)iBattle, wRound & 0x0f, itok);
+        if (itok < ctok)
+        {
+            fprintf(pfOut, ",\"owner\":%u,\"id\":%u", pbTok[itok * cbTokDisk + 2], WGet(pbTok + itok * cbTokDisk));
+        }
+        fprintf(pfOut, "},\"move\":%u,\"dz\":%u,\"target\":%u,\"kills\":%ld,\"shield_damage\":%ld,\"hits\":[",
+                pbRec[1], (wRound >> 4) & 0x0f, wRound >> 8, (long)cKill, (long)dpShield);
+        for (i = 0; i < ctokRec; i++)
+        {
+            pbKill = pbRec + cbBtlRecDisk + i * cbKillDisk;
+            fprintf(pfOut, "%s{\"itok\":%u", i ? "," : "", pbKill[0]);
+            if (pbKill[0] < ctok)
+            {
+                fprintf(pfOut, ",\"owner\":%u", pbTok[pbKill[0] * cbTokDisk + 2]);
+            }
+            fprintf(pfOut, ",\"weapon\":%u,\"kills\":%u,\"shield\":%u,\"dv\":%u}",
+                    pbKill[1], WGet(pbKill + 2), WGet(pbKill + 4), WGet(pbKill + 6));
+        }
+        fputs("]}\n", pfOut);
+
+        cAction++;
+        pbRec += cbBtlRecDisk + ctokRec * cbKillDisk;
+    }
+    return cAction;
+}
+
+/* Walk a turn file record by record (same framing and decryption as ReadRt)
+ * and export every battle. Battles are reassembled from rtBtlData plus its
+ * rtBtlCont records into a single cbBattleMax buffer and written as soon as
+ * cbData bytes are in. Returns the number of battles, or -1 if the file is
+ * not a Stars! file or a battle is malformed. */
+int32_t CExportBattlesNdjson(FILE *pfIn, FILE *pfOut)
+{
+    uint32_t rglRt[1024 / 4]; /* XorFileBuf works a dword at a time */
+    uint8_t *rgbRt = (uint8_t *)rglRt;
+    uint8_t *rgbBattle;
+    uint8_t rgbHdr[2];
+    uint16_t cb;
+    uint16_t rt;
+    uint32_t ibBattle;
+    uint32_t cbBattle;
+    int32_t cBattle;
+    int16_t turn;
+    int16_t iPlayer;
+    int16_t fBof;
+
+    rgbBattle = (uint8_t *)malloc(cbBattleMax);
+    if (rgbBattle == NULL)
+    {
+        return -1;
+    }
+
+    cBattle = 0;
+    ibBattle = 0;
+    cbBattle = 0;
+    turn = 0;
+    iPlayer = 0;
+    fBof = 0;
+    while (fread(rgbHdr, 1, 2, pfIn) == 2)
+    {
+        cb = (uint16_t)(WGet(rgbHdr) & 0x3ff);
+        rt = (uint16_t)(WGet(rgbHdr) >> 10);
+        if (cb != 0 && fread(rgbRt, 1, cb, pfIn) != cb)
+        {
+            goto LBadFile;
+        }
+
+        if (rt == 8)
+        {
+            /* same version gate as FOpenFile: 2.49 .. 2.83 */
+            if (cb < 16 || (WGet(rgbRt + 8) >> 12) != 2 || ((WGet(rgbRt + 8) >> 5) & 0x7f) <= 0x30 ||
+                ((WGet(rgbRt + 8) >> 5) & 0x7f) >= 0x54)
+            {
+                goto LBadFile;
+            }
+            /* RTBOF: lidGame, wVersion, turn, iPlayer:5 lSaltTime:11, ... fCrippled:1 */
+            turn = (int16_t)WGet(rgbRt + 10);
+            iPlayer = (int16_t)(WGet(rgbRt + 12) & 0x1f);
+            SetFileXorStream((int32_t)LGet(rgbRt + 4), (int16_t)(WGet(rgbRt + 12) >> 5), turn, iPlayer,
+                             (int16_t)((WGet(rgbRt + 14) >> 12) & 1));
+            fBof = 1;
+            continue;
+        }
+        if (!fBof)
+        {
+            goto LBadFile;
+        }
+        if (rt == 0)
+        {
+            break;
+        }
+        XorFileBuf(rgbRt, (int16_t)cb);
+
+        if (rt == rtBtlData)
+        {
+            if (cbBattle != 0 || cb < cbBtlDataDisk)
+            {
+                goto LBadFile;
+            }
+            cbBattle = WGet(rgbRt + 6);
+            ibBattle = 0;
+        }
+        else if (rt != rtBtlCont)
+        {
+            continue;
+        }
+        if (cbBattle == 0 || ibBattle + cb > cbBattle)
+        {
+            goto LBadFile;
+        }
+        memcpy(rgbBattle + ibBattle, rgbRt, cb);
+        ibBattle += cb;
+        if (ibBattle == cbBattle)
+        {
+            if (CWriteBattleNdjson(pfOut, rgbBattle, (uint16_t)cbBattle, cBattle, turn, iPlayer) < 0)
+            {
+                goto LBadFile;
+            }
+            cBattle++;
+            cbBattle = 0;
+        }
+    }
+    if (cbBattle != 0)
+    {
+        goto LBadFile;
+    }
+
+    free(rgbBattle);
+    return cBattle;
+
+LBadFile:
+    free(rgbBattle);
+    return -1;
+}
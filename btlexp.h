@@ -0,0 +1,37 @@
+#ifndef BTLEXP_H_
+#define BTLEXP_H_
+
+#include <stdio.h>
+
+#include "types.h"
+
+/*
+ * Headless battle report exporter.
+ *
+ * Reads the battle records WriteBattles puts in a turn file (.m) and writes
+ * one NDJSON line per battle and per action. Works on the on-disk layout
+ * (TOK is 0x1d bytes, BTLDATA header 0xe), not the native structs, so it
+ * needs nothing but the file. Memory use is one battle buffer regardless of
+ * how many battles the turn holds.
+ *
+ *   {"type":"battle","turn":..,"player":..,"battle":..,"id":..,"planet":..,
+ *    "x":..,"y":..,"players":..,"tokens":[{"itok":..,"owner":..,"id":..,
+ *    "design":..,"ships":..}]}
+ *   {"type":"action","battle":..,"round":..,"attacker":{"itok":..,"owner":..,
+ *    "id":..},"move":..,"target":..,"kills":..,"shield_damage":..,
+ *    "hits":[{"itok":..,"owner":..,"weapon":..,"kills":..,"shield":..,"dv":..}]}
+ */
+
+#define rtBtlData 0x1f /* BTLDATA + TOKs, first record of a battle */
+#define rtBtlCont 0x27 /* continuation: more TOKs and BTLRECs */
+
+#define cbBtlDataDisk 0x0e
+#define cbTokDisk 0x1d
+#define cbBtlRecDisk 0x06
+#define cbKillDisk 0x08
+
+/* functions */
+int32_t CExportBattlesNdjson(FILE *pfIn, FILE *pfOut);
+int32_t CWriteBattleNdjson(FILE *pfOut, const uint8_t *pb, uint16_t cb, int32_t iBattle, int16_t turn, int16_t iPlayer);
+
+#endif /* BTLEXP_H_ */
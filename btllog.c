@@ -0,0 +1,307 @@
+
+#include "types.h"
+
+#include "btllog.h"
+#include "vcr.h"
+
+/* globals */
+BTLLOG vbtllog = {0};
+
+#define CbBtlHdr(lpbd) ((uint16_t)(sizeof(BTLDATA) + (lpbd)->ctok * sizeof(TOK)))
+#define CbBtlRec(lpbr) ((uint16_t)(sizeof(BTLREC) + (lpbr)->ctok * sizeof(KILL)))
+
+/* Count the action records of one battle, or -1 if they overrun cbData. */
+static int16_t CbrFromLpbd(BTLDATA *lpbd, uint8_t *pcRound)
+{
+    uint8_t *lpb;
+    uint8_t *lpbMac;
+    BTLREC *lpbr;
+    int16_t cbr;
+    uint8_t cRound;
+
+    lpb = (uint8_t *)lpbd + CbBtlHdr(lpbd);
+    lpbMac = (uint8_t *)lpbd + lpbd->cbData;
+    cbr = 0;
+    cRound = 0;
+    while (lpb + sizeof(BTLREC) <= lpbMac)
+    {
+        lpbr = (BTLREC *)lpb;
+        if (lpbr->ctok < 0 || lpb + CbBtlRec(lpbr) > lpbMac)
+        {
+            return -1;
+        }
+        if (lpbr->iRound + 1 > cRound)
+        {
+            cRound = (uint8_t)(lpbr->iRound + 1);
+        }
+        cbr++;
+        lpb += CbBtlRec(lpbr);
+    }
+    *pcRound = cRound;
+    return cbr;
+}
+
+static int CompareBtlMap(const void *pv1, const void *pv2)
+{
+    uintptr_t u1 = (uintptr_t)((const BTLMAP *)pv1)->lpbd;
+    uintptr_t u2 = (uintptr_t)((const BTLMAP *)pv2)->lpbd;
+
+    return (u1 > u2) - (u1 < u2);
+}
+
+static void ApplyBtlRec(BTLTOKST *rgtokst, int16_t ctok, BTLREC *lpbr)
+{
+    int16_t i;
+    KILL *lpkill;
+    BTLTOKST *ptokst;
+
+    for (i = 0; i < lpbr->ctok; i++)
+    {
+        lpkill = &lpbr->rgkill[i];
+        if (lpkill->itok >= ctok)
+        {
+            continue;
+        }
+        ptokst = &rgtokst[lpkill->itok];
+        ptokst->csh = (lpkill->cshKill >= ptokst->csh) ? 0 : (uint16_t)(ptokst->csh - lpkill->cshKill);
+        ptokst->dv = lpkill->dv;
+        ptokst->dpShield += lpkill->dpShield;
+    }
+}
+
+/* Fill one BTLENT: record offsets, round starts and the token state at the
+ * start of every round (row cRound is the state after the battle). */
+static void IndexBattle(BTLLOG *plog, BTLENT *pent)
+{
+    BTLDATA *lpbd;
+    BTLREC *lpbr;
+    BTLTOKST *rgtokst;
+    uint8_t *lpb;
+    int16_t ibr;
+    int16_t itok;
+    int16_t iRound;
+    int16_t iRoundCur;
+
+    lpbd = pent->lpbd;
+    rgtokst = &plog->rgtokst[pent->itokstFirst];
+    for (itok = 0; itok < lpbd->ctok; itok++)
+    {
+        rgtokst[itok].csh = lpbd->rgtok[itok].csh;
+        rgtokst[itok].dv = lpbd->rgtok[itok].dv;
+        rgtokst[itok].dpShield = 0;
+    }
+
+    lpb = (uint8_t *)lpbd + CbBtlHdr(lpbd);
+    iRoundCur = 0;
+    pent->rgibrRound[0] = 0;
+    if (pent->cRound > 0)
+    {
+        /* row r + 1 accumulates round r's damage */
+        memcpy(rgtokst + lpbd->ctok, rgtokst, lpbd->ctok * sizeof(BTLTOKST));
+        rgtokst += lpbd->ctok;
+    }
+    for (ibr = 0; ibr < pent->cbr; ibr++)
+    {
+        lpbr = (BTLREC *)lpb;
+        plog->rgibBr[pent->iibFirst + ibr] = (uint16_t)(lpb - (uint8_t *)lpbd);
+
+        /* close out every round we stepped past */
+        while (iRoundCur < lpbr->iRound)
+        {
+            memcpy(rgtokst + lpbd->ctok, rgtokst, lpbd->ctok * sizeof(BTLTOKST));
+            rgtokst += lpbd->ctok;
+            pent->rgibrRound[++iRoundCur] = (uint16_t)ibr;
+        }
+        ApplyBtlRec(rgtokst, lpbd->ctok, lpbr);
+        lpb += CbBtlRec(lpbr);
+    }
+    for (iRound = (int16_t)(iRoundCur + 1); iRound <= cBtlRoundMax; iRound++)
+    {
+        pent->rgibrRound[iRound] = pent->cbr;
+    }
+}
+
+int16_t FBuildBtlLog(BTLLOG *plog)
+{
+    HB *lphb;
+    BTLDATA *lpbd;
+    BTLENT *pent;
+    int16_t cBattle;
+    int16_t cbr;
+    uint8_t cRound;
+    uint32_t cbrTot;
+    uint32_t ctokstTot;
+
+    memset(plog, 0, sizeof(BTLLOG));
+
+    /* pass 1: size the tables */
+    cBattle = 0;
+    cbrTot = 0;
+    ctokstTot = 0;
+    lphb = NULL;
+    for (lpbd = LpbdNextBattle(&lphb, NULL); lpbd != NULL; lpbd = LpbdNextBattle(&lphb, lpbd))
+    {
+        if (CbBtlHdr(lpbd) > lpbd->cbData || (cbr = CbrFromLpbd(lpbd, &cRound)) < 0)
+        {
+            return false;
+        }
+        cBattle++;
+        cbrTot += (uint32_t)cbr;
+        ctokstTot += (uint32_t)(cRound + 1) * lpbd->ctok;
+    }
+
+    plog->rgent = (BTLENT *)calloc(cBattle > 0 ? cBattle : 1, sizeof(BTLENT));
+    plog->rgibBr = (uint16_t *)malloc((cbrTot > 0 ? cbrTot : 1) * sizeof(uint16_t));
+    plog->rgtokst = (BTLTOKST *)malloc((ctokstTot > 0 ? ctokstTot : 1) * sizeof(BTLTOKST));
+    plog->rgmap = (BTLMAP *)malloc((cBattle > 0 ? cBattle : 1) * sizeof(BTLMAP));
+    if (plog->rgent == NULL || plog->rgibBr == NULL || plog->rgtokst == NULL || plog->rgmap == NULL)
+    {
+        FreeBtlLog(plog);
+        return false;
+    }
+
+    /* pass 2: fill them */
+    cbrTot = 0;
+    ctokstTot = 0;
+    lphb = NULL;
+    pent = plog->rgent;
+    for (lpbd = LpbdNextBattle(&lphb, NULL); lpbd != NULL; lpbd = LpbdNextBattle(&lphb, lpbd), pent++)
+    {
+        pent->lpbd = lpbd;
+        plog->rgmap[pent - plog->rgent].lpbd = lpbd;
+        plog->rgmap[pent - plog->rgent].iBattle = (int16_t)(pent - plog->rgent);
+        pent->cbr = (uint16_t)CbrFromLpbd(lpbd, &pent->cRound);
+        pent->iibFirst = cbrTot;
+        pent->itokstFirst = ctokstTot;
+        IndexBattle(plog, pent);
+        cbrTot += pent->cbr;
+        ctokstTot += (uint32_t)(pent->cRound + 1) * lpbd->ctok;
+    }
+    /* heap blocks are not in address order, so sort the reverse map */
+    qsort(plog->rgmap, (size_t)cBattle, sizeof(BTLMAP), CompareBtlMap);
+    plog->cBattle = cBattle;
+    plog->fValid = true;
+    return true;
+}
+
+/* Make vbtllog describe the htBattle heap. */
+int16_t FSyncBtlLog(void)
+{
+    if (vbtllog.fValid)
+    {
+        return true;
+    }
+    return FBuildBtlLog(&vbtllog);
+}
+
+void InvalidateBtlLog(void)
+{
+    FreeBtlLog(&vbtllog);
+}
+
+/* Which battle lpbd is, or -1. Binary search over rgmap, which is kept
+ * sorted by address. */
+int16_t IBattleFromBtlLog(BTLLOG *plog, BTLDATA *lpbd)
+{
+    int16_t iLo;
+    int16_t iHi;
+    int16_t iMid;
+    uintptr_t u;
+    uintptr_t uMid;
+
+    u = (uintptr_t)lpbd;
+    iLo = 0;
+    iHi = (int16_t)(plog->cBattle - 1);
+    while (iLo <= iHi)
+    {
+        iMid = (int16_t)((iLo + iHi) / 2);
+        uMid = (uintptr_t)plog->rgmap[iMid].lpbd;
+        if (uMid == u)
+        {
+            return plog->rgmap[iMid].iBattle;
+        }
+        if (uMid < u)
+        {
+            iLo = (int16_t)(iMid + 1);
+        }
+        else
+        {
+            iHi = (int16_t)(iMid - 1);
+        }
+    }
+    return -1;
+}
+
+void FreeBtlLog(BTLLOG *plog)
+{
+    free(plog->rgent);
+    free(plog->rgibBr);
+    free(plog->rgtokst);
+    free(plog->rgmap);
+    memset(plog, 0, sizeof(BTLLOG));
+}
+
+BTLDATA *LpbdFromBtlLog(BTLLOG *plog, int16_t iBattle)
+{
+    if (iBattle < 0 || iBattle >= plog->cBattle)
+    {
+        return NULL;
+    }
+    return plog->rgent[iBattle].lpbd;
+}
+
+BTLREC *LpbrFromBtlLog(BTLLOG *plog, int16_t iBattle, int16_t ibr)
+{
+    BTLENT *pent;
+
+    if (iBattle < 0 || iBattle >= plog->cBattle)
+    {
+        return NULL;
+    }
+    pent = &plog->rgent[iBattle];
+    if (ibr < 0 || ibr >= pent->cbr)
+    {
+        return NULL;
+    }
+    return (BTLREC *)((uint8_t *)pent->lpbd + plog->rgibBr[pent->iibFirst + ibr]);
+}
+
+/* First record of iRound; cbr if the battle is over by then. */
+int16_t IbrFromBtlLogRound(BTLLOG *plog, int16_t iBattle, int16_t iRound)
+{
+    if (iBattle < 0 || iBattle >= plog->cBattle)
+    {
+        return -1;
+    }
+    if (iRound < 0)
+    {
+        iRound = 0;
+    }
+    if (iRound > cBtlRoundMax)
+    {
+        iRound = cBtlRoundMax;
+    }
+    return (int16_t)plog->rgent[iBattle].rgibrRound[iRound];
+}
+
+/* Token states (ctok of them) at the start of iRound. Rounds at or past the
+ * last one return the final state. */
+BTLTOKST *LptokstFromBtlLog(BTLLOG *plog, int16_t iBattle, int16_t iRound)
+{
+    BTLENT *pent;
+
+    if (iBattle < 0 || iBattle >= plog->cBattle)
+    {
+        return NULL;
+    }
+    pent = &plog->rgent[iBattle];
+    if (iRound < 0)
+    {
+        iRound = 0;
+    }
+    if (iRound > pent->cRound)
+    {
+        iRound = pent->cRound;
+    }
+    return &plog->rgtokst[pent->itokstFirst + (uint32_t)iRound * pent->lpbd->ctok];
+}
@@ -0,0 +1,75 @@
+#ifndef BTLLOG_H_
+#define BTLLOG_H_
+
+#include "types.h"
+
+/*
+ * Indexed battle log.
+ *
+ * The htBattle heap is a chain of variable-length BTLDATA blobs, each followed
+ * by its BTLREC action records, so finding battle N or round R means walking
+ * everything in front of it. BTLLOG is built once per loaded turn and keeps
+ * offset tables plus the per-round token damage state, so counting, seeking
+ * and scrubbing are table lookups.
+ *
+ * vbtllog indexes the live htBattle heap. It is built by the first query
+ * after the heap changes: LphbAlloc, ResetHb and FreeHb on htBattle call
+ * InvalidateBtlLog, and so does UpdateBattleRecords once a loaded log has
+ * been converted. Code that writes battles into an existing block must
+ * call it too.
+ */
+
+#define cBtlRoundMax 16 /* BTLREC.iRound is 4 bits */
+
+/* Damage state of one token at the start of a round. */
+typedef struct _btltokst
+{
+    uint16_t csh;     /* ships still alive */
+    DV dv;            /* armor damage on the stack */
+    int32_t dpShield; /* shield damage absorbed so far */
+} BTLTOKST;
+
+/* One battle. */
+typedef struct _btlent
+{
+    BTLDATA *lpbd;
+    uint16_t cbr;                          /* action records */
+    uint8_t cRound;                        /* max iRound + 1, 0 if no actions */
+    uint8_t unused;
+    uint16_t rgibrRound[cBtlRoundMax + 1]; /* first record of round r; [cRound] == cbr */
+    uint32_t iibFirst;                     /* into BTLLOG.rgibBr */
+    uint32_t itokstFirst;                  /* into BTLLOG.rgtokst, (cRound + 1) rows of ctok */
+} BTLENT;
+
+/* Reverse lookup from a BTLDATA pointer, sorted by address. */
+typedef struct _btlmap
+{
+    BTLDATA *lpbd;
+    int16_t iBattle;
+} BTLMAP;
+
+typedef struct _btllog
+{
+    int16_t fValid;
+    int16_t cBattle;
+    BTLENT *rgent;
+    uint16_t *rgibBr;    /* byte offset of each BTLREC from its BTLDATA */
+    BTLTOKST *rgtokst;
+    BTLMAP *rgmap;
+} BTLLOG;
+
+/* globals */
+extern BTLLOG vbtllog;
+
+/* functions */
+int16_t FBuildBtlLog(BTLLOG *plog);
+int16_t FSyncBtlLog(void);
+void InvalidateBtlLog(void);
+int16_t IBattleFromBtlLog(BTLLOG *plog, BTLDATA *lpbd);
+void FreeBtlLog(BTLLOG *plog);
+BTLDATA *LpbdFromBtlLog(BTLLOG *plog, int16_t iBattle);
+BTLREC *LpbrFromBtlLog(BTLLOG *plog, int16_t iBattle, int16_t ibr);
+int16_t IbrFromBtlLogRound(BTLLOG *plog, int16_t iBattle, int16_t iRound);
+BTLTOKST *LptokstFromBtlLog(BTLLOG *plog, int16_t iBattle, int16_t iRound);
+
+#endif /* BTLLOG_H_ */
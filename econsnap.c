@@ -0,0 +1,237 @@
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "types.h"
+#include "globals.h"
+
+#include "econsnap.h"
+#include "habmat.h"
+#include "planet.h"
+#include "race.h"
+#include "util.h"
+
+/* globals */
+ECONSNAP vecon = {0};
+
+static int16_t FGrowEconSnap(ECONSNAP *pecon, int16_t cpl)
+{
+    uint8_t *pb;
+    size_t cb;
+
+    if (cpl <= pecon->cplMax)
+    {
+        return 1;
+    }
+    cb = (size_t)cpl * (4 * sizeof(int32_t) + 8 * sizeof(int16_t) + 3 * sizeof(uint8_t));
+    pb = (uint8_t *)malloc(cb);
+    if (pb == NULL)
+    {
+        return 0;
+    }
+    free(pecon->pvBlock);
+    pecon->pvBlock = pb;
+    pecon->cplMax = cpl;
+    pecon->fTblValid = 0;
+
+    /* widest first so every array stays naturally aligned */
+    pecon->rglPop = (int32_t *)pb;
+    pb += cpl * sizeof(int32_t);
+    pecon->rglPopMax = (int32_t *)pb;
+    pb += cpl * sizeof(int32_t);
+    pecon->rglPopChg = (int32_t *)pb;
+    pb += cpl * sizeof(int32_t);
+    pecon->rglPopTbl = (int32_t *)pb;
+    pb += cpl * sizeof(int32_t);
+    pecon->rgiPlayer = (int16_t *)pb;
+    pb += cpl * sizeof(int16_t);
+    pecon->rgpctHab = (int16_t *)pb;
+    pb += cpl * sizeof(int16_t);
+    pecon->rgpctGrow = (int16_t *)pb;
+    pb += cpl * sizeof(int16_t);
+    pecon->rgcMinesOp = (int16_t *)pb;
+    pb += cpl * sizeof(int16_t);
+    pecon->rgcFactOp = (int16_t *)pb;
+    pb += cpl * sizeof(int16_t);
+    pecon->rgiMineEff = (int16_t *)pb;
+    pb += cpl * sizeof(int16_t);
+    pecon->rgcRes = (int16_t *)pb;
+    pb += cpl * sizeof(int16_t);
+    pecon->rgiPlayerTbl = (int16_t *)pb;
+    pb += cpl * sizeof(int16_t);
+    pecon->rgfHalfGrow = pb;
+    pb += cpl;
+    pecon->rgiDeltaPop = pb;
+    pb += cpl;
+    pecon->rgiDeltaPopNew = pb;
+    return 1;
+}
+
+/* Snapshot lpPlanets. Planets nobody lives on get a zero population and
+ * no owner so the kernel leaves them alone. */
+int16_t FBuildEconSnap(ECONSNAP *pecon)
+{
+    PLANET *lppl;
+    int16_t ipl;
+    int16_t iplr;
+
+    if (!FGrowEconSnap(pecon, cPlanet))
+    {
+        return 0;
+    }
+    pecon->cpl = cPlanet;
+    for (ipl = 0; ipl < cPlanet; ipl++)
+    {
+        lppl = &lpPlanets[ipl];
+        iplr = lppl->iPlayer;
+        pecon->rgiDeltaPop[ipl] = (uint8_t)lppl->iDeltaPop;
+        pecon->rglPopChg[ipl] = 0;
+        pecon->rgiDeltaPopNew[ipl] = (uint8_t)lppl->iDeltaPop;
+        if (iplr == -1 || lppl->rgwtMin[3] == 0)
+        {
+            pecon->rgiPlayer[ipl] = -1;
+            pecon->rglPop[ipl] = 0;
+            pecon->rglPopMax[ipl] = 0;
+            pecon->rgpctHab[ipl] = 0;
+            pecon->rgpctGrow[ipl] = 0;
+            pecon->rgfHalfGrow[ipl] = 0;
+            continue;
+        }
+        pecon->rgiPlayer[ipl] = iplr;
+        pecon->rglPop[ipl] = lppl->rgwtMin[3];
+        pecon->rgpctHab[ipl] = PctHabFromCache(lppl, iplr);
+        pecon->rglPopMax[ipl] = pecon->rgpctHab[ipl] < 0 ? 0 : CalcPlanetMaxPop(lppl->id, iplr);
+        pecon->rgpctGrow[ipl] = PctTrueMaxGrowth(iplr);
+        pecon->rgfHalfGrow[ipl] = (uint8_t)(gd.fGeneratingTurn && rgplr[iplr].fCheater);
+    }
+    return 1;
+}
+
+/* ChgPopFromGrowth over the whole snapshot. Reads only the input arrays
+ * and writes only rglPopChg / rgiDeltaPopNew. */
+void CalcEconPopGrowth(ECONSNAP *pecon)
+{
+    int16_t DeltaCur;
+    int16_t ipl;
+
+    for (ipl = 0; ipl < pecon->cpl; ipl++)
+    {
+        DeltaCur = pecon->rgiDeltaPop[ipl];
+        pecon->rglPopChg[ipl] = 0;
+        if (pecon->rgiPlayer[ipl] != -1 && pecon->rglPop[ipl] != 0)
+        {
+            pecon->rglPopChg[ipl] = ChgPopFromGrowth(pecon->rglPop[ipl], pecon->rglPopMax[ipl], pecon->rgpctHab[ipl],
+                                                     pecon->rgpctGrow[ipl], pecon->rgfHalfGrow[ipl], &DeltaCur);
+        }
+        pecon->rgiDeltaPopNew[ipl] = (uint8_t)DeltaCur;
+    }
+}
+
+void ApplyEconPopGrowth(ECONSNAP *pecon)
+{
+    PLANET *lppl;
+    int16_t ipl;
+
+    for (ipl = 0; ipl < pecon->cpl && ipl < cPlanet; ipl++)
+    {
+        lppl = &lpPlanets[ipl];
+        lppl->rgwtMin[3] += pecon->rglPopChg[ipl];
+        lppl->iDeltaPop = pecon->rgiDeltaPopNew[ipl];
+    }
+    pecon->fTblValid = 0;
+}
+
+/* Nonzero if no planet changed owner or population since the table was
+ * filled. */
+static int16_t FEconTableCurrent(ECONSNAP *pecon)
+{
+    PLANET *lppl;
+    int16_t ipl;
+
+    for (ipl = 0; ipl < pecon->cpl; ipl++)
+    {
+        lppl = &lpPlanets[ipl];
+        if (pecon->rgiPlayerTbl[ipl] != lppl->iPlayer || pecon->rglPopTbl[ipl] != lppl->rgwtMin[3])
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Build the economy table for the current turn. Cheap to call again: it
+ * only rebuilds after InvalidateEconTable, a turn change, a resize or an
+ * owner or population change. */
+int16_t FBuildEconTable(ECONSNAP *pecon)
+{
+    if (pecon->fTblValid && pecon->turnTbl == game.turn && pecon->cpl == cPlanet && pecon->cplMax >= cPlanet &&
+        FEconTableCurrent(pecon))
+    {
+        return 1;
+    }
+    if (!FGrowEconSnap(pecon, cPlanet))
+    {
+        return 0;
+    }
+    pecon->cpl = cPlanet;
+    FillEconTable(pecon, 0, cPlanet);
+    SumEconResources(pecon);
+    pecon->turnTbl = game.turn;
+    pecon->fTblValid = 1;
+    return 1;
+}
+
+void FillEconTable(ECONSNAP *pecon, int16_t iplFirst, int16_t iplLim)
+{
+    PLANET *lppl;
+    PLAYER *pplr;
+    int16_t ipl;
+
+    for (ipl = iplFirst; ipl < iplLim; ipl++)
+    {
+        lppl = &lpPlanets[ipl];
+        pecon->rgiPlayerTbl[ipl] = lppl->iPlayer;
+        pecon->rglPopTbl[ipl] = lppl->rgwtMin[3];
+        if (lppl->iPlayer == -1 || lppl->rgwtMin[3] == 0)
+        {
+            pecon->rgcMinesOp[ipl] = 0;
+            pecon->rgcFactOp[ipl] = 0;
+            pecon->rgiMineEff[ipl] = 0;
+            pecon->rgcRes[ipl] = 0;
+            continue;
+        }
+        pplr = &rgplr[lppl->iPlayer];
+        pecon->rgcMinesOp[ipl] = CMinesOperating(lppl);
+        pecon->rgcFactOp[ipl] = CFactoriesOperating(lppl);
+        pecon->rgiMineEff[ipl] = GetRaceStat(pplr, 0xe) == 8 ? 10 : GetRaceStat(pplr, 4);
+        pecon->rgcRes[ipl] = CResourcesAtPlanet(lppl, lppl->iPlayer);
+    }
+}
+
+void SumEconResources(ECONSNAP *pecon)
+{
+    int16_t ipl;
+    int16_t iplr;
+
+    memset(pecon->rglResPlr, 0, sizeof(pecon->rglResPlr));
+    for (ipl = 0; ipl < pecon->cpl; ipl++)
+    {
+        iplr = lpPlanets[ipl].iPlayer;
+        if (iplr >= 0 && iplr < 16)
+        {
+            pecon->rglResPlr[iplr] += pecon->rgcRes[ipl];
+        }
+    }
+}
+
+/* Mines, factories or population changed: next FBuildEconTable rebuilds. */
+void InvalidateEconTable(ECONSNAP *pecon)
+{
+    pecon->fTblValid = 0;
+}
+
+void FreeEconSnap(ECONSNAP *pecon)
+{
+    free(pecon->pvBlock);
+    memset(pecon, 0, sizeof(ECONSNAP));
+}
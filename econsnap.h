@@ -0,0 +1,87 @@
+#ifndef ECONSNAP_H_
+#define ECONSNAP_H_
+
+#include "types.h"
+
+/*
+ * Per-turn economy snapshot.
+ *
+ * UpdatePopulations used to walk lpPlanets and call ChgPopFromPlanet on
+ * each one, which re-derives habitability, max population and the owner's
+ * growth rate planet by planet. ECONSNAP pulls everything growth depends on
+ * out of the PLANET records once, into parallel arrays indexed like
+ * lpPlanets:
+ *
+ *   rgiPlayer    owner, -1 if none
+ *   rglPop       population (rgwtMin[3])
+ *   rglPopMax    CalcPlanetMaxPop for the owner
+ *   rgpctHab     PctPlanetDesirability for the owner (via the hab cache)
+ *   rgpctGrow    PctTrueMaxGrowth of the owner
+ *   rgfHalfGrow  growth halved (cheater penalty while generating)
+ *   rgiDeltaPop  fractional population carried between turns
+ *
+ * CalcEconPopGrowth then runs ChgPopFromGrowth, the arithmetic
+ * ChgPopFromPlanet itself uses, over the arrays in one pass, touching
+ * nothing else, and leaves the deltas in rglPopChg and
+ * rgiDeltaPopNew. ApplyEconPopGrowth writes them back. The results are
+ * exactly what ChgPopFromPlanet(lppl, 1) would have produced.
+ *
+ * The same block also carries the economy table: operating mines and
+ * factories, mining efficiency and resources for every owned planet, which
+ * MineMinerals, CMinesOperating, CFactoriesOperating, CResourcesAtPlanet
+ * and friends would otherwise each work out again. FillEconTable touches
+ * one planet per index and nothing shared, so a caller may hand disjoint
+ * [iplFirst, iplLim) ranges to separate workers; SumEconResources is the
+ * only cross-planet step (per-player resource pools for research) and runs
+ * afterwards in planet order.
+ *
+ * The table is good for a turn. Anything that changes an owner or a
+ * population (SatisfyOrders colonizing, DoBombing, DropColonists invading,
+ * UninhabitPlanet, Produce) calls InvalidateEconTable. FBuildEconTable
+ * also compares every planet's owner and population against the ones the
+ * table was built for, so a path that forgets costs a rebuild rather than
+ * stale numbers.
+ */
+
+typedef struct _econsnap
+{
+    int16_t cpl;
+    int16_t cplMax;
+    int16_t *rgiPlayer;
+    int32_t *rglPop;
+    int32_t *rglPopMax;
+    int16_t *rgpctHab;
+    int16_t *rgpctGrow;
+    uint8_t *rgfHalfGrow;
+    uint8_t *rgiDeltaPop;
+    int32_t *rglPopChg;      /* out */
+    uint8_t *rgiDeltaPopNew; /* out */
+
+    /* economy table, see FBuildEconTable */
+    int16_t *rgcMinesOp;
+    int16_t *rgcFactOp;
+    int16_t *rgiMineEff; /* 0 for planets that don't mine */
+    int16_t *rgcRes;
+    int32_t rglResPlr[16]; /* sum of rgcRes per owner */
+    int16_t *rgiPlayerTbl; /* owner and population the table was built for */
+    int32_t *rglPopTbl;
+    uint16_t turnTbl;
+    int16_t fTblValid;
+
+    void *pvBlock; /* single allocation backing the arrays */
+} ECONSNAP;
+
+/* globals */
+extern ECONSNAP vecon;
+
+/* functions */
+int16_t FBuildEconSnap(ECONSNAP *pecon);
+void CalcEconPopGrowth(ECONSNAP *pecon);
+void ApplyEconPopGrowth(ECONSNAP *pecon);
+int16_t FBuildEconTable(ECONSNAP *pecon);
+void FillEconTable(ECONSNAP *pecon, int16_t iplFirst, int16_t iplLim);
+void SumEconResources(ECONSNAP *pecon);
+void InvalidateEconTable(ECONSNAP *pecon);
+void FreeEconSnap(ECONSNAP *pecon);
+
+#endif /* ECONSNAP_H_ */
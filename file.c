@@ -1,7 +1,27 @@
 
+#include <stdlib.h>
+#include <string.h>
+
 #include "types.h"
+#include "globals.h"
 
 #include "file.h"
+#include "aictx.h"
+#include "btllog.h"
+#include "econsnap.h"
+#include "flloc.h"
+#include "flmove.h"
+#include "habmat.h"
+#include "minegrid.h"
+#include "minetbl.h"
+#include "msg.h"
+#include "msgidx.h"
+#include "planet.h"
+#include "plidx.h"
+#include "prodeta.h"
+#include "race.h"
+#include "utilgen.h"
+#include "vcr.h"
 
 /* functions */
 void FileError(int16_t ids)
@@ -33,7 +53,23 @@ void UnpackBattlePlan(uint8_t *lpb, BTLPLAN *lpbtlplan, int16_t iplan)
     /* debug symbols */
     /* block (block) @ MEMORY_IO:0x412a */
 
-    /* TODO: implement */
+    memmove(lpbtlplan, lpb, 4);
+    lpb += 4;
+    cch = *lpb;
+    if (cch == 0)
+    {
+        strcpy(lpbtlplan->szName, (char *)lpb + 1);
+    }
+    else
+    {
+        /* the decompile leaves szName as is if decompressing fails */
+        szName[0] = '\0';
+        cOut = 0x20;
+        memmove(szTemp, lpb + 1, cch);
+        FDecompressUserString(szTemp, cch, szName, &cOut);
+        memmove(lpbtlplan->szName, szName, sizeof(lpbtlplan->szName));
+    }
+    lpbtlplan->iplan = (uint16_t)(iplan & 0xf);
 }
 
 int16_t FBadFileError(int16_t ids)
@@ -66,8 +102,27 @@ void UpdateBattleRecords(void)
     HB * lphb;
     BTLREC26 * lpbr26;
     int16_t itok;
-
-    /* TODO: implement */
+    uint8_t *lpbMac;
+    uint8_t itokAttack;
+
+    /* 2.6 records keep itokAttack and a byte ctok where 2.6j keeps a word
+     * ctok and packs itokAttack above iRound/dzDis. */
+    lphb = NULL;
+    for (lpbd = LpbdNextBattle(&lphb, NULL); lpbd != NULL; lpbd = LpbdNextBattle(&lphb, lpbd))
+    {
+        lpbr = (BTLREC *)((uint8_t *)lpbd + sizeof(BTLDATA) + lpbd->ctok * sizeof(TOK));
+        lpbMac = (uint8_t *)lpbd + lpbd->cbData;
+        while ((uint8_t *)lpbr < lpbMac)
+        {
+            lpbr26 = (BTLREC26 *)lpbr;
+            itokAttack = lpbr26->itokAttack;
+            lpbr->ctok = lpbr26->ctok;
+            lpbr->itokAttack = itokAttack;
+            lpbr = (BTLREC *)((uint8_t *)lpbr + sizeof(BTLREC) + lpbr->ctok * sizeof(KILL));
+        }
+    }
+    InvalidateBtlLog();
+    (void)FSyncBtlLog();
 }
 
 int16_t FReadFleet(FLEET *lpfl)
@@ -255,8 +310,218 @@ int16_t FReadPlanet(int16_t iPlayer, PLANET *lppl, int16_t fHistory, int16_t fPr
     /* block (block) @ MEMORY_IO:0x380d */
     /* label LFinishBRecord @ MEMORY_IO:0x373b */
 
-    /* TODO: implement */
-    return 0;
+    uint16_t wFlags;
+    int16_t iPlayerFile;
+    int32_t l;
+
+    /* decodes hdrCur/rgbCur, which ReadRt just filled */
+    fFirstYear = 0;
+    if (!fPreInited)
+    {
+        memset(lppl, 0, sizeof(PLANET));
+    }
+    memcpy(&wFlags, rgbCur + 2, sizeof(uint16_t));
+    if (!fHistory && iPlayer != -1)
+    {
+        if (!fPreInited)
+        {
+            fFirstYear = 1;
+            lppl->fFirstYear = 1;
+        }
+        else if (lppl->fFirstYear)
+        {
+            if (lppl->turn == game.turn)
+            {
+                fFirstYear = 1;
+            }
+            else
+            {
+                lppl->fFirstYear = 0;
+            }
+        }
+    }
+    else
+    {
+        lppl->fFirstYear = wFlags >> 15;
+    }
+
+    /* id:11, iPlayer:5 with 31 meaning nobody */
+    lppl->id = (int16_t)(*(uint16_t *)rgbCur & 0x7ff);
+    iPlayerFile = (int16_t)(((uint8_t)rgbCur[1] >> 3) == 31 ? -1 : ((uint8_t)rgbCur[1] >> 3));
+    lppl->iPlayer = iPlayerFile;
+    if (lppl->det < (wFlags & 0x7f))
+    {
+        lppl->det = wFlags & 0x7f;
+    }
+    lppl->fInclude = (wFlags >> 8) & 1;
+    lppl->fStarbase = (wFlags >> 9) & 1;
+    lppl->fHomeworld = (wFlags >> 7) & 1;
+    fRouting = (int16_t)((wFlags >> 14) & 1);
+    if (lppl->fStarbase && lppl->iPlayer == -1)
+    {
+        lppl->fStarbase = 0;
+    }
+    if (!fHistory)
+    {
+        lppl->turn = game.turn;
+    }
+
+    pb = (uint8_t *)rgbCur + 4;
+    if ((wFlags & 0x7f) > 2)
+    {
+        bMask = *pb++;
+        for (i = 0; i < 3; i++)
+        {
+            if ((bMask & 3) == 0)
+            {
+                lppl->rgpctMinLevel[i] = 0;
+            }
+            else if ((bMask & 3) == 1)
+            {
+                lppl->rgpctMinLevel[i] = *pb++;
+            }
+            else
+            {
+                return 0;
+            }
+            bMask >>= 2;
+        }
+        for (i = 0; i < 3; i++)
+        {
+            lppl->rgMinConc[i] = *pb++;
+        }
+        for (i = 0; i < 3; i++)
+        {
+            if (*pb > 100)
+            {
+                return 0;
+            }
+            lppl->rgEnvVar[i] = (char)*pb;
+            lppl->rgEnvVarOrig[i] = (char)*pb;
+            pb++;
+        }
+        /* terraformed: the original environment follows */
+        if ((wFlags >> 10) & 1)
+        {
+            for (i = 0; i < 3; i++)
+            {
+                if (*pb > 100)
+                {
+                    return 0;
+                }
+                lppl->rgEnvVarOrig[i] = (char)*pb++;
+            }
+        }
+        if (iPlayerFile != -1)
+        {
+            memcpy(&lppl->uGuesses, pb, sizeof(uint16_t));
+            pb += 2;
+        }
+        if (lppl->det > 3)
+        {
+            if ((wFlags >> 13) & 1)
+            {
+                bMask = *pb++;
+                for (i = 0; i < 4; i++)
+                {
+                    l = 0;
+                    switch (bMask & 3)
+                    {
+                    case 1:
+                        l = *pb;
+                        pb += 1;
+                        break;
+                    case 2:
+                        l = *(uint16_t *)pb;
+                        pb += 2;
+                        break;
+                    case 3:
+                        memcpy(&l, pb, sizeof(int32_t));
+                        pb += 4;
+                        break;
+                    }
+                    lppl->rgwtMin[i] = l;
+                    bMask >>= 2;
+                }
+            }
+            if (hdrCur.rt != 0xe)
+            {
+                if (((wFlags >> 11) & 1) == 0)
+                {
+                    /* no surface record: nothing known beyond the scanner */
+                    lppl->fArtifact = 0;
+                    lppl->iScanner = 0x1f;
+                    lppl->cDefenses = 0;
+                }
+                else
+                {
+                    memcpy(lppl->rgbImp, pb, 8);
+                    pb += 8;
+                }
+                if (lppl->iPlayer != -1)
+                {
+                    if (lppl->fStarbase)
+                    {
+                        memcpy(&lppl->lStarbase, pb, sizeof(int32_t));
+                        lppl->fNoHeal = 0;
+                        pb += 4;
+                    }
+                    if (fRouting)
+                    {
+                        memcpy(&lppl->wRouting, pb, sizeof(uint16_t));
+                    }
+                }
+                return 1;
+            }
+        }
+    }
+    /* LFinishBRecord */
+    if (lppl->fStarbase)
+    {
+        lppl->isb = *pb & 0xf;
+        pb++;
+    }
+    if (fHistory)
+    {
+        memcpy(&lppl->turn, pb, sizeof(int16_t));
+        return 1;
+    }
+    if (!fFirstYear)
+    {
+        return 1;
+    }
+
+    /* first sight of the planet this turn: tell the player about it */
+    if (lppl->iPlayer != -1)
+    {
+        FSendPlrMsg2XGen(0, 0xaa, lppl->id, lppl->id, (int16_t)(lppl->iPlayer | 0x30));
+    }
+    else if (lppl->det < 2)
+    {
+        FSendPlrMsg2XGen(0, 0xad, lppl->id, lppl->id, 0);
+    }
+    else if (GetRaceStat(&rgplr[iPlayer], 0xe) == 3)
+    {
+        FSendPlrMsg2XGen(0, 0x15d, lppl->id, lppl->id, PctPlanetOptValue(lppl, iPlayer));
+    }
+    else
+    {
+        /* the decompile loses which value goes through abs(); the one the
+         * message is about is the natural reading */
+        pct = PctPlanetDesirability(lppl, iPlayer);
+        pctOpt = 0;
+        if (pct < 1)
+        {
+            pctOpt = PctPlanetOptValue(lppl, iPlayer);
+            idm = pctOpt < 1 ? 0xab : 0xae;
+        }
+        else
+        {
+            idm = 0xac;
+        }
+        FSendPlrMsg2XGen(0, idm, lppl->id, (int16_t)abs(idm == 0xae ? pctOpt : pct), lppl->id);
+    }
+    return 1;
 }
 
 void PromptSaveGame(void)
@@ -293,6 +558,21 @@ void DestroyCurGame(void)
 {
     int16_t i;
 
+    FreeAiCtxs();
+
+    /* the per-game caches, so none of them outlives the game it describes */
+    FreeEconSnap(&vecon);
+    FreeHabCache();
+    FreeProdEtaCache();
+    FreeMineGrid(&vminegrid);
+    FreeMineTable(&vminetbl);
+    FreeFleetLocs(&vflloc);
+    FreeFleetMoves(&vflmove);
+    FreeMsgIndex(&vmsgidx);
+    FreeMsgTurnIndex(&vmsgtidx);
+    FreePlanetIndex(&vplidx);
+    InvalidateBtlLog();
+
     /* TODO: implement */
 }
 
@@ -0,0 +1,269 @@
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "types.h"
+#include "globals.h"
+
+#include "flloc.h"
+
+/* globals */
+FLLOC vflloc = {0};
+
+static uint32_t LKeyFromPt(POINT pt)
+{
+    return ((uint32_t)(uint16_t)pt.x << 16) | (uint16_t)pt.y;
+}
+
+static int32_t IslotHome(FLLOC *ploc, uint32_t lKey)
+{
+    return (int32_t)(((lKey * 2654435761u) >> 8) & (uint32_t)(ploc->cslot - 1));
+}
+
+/* Slot holding lKey, or the empty slot it would go in. */
+static int32_t IslotFind(FLLOC *ploc, uint32_t lKey)
+{
+    int32_t islot;
+
+    islot = IslotHome(ploc, lKey);
+    while (ploc->rglpflHead[islot] != NULL && ploc->rglKey[islot] != lKey)
+    {
+        islot = (islot + 1) & (ploc->cslot - 1);
+    }
+    return islot;
+}
+
+/* Keep the table at most half full, rehashing into a bigger one. */
+static int16_t FGrowFleetLocs(FLLOC *ploc, int32_t cLoc)
+{
+    uint32_t *rglKeyOld;
+    FLEET **rglpflHeadOld;
+    int32_t cslotOld;
+    int32_t cslot;
+    int32_t islot;
+    int32_t islotNew;
+
+    if (ploc->rglpflHead != NULL && 2 * cLoc <= ploc->cslot)
+    {
+        return 1;
+    }
+    for (cslot = 64; cslot < 2 * cLoc; cslot <<= 1)
+        ;
+
+    rglKeyOld = ploc->rglKey;
+    rglpflHeadOld = ploc->rglpflHead;
+    cslotOld = ploc->cslot;
+    ploc->rglKey = (uint32_t *)malloc(cslot * sizeof(uint32_t));
+    ploc->rglpflHead = (FLEET **)calloc(cslot, sizeof(FLEET *));
+    if (ploc->rglKey == NULL || ploc->rglpflHead == NULL)
+    {
+        free(ploc->rglKey);
+        free(ploc->rglpflHead);
+        ploc->rglKey = rglKeyOld;
+        ploc->rglpflHead = rglpflHeadOld;
+        return 0;
+    }
+    ploc->cslot = cslot;
+    for (islot = 0; islot < cslotOld; islot++)
+    {
+        if (rglpflHeadOld[islot] != NULL)
+        {
+            islotNew = IslotFind(ploc, rglKeyOld[islot]);
+            ploc->rglKey[islotNew] = rglKeyOld[islot];
+            ploc->rglpflHead[islotNew] = rglpflHeadOld[islot];
+        }
+    }
+    free(rglKeyOld);
+    free(rglpflHeadOld);
+    return 1;
+}
+
+/* Empty a slot, shifting later members of its probe run back so lookups
+ * never stop early (no tombstones). */
+static void RemoveSlot(FLLOC *ploc, int32_t islot)
+{
+    int32_t i;
+    int32_t j;
+    int32_t k;
+
+    i = j = islot;
+    for (;;)
+    {
+        j = (j + 1) & (ploc->cslot - 1);
+        if (ploc->rglpflHead[j] == NULL)
+        {
+            break;
+        }
+        k = IslotHome(ploc, ploc->rglKey[j]);
+        /* j can stay if its home lies cyclically in (i, j] */
+        if (i <= j ? (i < k && k <= j) : (i < k || k <= j))
+        {
+            continue;
+        }
+        ploc->rglKey[i] = ploc->rglKey[j];
+        ploc->rglpflHead[i] = ploc->rglpflHead[j];
+        i = j;
+    }
+    ploc->rglpflHead[i] = NULL;
+}
+
+static int16_t FLinkAt(FLLOC *ploc, FLEET *lpfl, POINT pt)
+{
+    FLEET **plpfl;
+    uint32_t lKey;
+    int32_t islot;
+
+    if (!FGrowFleetLocs(ploc, ploc->cLoc + 1))
+    {
+        return 0;
+    }
+    lKey = LKeyFromPt(pt);
+    islot = IslotFind(ploc, lKey);
+    if (ploc->rglpflHead[islot] == NULL)
+    {
+        ploc->rglKey[islot] = lKey;
+        ploc->cLoc++;
+    }
+    for (plpfl = &ploc->rglpflHead[islot]; *plpfl != NULL && (*plpfl)->id < lpfl->id; plpfl = &(*plpfl)->lpflNext)
+        ;
+    lpfl->lpflNext = *plpfl;
+    *plpfl = lpfl;
+    return 1;
+}
+
+static int16_t FUnlinkAt(FLLOC *ploc, FLEET *lpfl, POINT pt)
+{
+    FLEET **plpfl;
+    int32_t islot;
+
+    islot = IslotFind(ploc, LKeyFromPt(pt));
+    for (plpfl = &ploc->rglpflHead[islot]; *plpfl != NULL && *plpfl != lpfl; plpfl = &(*plpfl)->lpflNext)
+        ;
+    if (*plpfl == NULL)
+    {
+        return 0;
+    }
+    *plpfl = lpfl->lpflNext;
+    lpfl->lpflNext = NULL;
+    if (ploc->rglpflHead[islot] == NULL)
+    {
+        RemoveSlot(ploc, islot);
+        ploc->cLoc--;
+    }
+    return 1;
+}
+
+/* Chain every fleet in rglpfl by point. Walking backwards and pushing on
+ * the front leaves each chain in ascending rglpfl order. */
+int16_t FRebuildFleetLocs(FLLOC *ploc)
+{
+    FLEET *lpfl;
+    int32_t islot;
+    uint32_t lKey;
+    int16_t ifl;
+
+    ploc->fValid = 0;
+    if (!FGrowFleetLocs(ploc, cFleet))
+    {
+        return 0;
+    }
+    memset(ploc->rglpflHead, 0, ploc->cslot * sizeof(FLEET *));
+    ploc->cLoc = 0;
+    for (ifl = (int16_t)(cFleet - 1); ifl >= 0; ifl--)
+    {
+        lpfl = rglpfl[ifl];
+        if (lpfl == NULL)
+        {
+            continue;
+        }
+        lKey = LKeyFromPt(lpfl->pt);
+        islot = IslotFind(ploc, lKey);
+        if (ploc->rglpflHead[islot] == NULL)
+        {
+            ploc->rglKey[islot] = lKey;
+            ploc->cLoc++;
+        }
+        lpfl->lpflNext = ploc->rglpflHead[islot];
+        ploc->rglpflHead[islot] = lpfl;
+    }
+    ploc->rglpflLoc = rglpfl;
+    ploc->cflLoc = cFleet;
+    ploc->fValid = 1;
+    return 1;
+}
+
+/* First fleet at pt, the rest follow through lpflNext; NULL if none. */
+FLEET *LpflFirstAtPoint(FLLOC *ploc, POINT pt)
+{
+    FLEET *lpfl;
+    int16_t ifl;
+
+    if (!ploc->fValid || ploc->rglpflLoc != rglpfl || ploc->cflLoc != cFleet)
+    {
+        if (!FRebuildFleetLocs(ploc))
+        {
+            /* out of memory: the chains can't be trusted, only the scan */
+            for (ifl = 0; ifl < cFleet; ifl++)
+            {
+                lpfl = rglpfl[ifl];
+                if (lpfl != NULL && lpfl->pt.x == pt.x && lpfl->pt.y == pt.y)
+                {
+                    return lpfl;
+                }
+            }
+            return NULL;
+        }
+    }
+    return ploc->rglpflHead[IslotFind(ploc, LKeyFromPt(pt))];
+}
+
+/* lpfl was just added to rglpfl. */
+void LinkFleetLoc(FLLOC *ploc, FLEET *lpfl)
+{
+    if (!ploc->fValid)
+    {
+        return;
+    }
+    if (!FLinkAt(ploc, lpfl, lpfl->pt))
+    {
+        ploc->fValid = 0;
+        return;
+    }
+    ploc->rglpflLoc = rglpfl;
+    ploc->cflLoc++;
+}
+
+/* lpfl is about to leave rglpfl. */
+void UnlinkFleetLoc(FLLOC *ploc, FLEET *lpfl)
+{
+    if (!ploc->fValid)
+    {
+        return;
+    }
+    if (!FUnlinkAt(ploc, lpfl, lpfl->pt))
+    {
+        ploc->fValid = 0;
+        return;
+    }
+    ploc->cflLoc--;
+}
+
+/* lpfl->pt changed from ptOld. */
+void MoveFleetLoc(FLLOC *ploc, FLEET *lpfl, POINT ptOld)
+{
+    if (!ploc->fValid || (lpfl->pt.x == ptOld.x && lpfl->pt.y == ptOld.y))
+    {
+        return;
+    }
+    if (!FUnlinkAt(ploc, lpfl, ptOld) || !FLinkAt(ploc, lpfl, lpfl->pt))
+    {
+        ploc->fValid = 0;
+    }
+}
+
+void FreeFleetLocs(FLLOC *ploc)
+{
+    free(ploc->rglKey);
+    free(ploc->rglpflHead);
+    memset(ploc, 0, sizeof(FLLOC));
+}
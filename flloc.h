@@ -0,0 +1,55 @@
+#ifndef FLLOC_H_
+#define FLLOC_H_
+
+#include "types.h"
+
+/*
+ * Fleets by location.
+ *
+ * Fleets at the same point are chained through lpflNext, in ascending id
+ * order (the order of rglpfl). FLLOC is an open-addressed hash from the
+ * point to the first fleet of its chain. "Who is at this point" is then
+ * one probe, not a sort or a scan of every fleet.
+ *
+ * FRebuildFleetLocs builds the whole thing. After that the index is kept
+ * up to date as fleets change:
+ *
+ *   LinkFleetLoc     a fleet was created or loaded
+ *   UnlinkFleetLoc   a fleet is about to go away
+ *   MoveFleetLoc     a fleet's pt changed (ApplyFleetMoves)
+ *
+ * LinkFleets, LpflNew, LpflNewSplit, FDeleteFleet and FLookupOrbitingXfer
+ * are still stubs, so nothing in the game builds or reads the index yet;
+ * they are the places these hooks belong once they are ported.
+ *
+ * The index remembers which rglpfl it was built from and how many fleets
+ * it holds. If either no longer matches rglpfl/cFleet, the next lookup
+ * rebuilds it. That only catches a path that changes the fleet count
+ * without telling the index: one that deletes a fleet and creates another
+ * in the same step, or moves a fleet without MoveFleetLoc, leaves stale
+ * chains behind. Every such path has to call the hooks above.
+ */
+
+typedef struct _flloc
+{
+    int16_t fValid;
+    FLEET **rglpflLoc; /* rglpfl / fleet count the index describes */
+    int16_t cflLoc;
+    int16_t cLoc;      /* distinct points */
+    int32_t cslot;     /* power of two, at least twice cLoc */
+    uint32_t *rglKey;  /* packed point */
+    FLEET **rglpflHead; /* NULL: empty slot */
+} FLLOC;
+
+/* globals */
+extern FLLOC vflloc;
+
+/* functions */
+int16_t FRebuildFleetLocs(FLLOC *ploc);
+FLEET *LpflFirstAtPoint(FLLOC *ploc, POINT pt);
+void LinkFleetLoc(FLLOC *ploc, FLEET *lpfl);
+void UnlinkFleetLoc(FLLOC *ploc, FLEET *lpfl);
+void MoveFleetLoc(FLLOC *ploc, FLEET *lpfl, POINT ptOld);
+void FreeFleetLocs(FLLOC *ploc);
+
+#endif /* FLLOC_H_ */
@@ -0,0 +1,412 @@
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "types.h"
+#include "globals.h"
+
+#include "flmove.h"
+#include "flloc.h"
+#include "ship.h"
+#include "ship2.h"
+#include "turn.h"
+#include "util.h"
+
+/* globals */
+FLMOVE vflmove = {0};
+
+#define grobjNone 0
+#define grobjPlanet 1
+#define grobjFleet 2
+#define ithMineField 0
+#define iWarpGate 11
+
+static int16_t FGrowFleetMoves(FLMOVE *pmv, int16_t cmv)
+{
+    uint8_t *pb;
+    size_t cb;
+
+    if (cmv <= pmv->cmvMax && pmv->pvBlock != NULL)
+    {
+        return 1;
+    }
+    if (cmv < 64)
+    {
+        cmv = 64;
+    }
+    cb = (size_t)cmv * (5 * sizeof(int32_t) + 8 * sizeof(int16_t) + sizeof(uint8_t));
+    pb = (uint8_t *)malloc(cb);
+    if (pb == NULL)
+    {
+        return 0;
+    }
+    free(pmv->pvBlock);
+    pmv->pvBlock = pb;
+    pmv->cmvMax = cmv;
+
+    /* widest first so every array stays naturally aligned */
+    pmv->rgdDist = (int32_t *)pb;
+    pb += cmv * sizeof(int32_t);
+    pmv->rgdAct = (int32_t *)pb;
+    pb += cmv * sizeof(int32_t);
+    pmv->rgwtFuel = (int32_t *)pb;
+    pb += cmv * sizeof(int32_t);
+    pmv->rgwtFuelUsed = (int32_t *)pb;
+    pb += cmv * sizeof(int32_t);
+    pmv->rglFuelGain = (int32_t *)pb;
+    pb += cmv * sizeof(int32_t);
+    pmv->rgifl = (int16_t *)pb;
+    pb += cmv * sizeof(int16_t);
+    pmv->rgxSrc = (int16_t *)pb;
+    pb += cmv * sizeof(int16_t);
+    pmv->rgySrc = (int16_t *)pb;
+    pb += cmv * sizeof(int16_t);
+    pmv->rgxDst = (int16_t *)pb;
+    pb += cmv * sizeof(int16_t);
+    pmv->rgyDst = (int16_t *)pb;
+    pb += cmv * sizeof(int16_t);
+    pmv->rgiWarp = (int16_t *)pb;
+    pb += cmv * sizeof(int16_t);
+    pmv->rgxEnd = (int16_t *)pb;
+    pb += cmv * sizeof(int16_t);
+    pmv->rgyEnd = (int16_t *)pb;
+    pb += cmv * sizeof(int16_t);
+    pmv->rggrf = pb;
+    return 1;
+}
+
+/* Collect every fleet that moves this pass. A fleet following another
+ * fleet waits until its target has moved unless fForce (a cycle). */
+int16_t FGatherFleetMoves(FLMOVE *pmv, int16_t fForce)
+{
+    FLEET *lpfl;
+    FLEET *lpflT;
+    ORDER *lpord;
+    THING *lpth;
+    POINT ptDst;
+    int16_t fMines;
+    int16_t iWarpSafe;
+    int16_t imv;
+    int16_t ifl;
+    int16_t i;
+
+    pmv->cmv = 0;
+    pmv->cDeferred = 0;
+    if (!FGrowFleetMoves(pmv, cFleet))
+    {
+        return 0;
+    }
+
+    /* Nobody below the lowest safe speed can hit a mine. */
+    fMines = 0;
+    for (i = 0, lpth = lpThings; i < cThing; i++, lpth++)
+    {
+        if (lpth->ith == ithMineField && lpth->thm.cMines > 0)
+        {
+            fMines = 1;
+            break;
+        }
+    }
+    iWarpSafe = rgiWarpSafe[0];
+    for (i = 1; i < 3; i++)
+    {
+        if (rgiWarpSafe[i] < iWarpSafe)
+        {
+            iWarpSafe = rgiWarpSafe[i];
+        }
+    }
+
+    for (ifl = 0; ifl < cFleet; ifl++)
+    {
+        lpfl = rglpfl[ifl];
+        if (lpfl == NULL || lpfl->fDead || lpfl->fDone)
+        {
+            continue;
+        }
+        if (lpfl->lpplord == NULL || lpfl->lpplord->iordMac < 2)
+        {
+            lpfl->fDone = 1;
+            continue;
+        }
+        lpord = &lpfl->lpplord->rgord[1];
+        ptDst = lpord->pt;
+        if (lpord->grobj == grobjFleet)
+        {
+            lpflT = LpflFromId(lpord->id);
+            if (lpflT != NULL && lpflT != lpfl && !lpflT->fDead)
+            {
+                if (!lpflT->fDone && !fForce)
+                {
+                    pmv->cDeferred++;
+                    continue;
+                }
+                ptDst = lpflT->pt;
+                lpord->pt = ptDst;
+            }
+        }
+
+        imv = pmv->cmv++;
+        pmv->rgifl[imv] = ifl;
+        pmv->rgxSrc[imv] = lpfl->pt.x;
+        pmv->rgySrc[imv] = lpfl->pt.y;
+        pmv->rgxDst[imv] = ptDst.x;
+        pmv->rgyDst[imv] = ptDst.y;
+        pmv->rgiWarp[imv] = (int16_t)lpord->iWarp;
+        pmv->rgwtFuel[imv] = lpfl->rgwtMin[4];
+        pmv->rgwtFuelUsed[imv] = 0;
+        pmv->rglFuelGain[imv] = 0;
+        pmv->rggrf[imv] = 0;
+        if (lpord->iWarp == iWarpGate)
+        {
+            pmv->rggrf[imv] |= fmxGate;
+        }
+        else if (fMines && lpord->iWarp > iWarpSafe)
+        {
+            pmv->rggrf[imv] |= fmxMines;
+        }
+    }
+    return 1;
+}
+
+/* End point dAct along the row's segment, dDist long. */
+static void SetMoveEnd(FLMOVE *pmv, int16_t imv, double dDist, int32_t dAct)
+{
+    double r;
+    double dxRound;
+    double dyRound;
+
+    r = dDist > 0.0 ? dAct / dDist : 0.0;
+    dxRound = (pmv->rgxDst[imv] - pmv->rgxSrc[imv]) * r;
+    dyRound = (pmv->rgyDst[imv] - pmv->rgySrc[imv]) * r;
+    pmv->rgxEnd[imv] = (int16_t)(pmv->rgxSrc[imv] + (int16_t)floor(dxRound + 0.5));
+    pmv->rgyEnd[imv] = (int16_t)(pmv->rgySrc[imv] + (int16_t)floor(dyRound + 0.5));
+}
+
+/* Distance, end point and arrival. Reads and writes only rows
+ * [imvFirst, imvLim). */
+void CalcFleetMoves(FLMOVE *pmv, int16_t imvFirst, int16_t imvLim)
+{
+    double d;
+    int32_t dx;
+    int32_t dy;
+    int32_t dMax;
+    int16_t imv;
+
+    for (imv = imvFirst; imv < imvLim; imv++)
+    {
+        dx = pmv->rgxDst[imv] - pmv->rgxSrc[imv];
+        dy = pmv->rgyDst[imv] - pmv->rgySrc[imv];
+        d = sqrt((double)(dx * dx + dy * dy));
+        pmv->rgdDist[imv] = (int32_t)d;
+        if (pmv->rggrf[imv] & fmxGate)
+        {
+            /* ApplyFleetMoves decides whether the jump happens */
+            pmv->rgxEnd[imv] = pmv->rgxSrc[imv];
+            pmv->rgyEnd[imv] = pmv->rgySrc[imv];
+            pmv->rgdAct[imv] = 0;
+            continue;
+        }
+        dMax = pmv->rgiWarp[imv] * pmv->rgiWarp[imv];
+        if (dMax >= d)
+        {
+            pmv->rgxEnd[imv] = pmv->rgxDst[imv];
+            pmv->rgyEnd[imv] = pmv->rgyDst[imv];
+            pmv->rgdAct[imv] = (int32_t)d;
+            pmv->rggrf[imv] |= fmxArrive;
+        }
+        else
+        {
+            pmv->rgdAct[imv] = dMax;
+            SetMoveEnd(pmv, imv, d, dMax);
+        }
+    }
+}
+
+/* Fuel for the distance worked out by CalcFleetMoves. Each row reads only
+ * its own fleet. */
+void CalcFleetFuel(FLMOVE *pmv, int16_t imvFirst, int16_t imvLim)
+{
+    FLEET *lpfl;
+    int16_t imv;
+
+    for (imv = imvFirst; imv < imvLim; imv++)
+    {
+        if ((pmv->rggrf[imv] & fmxGate) || pmv->rgdAct[imv] <= 0)
+        {
+            continue;
+        }
+        lpfl = rglpfl[pmv->rgifl[imv]];
+        pmv->rgwtFuelUsed[imv] = EstFuelUse(lpfl, 0, pmv->rgiWarp[imv], pmv->rgdAct[imv], 0);
+        pmv->rglFuelGain[imv] = LCalcFuelGainFromRamScoops(lpfl, pmv->rgiWarp[imv], pmv->rgdAct[imv]);
+        if (pmv->rgwtFuelUsed[imv] > pmv->rgwtFuel[imv])
+        {
+            pmv->rggrf[imv] |= fmxFuel;
+        }
+    }
+}
+
+/* Cut the row's move short at dAct. */
+static void ShortenMove(FLMOVE *pmv, int16_t imv, int32_t dAct)
+{
+    FLEET *lpfl;
+    double d;
+
+    if (dAct >= pmv->rgdAct[imv])
+    {
+        return;
+    }
+    lpfl = rglpfl[pmv->rgifl[imv]];
+    d = DGetDistance(pmv->rgxSrc[imv], pmv->rgySrc[imv], pmv->rgxDst[imv], pmv->rgyDst[imv]);
+    pmv->rgdAct[imv] = dAct;
+    pmv->rggrf[imv] &= ~fmxArrive;
+    SetMoveEnd(pmv, imv, d, dAct);
+    pmv->rgwtFuelUsed[imv] = dAct > 0 ? EstFuelUse(lpfl, 0, pmv->rgiWarp[imv], dAct, 0) : 0;
+    pmv->rglFuelGain[imv] = dAct > 0 ? LCalcFuelGainFromRamScoops(lpfl, pmv->rgiWarp[imv], dAct) : 0;
+}
+
+static int32_t WtFuelMaxFleet(FLEET *lpfl)
+{
+    SHDEF *lpshdef;
+    int32_t wt;
+    int16_t i;
+
+    wt = 0;
+    for (i = 0; i < 16; i++)
+    {
+        if (lpfl->rgcsh[i] > 0)
+        {
+            lpshdef = (SHDEF *)((uint8_t *)rglpshdef[lpfl->iPlayer] + (int32_t)i * 0x93);
+            wt += (int32_t)lpfl->rgcsh[i] * WtMaxShdefStat(lpshdef, 1);
+        }
+    }
+    return wt;
+}
+
+/* Exceptions and write-back, one fleet at a time in rglpfl order. Returns
+ * the number of fleets moved. Not decompiled: the order of the steps and
+ * the fuel rules are invented. */
+int16_t ApplyFleetMoves(FLMOVE *pmv)
+{
+    FLEET *lpfl;
+    PLORD *lpplord;
+    ORDER *lpord;
+    PLANET *lpplSrc;
+    PLANET *lpplDst;
+    THING thHit;
+    POINT ptOld;
+    int32_t dLo;
+    int32_t dHi;
+    int32_t dTry;
+    int32_t wtFuel;
+    int32_t wtFuelMax;
+    int16_t dMineTravel;
+    int16_t cMoved;
+    int16_t imv;
+
+    cMoved = 0;
+    for (imv = 0; imv < pmv->cmv; imv++)
+    {
+        lpfl = rglpfl[pmv->rgifl[imv]];
+        lpplord = lpfl->lpplord;
+        lpord = &lpplord->rgord[1];
+        lpfl->fDone = 1;
+        cMoved++;
+
+        if (pmv->rggrf[imv] & fmxGate)
+        {
+            lpplSrc = lpfl->idPlanet >= 0 ? LpplFromId(lpfl->idPlanet) : NULL;
+            lpplDst = lpord->grobj == grobjPlanet ? LpplFromId(lpord->id) : NULL;
+            if (lpplSrc != NULL && lpplDst != NULL && lpplSrc->fStarbase && lpplDst->fStarbase &&
+                FStargateJump(lpfl, (int16_t)lpplSrc->isb, (int16_t)lpplDst->isb, (int16_t)pmv->rgdDist[imv]))
+            {
+                pmv->rgxEnd[imv] = pmv->rgxDst[imv];
+                pmv->rgyEnd[imv] = pmv->rgyDst[imv];
+                pmv->rggrf[imv] |= fmxArrive;
+            }
+            if (lpfl->fDead)
+            {
+                continue;
+            }
+        }
+
+        if (pmv->rggrf[imv] & fmxFuel)
+        {
+            /* Not decompiled: invented as the longest distance whose
+               EstFuelUse the tanks cover, found by bisection. */
+            dLo = 0;
+            dHi = pmv->rgdAct[imv];
+            while (dLo < dHi)
+            {
+                dTry = dLo + (dHi - dLo + 1) / 2;
+                if (EstFuelUse(lpfl, 0, pmv->rgiWarp[imv], dTry, 0) <= pmv->rgwtFuel[imv])
+                {
+                    dLo = dTry;
+                }
+                else
+                {
+                    dHi = dTry - 1;
+                }
+            }
+            ShortenMove(pmv, imv, dLo);
+        }
+
+        if ((pmv->rggrf[imv] & fmxMines) && pmv->rgdAct[imv] > 0)
+        {
+            dMineTravel = (int16_t)pmv->rgdAct[imv];
+            memset(&thHit, 0, sizeof(THING));
+            if (FTravelThroughMineFields(lpfl, &dMineTravel, &thHit))
+            {
+                if (lpfl->fDead)
+                {
+                    continue;
+                }
+                ShortenMove(pmv, imv, dMineTravel);
+            }
+        }
+
+        wtFuel = pmv->rgwtFuel[imv] - pmv->rgwtFuelUsed[imv];
+        if (wtFuel < 0)
+        {
+            wtFuel = 0;
+        }
+        if (pmv->rglFuelGain[imv] > 0)
+        {
+            wtFuelMax = WtFuelMaxFleet(lpfl);
+            wtFuel += pmv->rglFuelGain[imv];
+            /* scooping never overfills the tanks */
+            wtFuel = wtFuelMax < wtFuel ? wtFuelMax : wtFuel;
+        }
+        lpfl->rgwtMin[4] = wtFuel;
+        lpfl->lFuelUsed = pmv->rgwtFuelUsed[imv];
+        ptOld = lpfl->pt;
+        lpfl->pt.x = pmv->rgxEnd[imv];
+        lpfl->pt.y = pmv->rgyEnd[imv];
+        MoveFleetLoc(&vflloc, lpfl, ptOld);
+
+        if (pmv->rggrf[imv] & fmxArrive)
+        {
+            /* the waypoint becomes where the fleet is */
+            memmove(&lpplord->rgord[0], &lpplord->rgord[1], (lpplord->iordMac - 1) * sizeof(ORDER));
+            lpplord->iordMac--;
+            lpord = &lpplord->rgord[0];
+            lpord->pt = lpfl->pt;
+            lpfl->idPlanet = lpord->grobj == grobjPlanet ? lpord->id : -1;
+        }
+        else if (pmv->rgdAct[imv] > 0)
+        {
+            lpord = &lpplord->rgord[0];
+            lpord->pt = lpfl->pt;
+            lpord->grobj = grobjNone;
+            lpord->id = -1;
+            lpfl->idPlanet = -1;
+        }
+    }
+    return cMoved;
+}
+
+void FreeFleetMoves(FLMOVE *pmv)
+{
+    free(pmv->pvBlock);
+    memset(pmv, 0, sizeof(FLMOVE));
+}
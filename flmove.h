@@ -0,0 +1,78 @@
+#ifndef FLMOVE_H_
+#define FLMOVE_H_
+
+#include "types.h"
+
+/*
+ * Phased fleet movement.
+ *
+ * Moving a fleet means: waypoint, distance, fuel, ram scoops, minefields,
+ * stargates. Only the last two can reach outside the fleet (they kill
+ * ships, drop salvage and draw Random()), so the move is split up:
+ *
+ *   FGatherFleetMoves  one row per fleet that moves this pass, in rglpfl
+ *                      order: where it is, where it's going, how fast and
+ *                      how much fuel it carries.
+ *   CalcFleetMoves     straight-line arithmetic over the rows: distance,
+ *                      end point, arrival.
+ *   CalcFleetFuel      fuel burnt and scooped for that distance. Reads only
+ *                      the fleet's own designs.
+ *   ApplyFleetMoves    walks the rows in order, handling the rows flagged
+ *                      for a stargate, fuel starvation or minefields one
+ *                      fleet at a time, then writes every fleet back.
+ *
+ * The two Calc steps touch nothing but their rows, so any split of
+ * [imvFirst, imvLim) gives the same result. They are plain scalar loops
+ * (sqrt, EstFuelUse); nothing here is vectorized. Everything with side effects
+ * happens in ApplyFleetMoves in fleet order, so Random() is drawn in fleet
+ * order too.
+ *
+ * Fleets following a fleet that hasn't moved yet are left for the next
+ * pass; a caller keeps gathering until nothing is left over.
+ *
+ * MoveFleets was never decompiled and is still a stub: nothing in the turn
+ * calls these yet. The fuel cut-off and the ram-scoop top-up are invented
+ * and only follow what the stubs they call (EstFuelUse,
+ * FTravelThroughMineFields, FStargateJump) suggest; they are the layout
+ * MoveFleets can fill in once it is ported, not Stars! rules.
+ */
+
+#define fmxGate 0x01   /* jumping through a stargate */
+#define fmxFuel 0x02   /* can't afford the whole distance */
+#define fmxMines 0x04  /* fast enough to hit mines on the way */
+#define fmxArrive 0x08 /* reaches the waypoint this year */
+
+typedef struct _flmove
+{
+    int16_t cmv;
+    int16_t cmvMax;
+    int16_t cDeferred; /* fleets left for a later pass */
+    int16_t *rgifl;    /* row -> rglpfl index */
+    int16_t *rgxSrc;
+    int16_t *rgySrc;
+    int16_t *rgxDst;
+    int16_t *rgyDst;
+    int16_t *rgiWarp;
+    int16_t *rgxEnd;   /* out: where the fleet stops */
+    int16_t *rgyEnd;
+    int32_t *rgdDist;  /* out: distance to the waypoint */
+    int32_t *rgdAct;   /* out: distance covered */
+    int32_t *rgwtFuel; /* fuel on board */
+    int32_t *rgwtFuelUsed;
+    int32_t *rglFuelGain;
+    uint8_t *rggrf;    /* fmx* bits */
+
+    void *pvBlock; /* single allocation backing the arrays */
+} FLMOVE;
+
+/* globals */
+extern FLMOVE vflmove;
+
+/* functions */
+int16_t FGatherFleetMoves(FLMOVE *pmv, int16_t fForce);
+void CalcFleetMoves(FLMOVE *pmv, int16_t imvFirst, int16_t imvLim);
+void CalcFleetFuel(FLMOVE *pmv, int16_t imvFirst, int16_t imvLim);
+int16_t ApplyFleetMoves(FLMOVE *pmv);
+void FreeFleetMoves(FLMOVE *pmv);
+
+#endif /* FLMOVE_H_ */
@@ -8,7 +8,7 @@
 /* globals */
 BTLDATA *vlpbdVCR;
 BTLDATA *vlpbdVCRNext;
-BTLPLAN *rglpbtlplan[1];
+BTLPLAN *rglpbtlplan[16];
 BTLPLAN btlplan = {0};
 BTLREC *vlpbrVCR;
 BTN *rgbtnXfer;
@@ -8,7 +8,7 @@
 /* globals */
 extern BTLDATA *vlpbdVCR;
 extern BTLDATA *vlpbdVCRNext;
-extern BTLPLAN *rglpbtlplan[1];
+extern BTLPLAN *rglpbtlplan[16];
 extern BTLPLAN btlplan;
 extern BTLREC *vlpbrVCR;
 extern BTN *rgbtnXfer;
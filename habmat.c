@@ -0,0 +1,331 @@
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "types.h"
+#include "globals.h"
+
+#include "habmat.h"
+#include "planet.h"
+
+#define pctHabNil ((int16_t)0x8000)
+
+/* One axis' contribution at one env value. */
+typedef struct _habax
+{
+    int16_t pctPos; /* pctIdeal squared, 10000 for an immune axis */
+    uint8_t pctNeg; /* capped distance outside the range */
+    uint8_t unused;
+    int16_t num;    /* pctMod *= num / den, den == 0 for no change */
+    int16_t den;
+} HABAX;
+
+typedef struct _habplr
+{
+    int16_t fValid;
+    char rgEnvVar[3];
+    char rgEnvVarMin[3];
+    char rgEnvVarMax[3];
+    HABAX rgax[3][iHabEnvMax + 1];
+} HABPLR;
+
+static HABPLR *rghabplr[16];
+static uint8_t rgsqrtHab[10000 + 1]; /* floor(sqrt(n)) for n = pctPos / 3 */
+static int16_t fSqrtHab;
+
+static int16_t *rgpctHab;     /* [16][cplHab] */
+static char (*rgenvHab)[3];   /* env each column was scored with */
+static int16_t cplHab;
+static PLANET *lpPlanetsHab;
+
+static void InitSqrtHab(void)
+{
+    int32_t n;
+    int32_t k;
+
+    k = 0;
+    for (n = 0; n <= 10000; n++)
+    {
+        while ((k + 1) * (k + 1) <= n)
+        {
+            k++;
+        }
+        rgsqrtHab[n] = (uint8_t)k;
+    }
+    fSqrtHab = 1;
+}
+
+/* Same arithmetic as PctPlanetDesirability, split by axis and env value. */
+static void BuildHabPlr(HABPLR *phabplr, int16_t iPlr)
+{
+    PLAYER *pplr = &rgplr[iPlr];
+    HABAX *pax;
+    int32_t iPref;
+    int32_t iMin;
+    int32_t iMax;
+    int32_t iPlanet;
+    int32_t absdiff;
+    int32_t d;
+    int32_t dPenalty;
+    int32_t pctIdeal;
+    int16_t i;
+
+    memcpy(phabplr->rgEnvVar, pplr->rgEnvVar, 3);
+    memcpy(phabplr->rgEnvVarMin, pplr->rgEnvVarMin, 3);
+    memcpy(phabplr->rgEnvVarMax, pplr->rgEnvVarMax, 3);
+    for (i = 0; i < 3; i++)
+    {
+        iPref = pplr->rgEnvVar[i];
+        iMin = pplr->rgEnvVarMin[i];
+        iMax = pplr->rgEnvVarMax[i];
+        for (iPlanet = 0; iPlanet <= iHabEnvMax; iPlanet++)
+        {
+            pax = &phabplr->rgax[i][iPlanet];
+            memset(pax, 0, sizeof(HABAX));
+            if (iMax < 0)
+            {
+                pax->pctPos = 10000;
+                continue;
+            }
+            if (iPlanet < iMin || iPlanet > iMax)
+            {
+                d = (iPlanet < iMin) ? (iMin - iPlanet) : (iPlanet - iMax);
+                pax->pctNeg = (uint8_t)(d > 15 ? 15 : d);
+                continue;
+            }
+            absdiff = iPlanet - iPref;
+            if (absdiff < 0)
+            {
+                absdiff = -absdiff;
+            }
+            if (iPlanet < iPref)
+            {
+                d = iPref - iMin;
+                dPenalty = (iPref - iPlanet) * 2 - d;
+            }
+            else
+            {
+                d = iMax - iPref;
+                dPenalty = (iPlanet - iPref) * 2 - d;
+            }
+            pctIdeal = 100 - ((d != 0) ? (absdiff * 100) / d : 100);
+            pax->pctPos = (int16_t)(pctIdeal * pctIdeal);
+            if (dPenalty > 0 && d > 0)
+            {
+                pax->num = (int16_t)(d * 2 - dPenalty);
+                pax->den = (int16_t)(d * 2);
+            }
+        }
+    }
+    phabplr->fValid = 1;
+}
+
+/* Tables for iPlr, rebuilt if the race's env parameters changed. Sets
+ * *pfRebuilt so the caller can drop that player's cached row. */
+static HABPLR *LphabplrGet(int16_t iPlr, int16_t *pfRebuilt)
+{
+    HABPLR *phabplr;
+    PLAYER *pplr = &rgplr[iPlr];
+
+    *pfRebuilt = 0;
+    phabplr = rghabplr[iPlr];
+    if (phabplr == NULL)
+    {
+        phabplr = (HABPLR *)calloc(1, sizeof(HABPLR));
+        if (phabplr == NULL)
+        {
+            return NULL;
+        }
+        rghabplr[iPlr] = phabplr;
+    }
+    if (!phabplr->fValid || memcmp(phabplr->rgEnvVar, pplr->rgEnvVar, 3) != 0 ||
+        memcmp(phabplr->rgEnvVarMin, pplr->rgEnvVarMin, 3) != 0 ||
+        memcmp(phabplr->rgEnvVarMax, pplr->rgEnvVarMax, 3) != 0)
+    {
+        BuildHabPlr(phabplr, iPlr);
+        *pfRebuilt = 1;
+    }
+    if (!fSqrtHab)
+    {
+        InitSqrtHab();
+    }
+    return phabplr;
+}
+
+static int16_t PctHabScore(HABPLR *phabplr, PLANET *lppl, int16_t iPlr)
+{
+    const HABAX *pax;
+    int32_t pctPos;
+    int32_t pctNeg;
+    int32_t pctMod;
+    int32_t iPlanet;
+    int16_t i;
+
+    pctPos = 0;
+    pctNeg = 0;
+    pctMod = 10000;
+    for (i = 0; i < 3; i++)
+    {
+        iPlanet = lppl->rgEnvVar[i];
+        if (iPlanet < 0 || iPlanet > iHabEnvMax)
+        {
+            return PctPlanetDesirability(lppl, iPlr);
+        }
+        pax = &phabplr->rgax[i][iPlanet];
+        pctPos += pax->pctPos;
+        pctNeg += pax->pctNeg;
+        if (pax->den != 0)
+        {
+            pctMod = (pctMod * pax->num) / pax->den;
+        }
+    }
+    if (pctNeg != 0)
+    {
+        return (int16_t)(-pctNeg);
+    }
+    return (int16_t)((rgsqrtHab[pctPos / 3] * pctMod) / 10000);
+}
+
+/* Score cpl planets for one player into rgpct. */
+void ScoreHabPlanets(int16_t iPlr, PLANET *rgpl, int16_t cpl, int16_t *rgpct)
+{
+    HABPLR *phabplr;
+    int16_t fRebuilt;
+    int16_t ipl;
+
+    phabplr = (iPlr >= 0 && iPlr < 16) ? LphabplrGet(iPlr, &fRebuilt) : NULL;
+    if (phabplr != NULL && fRebuilt)
+    {
+        InvalidateHabPlayer(iPlr);
+    }
+    for (ipl = 0; ipl < cpl; ipl++)
+    {
+        rgpct[ipl] = phabplr != NULL ? PctHabScore(phabplr, &rgpl[ipl], iPlr) : PctPlanetDesirability(&rgpl[ipl], iPlr);
+    }
+}
+
+static int16_t FEnsureHabMatrix(void)
+{
+    int32_t ipl;
+
+    if (rgpctHab != NULL && cplHab == cPlanet && lpPlanetsHab == lpPlanets)
+    {
+        return 1;
+    }
+    free(rgpctHab);
+    free(rgenvHab);
+    rgpctHab = NULL;
+    rgenvHab = NULL;
+    cplHab = 0;
+    lpPlanetsHab = NULL;
+    if (cPlanet <= 0)
+    {
+        return 0;
+    }
+    rgpctHab = (int16_t *)malloc(16 * (size_t)cPlanet * sizeof(int16_t));
+    rgenvHab = (char (*)[3])malloc(cPlanet * 3);
+    if (rgpctHab == NULL || rgenvHab == NULL)
+    {
+        FreeHabCache();
+        return 0;
+    }
+    for (ipl = 0; ipl < 16 * cPlanet; ipl++)
+    {
+        rgpctHab[ipl] = pctHabNil;
+    }
+    for (ipl = 0; ipl < cPlanet; ipl++)
+    {
+        memcpy(rgenvHab[ipl], lpPlanets[ipl].rgEnvVar, 3);
+    }
+    cplHab = cPlanet;
+    lpPlanetsHab = lpPlanets;
+    return 1;
+}
+
+/* Cached PctPlanetDesirability. Planets outside lpPlanets (scratch copies)
+ * are scored directly. */
+int16_t PctHabFromCache(PLANET *lppl, int16_t iPlr)
+{
+    HABPLR *phabplr;
+    int16_t fRebuilt;
+    int16_t *ppct;
+    int32_t ipl;
+
+    if (iPlr < 0 || iPlr >= 16)
+    {
+        return PctPlanetDesirability(lppl, iPlr);
+    }
+    phabplr = LphabplrGet(iPlr, &fRebuilt);
+    if (phabplr == NULL || !FEnsureHabMatrix())
+    {
+        return PctPlanetDesirability(lppl, iPlr);
+    }
+    if (fRebuilt)
+    {
+        InvalidateHabPlayer(iPlr);
+    }
+    ipl = lppl - lpPlanets;
+    if (ipl < 0 || ipl >= cplHab)
+    {
+        return PctHabScore(phabplr, lppl, iPlr);
+    }
+    if (memcmp(rgenvHab[ipl], lppl->rgEnvVar, 3) != 0)
+    {
+        InvalidateHabPlanet(lppl);
+    }
+    ppct = &rgpctHab[iPlr * cplHab + ipl];
+    if (*ppct == pctHabNil)
+    {
+        *ppct = PctHabScore(phabplr, lppl, iPlr);
+    }
+    return *ppct;
+}
+
+/* Terraforming: forget every player's score for this planet. */
+void InvalidateHabPlanet(PLANET *lppl)
+{
+    int32_t ipl;
+    int16_t iPlr;
+
+    ipl = lppl - lpPlanets;
+    if (rgpctHab == NULL || lpPlanetsHab != lpPlanets || ipl < 0 || ipl >= cplHab)
+    {
+        return;
+    }
+    for (iPlr = 0; iPlr < 16; iPlr++)
+    {
+        rgpctHab[iPlr * cplHab + ipl] = pctHabNil;
+    }
+    memcpy(rgenvHab[ipl], lppl->rgEnvVar, 3);
+}
+
+void InvalidateHabPlayer(int16_t iPlr)
+{
+    int16_t ipl;
+
+    if (rgpctHab == NULL || iPlr < 0 || iPlr >= 16)
+    {
+        return;
+    }
+    for (ipl = 0; ipl < cplHab; ipl++)
+    {
+        rgpctHab[iPlr * cplHab + ipl] = pctHabNil;
+    }
+}
+
+void FreeHabCache(void)
+{
+    int16_t i;
+
+    for (i = 0; i < 16; i++)
+    {
+        free(rghabplr[i]);
+        rghabplr[i] = NULL;
+    }
+    free(rgpctHab);
+    free(rgenvHab);
+    rgpctHab = NULL;
+    rgenvHab = NULL;
+    cplHab = 0;
+    lpPlanetsHab = NULL;
+}
@@ -0,0 +1,32 @@
+#ifndef HABMAT_H_
+#define HABMAT_H_
+
+#include "types.h"
+
+/*
+ * Cached habitability: PctPlanetDesirability for every [player x planet].
+ *
+ * Each player gets per-axis lookup tables (one entry per env value 0..100)
+ * holding that axis' share of the result, built from rgplr[].rgEnvVar,
+ * rgEnvVarMin and rgEnvVarMax. Scoring a planet is then three table reads,
+ * the pctMod chain and an integer square root; ScoreHabPlanets runs that
+ * over a whole planet array in one pass.
+ *
+ * PctHabFromCache keeps the results in a matrix. A row is thrown away when
+ * its player's env parameters no longer match the tables; a column when the
+ * planet's rgEnvVar no longer matches the env it was scored with (i.e. it was
+ * terraformed). Both checks are made on every lookup, so callers never see a
+ * stale value even if they forget to invalidate. Results are identical to
+ * PctPlanetDesirability.
+ */
+
+#define iHabEnvMax 100
+
+/* functions */
+int16_t PctHabFromCache(PLANET *lppl, int16_t iPlr);
+void ScoreHabPlanets(int16_t iPlr, PLANET *rgpl, int16_t cpl, int16_t *rgpct);
+void InvalidateHabPlanet(PLANET *lppl);
+void InvalidateHabPlayer(int16_t iPlr);
+void FreeHabCache(void);
+
+#endif /* HABMAT_H_ */
@@ -0,0 +1,571 @@
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "types.h"
+#include "globals.h"
+
+#include "histdb.h"
+
+static void PutW(uint8_t *pb, uint16_t w)
+{
+    pb[0] = (uint8_t)w;
+    pb[1] = (uint8_t)(w >> 8);
+}
+
+static void PutL(uint8_t *pb, uint32_t l)
+{
+    PutW(pb, (uint16_t)l);
+    PutW(pb + 2, (uint16_t)(l >> 16));
+}
+
+static uint16_t WGet(const uint8_t *pb)
+{
+    return (uint16_t)(pb[0] | (pb[1] << 8));
+}
+
+static uint32_t LGet(const uint8_t *pb)
+{
+    return WGet(pb) | ((uint32_t)WGet(pb + 2) << 16);
+}
+
+/* A planet on disk, little-endian, bitfields packed low bit first:
+ *
+ *   +0  id              +20 rgbImp[8]
+ *   +2  iPlayer         +28 cDefenses:12 iScanner:5 unused5:5 fArtifact:1
+ *   +4  det:8 fInclude:1 fStarbase:1        fNoResearch:1 unused2:8
+ *       fHomeworld:1 fFirstYear:1       +32 rgwtMin[4]
+ *       unusedC:1 fWasInhabited:1       +48 lStarbase
+ *       unusedD:2                       +52 idFling:10 iWarpFling:4
+ *   +6  rgpctMinLevel[3]                    fNoHeal:1 unused3:1
+ *   +9  rgMinConc[3]                    +54 wRouting
+ *   +12 rgEnvVar[3]                     +56 turn
+ *   +15 rgEnvVarOrig[3]
+ *   +18 uGuesses
+ */
+static void PackHistPlanet(uint8_t *pb, PLANET *lppl)
+{
+    PutW(pb, (uint16_t)lppl->id);
+    PutW(pb + 2, (uint16_t)lppl->iPlayer);
+    PutW(pb + 4, (uint16_t)(lppl->det | lppl->fInclude << 8 | lppl->fStarbase << 9 | lppl->fHomeworld << 10 |
+                            lppl->fFirstYear << 11 | lppl->unusedC << 12 | lppl->fWasInhabited << 13 |
+                            lppl->unusedD << 14));
+    memcpy(pb + 6, lppl->rgpctMinLevel, 3);
+    memcpy(pb + 9, lppl->rgMinConc, 3);
+    memcpy(pb + 12, lppl->rgEnvVar, 3);
+    memcpy(pb + 15, lppl->rgEnvVarOrig, 3);
+    PutW(pb + 18, lppl->uGuesses);
+    memcpy(pb + 20, lppl->rgbImp, 8);
+    PutL(pb + 28, (uint32_t)lppl->cDefenses | (uint32_t)lppl->iScanner << 12 | (uint32_t)lppl->unused5 << 17 |
+                      (uint32_t)lppl->fArtifact << 22 | (uint32_t)lppl->fNoResearch << 23 |
+                      (uint32_t)lppl->unused2 << 24);
+    PutL(pb + 32, (uint32_t)lppl->rgwtMin[0]);
+    PutL(pb + 36, (uint32_t)lppl->rgwtMin[1]);
+    PutL(pb + 40, (uint32_t)lppl->rgwtMin[2]);
+    PutL(pb + 44, (uint32_t)lppl->rgwtMin[3]);
+    PutL(pb + 48, (uint32_t)lppl->lStarbase);
+    PutW(pb + 52, (uint16_t)(lppl->idFling | lppl->iWarpFling << 10 | lppl->fNoHeal << 14 | lppl->unused3 << 15));
+    PutW(pb + 54, lppl->wRouting);
+    PutW(pb + 56, (uint16_t)lppl->turn);
+}
+
+static void UnpackHistPlanet(PLANET *lppl, uint8_t *pb)
+{
+    uint16_t w;
+    uint32_t l;
+
+    memset(lppl, 0, sizeof(PLANET));
+    lppl->id = (int16_t)WGet(pb);
+    lppl->iPlayer = (int16_t)WGet(pb + 2);
+    w = WGet(pb + 4);
+    lppl->det = w & 0xff;
+    lppl->fInclude = (w >> 8) & 1;
+    lppl->fStarbase = (w >> 9) & 1;
+    lppl->fHomeworld = (w >> 10) & 1;
+    lppl->fFirstYear = (w >> 11) & 1;
+    lppl->unusedC = (w >> 12) & 1;
+    lppl->fWasInhabited = (w >> 13) & 1;
+    lppl->unusedD = (w >> 14) & 3;
+    memcpy(lppl->rgpctMinLevel, pb + 6, 3);
+    memcpy(lppl->rgMinConc, pb + 9, 3);
+    memcpy(lppl->rgEnvVar, pb + 12, 3);
+    memcpy(lppl->rgEnvVarOrig, pb + 15, 3);
+    lppl->uGuesses = WGet(pb + 18);
+    memcpy(lppl->rgbImp, pb + 20, 8);
+    l = LGet(pb + 28);
+    lppl->cDefenses = l & 0xfff;
+    lppl->iScanner = (l >> 12) & 0x1f;
+    lppl->unused5 = (l >> 17) & 0x1f;
+    lppl->fArtifact = (l >> 22) & 1;
+    lppl->fNoResearch = (l >> 23) & 1;
+    lppl->unused2 = (l >> 24) & 0xff;
+    lppl->rgwtMin[0] = (int32_t)LGet(pb + 32);
+    lppl->rgwtMin[1] = (int32_t)LGet(pb + 36);
+    lppl->rgwtMin[2] = (int32_t)LGet(pb + 40);
+    lppl->rgwtMin[3] = (int32_t)LGet(pb + 44);
+    lppl->lStarbase = (int32_t)LGet(pb + 48);
+    w = WGet(pb + 52);
+    lppl->idFling = w & 0x3ff;
+    lppl->iWarpFling = (w >> 10) & 0xf;
+    lppl->fNoHeal = (w >> 14) & 1;
+    lppl->unused3 = (w >> 15) & 1;
+    lppl->wRouting = WGet(pb + 54);
+    lppl->turn = (int16_t)WGet(pb + 56);
+}
+
+/* Nonzero if the two planets differ in anything the file keeps. */
+static int16_t FHistPlanetChanged(PLANET *lppl1, PLANET *lppl2)
+{
+    uint8_t rgb1[cbHistPlanet];
+    uint8_t rgb2[cbHistPlanet];
+
+    PackHistPlanet(rgb1, lppl1);
+    PackHistPlanet(rgb2, lppl2);
+    return (int16_t)(memcmp(rgb1, rgb2, cbHistPlanet) != 0);
+}
+
+static int16_t FAllocHistDb(HISTDB *phd, int16_t cpl)
+{
+    phd->rgplNew = (PLANET *)calloc(cpl > 0 ? cpl : 1, sizeof(PLANET));
+    phd->rgplCur = (PLANET *)calloc(cpl > 0 ? cpl : 1, sizeof(PLANET));
+    phd->iturnCur = -1;
+    return (int16_t)(phd->rgplNew != NULL && phd->rgplCur != NULL);
+}
+
+static int16_t FGrowHistIndex(HISTDB *phd, int16_t cturn)
+{
+    HISTTURN *rgturn;
+    int16_t cturnMax;
+
+    if (cturn <= phd->cturnMax)
+    {
+        return 1;
+    }
+    cturnMax = phd->cturnMax < 32 ? 32 : phd->cturnMax;
+    while (cturnMax < cturn)
+    {
+        cturnMax *= 2;
+    }
+    rgturn = (HISTTURN *)realloc(phd->rgturn, cturnMax * sizeof(HISTTURN));
+    if (rgturn == NULL)
+    {
+        return 0;
+    }
+    phd->rgturn = rgturn;
+    phd->cturnMax = cturnMax;
+    return 1;
+}
+
+/* Header at 0, index at hdr.ibIndex:
+ *
+ *   header  rgid[4], lidGame, iPlayer, cPlanet, cturn, cturnKey, ibIndex,
+ *           cturnIndex
+ *   index   turn, fKey, ib, cb per slot; slots past cturn are zero
+ *
+ * Writes index slots [iturnFirst, iturnLim), then the header, flushing in
+ * between so the header never points at slots that aren't there yet. */
+static int16_t FWriteHistIndex(HISTDB *phd, int16_t iturnFirst, int16_t iturnLim)
+{
+    uint8_t rgb[cbHistDbHdr];
+    HISTTURN *pturn;
+    int16_t iturn;
+
+    if (fseek(phd->fp, phd->hdr.ibIndex + (int32_t)iturnFirst * cbHistTurn, SEEK_SET) != 0)
+    {
+        return 0;
+    }
+    for (iturn = iturnFirst; iturn < iturnLim; iturn++)
+    {
+        memset(rgb, 0, cbHistTurn);
+        if (iturn < phd->hdr.cturn)
+        {
+            pturn = &phd->rgturn[iturn];
+            PutW(rgb, pturn->turn);
+            PutW(rgb + 2, (uint16_t)pturn->fKey);
+            PutL(rgb + 4, (uint32_t)pturn->ib);
+            PutL(rgb + 8, (uint32_t)pturn->cb);
+        }
+        if (fwrite(rgb, cbHistTurn, 1, phd->fp) != 1)
+        {
+            return 0;
+        }
+    }
+    if (fflush(phd->fp) != 0)
+    {
+        return 0;
+    }
+    memcpy(rgb, phd->hdr.rgid, 4);
+    PutL(rgb + 4, (uint32_t)phd->hdr.lidGame);
+    PutW(rgb + 8, (uint16_t)phd->hdr.iPlayer);
+    PutW(rgb + 10, (uint16_t)phd->hdr.cPlanet);
+    PutW(rgb + 12, (uint16_t)phd->hdr.cturn);
+    PutW(rgb + 14, (uint16_t)phd->hdr.cturnKey);
+    PutL(rgb + 16, (uint32_t)phd->hdr.ibIndex);
+    PutW(rgb + 20, (uint16_t)phd->hdr.cturnIndex);
+    if (fseek(phd->fp, 0, SEEK_SET) != 0 || fwrite(rgb, cbHistDbHdr, 1, phd->fp) != 1)
+    {
+        return 0;
+    }
+    return (int16_t)(fflush(phd->fp) == 0);
+}
+
+static int16_t FReadHistHdr(HISTDB *phd)
+{
+    uint8_t rgb[cbHistDbHdr];
+
+    if (fseek(phd->fp, 0, SEEK_SET) != 0 || fread(rgb, cbHistDbHdr, 1, phd->fp) != 1)
+    {
+        return 0;
+    }
+    memcpy(phd->hdr.rgid, rgb, 4);
+    phd->hdr.lidGame = (int32_t)LGet(rgb + 4);
+    phd->hdr.iPlayer = (int16_t)WGet(rgb + 8);
+    phd->hdr.cPlanet = (int16_t)WGet(rgb + 10);
+    phd->hdr.cturn = (int16_t)WGet(rgb + 12);
+    phd->hdr.cturnKey = (int16_t)WGet(rgb + 14);
+    phd->hdr.ibIndex = (int32_t)LGet(rgb + 16);
+    phd->hdr.cturnIndex = (int16_t)WGet(rgb + 20);
+    return 1;
+}
+
+static int16_t FReadHistIndex(HISTDB *phd)
+{
+    uint8_t rgb[cbHistTurn];
+    HISTTURN *pturn;
+    int16_t iturn;
+
+    if (fseek(phd->fp, phd->hdr.ibIndex, SEEK_SET) != 0)
+    {
+        return 0;
+    }
+    for (iturn = 0; iturn < phd->hdr.cturn; iturn++)
+    {
+        if (fread(rgb, cbHistTurn, 1, phd->fp) != 1)
+        {
+            return 0;
+        }
+        pturn = &phd->rgturn[iturn];
+        pturn->turn = WGet(rgb);
+        pturn->fKey = (int16_t)WGet(rgb + 2);
+        pturn->ib = (int32_t)LGet(rgb + 4);
+        pturn->cb = (int32_t)LGet(rgb + 8);
+    }
+    return 1;
+}
+
+/* Apply turn iturn's chunk on top of rgpl. */
+static int16_t FReadHistChunk(HISTDB *phd, int16_t iturn, PLANET *rgpl)
+{
+    HISTTURN *pturn;
+    uint8_t rgb[2 + cbHistPlanet];
+    int16_t ipl;
+    int16_t cChg;
+    int16_t i;
+
+    pturn = &phd->rgturn[iturn];
+    if (fseek(phd->fp, pturn->ib, SEEK_SET) != 0)
+    {
+        return 0;
+    }
+    phd->cchunkRead++;
+    if (pturn->fKey)
+    {
+        for (ipl = 0; ipl < phd->hdr.cPlanet; ipl++)
+        {
+            if (fread(rgb, cbHistPlanet, 1, phd->fp) != 1)
+            {
+                return 0;
+            }
+            UnpackHistPlanet(&rgpl[ipl], rgb);
+        }
+        return 1;
+    }
+    if (fread(rgb, 2, 1, phd->fp) != 1)
+    {
+        return 0;
+    }
+    cChg = (int16_t)WGet(rgb);
+    for (i = 0; i < cChg; i++)
+    {
+        if (fread(rgb, 2 + cbHistPlanet, 1, phd->fp) != 1)
+        {
+            return 0;
+        }
+        ipl = (int16_t)WGet(rgb);
+        if (ipl < 0 || ipl >= phd->hdr.cPlanet)
+        {
+            return 0;
+        }
+        UnpackHistPlanet(&rgpl[ipl], rgb + 2);
+    }
+    return 1;
+}
+
+/* rgpl = turn iturn, from the key chunk at or before it. */
+static int16_t FBuildHistTurn(HISTDB *phd, int16_t iturn, PLANET *rgpl, int16_t iturnHave)
+{
+    int16_t ikey;
+
+    for (ikey = iturn; ikey > 0 && !phd->rgturn[ikey].fKey; ikey--)
+    {
+    }
+    if (iturnHave < ikey || iturnHave > iturn)
+    {
+        iturnHave = (int16_t)(ikey - 1);
+    }
+    for (iturnHave++; iturnHave <= iturn; iturnHave++)
+    {
+        if (!FReadHistChunk(phd, iturnHave, rgpl))
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Start an empty history in fp (which must be open for update). */
+int16_t FInitHistDb(HISTDB *phd, FILE *fp, int16_t iPlayer, int16_t cpl)
+{
+    memset(phd, 0, sizeof(HISTDB));
+    phd->fp = fp;
+    if (fp == NULL)
+    {
+        return 0;
+    }
+    memcpy(phd->hdr.rgid, "HDB3", 4);
+    phd->hdr.lidGame = game.lid;
+    phd->hdr.iPlayer = iPlayer;
+    phd->hdr.cPlanet = cpl;
+    phd->hdr.cturnKey = cturnHistKey;
+    phd->hdr.ibIndex = cbHistDbHdr;
+    phd->hdr.cturnIndex = 0;
+    if (!FAllocHistDb(phd, cpl) || !FWriteHistIndex(phd, 0, 0))
+    {
+        CloseHistDb(phd);
+        return 0;
+    }
+    return 1;
+}
+
+/* Read an existing history: header, index and the newest turn only. */
+int16_t FAttachHistDb(HISTDB *phd, FILE *fp)
+{
+    int16_t iturn;
+
+    memset(phd, 0, sizeof(HISTDB));
+    phd->fp = fp;
+    if (fp == NULL)
+    {
+        return 0;
+    }
+    if (!FReadHistHdr(phd) || memcmp(phd->hdr.rgid, "HDB3", 4) != 0 || phd->hdr.lidGame != game.lid || phd->hdr.cPlanet < 0 ||
+        phd->hdr.cturn < 0 || phd->hdr.cturnIndex < phd->hdr.cturn || !FAllocHistDb(phd, phd->hdr.cPlanet) || !FGrowHistIndex(phd, phd->hdr.cturn))
+    {
+        CloseHistDb(phd);
+        return 0;
+    }
+    if (phd->hdr.cturn > 0 &&
+        (!FReadHistIndex(phd) || !FBuildHistTurn(phd, (int16_t)(phd->hdr.cturn - 1), phd->rgplNew, -1)))
+    {
+        CloseHistDb(phd);
+        return 0;
+    }
+    for (iturn = 0; iturn < phd->hdr.cturn; iturn++)
+    {
+        if (phd->rgturn[iturn].fKey)
+        {
+            phd->iturnKeyLast = iturn;
+        }
+    }
+    return 1;
+}
+
+/* szFile if it is there, otherwise a new, empty one. */
+int16_t FOpenHistDb(HISTDB *phd, char *pszFile, int16_t iPlayer, int16_t cpl)
+{
+    FILE *fp;
+
+    fp = fopen(pszFile, "r+b");
+    if (fp != NULL)
+    {
+        return FAttachHistDb(phd, fp);
+    }
+    return FInitHistDb(phd, fopen(pszFile, "w+b"), iPlayer, cpl);
+}
+
+/* Add what the player knows after turn, cPlanet planets in rgpl. Turns
+ * must be appended in increasing order. */
+int16_t FAppendHistTurn(HISTDB *phd, uint16_t turn, PLANET *rgpl)
+{
+    HISTTURN *pturn;
+    HISTDBHDR hdrOld;
+    uint8_t rgb[2 + cbHistPlanet];
+    long ib;
+    int16_t ipl;
+    int16_t cChg;
+    int16_t cpl;
+    int16_t fKey;
+    int16_t iturnFirst;
+    int16_t iturnLim;
+
+    cpl = phd->hdr.cPlanet;
+    if (phd->hdr.cturn > 0 && turn <= phd->rgturn[phd->hdr.cturn - 1].turn)
+    {
+        return 0;
+    }
+    if (phd->hdr.cturn == INT16_MAX || !FGrowHistIndex(phd, (int16_t)(phd->hdr.cturn + 1)))
+    {
+        return 0;
+    }
+
+    cChg = 0;
+    for (ipl = 0; ipl < cpl; ipl++)
+    {
+        cChg += FHistPlanetChanged(&rgpl[ipl], &phd->rgplNew[ipl]);
+    }
+    /* a delta costs an extra word per planet; past half the planets a key
+     * chunk is as small and makes older turns cheaper to reach */
+    fKey = (int16_t)(phd->hdr.cturn == 0 || phd->hdr.cturn - phd->iturnKeyLast >= phd->hdr.cturnKey ||
+                     cChg * 2 > cpl);
+
+    /* The chunk goes at the end of the file, past the index and anything a
+       failed append left there. Until the header is rewritten the file
+       still reads as it did before. */
+    if (fseek(phd->fp, 0, SEEK_END) != 0 || (ib = ftell(phd->fp)) < 0 || ib > INT32_MAX)
+    {
+        return 0;
+    }
+    pturn = &phd->rgturn[phd->hdr.cturn];
+    pturn->turn = turn;
+    pturn->fKey = fKey;
+    pturn->ib = (int32_t)ib;
+    if (fKey)
+    {
+        for (ipl = 0; ipl < cpl; ipl++)
+        {
+            PackHistPlanet(rgb, &rgpl[ipl]);
+            if (fwrite(rgb, cbHistPlanet, 1, phd->fp) != 1)
+            {
+                return 0;
+            }
+        }
+        pturn->cb = (int32_t)cpl * cbHistPlanet;
+    }
+    else
+    {
+        PutW(rgb, (uint16_t)cChg);
+        if (fwrite(rgb, 2, 1, phd->fp) != 1)
+        {
+            return 0;
+        }
+        for (ipl = 0; ipl < cpl; ipl++)
+        {
+            if (!FHistPlanetChanged(&rgpl[ipl], &phd->rgplNew[ipl]))
+            {
+                continue;
+            }
+            PutW(rgb, (uint16_t)ipl);
+            PackHistPlanet(rgb + 2, &rgpl[ipl]);
+            if (fwrite(rgb, 2 + cbHistPlanet, 1, phd->fp) != 1)
+            {
+                return 0;
+            }
+        }
+        pturn->cb = 2 + (int32_t)cChg * (2 + cbHistPlanet);
+    }
+
+    /* The index keeps spare slots, so most turns fill one in. When they
+       run out, an index twice the size goes after the chunk and the old
+       one is left behind as dead space. */
+    hdrOld = phd->hdr;
+    iturnFirst = phd->hdr.cturn;
+    phd->hdr.cturn++;
+    iturnLim = phd->hdr.cturn;
+    if (phd->hdr.cturn > phd->hdr.cturnIndex)
+    {
+        phd->hdr.ibIndex = pturn->ib + pturn->cb;
+        phd->hdr.cturnIndex = 16;
+        if (phd->hdr.cturn > INT16_MAX / 2)
+        {
+            phd->hdr.cturnIndex = INT16_MAX;
+        }
+        else if (phd->hdr.cturn > 8)
+        {
+            phd->hdr.cturnIndex = (int16_t)(phd->hdr.cturn * 2);
+        }
+        iturnFirst = 0;
+        iturnLim = phd->hdr.cturnIndex;
+    }
+    if (!FWriteHistIndex(phd, iturnFirst, iturnLim))
+    {
+        phd->hdr = hdrOld;
+        return 0;
+    }
+    if (fKey)
+    {
+        phd->iturnKeyLast = (int16_t)(phd->hdr.cturn - 1);
+    }
+    /* keep what a reader of the file would see */
+    for (ipl = 0; ipl < cpl; ipl++)
+    {
+        PackHistPlanet(rgb, &rgpl[ipl]);
+        UnpackHistPlanet(&phd->rgplNew[ipl], rgb);
+    }
+    return 1;
+}
+
+/* The planets as the player knew them after turn (the newest stored turn
+ * not after it). NULL if there is no such turn or the file is bad. The
+ * array belongs to phd and is good until the next call. */
+PLANET *LpplHistTurn(HISTDB *phd, uint16_t turn)
+{
+    int16_t iLo;
+    int16_t iHi;
+    int16_t iMid;
+
+    if (phd->hdr.cturn == 0 || turn < phd->rgturn[0].turn)
+    {
+        return NULL;
+    }
+    if (turn >= phd->rgturn[phd->hdr.cturn - 1].turn)
+    {
+        return phd->rgplNew;
+    }
+    iLo = 0;
+    iHi = (int16_t)(phd->hdr.cturn - 1);
+    while (iHi > iLo + 1)
+    {
+        iMid = (int16_t)((iLo + iHi) >> 1);
+        if (phd->rgturn[iMid].turn <= turn)
+        {
+            iLo = iMid;
+        }
+        else
+        {
+            iHi = iMid;
+        }
+    }
+    if (iLo != phd->iturnCur)
+    {
+        if (!FBuildHistTurn(phd, iLo, phd->rgplCur, phd->iturnCur))
+        {
+            phd->iturnCur = -1;
+            return NULL;
+        }
+        phd->iturnCur = iLo;
+    }
+    return phd->rgplCur;
+}
+
+void CloseHistDb(HISTDB *phd)
+{
+    if (phd->fp != NULL)
+    {
+        fclose(phd->fp);
+    }
+    free(phd->rgturn);
+    free(phd->rgplNew);
+    free(phd->rgplCur);
+    memset(phd, 0, sizeof(HISTDB));
+}
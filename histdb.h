@@ -0,0 +1,87 @@
+#ifndef HISTDB_H_
+#define HISTDB_H_
+
+#include <stdio.h>
+
+#include "types.h"
+
+/*
+ * Per-turn planet history.
+ *
+ * The classic .h file holds one copy of what a player knows about every
+ * planet, rewritten each turn by FWriteHistFile. HISTDB keeps every turn
+ * instead, as chunks appended to one file:
+ *
+ *   HISTDBHDR   id, game, player, planet count, index offset and slots
+ *   chunks      a key chunk (all cPlanet planets) every cturnKey turns or
+ *               when most planets changed; otherwise a delta chunk with
+ *               just the planets that differ from the turn before
+ *   index       one HISTTURN per turn, with spare slots at the end
+ *
+ * An append writes its chunk at the end of the file, then its index slot,
+ * then the header. When the slots run out, a new index twice the size is
+ * written after the chunk instead and the old one becomes dead space.
+ * Nothing the current header points at is overwritten, so a failed append
+ * leaves the file as it was.
+ *
+ * Opening reads the header and the index, and rebuilds the newest turn
+ * from its key chunk onwards. Older turns are only read when asked for
+ * (LpplHistTurn), and a walk forward through the turns continues from
+ * the last one built.
+ *
+ * Everything is written field by field, little-endian, in the layouts
+ * histdb.c spells out, not as native structs. Planets are stored without
+ * lpplprod; history planets have no queue.
+ *
+ * Nothing in the game opens or appends to a HISTDB yet. FWriteHistFile,
+ * which writes the classic .h file, is still a stub, and is where this
+ * would be hooked in once it is ported.
+ */
+
+#define cturnHistKey 16
+#define cbHistDbHdr 22
+#define cbHistTurn 12
+#define cbHistPlanet 58
+
+typedef struct _histdbhdr
+{
+    char rgid[4]; /* "HDB3" */
+    int32_t lidGame;
+    int16_t iPlayer;
+    int16_t cPlanet;
+    int16_t cturn;
+    int16_t cturnKey;
+    int32_t ibIndex;
+    int16_t cturnIndex; /* index slots at ibIndex */
+} HISTDBHDR;
+
+typedef struct _histturn
+{
+    uint16_t turn;
+    int16_t fKey;
+    int32_t ib;
+    int32_t cb;
+} HISTTURN;
+
+typedef struct _histdb
+{
+    FILE *fp;
+    HISTDBHDR hdr;
+    HISTTURN *rgturn;
+    int16_t cturnMax;
+    int16_t iturnKeyLast; /* newest key chunk */
+    PLANET *rgplNew;      /* the newest turn */
+    PLANET *rgplCur;      /* the last older turn asked for */
+    int16_t iturnCur;     /* which turn rgplCur holds, -1 if none */
+    int16_t cchunkRead;   /* chunks read since open */
+} HISTDB;
+
+/* functions */
+int16_t FInitHistDb(HISTDB *phd, FILE *fp, int16_t iPlayer, int16_t cpl);
+int16_t FAttachHistDb(HISTDB *phd, FILE *fp);
+int16_t FOpenHistDb(HISTDB *phd, char *pszFile, int16_t iPlayer, int16_t cpl);
+int16_t FAppendHistTurn(HISTDB *phd, uint16_t turn, PLANET *rgpl);
+PLANET *LpplHistTurn(HISTDB *phd, uint16_t turn);
+void CloseHistDb(HISTDB *phd);
+
+#endif /* HISTDB_H_ */
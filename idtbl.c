@@ -0,0 +1,124 @@
+
+#include <string.h>
+
+#include "types.h"
+#include "globals.h"
+
+#include "idtbl.h"
+
+/* globals */
+IDTBL vidtbl = {0};
+
+#define IdFleetKey(id) ((uint16_t)(id) & (cFleetIdMax - 1))
+
+void RebuildFleetIds(IDTBL *ptbl)
+{
+    FLEET *lpfl;
+    int16_t ifl;
+
+    memset(ptbl->rglpflById, 0, sizeof(ptbl->rglpflById));
+    for (ifl = 0; ifl < cFleet; ifl++)
+    {
+        lpfl = rglpfl[ifl];
+        if (lpfl != NULL)
+        {
+            ptbl->rglpflById[IdFleetKey(lpfl->id)] = lpfl;
+        }
+    }
+    ptbl->rglpflIds = rglpfl;
+    ptbl->cFleetIds = cFleet;
+    ptbl->fFleetValid = 1;
+}
+
+void RebuildThingIds(IDTBL *ptbl)
+{
+    int16_t ith;
+
+    memset(ptbl->rgithById, 0xff, sizeof(ptbl->rgithById));
+    for (ith = 0; ith < cThing; ith++)
+    {
+        ptbl->rgithById[lpThings[ith].idFull] = ith;
+    }
+    ptbl->lpThingsIds = lpThings;
+    ptbl->cThingIds = cThing;
+    ptbl->fThingValid = 1;
+}
+
+FLEET *LpflLookupId(IDTBL *ptbl, int16_t idFleet)
+{
+    FLEET *lpfl;
+
+    if (idFleet < 0)
+    {
+        return NULL;
+    }
+    if (!ptbl->fFleetValid || ptbl->rglpflIds != rglpfl || ptbl->cFleetIds != cFleet)
+    {
+        RebuildFleetIds(ptbl);
+    }
+    lpfl = ptbl->rglpflById[IdFleetKey(idFleet)];
+    if (lpfl == NULL || lpfl->id == idFleet)
+    {
+        return lpfl;
+    }
+
+    /* the fleet in that slot was renumbered or replaced: rebuild once */
+    RebuildFleetIds(ptbl);
+    lpfl = ptbl->rglpflById[IdFleetKey(idFleet)];
+    return lpfl != NULL && lpfl->id == idFleet ? lpfl : NULL;
+}
+
+THING *LpthLookupId(IDTBL *ptbl, int16_t idth)
+{
+    int16_t ith;
+
+    if (!ptbl->fThingValid || ptbl->lpThingsIds != lpThings || ptbl->cThingIds != cThing)
+    {
+        RebuildThingIds(ptbl);
+    }
+    ith = ptbl->rgithById[(uint16_t)idth];
+    if (ith >= 0 && ith < cThing && lpThings[ith].idFull == (uint16_t)idth)
+    {
+        return &lpThings[ith];
+    }
+    if (ith < 0)
+    {
+        return NULL;
+    }
+
+    /* things moved without InvalidateThingIds: rebuild once */
+    RebuildThingIds(ptbl);
+    ith = ptbl->rgithById[(uint16_t)idth];
+    return ith >= 0 ? &lpThings[ith] : NULL;
+}
+
+/* lpfl was just added to rglpfl. */
+void LinkFleetId(IDTBL *ptbl, FLEET *lpfl)
+{
+    if (!ptbl->fFleetValid)
+    {
+        return;
+    }
+    ptbl->rglpflById[IdFleetKey(lpfl->id)] = lpfl;
+    ptbl->rglpflIds = rglpfl;
+    ptbl->cFleetIds++;
+}
+
+/* lpfl is about to leave rglpfl. */
+void UnlinkFleetId(IDTBL *ptbl, FLEET *lpfl)
+{
+    if (!ptbl->fFleetValid)
+    {
+        return;
+    }
+    if (ptbl->rglpflById[IdFleetKey(lpfl->id)] == lpfl)
+    {
+        ptbl->rglpflById[IdFleetKey(lpfl->id)] = NULL;
+    }
+    ptbl->cFleetIds--;
+}
+
+void InvalidateThingIds(IDTBL *ptbl)
+{
+    ptbl->fThingValid = 0;
+}
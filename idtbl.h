@@ -0,0 +1,59 @@
+#ifndef IDTBL_H_
+#define IDTBL_H_
+
+#include "types.h"
+
+/*
+ * Dense id -> object tables.
+ *
+ * Orders, targets and log records refer to fleets and things by id, and
+ * each turn resolves a great many of them. The ids are already small dense
+ * keys:
+ *
+ *   fleet  ifl:9 iplr:4        -> 13 bits, 8192 slots
+ *   thing  id:9 iplr:4 ith:3   -> 16 bits, 65536 slots
+ *
+ * so LpflFromId and LpthFromId index a flat array instead of searching
+ * rglpfl or scanning lpThings.
+ *
+ * The fleet table holds FLEET pointers. Those stay put while rglpfl is
+ * reallocated, so it only changes when fleets are created or deleted.
+ * LinkFleetId and UnlinkFleetId keep it current without a rebuild; they
+ * belong in LpflNew/LpflNewSplit and FDeleteFleet, which are still stubs.
+ * The thing table holds lpThings indices, which shift when things are
+ * removed, so anything that compacts lpThings (CRemoveSpentMineFields)
+ * calls InvalidateThingIds.
+ *
+ * Both tables remember the array and count they were built from and
+ * rebuild on the next lookup if either differs. A lookup also checks that
+ * the object it lands on really has that id, and rebuilds once if not.
+ */
+
+#define cFleetIdMax 0x2000
+#define cThingIdMax 0x10000
+
+typedef struct _idtbl
+{
+    int16_t fFleetValid;
+    FLEET **rglpflIds; /* rglpfl / cFleet the fleet table describes */
+    int16_t cFleetIds;
+    int16_t fThingValid;
+    THING *lpThingsIds; /* lpThings / cThing the thing table describes */
+    int16_t cThingIds;
+    FLEET *rglpflById[cFleetIdMax];
+    int16_t rgithById[cThingIdMax]; /* -1: no such thing */
+} IDTBL;
+
+/* globals */
+extern IDTBL vidtbl;
+
+/* functions */
+void RebuildFleetIds(IDTBL *ptbl);
+void RebuildThingIds(IDTBL *ptbl);
+FLEET *LpflLookupId(IDTBL *ptbl, int16_t idFleet);
+THING *LpthLookupId(IDTBL *ptbl, int16_t idth);
+void LinkFleetId(IDTBL *ptbl, FLEET *lpfl);
+void UnlinkFleetId(IDTBL *ptbl, FLEET *lpfl);
+void InvalidateThingIds(IDTBL *ptbl);
+
+#endif /* IDTBL_H_ */
@@ -1,7 +1,296 @@
 
+#include <stdio.h>
+#include <string.h>
+
 #include "types.h"
 
 #include "log.h"
+#include "logbat.h"
+#include "globals.h"
+#include "file.h"
+#include "msg.h"
+#include "save.h"
+#include "util.h"
+#include "utilgen.h"
+
+static int16_t FRunWayptChgRt(int16_t rt, int16_t cb, uint8_t *lpb);
+static int16_t FRunChgProdQRt(int16_t rt, int16_t cb, uint8_t *lpb);
+static int16_t FRunBtlPlanRt(int16_t rt, int16_t cb, uint8_t *lpb);
+static int32_t LKeyWayptChgRt(int16_t rt, int16_t cb, uint8_t *lpb);
+static int32_t LKeyChgProdQRt(int16_t rt, int16_t cb, uint8_t *lpb);
+static int32_t LKeyBtlPlanRt(int16_t rt, int16_t cb, uint8_t *lpb);
+
+/* globals */
+PFNRUNLOGRT vrgpfnRunLogRt[rtLogMax] = {
+    [rtWayptChg] = FRunWayptChgRt, [rtChgProdQ] = FRunChgProdQRt, [rtBtlPlan] = FRunBtlPlanRt};
+PFNLOGRTKEY vrgpfnLogRtKey[rtLogMax] = {
+    [rtWayptChg] = LKeyWayptChgRt, [rtChgProdQ] = LKeyChgProdQRt, [rtBtlPlan] = LKeyBtlPlanRt};
+
+/* Offsets of the last few records WriteMemRt put in lpLog, oldest first.
+ * Only trusted while the newest one is still imemLogPrev, and only for
+ * the lpLog they were taken in. */
+static int16_t rgimemLogRecent[cLogRecentMax];
+static int16_t cLogRecent = 0;
+static uint8_t *lpLogRecent = NULL;
+
+/* Set one waypoint of a fleet, as LogChangeFleet logged it. */
+static int16_t FRunWayptChgRt(int16_t rt, int16_t cb, uint8_t *lpb)
+{
+    RTWAYPT rtwp;
+    FLEET *lpfl;
+
+    if (cb < (int16_t)sizeof(RTWAYPT))
+    {
+        return 0;
+    }
+    memcpy(&rtwp, lpb, sizeof(RTWAYPT));
+    lpfl = LpflFromId(rtwp.id);
+    if (lpfl == NULL || lpfl->lpplord == NULL || rtwp.iWaypt < 0 || rtwp.iWaypt >= lpfl->lpplord->iordMac)
+    {
+        return 0;
+    }
+    lpfl->lpplord->rgord[rtwp.iWaypt] = rtwp.order;
+    return 1;
+}
+
+/* Replace a planet's production queue, as LogChangePlanet logged it. A
+ * queue can only grow as far as its PLPROD already has room, as growing
+ * one takes LpplReAlloc, which isn't decompiled yet. */
+static int16_t FRunChgProdQRt(int16_t rt, int16_t cb, uint8_t *lpb)
+{
+    PLANET *lppl;
+    int16_t id;
+    int16_t cprod;
+
+    if (cb < 2 || (cb - 2) % sizeof(PROD) != 0)
+    {
+        return 0;
+    }
+    memcpy(&id, lpb, 2);
+    cprod = (int16_t)((cb - 2) / sizeof(PROD));
+    lppl = LpplFromId(id);
+    if (lppl == NULL)
+    {
+        return 0;
+    }
+    if (lppl->lpplprod == NULL)
+    {
+        return (int16_t)(cprod == 0);
+    }
+    if (cprod > lppl->lpplprod->iprodMax)
+    {
+        return 0;
+    }
+    memcpy(lppl->lpplprod->rgprod, lpb + 2, cprod * sizeof(PROD));
+    lppl->lpplprod->iprodMac = (uint8_t)cprod;
+    return 1;
+}
+
+/* Apply what LogChangeBtlplan wrote: the plan, unpacked the way
+ * UnpackBattlePlan reads it from a file, or its deletion. Not decompiled:
+ * invented as clearing the plan and putting the player's fleets that
+ * flew it back on plan 0, which every player always has. */
+static int16_t FRunBtlPlanRt(int16_t rt, int16_t cb, uint8_t *lpb)
+{
+    BTLPLAN btlplan;
+    FLEET *lpfl;
+    int16_t ifl;
+    int16_t cch;
+
+    if (cb < 2)
+    {
+        return 0;
+    }
+    memset(&btlplan, 0, sizeof(BTLPLAN));
+    memcpy(&btlplan, lpb, 2);
+    if (btlplan.iplr >= game.cPlayer || rglpbtlplan[btlplan.iplr] == NULL)
+    {
+        return 0;
+    }
+    if (btlplan.fDelete)
+    {
+        if (btlplan.iplan == 0)
+        {
+            return 0;
+        }
+        memset(&rglpbtlplan[btlplan.iplr][btlplan.iplan], 0, sizeof(BTLPLAN));
+        for (ifl = 0; ifl < cFleet; ifl++)
+        {
+            lpfl = rglpfl[ifl];
+            if (lpfl != NULL && lpfl->iPlayer == btlplan.iplr && lpfl->iplan == btlplan.iplan)
+            {
+                lpfl->iplan = 0;
+            }
+        }
+        return 1;
+    }
+    /* a plain name must end inside the record, a packed one fit szTemp */
+    if (cb < 6)
+    {
+        return 0;
+    }
+    cch = lpb[4];
+    if (cch == 0 ? memchr(lpb + 5, '\0', cb - 5) == NULL : cch > 32 || 5 + cch > cb)
+    {
+        return 0;
+    }
+    UnpackBattlePlan(lpb, &rglpbtlplan[btlplan.iplr][btlplan.iplan], (int16_t)btlplan.iplan);
+    if (rgcbtlplan[btlplan.iplr] <= btlplan.iplan)
+    {
+        rgcbtlplan[btlplan.iplr] = (uint8_t)(btlplan.iplan + 1);
+    }
+    return 1;
+}
+
+/* A battle plan record carries the whole plan. Plans are only ever logged
+ * as rtBtlPlan, so that doubles as the key's class. A deletion also moves
+ * the owner's fleets on that plan back to plan 0, which a later edit of
+ * the plan doesn't undo, so deletions stay unkeyed. */
+static int32_t LKeyBtlPlanRt(int16_t rt, int16_t cb, uint8_t *lpb)
+{
+    /* fDelete is bit 14 of the first word */
+    if (cb < 2 || (lpb[1] & 0x40))
+    {
+        return -1;
+    }
+    /* iplr:4, iplan:4 */
+    return ((int32_t)rtBtlPlan << 24) | lpb[0];
+}
+
+/* A waypoint change sets one waypoint outright. Adding or deleting one
+ * moves the waypoints after it, so those records stay unkeyed and nothing
+ * coalesces across them. */
+static int32_t LKeyWayptChgRt(int16_t rt, int16_t cb, uint8_t *lpb)
+{
+    uint16_t id;
+    uint16_t iWaypt;
+
+    if (cb < 4)
+    {
+        return -1;
+    }
+    memcpy(&id, lpb, 2);
+    memcpy(&iWaypt, lpb + 2, 2);
+    if (iWaypt > 0xff)
+    {
+        return -1;
+    }
+    /* fleet ids are ifl:9 iplr:4 */
+    return ((int32_t)rtWayptChg << 24) | ((int32_t)(id & 0x1fff) << 8) | iWaypt;
+}
+
+/* A queue record carries the planet's whole queue. */
+static int32_t LKeyChgProdQRt(int16_t rt, int16_t cb, uint8_t *lpb)
+{
+    uint16_t id;
+
+    if (cb < 2)
+    {
+        return -1;
+    }
+    memcpy(&id, lpb, 2);
+    return ((int32_t)rtChgProdQ << 24) | id;
+}
+
+/* Forget the records coalescing was looking back over. Call whenever lpLog
+ * is freed, replaced or emptied. */
+void ResetLogRecent(void)
+{
+    cLogRecent = 0;
+    lpLogRecent = lpLog;
+}
+
+static void SyncLogRecent(void)
+{
+    HDR *lprts;
+
+    if (lpLog != lpLogRecent)
+    {
+        ResetLogRecent();
+    }
+    if (cLogRecent > 0 && rgimemLogRecent[cLogRecent - 1] == imemLogPrev)
+    {
+        return;
+    }
+    cLogRecent = 0;
+    if (imemLogPrev >= 0 && imemLogPrev < imemLogCur)
+    {
+        lprts = (HDR *)(lpLog + imemLogPrev);
+        if (imemLogPrev + lprts->cb + 2 == imemLogCur)
+        {
+            rgimemLogRecent[cLogRecent++] = imemLogPrev;
+        }
+    }
+}
+
+static void PushLogRecent(int16_t imem)
+{
+    if (cLogRecent == cLogRecentMax)
+    {
+        memmove(rgimemLogRecent, rgimemLogRecent + 1, (cLogRecentMax - 1) * sizeof(int16_t));
+        cLogRecent--;
+    }
+    rgimemLogRecent[cLogRecent++] = imem;
+}
+
+/* Remove recent record irec from lpLog, closing the gap. */
+static void DropLogRecent(int16_t irec)
+{
+    HDR *lprts;
+    int16_t imem;
+    int16_t cbOld;
+    int16_t i;
+
+    imem = rgimemLogRecent[irec];
+    lprts = (HDR *)(lpLog + imem);
+    cbOld = (int16_t)(lprts->cb + 2);
+    memmove(lpLog + imem, lpLog + imem + cbOld, imemLogCur - imem - cbOld);
+    imemLogCur = (int16_t)(imemLogCur - cbOld);
+    for (i = irec + 1; i < cLogRecent; i++)
+    {
+        rgimemLogRecent[i - 1] = (int16_t)(rgimemLogRecent[i] - cbOld);
+    }
+    cLogRecent--;
+    imemLogPrev = cLogRecent > 0 ? rgimemLogRecent[cLogRecent - 1] : -1;
+}
+
+/* A record that sets an object outright makes an earlier one for the same
+ * object and type dead, as long as nothing between them could have looked
+ * at that object: every record in between must be keyed, and keyed to a
+ * different object. Replaying what is left ends in the same universe. */
+static void CoalesceMemRt(int16_t rt, int16_t cb, uint8_t *lpb)
+{
+    PFNLOGRTKEY pfn;
+    HDR *lprts;
+    int32_t lKey;
+    int32_t lKeyOld;
+    int16_t irec;
+
+    pfn = vrgpfnLogRtKey[rt];
+    SyncLogRecent();
+    if (pfn == NULL || (lKey = pfn(rt, cb, lpb)) < 0)
+    {
+        return;
+    }
+    for (irec = (int16_t)(cLogRecent - 1); irec >= 0; irec--)
+    {
+        lprts = (HDR *)(lpLog + rgimemLogRecent[irec]);
+        pfn = vrgpfnLogRtKey[lprts->rt];
+        lKeyOld = pfn == NULL ? -1 : pfn((int16_t)lprts->rt, (int16_t)lprts->cb, (uint8_t *)(lprts + 1));
+        if (lKeyOld < 0)
+        {
+            return;
+        }
+        if (lKeyOld == lKey)
+        {
+            if (lprts->rt == rt)
+            {
+                DropLogRecent(irec);
+            }
+            return;
+        }
+    }
+}
 
 /* functions */
 void WriteMemRt(int16_t rt, int16_t cb, void *rg)
@@ -9,7 +298,32 @@ void WriteMemRt(int16_t rt, int16_t cb, void *rg)
     HDR hdr;
     uint8_t * lpv;
 
-    /* TODO: implement */
+    if (fLogOff)
+    {
+        return;
+    }
+    if (imemLogCur + cb + 2 > 32000)
+    {
+        AlertSz(PszFormatIds(0x10, NULL), 0x10);
+    }
+    DirtyGame(1);
+    CoalesceMemRt(rt, cb, (uint8_t *)rg);
+
+    imemLogPrev = imemLogCur;
+    hdr.rt = (uint16_t)rt;
+    hdr.cb = (uint16_t)cb;
+    lpv = lpLog + imemLogCur;
+    memcpy(lpv, &hdr, sizeof(HDR));
+    if (cb > 0)
+    {
+        memcpy(lpv + sizeof(HDR), rg, cb);
+    }
+    imemLogCur = (int16_t)(imemLogCur + cb + 2);
+    PushLogRecent(imemLogPrev);
+    if (rt != 0)
+    {
+        hdrPrev = hdr;
+    }
 }
 
 int16_t FWriteLogFile(char *pszFileBase, int16_t iPlayer)
@@ -59,6 +373,8 @@ int16_t FLoadLogFile(char *pszLog)
     /* label Done @ MEMORY_PLANET:0xcc76 */
 
     /* TODO: implement */
+    /* lpLog is replaced here: drop what coalescing remembered of the old */
+    ResetLogRecent();
     return 0;
 }
 
@@ -105,8 +421,17 @@ int16_t FGetPrevLogRt(HDR *phdr, uint8_t *pb)
 {
     uint8_t * lpv;
 
-    /* TODO: implement */
-    return 0;
+    if (imemLogPrev < 0 || imemLogPrev >= imemLogCur)
+    {
+        return 0;
+    }
+    lpv = lpLog + imemLogPrev;
+    memcpy(phdr, lpv, sizeof(HDR));
+    if (phdr->cb > 0)
+    {
+        memcpy(pb, lpv + sizeof(HDR), phdr->cb);
+    }
+    return 1;
 }
 
 void LogChangeThing(THING *lpth, THING *pthNew)
@@ -125,10 +450,31 @@ void LogChangePlanet(PLANET *ppl, PLANET *pplNew)
     HDR hdr;
     LOGXFER lxNew;
 
+    uint8_t rgb[2 + 255 * sizeof(PROD)];
+    int16_t cprod;
+    int16_t cprodNew;
+
     /* debug symbols */
     /* label ChgIt @ MEMORY_PLANET:0x953a */
 
     /* TODO: implement */
+    /* Not decompiled: invented as logging only the production queue, whole,
+     * when it changed. WriteMemRt coalesces it with an earlier queue record
+     * for the same planet. */
+    cprod = ppl->lpplprod == NULL ? 0 : ppl->lpplprod->iprodMac;
+    cprodNew = pplNew->lpplprod == NULL ? 0 : pplNew->lpplprod->iprodMac;
+    fChg = cprod != cprodNew ||
+           (cprod != 0 && memcmp(ppl->lpplprod->rgprod, pplNew->lpplprod->rgprod, cprod * sizeof(PROD)) != 0);
+    if (!fChg)
+    {
+        return;
+    }
+    memcpy(rgb, &pplNew->id, 2);
+    if (cprodNew != 0)
+    {
+        memcpy(rgb + 2, pplNew->lpplprod->rgprod, cprodNew * sizeof(PROD));
+    }
+    WriteMemRt(rtChgProdQ, (int16_t)(2 + cprodNew * sizeof(PROD)), rgb);
 }
 
 int16_t FCheckLogFile(int16_t iplr, int16_t *pfError)
@@ -138,18 +484,41 @@ int16_t FCheckLogFile(int16_t iplr, int16_t *pfError)
     int16_t fRet;
     int16_t cbLog;
     int16_t iCur;
+    LOGSTREAM ls;
+    LOGBATCH lb;
+    FILE *fp;
+    char szLog[256 + 8];
 
     /* debug symbols */
     /* label Done @ MEMORY_PLANET:0xcdde */
 
-    /* TODO: implement */
-    return 0;
+    /* no log yet is not an error, just nothing to check */
+    *pfError = 0;
+    (void)snprintf(szLog, sizeof(szLog), "%s.x%d", szBase, iplr + 1);
+    fp = fopen(szLog, "rb");
+    if (fp == NULL)
+    {
+        return 0;
+    }
+    if (!FAttachLogStream(&ls, fp, iplr))
+    {
+        *pfError = 1;
+        return 0;
+    }
+
+    /* decode and validate only; nothing is applied */
+    memset(&lb, 0, sizeof(lb));
+    fRet = FDecodeLogBatch(&lb, iplr, &ls);
+    CloseLogStream(&ls);
+    *pfError = (int16_t)(!fRet || lb.crtBad != 0);
+    FreeLogBatch(&lb);
+    return fRet;
 }
 
 void LogChangeBtlplan(BTLPLAN *pbtlplan)
 {
 
-    /* TODO: implement */
+    WriteBattlePlan(pbtlplan, 1);
 }
 
 void LogChangeRelations(void)
@@ -199,8 +568,13 @@ int16_t FRunLogRecord(int16_t rt, int16_t cb, uint8_t *lpb)
     /* label BombOut @ MEMORY_PLANET:0xc416 */
     /* label DoNext @ MEMORY_PLANET:0xb71d */
 
-    /* TODO: implement */
-    return 0;
+    /* one handler per record type instead of one big switch */
+    if (rt < 0 || rt >= rtLogMax || vrgpfnRunLogRt[rt] == NULL)
+    {
+        /* TODO: implement (port each case as a handler in vrgpfnRunLogRt) */
+        return 0;
+    }
+    return vrgpfnRunLogRt[rt](rt, cb, lpb);
 }
 
 int16_t FWriteHistFile(int16_t iPlayer)
@@ -225,7 +599,29 @@ int16_t FWriteHistFile(int16_t iPlayer)
 void CancelMemRt(int16_t rt)
 {
 
-    /* TODO: implement */
+    /* take back the last record, if it is an rt */
+    if (fLogOff || imemLogPrev < 0 || imemLogPrev >= imemLogCur || ((HDR *)(lpLog + imemLogPrev))->rt != rt)
+    {
+        return;
+    }
+    SyncLogRecent();
+    if (cLogRecent > 0)
+    {
+        DropLogRecent((int16_t)(cLogRecent - 1));
+    }
+    else
+    {
+        imemLogCur = imemLogPrev;
+        imemLogPrev = -1;
+    }
+    if (imemLogPrev >= 0)
+    {
+        memcpy(&hdrPrev, lpLog + imemLogPrev, sizeof(HDR));
+    }
+    else
+    {
+        memset(&hdrPrev, 0, sizeof(HDR));
+    }
 }
 
 void LogMakeValidXferf(LOGXFERF *plxf1, LOGXFERF *plxf2)
@@ -248,8 +644,20 @@ int16_t FRunLogFile(void)
     int16_t iCur;
     HDR * lprts;
 
-    /* TODO: implement */
-    return 0;
+    fLogOld = fLogOff;
+    fRet = 1;
+    if (imemLogCur != 0)
+    {
+        fLogOff = 1;
+        for (iCur = 0; iCur < imemLogCur; iCur = (int16_t)(iCur + lprts->cb + 2))
+        {
+            lprts = (HDR *)(lpLog + iCur);
+            fRet &= FRunLogRecord((int16_t)lprts->rt, (int16_t)lprts->cb, lpLog + iCur + 2);
+        }
+        gd.fFleetLinkValid = 0;
+    }
+    fLogOff = fLogOld;
+    return fRet;
 }
 
 void LogMakeValidXfer(LOGXFER *plx1, LOGXFER *plx2)
@@ -294,6 +702,25 @@ void LogChangeFleet(FLEET *pfl, FLEET *pflNew)
     /* label NextTest @ MEMORY_PLANET:0x9337 */
 
     /* TODO: implement */
+    /* Not decompiled: invented as logging only the waypoints changed in
+     * place, one record each; added and deleted waypoints aren't logged
+     * yet. WriteMemRt coalesces each with an earlier change to the same
+     * waypoint. */
+    if (pfl->lpplord == NULL || pflNew->lpplord == NULL || pfl->lpplord->iordMac != pflNew->lpplord->iordMac)
+    {
+        return;
+    }
+    for (i = 0; i < pflNew->lpplord->iordMac; i++)
+    {
+        if (memcmp(&pfl->lpplord->rgord[i], &pflNew->lpplord->rgord[i], sizeof(ORDER)) == 0)
+        {
+            continue;
+        }
+        rtwp.id = pflNew->id;
+        rtwp.iWaypt = i;
+        rtwp.order = pflNew->lpplord->rgord[i];
+        WriteMemRt(rtWayptChg, sizeof(RTWAYPT), &rtwp);
+    }
 }
 
 void LogChangeName(int16_t grobj, int16_t id, char *szName)
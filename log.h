@@ -4,6 +4,25 @@
 
 #include "types.h"
 
+#define rtLogMax 64 /* HDR.rt is 6 bits */
+
+#define rtWayptChg 0x05 /* RTWAYPT: one waypoint of a fleet */
+#define rtChgProdQ 0x1d /* RTCHGPRODQ: a planet's whole production queue */
+#define rtBtlPlan 0x1e
+#define cLogRecentMax 32 /* records WriteMemRt looks back over to coalesce */
+
+/* Applies one order-log record; nonzero if it went through. */
+typedef int16_t (*PFNRUNLOGRT)(int16_t rt, int16_t cb, uint8_t *lpb);
+
+/* The object a record sets outright, as (object class << 24 | object),
+ * or -1 if the record is a delta that must stay as written. Records about
+ * the same object give the same key whatever their type. */
+typedef int32_t (*PFNLOGRTKEY)(int16_t rt, int16_t cb, uint8_t *lpb);
+
+/* globals */
+extern PFNRUNLOGRT vrgpfnRunLogRt[rtLogMax];
+extern PFNLOGRTKEY vrgpfnLogRtKey[rtLogMax];
+
 /* functions */
 void WriteMemRt(int16_t rt, int16_t cb, void *rg);  /* MEMORY_PLANET:0xa130 */
 int16_t FWriteLogFile(char *pszFileBase, int16_t iPlayer);  /* MEMORY_PLANET:0xcdf6 */
@@ -14,6 +33,7 @@ void LogSplitFleet(int16_t id);  /* MEMORY_PLANET:0x8b0e */
 int16_t FWriteTutorialMFile(int16_t iTurn);  /* MEMORY_PLANET:0xd058 */
 void EnumLogRts(int16_t (*pfn)(void *, int16_t, int16_t, void *, int16_t), void *lpPass, int16_t iPass);  /* MEMORY_PLANET:0xd6e0 */
 int16_t FGetPrevLogRt(HDR *phdr, uint8_t *pb);  /* MEMORY_PLANET:0xa25e */
+void ResetLogRecent(void);
 void LogChangeThing(THING *lpth, THING *pthNew);  /* MEMORY_PLANET:0x9908 */
 void LogChangePlanet(PLANET *ppl, PLANET *pplNew);  /* MEMORY_PLANET:0x9420 */
 int16_t FCheckLogFile(int16_t iplr, int16_t *pfError);  /* MEMORY_PLANET:0xcccc */
@@ -0,0 +1,211 @@
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "types.h"
+#include "globals.h"
+
+#include "logbat.h"
+
+static int16_t FCheckWayptChgRt(int16_t iplr, int16_t rt, int16_t cb, uint8_t *lpb);
+static int16_t FCheckChgProdQRt(int16_t iplr, int16_t rt, int16_t cb, uint8_t *lpb);
+static int16_t FCheckBtlPlanRt(int16_t iplr, int16_t rt, int16_t cb, uint8_t *lpb);
+
+/* globals */
+PFNCHECKLOGRT vrgpfnCheckLogRt[rtLogMax] = {
+    [rtWayptChg] = FCheckWayptChgRt, [rtChgProdQ] = FCheckChgProdQRt, [rtBtlPlan] = FCheckBtlPlanRt};
+
+#define rtEOF 0
+#define rtBOF 8
+
+/* A player moves only its own fleets; fleet ids are ifl:9 iplr:4. */
+static int16_t FCheckWayptChgRt(int16_t iplr, int16_t rt, int16_t cb, uint8_t *lpb)
+{
+    RTWAYPT rtwp;
+
+    if (cb != (int16_t)sizeof(RTWAYPT))
+    {
+        return 0;
+    }
+    memcpy(&rtwp, lpb, sizeof(RTWAYPT));
+    return (int16_t)(((rtwp.id >> 9) & 0xf) == iplr && rtwp.iWaypt >= 0);
+}
+
+/* A whole number of PRODs for a planet that exists. Who owns the planet
+ * isn't checked: LpplFromId may decode it, which a validator must not. */
+static int16_t FCheckChgProdQRt(int16_t iplr, int16_t rt, int16_t cb, uint8_t *lpb)
+{
+    int16_t id;
+
+    if (cb < 2 || (cb - 2) % sizeof(PROD) != 0)
+    {
+        return 0;
+    }
+    memcpy(&id, lpb, 2);
+    return (int16_t)(id >= 0 && id < game.cPlanMax);
+}
+
+/* A player edits only its own battle plans and never deletes plan 0. A
+ * plain name must end inside the record, a packed one fit in 32 bytes. */
+static int16_t FCheckBtlPlanRt(int16_t iplr, int16_t rt, int16_t cb, uint8_t *lpb)
+{
+    BTLPLAN btlplan;
+    int16_t cch;
+
+    if (cb < 2)
+    {
+        return 0;
+    }
+    memcpy(&btlplan, lpb, 2);
+    if (btlplan.iplr != iplr)
+    {
+        return 0;
+    }
+    if (btlplan.fDelete)
+    {
+        return (int16_t)(btlplan.iplan != 0);
+    }
+    if (cb < 6)
+    {
+        return 0;
+    }
+    cch = lpb[4];
+    if (cch == 0)
+    {
+        return (int16_t)(memchr(lpb + 5, '\0', cb - 5) != NULL);
+    }
+    return (int16_t)(cch <= 32 && 5 + cch <= cb);
+}
+
+static void ResetLogBatch(LOGBATCH *plb, int16_t iplr)
+{
+    plb->iplr = iplr;
+    plb->fLoaded = 0;
+    plb->fError = 0;
+    plb->crt = 0;
+    plb->crtBad = 0;
+    plb->cb = 0;
+}
+
+/* Read the rest of pls into plb, keeping the records their validators
+ * accept. Writes nothing but plb (and closes nothing; the caller owns pls).
+ * Returns 0 if the log is short or corrupt. */
+int16_t FDecodeLogBatch(LOGBATCH *plb, int16_t iplr, LOGSTREAM *pls)
+{
+    PFNCHECKLOGRT pfn;
+    uint8_t *pb;
+    int16_t rt;
+    int16_t cb;
+
+    ResetLogBatch(plb, iplr);
+    /* cbLeft is the unsigned cbLog less what has been read already */
+    if (pls->cbLeft > plb->cbMax)
+    {
+        pb = (uint8_t *)realloc(plb->pb, (size_t)pls->cbLeft);
+        if (pb == NULL)
+        {
+            plb->fError = 1;
+            return 0;
+        }
+        plb->pb = pb;
+        plb->cbMax = pls->cbLeft;
+    }
+    while (FNextLogStreamRt(pls))
+    {
+        rt = (int16_t)pls->hdr.rt;
+        cb = (int16_t)pls->hdr.cb;
+        /* a record type nobody checks is turned down, not waved through */
+        pfn = vrgpfnCheckLogRt[rt];
+        if (pfn == NULL || !pfn(iplr, rt, cb, pls->rgb))
+        {
+            plb->crtBad++;
+            continue;
+        }
+        /* FNextLogStreamRt keeps the records inside cbLeft */
+        memcpy(plb->pb + plb->cb, &pls->hdr, sizeof(HDR));
+        memcpy(plb->pb + plb->cb + sizeof(HDR), pls->rgb, cb);
+        plb->cb += cb + sizeof(HDR);
+        plb->crt++;
+    }
+    plb->fError = pls->fError;
+    plb->fLoaded = !pls->fError;
+    return plb->fLoaded;
+}
+
+/* Decode every player's szBase.x<n>. Each player only touches its own
+ * batch, so the loop can be split across workers. Returns the number of
+ * logs decoded; players with no log just get an fError batch. */
+int16_t CDecodeLogBatches(LOGBATCH *rglb, int16_t cplr)
+{
+    LOGSTREAM ls;
+    char szLog[256 + 8];
+    int16_t iplr;
+    int16_t cLoaded;
+
+    cLoaded = 0;
+    for (iplr = 0; iplr < cplr; iplr++)
+    {
+        ResetLogBatch(&rglb[iplr], iplr);
+        (void)snprintf(szLog, sizeof(szLog), "%s.x%d", szBase, iplr + 1);
+        if (!FOpenLogStream(&ls, szLog, iplr))
+        {
+            rglb[iplr].fError = 1;
+            continue;
+        }
+        cLoaded += FDecodeLogBatch(&rglb[iplr], iplr, &ls);
+        CloseLogStream(&ls);
+    }
+    return cLoaded;
+}
+
+/* Replay one decoded batch, like FRunLogFile does lpLog. */
+int16_t FApplyLogBatch(LOGBATCH *plb)
+{
+    HDR *lprts;
+    int16_t fLogOld;
+    int16_t fRet;
+    int32_t iCur;
+
+    if (!plb->fLoaded)
+    {
+        return 0;
+    }
+    fLogOld = fLogOff;
+    fLogOff = 1;
+    fRet = 1;
+    for (iCur = 0; iCur < plb->cb; iCur += lprts->cb + sizeof(HDR))
+    {
+        lprts = (HDR *)(plb->pb + iCur);
+        fRet &= FRunLogRecord((int16_t)lprts->rt, (int16_t)lprts->cb, plb->pb + iCur + sizeof(HDR));
+    }
+    if (plb->crt != 0)
+    {
+        gd.fFleetLinkValid = 0;
+    }
+    fLogOff = fLogOld;
+    return fRet;
+}
+
+/* The serial phase: players in order, each player's records in order. */
+int16_t FApplyLogBatches(LOGBATCH *rglb, int16_t cplr)
+{
+    int16_t iplr;
+    int16_t fRet;
+
+    fRet = 1;
+    for (iplr = 0; iplr < cplr; iplr++)
+    {
+        if (rglb[iplr].fLoaded)
+        {
+            fRet &= FApplyLogBatch(&rglb[iplr]);
+        }
+    }
+    return fRet;
+}
+
+void FreeLogBatch(LOGBATCH *plb)
+{
+    free(plb->pb);
+    memset(plb, 0, sizeof(LOGBATCH));
+}
@@ -0,0 +1,54 @@
+#ifndef LOGBAT_H_
+#define LOGBAT_H_
+
+#include "types.h"
+#include "log.h"
+#include "logstrm.h"
+
+/*
+ * Two-phase handling of the players' order logs on the host.
+ *
+ * Decode: each player's log is read (through a LOGSTREAM) into that
+ * player's LOGBATCH, and every record is checked by the vrgpfnCheckLogRt
+ * validator for its type. A record type with no validator is rejected.
+ * Validators only read the pre-turn universe and the batch only writes its
+ * own LOGBATCH, so the players can be decoded in any order, or side by
+ * side.
+ *
+ * Apply: FApplyLogBatches replays the accepted records through
+ * FRunLogRecord, player after player, in the order they were logged.
+ *
+ * A batch keeps its records in the lpLog layout (HDR, then payload). It is
+ * sized from the unsigned log length, so a log of 32K or more is fine.
+ *
+ * FCheckLogFile decodes through FDecodeLogBatch. CDecodeLogBatches and
+ * FApplyLogBatches are not wired in: the host's turn generation
+ * (FGenerateTurn) is still a stub, and they are here for it.
+ */
+
+/* Nonzero if the record may be applied for iplr. Must not write game state. */
+typedef int16_t (*PFNCHECKLOGRT)(int16_t iplr, int16_t rt, int16_t cb, uint8_t *lpb);
+
+typedef struct _logbatch
+{
+    int16_t iplr;
+    int16_t fLoaded; /* log read to the end */
+    int16_t fError;  /* missing, foreign or corrupt log */
+    int16_t crt;     /* records accepted */
+    int16_t crtBad;  /* records a validator turned down */
+    int32_t cb;      /* bytes used in pb */
+    int32_t cbMax;
+    uint8_t *pb;
+} LOGBATCH;
+
+/* globals */
+extern PFNCHECKLOGRT vrgpfnCheckLogRt[rtLogMax];
+
+/* functions */
+int16_t FDecodeLogBatch(LOGBATCH *plb, int16_t iplr, LOGSTREAM *pls);
+int16_t CDecodeLogBatches(LOGBATCH *rglb, int16_t cplr);
+int16_t FApplyLogBatch(LOGBATCH *plb);
+int16_t FApplyLogBatches(LOGBATCH *rglb, int16_t cplr);
+void FreeLogBatch(LOGBATCH *plb);
+
+#endif /* LOGBAT_H_ */
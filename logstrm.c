@@ -0,0 +1,161 @@
+
+#include <stdio.h>
+#include <string.h>
+
+#include "types.h"
+#include "globals.h"
+
+#include "logstrm.h"
+#include "log.h"
+#include "utilgen.h"
+
+#define rtEOF 0
+#define rtBOF 8
+#define dtLog 1
+
+/* the RTBOF versions FOpenFile takes */
+#define verMajorLog 2
+#define verMinorLogFirst 0x31
+#define verMinorLogLast 0x53
+
+/* One record off the file: header, then payload decrypted in place. */
+static int16_t FReadLogStreamRt(LOGSTREAM *pls)
+{
+    if (fread(&pls->hdr, 1, 2, pls->fp) != 2 ||
+        (pls->hdr.cb != 0 && fread(pls->rgb, 1, pls->hdr.cb, pls->fp) != pls->hdr.cb))
+    {
+        pls->fError = 1;
+        return 0;
+    }
+    if (pls->hdr.rt == rtBOF)
+    {
+        memcpy(&pls->rtbof, pls->rgb, sizeof(RTBOF));
+        InitXorSeeds(&pls->lSeed1, &pls->lSeed2, pls->rtbof.lidGame, pls->rtbof.lSaltTime, (int16_t)pls->rtbof.turn,
+                     pls->rtbof.iPlayer, (int16_t)pls->rtbof.fCrippled);
+    }
+    else if (pls->hdr.rt != rtEOF)
+    {
+        XorBufSeeds(pls->rgb, (int16_t)pls->hdr.cb, &pls->lSeed1, &pls->lSeed2);
+    }
+    return 1;
+}
+
+/* The BOF checks FOpenFile makes of player iPlayer's .x file. */
+static int16_t FLogStreamBofOk(LOGSTREAM *pls, int16_t iPlayer)
+{
+    RTBOF *prtbof;
+
+    prtbof = &pls->rtbof;
+    if (pls->hdr.rt != rtBOF || pls->hdr.cb < sizeof(RTBOF) || memcmp(prtbof->rgid, "J3J3", 4) != 0)
+    {
+        return 0;
+    }
+    if (prtbof->verMajor != verMajorLog || prtbof->verMinor < verMinorLogFirst || prtbof->verMinor > verMinorLogLast)
+    {
+        return 0;
+    }
+    if (prtbof->dt != dtLog || prtbof->iPlayer != iPlayer)
+    {
+        return 0;
+    }
+    if (prtbof->lidGame != game.lid || prtbof->turn != game.turn)
+    {
+        return 0;
+    }
+    /* written against this generation of the turn, bar the tutorial */
+    return (int16_t)(game.fTutorial || prtbof->wGen == game.wGen);
+}
+
+/* Take over player iPlayer's open .x log and read up to its first record.
+ * Fails (and closes fp) if the file isn't that player's log for this
+ * game and turn. */
+int16_t FAttachLogStream(LOGSTREAM *pls, FILE *fp, int16_t iPlayer)
+{
+    int16_t fOk;
+
+    memset(pls, 0, sizeof(LOGSTREAM));
+    pls->fp = fp;
+    if (pls->fp == NULL)
+    {
+        return 0;
+    }
+    fOk = FReadLogStreamRt(pls) && FLogStreamBofOk(pls, iPlayer) && FReadLogStreamRt(pls) && pls->hdr.cb >= 6;
+    if (!fOk)
+    {
+        CloseLogStream(pls);
+        return 0;
+    }
+    /* RTLOGHDR is packed on disk: cbLog, lSerialNumber, rgbConfig */
+    memcpy(&pls->rtlh.cbLog, pls->rgb, 2);
+    memcpy(&pls->rtlh.lSerialNumber, pls->rgb + 2, 4);
+    memcpy(pls->rtlh.rgbConfig, pls->rgb + 6, pls->hdr.cb - 6 < 11 ? pls->hdr.cb - 6 : 11);
+    pls->cbLeft = (uint16_t)pls->rtlh.cbLog;
+    return 1;
+}
+
+int16_t FOpenLogStream(LOGSTREAM *pls, char *pszLog, int16_t iPlayer)
+{
+    return FAttachLogStream(pls, fopen(pszLog, "rb"), iPlayer);
+}
+
+/* Step to the next order record. Returns 0 once cbLog bytes have been
+ * read, or on a short or corrupt file (fError). */
+int16_t FNextLogStreamRt(LOGSTREAM *pls)
+{
+    if (pls->fp == NULL || pls->fError || pls->cbLeft <= 0)
+    {
+        return 0;
+    }
+    if (!FReadLogStreamRt(pls) || pls->hdr.rt == rtEOF || pls->hdr.rt == rtBOF || pls->hdr.cb + 2 > pls->cbLeft)
+    {
+        pls->fError = 1;
+        return 0;
+    }
+    pls->cbLeft -= pls->hdr.cb + 2;
+    return 1;
+}
+
+/* Replay every order record, like FRunLogFile does from lpLog. */
+int16_t FRunLogStream(LOGSTREAM *pls)
+{
+    int16_t fLogOld;
+    int16_t fRet;
+
+    fLogOld = fLogOff;
+    fLogOff = 1;
+    fRet = 1;
+    while (FNextLogStreamRt(pls))
+    {
+        fRet &= FRunLogRecord((int16_t)pls->hdr.rt, (int16_t)pls->hdr.cb, pls->rgb);
+    }
+    if (pls->rtlh.cbLog != 0)
+    {
+        gd.fFleetLinkValid = 0;
+    }
+    fLogOff = fLogOld;
+    return (int16_t)(fRet && !pls->fError);
+}
+
+void CloseLogStream(LOGSTREAM *pls)
+{
+    if (pls->fp != NULL)
+    {
+        fclose(pls->fp);
+        pls->fp = NULL;
+    }
+}
+
+/* Open, replay and close one player's log without loading it. */
+int16_t FRunLogFileStream(char *pszLog, int16_t iPlayer)
+{
+    LOGSTREAM ls;
+    int16_t fRet;
+
+    if (!FOpenLogStream(&ls, pszLog, iPlayer))
+    {
+        return 0;
+    }
+    fRet = FRunLogStream(&ls);
+    CloseLogStream(&ls);
+    return fRet;
+}
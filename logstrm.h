@@ -0,0 +1,55 @@
+#ifndef LOGSTRM_H_
+#define LOGSTRM_H_
+
+#include <stdio.h>
+
+#include "types.h"
+
+/*
+ * Streaming order-log replay.
+ *
+ * FLoadLogFile copies a player's whole .x log into lpLog, and FRunLogFile
+ * replays it from there. A host applying sixteen logs then keeps all
+ * sixteen resident at once. LOGSTREAM replays straight from the file
+ * instead. It reads one record at a time into a fixed buffer, decrypts it
+ * and hands it to FRunLogRecord (and so to the vrgpfnRunLogRt handler for
+ * its type). A stream's memory is the buffer, whatever the size of the
+ * log.
+ *
+ * The file is read the way ReadRt reads it:
+ *
+ *   BOF       RTBOF, plain; seeds the XOR stream (SetFileXorStream).
+ *             Checked as FOpenFile checks a .x file: a 2.6 version,
+ *             this player, game and turn, and the wGen of the game
+ *             (game.wCrap) unless it's the tutorial
+ *   log hdr   RTLOGHDR; cbLog is the byte count of the records below
+ *   records   cbLog bytes of HDR + payload, each payload XorFileBuf'd
+ *   ...       player messages and EOF, which replay doesn't need
+ *
+ * Each LOGSTREAM keeps its own XOR seeds (InitXorSeeds, XorBufSeeds) and
+ * never touches the global file seeds, so streams for several players
+ * can be read interleaved, or on different threads.
+ */
+
+typedef struct _logstream
+{
+    FILE *fp;
+    RTBOF rtbof;
+    RTLOGHDR rtlh;
+    int32_t lSeed1; /* this stream's XOR state */
+    int32_t lSeed2;
+    int32_t cbLeft; /* log bytes not read yet */
+    int16_t fError;
+    HDR hdr;         /* current record */
+    uint8_t rgb[1024]; /* its payload; HDR.cb is 10 bits */
+} LOGSTREAM;
+
+/* functions */
+int16_t FAttachLogStream(LOGSTREAM *pls, FILE *fp, int16_t iPlayer);
+int16_t FOpenLogStream(LOGSTREAM *pls, char *pszLog, int16_t iPlayer);
+int16_t FNextLogStreamRt(LOGSTREAM *pls);
+int16_t FRunLogStream(LOGSTREAM *pls);
+void CloseLogStream(LOGSTREAM *pls);
+int16_t FRunLogFileStream(char *pszLog, int16_t iPlayer);
+
+#endif /* LOGSTRM_H_ */
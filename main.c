@@ -3,11 +3,55 @@
 #include "types.h"
 #include "strings.h"
 #include "util.h"
+#include "btlexp.h"
+
+/* stars_cli battles <file.mN> [out.ndjson] */
+static int CmdBattles(int argc, char **argv)
+{
+    FILE *pfIn;
+    FILE *pfOut;
+    int32_t cBattle;
+
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage: %s battles <file.mN> [out.ndjson]\n", argv[0]);
+        return 2;
+    }
+    pfIn = fopen(argv[2], "rb");
+    if (pfIn == NULL)
+    {
+        perror(argv[2]);
+        return 1;
+    }
+    pfOut = stdout;
+    if (argc > 3 && (pfOut = fopen(argv[3], "w")) == NULL)
+    {
+        perror(argv[3]);
+        fclose(pfIn);
+        return 1;
+    }
+
+    cBattle = CExportBattlesNdjson(pfIn, pfOut);
+
+    fclose(pfIn);
+    if (pfOut != stdout)
+    {
+        fclose(pfOut);
+    }
+    if (cBattle < 0)
+    {
+        fprintf(stderr, "%s: not a Stars! file or bad battle record\n", argv[2]);
+        return 1;
+    }
+    return 0;
+}
 
 int main(int argc, char **argv)
 {
-    (void)argc;
-    (void)argv;
+    if (argc > 1 && strcmp(argv[1], "battles") == 0)
+    {
+        return CmdBattles(argc, argv);
+    }
 
     printf("stars CLI %s\n", SzVersion());
 
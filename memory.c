@@ -2,6 +2,7 @@
 #include "types.h"
 
 #include "memory.h"
+#include "btllog.h"
 #include "msg.h"
 #include "strings.h"
 #include "utilgen.h"
@@ -104,6 +105,10 @@ void ResetHb(HeapType ht)
     {
         return;
     }
+    if (ht == htBattle)
+    {
+        InvalidateBtlLog();
+    }
 
     lphb = rglphb[(uint16_t)ht];
     while (lphb != NULL)
@@ -144,6 +149,10 @@ HB *LphbReAlloc(HB *lphb)
     hmem = lphb->hmem;
     cbCur = lphb->cbBlock;
     ht = lphb->ht;
+    if (ht == htBattle)
+    {
+        InvalidateBtlLog();
+    }
 
     cbGrow = mphtcbAlloc[(uint16_t)ht];
 
@@ -329,6 +338,11 @@ HB *LphbAlloc(uint16_t cb, HeapType ht)
     lphb->ibTop = cbHdr;
     lphb->ht = (uint8_t)ht;
 
+    if (ht == htBattle)
+    {
+        InvalidateBtlLog();
+    }
+
     /* push on head of heap list */
     lphb->lphbNext = rglphb[(uint16_t)ht];
     rglphb[(uint16_t)ht] = lphb;
@@ -346,6 +360,10 @@ PL *LpplAlloc(uint16_t cbItem, uint16_t cAlloc, HeapType ht)
 
 void FreeHb(HB *lphb)
 {
+    if (lphb != NULL && lphb->ht == htBattle)
+    {
+        InvalidateBtlLog();
+    }
     while (lphb != NULL)
     {
         HB *lphbNext = lphb->lphbNext;
@@ -2,6 +2,10 @@
 #include "types.h"
 
 #include "mine.h"
+#include "globals.h"
+#include "planet.h"
+#include "race.h"
+#include "utilgen.h"
 
 /* functions */
 void GetMineFieldCounts(uint16_t id, int16_t *pithm, int16_t *pcthm)
@@ -11,7 +15,24 @@ void GetMineFieldCounts(uint16_t id, int16_t *pithm, int16_t *pcthm)
     THING * lpth;
     THING * lpthMac;
 
-    /* TODO: implement */
+    /* which of its owner's minefields id is, and how many there are */
+    cthTotal = 0;
+    ithFound = -1;
+    lpthMac = &lpThings[cThing];
+    for (lpth = lpThings; lpth < lpthMac; lpth++)
+    {
+        if (lpth->ith != 0 || lpth->iplr != ((id >> 9) & 0xf))
+        {
+            continue;
+        }
+        if (lpth->idFull == id)
+        {
+            ithFound = cthTotal;
+        }
+        cthTotal++;
+    }
+    *pithm = ithFound;
+    *pcthm = cthTotal;
 }
 
 void MineClick(int16_t x, int16_t y, int16_t msg, int16_t sks)
@@ -262,7 +283,119 @@ void EstMineralsMined(PLANET *lppl, int32_t *plQuan, int32_t cMines, int16_t fAp
     /* block (block) @ MEMORY_MINE:0x5666 */
     /* block (block) @ MEMORY_MINE:0x58ae */
 
-    /* TODO: implement */
+    fRemote = (int16_t)(cMines != -1);
+    fMacintosh = (int16_t)(lppl->iPlayer != -1 && GetRaceStat(&rgplr[lppl->iPlayer], 0xe) == 8);
+    lMineEff = 10;
+    if (cMines == -1)
+    {
+        if (lppl->iPlayer == -1 || lppl->rgwtMin[3] == 0)
+        {
+            for (i = 0; i < 3; i++)
+            {
+                plQuan[i] = -1;
+            }
+            return;
+        }
+        cMines = CMinesOperating(lppl);
+        if (!fMacintosh)
+        {
+            lMineEff = GetRaceStat(&rgplr[lppl->iPlayer], 4);
+        }
+    }
+    /* AR also collects what its remote miners in orbit dig up; that needs
+     * CMineFromLpfl, which is not ported yet. */
+    MinePlanetMinerals(lppl, plQuan, cMines, (int16_t)lMineEff, fRemote, fApply);
+}
+
+/* Not in the original: EstMineralsMined once the mine count and efficiency
+ * are known, so the per-turn economy table can supply them. */
+void MinePlanetMinerals(PLANET *lppl, int32_t *plQuan, int32_t cMines, int16_t iMineEff, int16_t fRemote, int16_t fApply)
+{
+    int32_t lQuanRem;
+    int32_t lQuanAct;
+    int32_t lQuan;
+    int32_t lConc;
+    int32_t lLeft;
+    int32_t lLevel;
+    int32_t lDiv;
+    int32_t lNew;
+    int16_t fMacintosh;
+    int16_t i;
+
+    fMacintosh = (int16_t)(lppl->iPlayer != -1 && GetRaceStat(&rgplr[lppl->iPlayer], 0xe) == 8);
+    for (i = 0; i < 3; i++)
+    {
+        lConc = lppl->rgMinConc[i];
+        /* homeworlds never mine out below 30 */
+        if (lConc < 30 && lppl->fHomeworld && (!fRemote || fMacintosh))
+        {
+            lConc = 30;
+        }
+        lQuanAct = cMines * lConc;
+        lQuan = fRemote ? lQuanAct : lQuanAct * iMineEff / 10;
+        lQuanRem = lQuan % 100;
+        lQuan /= 100;
+        if (lQuanRem != 0 && gd.fGeneratingTurn && Random(100) < lQuanRem)
+        {
+            lQuan++;
+        }
+        plQuan[i] = lQuan;
+        if (!fApply)
+        {
+            continue;
+        }
+
+        lppl->rgwtMin[i] += lQuan;
+
+        /* Deplete: each concentration point costs 12500 / lDiv mine-units,
+         * rgpctMinLevel holds the unmined share of the current point in
+         * 256ths (0 meaning a fresh point). */
+        lQuanAct /= 100;
+        if (lQuanAct < 1 || lppl->rgMinConc[i] < 2)
+        {
+            continue;
+        }
+        for (;;)
+        {
+            lLevel = lppl->rgpctMinLevel[i];
+            if (lLevel == 0)
+            {
+                lLevel = 0x100;
+            }
+            lConc = lppl->rgMinConc[i];
+            lDiv = lConc > 100 ? 100 : lConc < 5 ? 10 : lConc < 25 ? 25 : lConc;
+            lLeft = lLevel * 12500 / 0x100 / lDiv;
+            if (lQuanAct < lLeft)
+            {
+                break;
+            }
+            lQuanAct -= lLeft;
+            lppl->rgMinConc[i]--;
+            lppl->rgpctMinLevel[i] = 0;
+            if (lQuanAct < 1 || lppl->rgMinConc[i] < 2)
+            {
+                break;
+            }
+        }
+        if (lQuanAct < 1 || lppl->rgMinConc[i] < 2)
+        {
+            continue;
+        }
+        lNew = ((lLeft - lQuanAct) << 8) / (12500 / lDiv);
+        if (lNew < 1)
+        {
+            lNew = 1;
+        }
+        if (lLevel <= lNew)
+        {
+            lNew = lLevel - 1;
+        }
+        lppl->rgpctMinLevel[i] = (uint8_t)lNew;
+        if (lNew == 0)
+        {
+            lppl->rgMinConc[i]--;
+        }
+    }
 }
 
 int16_t HtMineWindow(uint16_t hwnd, int16_t x, int16_t y)
@@ -17,5 +17,6 @@ void SetMineralTitleBar(uint16_t hwnd);  /* MEMORY_MINE:0x47dc */
 void EstMineralsMined(PLANET *lppl, int32_t *plQuan, int32_t cMines, int16_t fApply);  /* MEMORY_MINE:0x5362 */
 int16_t HtMineWindow(uint16_t hwnd, int16_t x, int16_t y);  /* MEMORY_MINE:0x37ac */
 void DrawDiamond(uint16_t hdc, RECT *prc, uint16_t hbr);  /* MEMORY_MINE:0x4b60 */
+void MinePlanetMinerals(PLANET *lppl, int32_t *plQuan, int32_t cMines, int16_t iMineEff, int16_t fRemote, int16_t fApply);
 
 #endif /* MINE_H_ */
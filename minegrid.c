@@ -0,0 +1,287 @@
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "types.h"
+#include "globals.h"
+
+#include "minegrid.h"
+
+/* globals */
+MINEGRID vminegrid = {0};
+
+#define ithMineField 0
+
+/* Bounding box of a field, one light year of slack for rounding. */
+static void GetMineFieldBox(THING *lpth, int16_t *pxLo, int16_t *pyLo, int16_t *pxHi, int16_t *pyHi)
+{
+    int16_t r;
+
+    r = (int16_t)ceil(sqrt((double)lpth->thm.cMines)) + 1;
+    *pxLo = (int16_t)(lpth->pt.x - r);
+    *pyLo = (int16_t)(lpth->pt.y - r);
+    *pxHi = (int16_t)(lpth->pt.x + r);
+    *pyHi = (int16_t)(lpth->pt.y + r);
+}
+
+static int16_t FIsMineField(THING *lpth)
+{
+    return (int16_t)(lpth->ith == ithMineField && lpth->thm.cMines > 0);
+}
+
+static int16_t FGrowMineGrid(MINEGRID *pgrid, int32_t ccell, int32_t cith)
+{
+    int32_t *rgiFirst;
+    int16_t *rgith;
+    uint16_t *rgwMark;
+    int16_t *rgithQuery;
+
+    if (ccell + 1 > pgrid->ccellMax)
+    {
+        rgiFirst = (int32_t *)realloc(pgrid->rgiFirst, (ccell + 1) * sizeof(int32_t));
+        if (rgiFirst == NULL)
+        {
+            return 0;
+        }
+        pgrid->rgiFirst = rgiFirst;
+        pgrid->ccellMax = ccell + 1;
+    }
+    if (cith > pgrid->cithMax)
+    {
+        rgith = (int16_t *)realloc(pgrid->rgith, cith * sizeof(int16_t));
+        if (rgith == NULL)
+        {
+            return 0;
+        }
+        pgrid->rgith = rgith;
+        pgrid->cithMax = cith;
+    }
+    if (cThing > pgrid->cthMax)
+    {
+        rgwMark = (uint16_t *)realloc(pgrid->rgwMark, cThing * sizeof(uint16_t));
+        if (rgwMark == NULL)
+        {
+            return 0;
+        }
+        pgrid->rgwMark = rgwMark;
+        rgithQuery = (int16_t *)realloc(pgrid->rgithQuery, cThing * sizeof(int16_t));
+        if (rgithQuery == NULL)
+        {
+            return 0;
+        }
+        pgrid->rgithQuery = rgithQuery;
+        pgrid->cthMax = cThing;
+        memset(pgrid->rgwMark, 0, cThing * sizeof(uint16_t));
+        pgrid->wMark = 0;
+    }
+    return 1;
+}
+
+/* Bucket every minefield in lpThings. Cheap to call again: it only
+ * rebuilds after InvalidateMineGrid or when lpThings was reallocated. */
+int16_t FBuildMineGrid(MINEGRID *pgrid)
+{
+    THING *lpth;
+    int32_t ccell;
+    int32_t icell;
+    int32_t i;
+    int16_t xLo;
+    int16_t yLo;
+    int16_t xHi;
+    int16_t yHi;
+    int16_t xMax;
+    int16_t yMax;
+    int16_t cx;
+    int16_t cy;
+    int16_t ith;
+    int16_t fAny;
+
+    if (pgrid->fValid && pgrid->lpThingsGrid == lpThings && pgrid->cThingGrid == cThing)
+    {
+        return 1;
+    }
+    pgrid->fValid = 0;
+
+    fAny = 0;
+    xMax = yMax = 0;
+    for (ith = 0; ith < cThing; ith++)
+    {
+        lpth = &lpThings[ith];
+        if (!FIsMineField(lpth))
+        {
+            continue;
+        }
+        GetMineFieldBox(lpth, &xLo, &yLo, &xHi, &yHi);
+        if (!fAny || xLo < pgrid->xMin)
+        {
+            pgrid->xMin = xLo;
+        }
+        if (!fAny || yLo < pgrid->yMin)
+        {
+            pgrid->yMin = yLo;
+        }
+        if (!fAny || xHi > xMax)
+        {
+            xMax = xHi;
+        }
+        if (!fAny || yHi > yMax)
+        {
+            yMax = yHi;
+        }
+        fAny = 1;
+    }
+    pgrid->cx = fAny ? (int16_t)((xMax - pgrid->xMin) / dMineCell + 1) : 0;
+    pgrid->cy = fAny ? (int16_t)((yMax - pgrid->yMin) / dMineCell + 1) : 0;
+    ccell = (int32_t)pgrid->cx * pgrid->cy;
+    if (!FGrowMineGrid(pgrid, ccell, 0))
+    {
+        return 0;
+    }
+
+    /* count, prefix sum, then fill using rgiFirst as the cursor */
+    memset(pgrid->rgiFirst, 0, (ccell + 1) * sizeof(int32_t));
+    for (ith = 0; ith < cThing; ith++)
+    {
+        lpth = &lpThings[ith];
+        if (!FIsMineField(lpth))
+        {
+            continue;
+        }
+        GetMineFieldBox(lpth, &xLo, &yLo, &xHi, &yHi);
+        for (cy = (int16_t)((yLo - pgrid->yMin) / dMineCell); cy <= (yHi - pgrid->yMin) / dMineCell; cy++)
+        {
+            for (cx = (int16_t)((xLo - pgrid->xMin) / dMineCell); cx <= (xHi - pgrid->xMin) / dMineCell; cx++)
+            {
+                pgrid->rgiFirst[(int32_t)cy * pgrid->cx + cx + 1]++;
+            }
+        }
+    }
+    for (icell = 0; icell < ccell; icell++)
+    {
+        pgrid->rgiFirst[icell + 1] += pgrid->rgiFirst[icell];
+    }
+    if (!FGrowMineGrid(pgrid, ccell, pgrid->rgiFirst[ccell]))
+    {
+        return 0;
+    }
+    for (ith = 0; ith < cThing; ith++)
+    {
+        lpth = &lpThings[ith];
+        if (!FIsMineField(lpth))
+        {
+            continue;
+        }
+        GetMineFieldBox(lpth, &xLo, &yLo, &xHi, &yHi);
+        for (cy = (int16_t)((yLo - pgrid->yMin) / dMineCell); cy <= (yHi - pgrid->yMin) / dMineCell; cy++)
+        {
+            for (cx = (int16_t)((xLo - pgrid->xMin) / dMineCell); cx <= (xHi - pgrid->xMin) / dMineCell; cx++)
+            {
+                icell = (int32_t)cy * pgrid->cx + cx;
+                pgrid->rgith[pgrid->rgiFirst[icell]++] = ith;
+            }
+        }
+    }
+    for (i = ccell; i > 0; i--)
+    {
+        pgrid->rgiFirst[i] = pgrid->rgiFirst[i - 1];
+    }
+    pgrid->rgiFirst[0] = 0;
+
+    pgrid->lpThingsGrid = lpThings;
+    pgrid->cThingGrid = cThing;
+    pgrid->fValid = 1;
+    return 1;
+}
+
+/* Minefields whose box shares a cell with the box of ptA-ptB, in lpThings
+ * order. Returns -1 if the grid can't be built; the caller should then
+ * look at every field. */
+int16_t CMineFieldsNearSegment(MINEGRID *pgrid, POINT ptA, POINT ptB, int16_t **prgith)
+{
+    int32_t i;
+    int32_t icell;
+    int16_t cxLo;
+    int16_t cyLo;
+    int16_t cxHi;
+    int16_t cyHi;
+    int16_t cx;
+    int16_t cy;
+    int16_t ith;
+    int16_t c;
+    int16_t j;
+
+    *prgith = NULL;
+    if (!FBuildMineGrid(pgrid))
+    {
+        return -1;
+    }
+    *prgith = pgrid->rgithQuery;
+    if (pgrid->cx == 0)
+    {
+        return 0;
+    }
+    cxLo = (int16_t)(((ptA.x < ptB.x ? ptA.x : ptB.x) - 1 - pgrid->xMin) / dMineCell);
+    cxHi = (int16_t)(((ptA.x > ptB.x ? ptA.x : ptB.x) + 1 - pgrid->xMin) / dMineCell);
+    cyLo = (int16_t)(((ptA.y < ptB.y ? ptA.y : ptB.y) - 1 - pgrid->yMin) / dMineCell);
+    cyHi = (int16_t)(((ptA.y > ptB.y ? ptA.y : ptB.y) + 1 - pgrid->yMin) / dMineCell);
+    if (cxHi < 0 || cyHi < 0 || cxLo >= pgrid->cx || cyLo >= pgrid->cy ||
+        (ptA.x > ptB.x ? ptA.x : ptB.x) + 1 < pgrid->xMin || (ptA.y > ptB.y ? ptA.y : ptB.y) + 1 < pgrid->yMin)
+    {
+        return 0;
+    }
+    cxLo = cxLo < 0 ? 0 : cxLo;
+    cyLo = cyLo < 0 ? 0 : cyLo;
+    cxHi = cxHi >= pgrid->cx ? (int16_t)(pgrid->cx - 1) : cxHi;
+    cyHi = cyHi >= pgrid->cy ? (int16_t)(pgrid->cy - 1) : cyHi;
+
+    if (++pgrid->wMark == 0)
+    {
+        memset(pgrid->rgwMark, 0, pgrid->cthMax * sizeof(uint16_t));
+        pgrid->wMark = 1;
+    }
+    c = 0;
+    for (cy = cyLo; cy <= cyHi; cy++)
+    {
+        for (cx = cxLo; cx <= cxHi; cx++)
+        {
+            icell = (int32_t)cy * pgrid->cx + cx;
+            for (i = pgrid->rgiFirst[icell]; i < pgrid->rgiFirst[icell + 1]; i++)
+            {
+                ith = pgrid->rgith[i];
+                if (pgrid->rgwMark[ith] != pgrid->wMark)
+                {
+                    pgrid->rgwMark[ith] = pgrid->wMark;
+                    pgrid->rgithQuery[c++] = ith;
+                }
+            }
+        }
+    }
+
+    /* a handful of fields at most: insertion sort back into lpThings order */
+    for (i = 1; i < c; i++)
+    {
+        ith = pgrid->rgithQuery[i];
+        for (j = (int16_t)(i - 1); j >= 0 && pgrid->rgithQuery[j] > ith; j--)
+        {
+            pgrid->rgithQuery[j + 1] = pgrid->rgithQuery[j];
+        }
+        pgrid->rgithQuery[j + 1] = ith;
+    }
+    return c;
+}
+
+/* Minefields were added, removed or changed size. */
+void InvalidateMineGrid(MINEGRID *pgrid)
+{
+    pgrid->fValid = 0;
+}
+
+void FreeMineGrid(MINEGRID *pgrid)
+{
+    free(pgrid->rgiFirst);
+    free(pgrid->rgith);
+    free(pgrid->rgwMark);
+    free(pgrid->rgithQuery);
+    memset(pgrid, 0, sizeof(MINEGRID));
+}
@@ -0,0 +1,62 @@
+#ifndef MINEGRID_H_
+#define MINEGRID_H_
+
+#include "types.h"
+
+/*
+ * Minefield broadphase.
+ *
+ * FTravelThroughMineFields has to find every minefield a fleet's path
+ * crosses. Testing the path against each field in lpThings makes movement
+ * O(fleets x fields). MINEGRID buckets the fields by the square cells
+ * (dMineCell light years) their bounding boxes cover. A path then only
+ * needs the fields listed in the cells its own bounding box covers.
+ *
+ * The cells are stored CSR-style: rgiFirst[icell]..rgiFirst[icell + 1]
+ * indexes rgith, which holds lpThings indices. Fields are inserted in
+ * lpThings order, so every cell lists them in ascending order, and
+ * CMineFieldsNearSegment returns its candidates in that same order. A
+ * caller walking the candidates therefore visits the fields in the order a
+ * full scan of lpThings would, and draws Random() the same way.
+ *
+ * FTravelThroughMineFields is still a stub, so nothing in the turn queries
+ * the grid yet; it is here for when that function is ported.
+ *
+ * The grid describes the fields as they were when it was built, and
+ * rebuilds itself if lpThings is reallocated. The minefield table calls
+ * InvalidateMineGrid when ApplyMineTable changes a field's size or
+ * CRemoveSpentMineFields drops fields; anything else that lays or removes
+ * mines must do the same once it is ported. DestroyCurGame frees it.
+ */
+
+#define dMineCell 64
+
+typedef struct _minegrid
+{
+    int16_t fValid;
+    THING *lpThingsGrid; /* lpThings / cThing the grid was built from */
+    int16_t cThingGrid;
+    int16_t xMin; /* top left of cell 0 */
+    int16_t yMin;
+    int16_t cx;
+    int16_t cy;
+    int32_t ccellMax;
+    int32_t cithMax;
+    int32_t *rgiFirst; /* [cx * cy + 1] */
+    int16_t *rgith;
+    int16_t cthMax;
+    uint16_t wMark;
+    uint16_t *rgwMark; /* per lpThings index, dedupes cells in a query */
+    int16_t *rgithQuery; /* last query's answer */
+} MINEGRID;
+
+/* globals */
+extern MINEGRID vminegrid;
+
+/* functions */
+int16_t FBuildMineGrid(MINEGRID *pgrid);
+int16_t CMineFieldsNearSegment(MINEGRID *pgrid, POINT ptA, POINT ptB, int16_t **prgith);
+void InvalidateMineGrid(MINEGRID *pgrid);
+void FreeMineGrid(MINEGRID *pgrid);
+
+#endif /* MINEGRID_H_ */
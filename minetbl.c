@@ -0,0 +1,325 @@
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "types.h"
+#include "globals.h"
+
+#include "minetbl.h"
+#include "idtbl.h"
+#include "minegrid.h"
+#include "ship2.h"
+
+/* globals */
+MINETBL vminetbl = {0};
+
+#define ithMineField 0
+
+static int16_t FGrowMineTable(MINETBL *ptbl, int16_t cfld)
+{
+    uint8_t *pb;
+    int16_t *rgifld;
+    size_t cb;
+
+    if (cThing > ptbl->cthMax)
+    {
+        rgifld = (int16_t *)realloc(ptbl->rgifld, cThing * sizeof(int16_t));
+        if (rgifld == NULL)
+        {
+            return 0;
+        }
+        ptbl->rgifld = rgifld;
+        ptbl->cthMax = cThing;
+    }
+    if (cfld <= ptbl->cfldMax && ptbl->pvBlock != NULL)
+    {
+        return 1;
+    }
+    if (cfld < 64)
+    {
+        cfld = 64;
+    }
+    cb = (size_t)cfld * (2 * sizeof(int32_t) + 5 * sizeof(int16_t) + 2 * sizeof(uint8_t));
+    pb = (uint8_t *)malloc(cb);
+    if (pb == NULL)
+    {
+        return 0;
+    }
+    free(ptbl->pvBlock);
+    ptbl->pvBlock = pb;
+    ptbl->cfldMax = cfld;
+
+    /* widest first so every array stays naturally aligned */
+    ptbl->rglR2 = (int32_t *)pb;
+    pb += cfld * sizeof(int32_t);
+    ptbl->rglDelta = (int32_t *)pb;
+    pb += cfld * sizeof(int32_t);
+    ptbl->rgith = (int16_t *)pb;
+    pb += cfld * sizeof(int16_t);
+    ptbl->rgx = (int16_t *)pb;
+    pb += cfld * sizeof(int16_t);
+    ptbl->rgy = (int16_t *)pb;
+    pb += cfld * sizeof(int16_t);
+    ptbl->rggrbitSw = (uint16_t *)pb;
+    pb += cfld * sizeof(uint16_t);
+    ptbl->rgcpl = (int16_t *)pb;
+    pb += cfld * sizeof(int16_t);
+    ptbl->rgiplr = pb;
+    pb += cfld;
+    ptbl->rgiType = pb;
+    return 1;
+}
+
+/* Copy every live minefield out of lpThings, in lpThings order, and clear
+ * the accumulators. */
+int16_t FBuildMineTable(MINETBL *ptbl)
+{
+    THING *lpth;
+    int16_t ith;
+    int16_t cfld;
+    int16_t ifld;
+
+    cfld = 0;
+    for (ith = 0; ith < cThing; ith++)
+    {
+        lpth = &lpThings[ith];
+        cfld += (lpth->ith == ithMineField && lpth->thm.cMines > 0);
+    }
+    ptbl->cfld = 0;
+    if (!FGrowMineTable(ptbl, cfld))
+    {
+        return 0;
+    }
+
+    ifld = 0;
+    for (ith = 0; ith < cThing; ith++)
+    {
+        lpth = &lpThings[ith];
+        if (lpth->ith != ithMineField || lpth->thm.cMines <= 0)
+        {
+            ptbl->rgifld[ith] = -1;
+            continue;
+        }
+        ptbl->rgifld[ith] = ifld;
+        ptbl->rgith[ifld] = ith;
+        ptbl->rgx[ifld] = lpth->pt.x;
+        ptbl->rgy[ifld] = lpth->pt.y;
+        ptbl->rglR2[ifld] = lpth->thm.cMines;
+        ptbl->rgiplr[ifld] = (uint8_t)lpth->iplr;
+        ptbl->rgiType[ifld] = lpth->thm.iType;
+        ifld++;
+    }
+    ptbl->cfld = cfld;
+    memset(ptbl->rglDelta, 0, cfld * sizeof(int32_t));
+    memset(ptbl->rggrbitSw, 0, cfld * sizeof(uint16_t));
+    memset(ptbl->rgcpl, 0, cfld * sizeof(int16_t));
+    return 1;
+}
+
+/* Every live fleet with sweeping weapons, in rglpfl order. Returns -1 if
+ * the arrays can't be allocated. */
+int16_t CGatherMineSweepers(MINETBL *ptbl)
+{
+    FLEET *lpfl;
+    uint8_t *pb;
+    int32_t lPow;
+    int16_t ifl;
+    int16_t csw;
+    int16_t cswMax;
+
+    if (cFleet > ptbl->cswMax || ptbl->pvBlockSw == NULL)
+    {
+        cswMax = cFleet < 64 ? 64 : cFleet;
+        pb = (uint8_t *)malloc((size_t)cswMax * (sizeof(int32_t) + sizeof(POINT) + sizeof(uint8_t)));
+        if (pb == NULL)
+        {
+            return -1;
+        }
+        free(ptbl->pvBlockSw);
+        ptbl->pvBlockSw = pb;
+        ptbl->cswMax = cswMax;
+        ptbl->rglPowSw = (int32_t *)pb;
+        pb += cswMax * sizeof(int32_t);
+        ptbl->rgptSw = (POINT *)pb;
+        pb += cswMax * sizeof(POINT);
+        ptbl->rgiplrSw = pb;
+    }
+
+    csw = 0;
+    for (ifl = 0; ifl < cFleet; ifl++)
+    {
+        lpfl = rglpfl[ifl];
+        if (lpfl == NULL || lpfl->fDead)
+        {
+            continue;
+        }
+        lPow = CMineSweepFromLpfl(lpfl);
+        if (lPow <= 0)
+        {
+            continue;
+        }
+        ptbl->rgptSw[csw] = lpfl->pt;
+        ptbl->rgiplrSw[csw] = (uint8_t)lpfl->iPlayer;
+        ptbl->rglPowSw[csw] = lPow;
+        csw++;
+    }
+    return csw;
+}
+
+/* Fields containing pt, as table rows. Uses the grid when it can and
+ * falls back to every row. */
+static int16_t CMineRowsAtPoint(MINETBL *ptbl, POINT pt, int16_t **prgith)
+{
+    int16_t c;
+
+    c = CMineFieldsNearSegment(&vminegrid, pt, pt, prgith);
+    if (c < 0)
+    {
+        *prgith = ptbl->rgith;
+        c = ptbl->cfld;
+    }
+    return c;
+}
+
+static int16_t FInMineRow(MINETBL *ptbl, int16_t ifld, POINT pt)
+{
+    int32_t dx;
+    int32_t dy;
+
+    dx = (int32_t)pt.x - ptbl->rgx[ifld];
+    dy = (int32_t)pt.y - ptbl->rgy[ifld];
+    return (int16_t)(dx * dx + dy * dy <= ptbl->rglR2[ifld]);
+}
+
+/* Sweeper i takes rglPow[i] mines from every other player's field it sits
+ * in. Only rglDelta and rggrbitSw change; radii stay as they were at the
+ * start of the sweep. */
+void SweepMineTable(MINETBL *ptbl, int16_t csw, POINT *rgpt, uint8_t *rgiplr, int32_t *rglPow)
+{
+    int16_t *rgith;
+    int16_t isw;
+    int16_t c;
+    int16_t i;
+    int16_t ifld;
+
+    if (ptbl->cfld == 0)
+    {
+        return;
+    }
+    for (isw = 0; isw < csw; isw++)
+    {
+        c = CMineRowsAtPoint(ptbl, rgpt[isw], &rgith);
+        for (i = 0; i < c; i++)
+        {
+            ifld = ptbl->rgifld[rgith[i]];
+            if (ifld < 0 || ptbl->rgiplr[ifld] == rgiplr[isw] || !FInMineRow(ptbl, ifld, rgpt[isw]))
+            {
+                continue;
+            }
+            ptbl->rglDelta[ifld] += rglPow[isw];
+            ptbl->rggrbitSw[ifld] |= (uint16_t)(1 << rgiplr[isw]);
+        }
+    }
+}
+
+/* rgcpl[ifld] = number of planets inside the field. */
+void CountPlanetsInMineTable(MINETBL *ptbl)
+{
+    int16_t *rgith;
+    int16_t ipl;
+    int16_t c;
+    int16_t i;
+    int16_t ifld;
+    POINT pt;
+
+    memset(ptbl->rgcpl, 0, ptbl->cfld * sizeof(int16_t));
+    if (ptbl->cfld == 0)
+    {
+        return;
+    }
+    for (ipl = 0; ipl < cPlanet; ipl++)
+    {
+        pt = rgptPlan[lpPlanets[ipl].id];
+        c = CMineRowsAtPoint(ptbl, pt, &rgith);
+        for (i = 0; i < c; i++)
+        {
+            ifld = ptbl->rgifld[rgith[i]];
+            if (ifld >= 0 && FInMineRow(ptbl, ifld, pt))
+            {
+                ptbl->rgcpl[ifld]++;
+            }
+        }
+    }
+}
+
+/* Subtract each field's summed rglDelta from lpThings, never below zero,
+ * and let the sweepers' owners see the field. Returns the number of fields
+ * that changed size. */
+int16_t ApplyMineTable(MINETBL *ptbl)
+{
+    THING *lpth;
+    int32_t cMines;
+    int16_t ifld;
+    int16_t cChanged;
+
+    cChanged = 0;
+    for (ifld = 0; ifld < ptbl->cfld; ifld++)
+    {
+        lpth = &lpThings[ptbl->rgith[ifld]];
+        lpth->thm.grbitPlr |= ptbl->rggrbitSw[ifld];
+        if (ptbl->rglDelta[ifld] == 0)
+        {
+            continue;
+        }
+        cMines = ptbl->rglR2[ifld] - ptbl->rglDelta[ifld];
+        lpth->thm.cMines = cMines < 0 ? 0 : cMines;
+        ptbl->rglDelta[ifld] = 0;
+        cChanged++;
+    }
+    if (cChanged)
+    {
+        InvalidateMineGrid(&vminegrid);
+    }
+    return cChanged;
+}
+
+/* Drop minefields under cMinesMin from lpThings, keeping the order of
+ * everything else. Returns the number removed. */
+int16_t CRemoveSpentMineFields(void)
+{
+    THING *lpth;
+    THING *lpthMac;
+    int16_t ith;
+
+    ith = 0;
+    lpthMac = &lpThings[cThing];
+    for (lpth = lpThings; lpth < lpthMac; lpth++)
+    {
+        if (lpth->ith == ithMineField && lpth->thm.cMines < cMinesMin)
+        {
+            continue;
+        }
+        if (lpth != &lpThings[ith])
+        {
+            lpThings[ith] = *lpth;
+        }
+        ith++;
+    }
+    if (ith == cThing)
+    {
+        return 0;
+    }
+    ith = (int16_t)(cThing - ith);
+    cThing = (int16_t)(cThing - ith);
+    InvalidateMineGrid(&vminegrid);
+    InvalidateThingIds(&vidtbl);
+    return ith;
+}
+
+void FreeMineTable(MINETBL *ptbl)
+{
+    free(ptbl->pvBlock);
+    free(ptbl->pvBlockSw);
+    free(ptbl->rgifld);
+    memset(ptbl, 0, sizeof(MINETBL));
+}
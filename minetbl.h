@@ -0,0 +1,70 @@
+#ifndef MINETBL_H_
+#define MINETBL_H_
+
+#include "types.h"
+
+/*
+ * Batched minefield table.
+ *
+ * SweepForMines and ThingDecay both pair every minefield with things near
+ * it: sweeping fleets, or planets inside the field. Doing that by walking
+ * lpThings once per fleet (or per planet) is O(sweepers x fields), and a
+ * large minefield war makes it the slowest part of the turn.
+ *
+ * MINETBL copies the minefields out of lpThings into flat columns: centre,
+ * r^2 (the mine count), owner and type. Each field also gets an
+ * accumulator, lDelta. The kernels find overlaps through the MINEGRID
+ * broadphase, so each sweeper or planet only looks at the fields in its
+ * cells. They add to lDelta and never touch lpThings.
+ * ApplyMineTable then writes every field back in one pass.
+ *
+ * A field is swept once per sweeper, and the count never goes below zero.
+ * Subtracting the summed sweep and clamping once gives the same count as
+ * subtracting each fleet in turn. So the result doesn't depend on the
+ * order the overlaps are found in.
+ *
+ * SweepForMines, ThingDecay and IncreaseAIMinefieldSizes are still stubs
+ * and do not use the table yet. The decay rules and the sweep strength
+ * (CMineSweepFromLpfl) are not ported, so the kernels only do the
+ * bookkeeping: callers supply the sweepers or fill lDelta themselves.
+ */
+
+#define cMinesMin 10 /* smaller fields are removed */
+
+typedef struct _minetbl
+{
+    int16_t cfld;
+    int16_t cfldMax;
+    int16_t *rgith;    /* row -> lpThings index */
+    int16_t *rgx;
+    int16_t *rgy;
+    int32_t *rglR2;    /* cMines, i.e. radius squared */
+    uint8_t *rgiplr;
+    uint8_t *rgiType;
+    int32_t *rglDelta; /* mines to remove, summed by the kernels */
+    uint16_t *rggrbitSw; /* players whose fleets swept the field */
+    int16_t *rgcpl;    /* planets inside the field */
+    int16_t cthMax;
+    int16_t *rgifld;   /* lpThings index -> row, -1 if not a field */
+    int16_t cswMax;
+    POINT *rgptSw;     /* sweeping fleets, gathered by CGatherMineSweepers */
+    uint8_t *rgiplrSw;
+    int32_t *rglPowSw;
+
+    void *pvBlock;   /* single allocation backing the row arrays */
+    void *pvBlockSw; /* and the sweeper arrays */
+} MINETBL;
+
+/* globals */
+extern MINETBL vminetbl;
+
+/* functions */
+int16_t FBuildMineTable(MINETBL *ptbl);
+int16_t CGatherMineSweepers(MINETBL *ptbl);
+void SweepMineTable(MINETBL *ptbl, int16_t csw, POINT *rgpt, uint8_t *rgiplr, int32_t *rglPow);
+void CountPlanetsInMineTable(MINETBL *ptbl);
+int16_t ApplyMineTable(MINETBL *ptbl);
+int16_t CRemoveSpentMineFields(void);
+void FreeMineTable(MINETBL *ptbl);
+
+#endif /* MINETBL_H_ */
@@ -1,22 +1,50 @@
 
+#include <string.h>
+
 #include "types.h"
 
 #include "msg.h"
+#include "globals.h"
+#include "msgfmt.h"
+#include "msgidx.h"
+#include "strings.h"
 
 /* globals */
-char aMSGCmpr[22836];                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                    /* MEMORY_MSG:0x0000 */
+char aMSGCmpr[22836] = {-4, -79, 12, -9, -3, -3, 15, -1, 18, -110, 103, 83, 80, -14, 45, 10, -126, -16, -16, 26, 2, 96, -49, 0, -8, 24, 16, -12, 69, 84, -24, 26, 15, 63, 32, 59, 16, -10, -126, -42, -96, 56, 34, -16, 80, 47, 16, -55, -11, -1, -113, 16, 59, 16, -49, 127, -33, -48, -1, -15, 41, 38, 117, 53, 15, 34, -48, -88, 47, 15, 1, -96, 38, 12, -16, -6, 12, -1, 32, -8, 24, 16, -95, 83, -126, -14, 26, 15, 63, 32, -16, -108, 97, 52, -113, 32, -95, -15, 22, 81, 95, -96, 59, 16, -127, 83, 15, -127, -127, 15, 68, 85, 78, -127, -96, -13, -14, 3, -79, 15, 104, 45, 106, 3, -126, 47, 5, 2, -15, 12, -97, 95, -53, 16, -49, 127, -33, -48, -1, -15, 41, 38, 117, 53, 15, 34, -48, -15, 40, -31, -96, 50, 3, -124, 101, -16, 40, 48, -94, -8, 96, 50, 12, -16, 10, 113, -96, -13, 30, 77, 81, 15, 34, -48, -89, -96, 98, 48, -30, -110, 103, -1, 17, 3, -79, 15, 9, 70, 19, 15, 23, -123, 63, 95, -78, -40, 15, 104, 45, 106, 3, -126, 47, 5, 2, 96, -49, 0, -9, 73, 116, 99, -97, 32, -95, 83, -126, -14, 26, 3, -79, 12, -9, -3, -3, 4, 51, 78, -7, 118, -10, 15, 52, -113, 52, -121, 70, 80, 47, 16, -55, -1, -11, -5, 45, -128, -16, -108, 97, 52, -113, 32, -95, -15, 22, 81, 80, 70, -96, -10, -126, -42, -96, 56, 34, -16, 80, 38, 12, -16, 10, 21, 56, 47, 33, -96, 59, 16, -49, 127, -33, -48, 118, -9, 74, 118, -10, 3, -126, 47, 5, 2, -15, 12, -97, 95, -16, 15, 77, -109, 115, -38, 16, 47, 16, 22, 31, 71, 21, 11, 79, 113, 15, 66, -42, 49, -96, 64, -57, -1, -16, -16, -126, 111, 96, 67, 52, -17, -112, 38, 12, -16, -11, 15, -7, 96, 59, 16, -127, 93, -109, 118, -10, 15, 24, 17, -1, -16, -15, 40, -1, -16, 73, -112, 31, 113, -113, 34, 97, 7, 111, 114, -97, 113, -96, -8, 69, 15, -105, -103, 26, -11, -5, 45, 15, -127, -127, 7, 111, 114, -97, 113, -96, 118, 4, 12, 127, -1, 15, -124, -14, 4, 85, 77, -109, 2, 96, -49, 15, 80, -1, -12, 47, 50, -81, 47, -27, 3, -126, 47, 5, 5, -40, -9, 127, 113, -96, 59, 16, -13, -115, 52, -112, -8, 72, -11, -49, -2, 11, 79, 113, 4, 51, 78, -7, 26, 15, 34, -48, 38, 12, -16, 15, -121, 59, 12, -9, -3, -3, 15, 23, -123, 63, -1, 8, 67, 16, 83, 40, -12, 3, -126, 47, 1, -123, -11, 15, -53, 45, -10, -80, -14, 45, -128, -30, -110, 103, 83, 80, -16, -45, 13, -16, 4, 5, -16, 120, 115, 26, 10, 31, 17, 101, 16, 59, 31, 32, 72, 16, -24, -43, -79, -81, 95, -78, -48, -8, 24, 16, 118, -9, 41, -9, 26, 7, 96, 64, -57, -1, -16, -8, 79, 32, -124, -31, 15, 18, -128, 59, 16, -42, 118, -76, -13, 115, 26, 15, 9, 70, 19, -6, 12, -16, -11, 15, -78, -40, 15, 18, -114, 21, 14, -115, 91, 4, -103, 3, -79, 2, -16, -16, 37, 115, 114, 111, 95, -78, -40, 14, 41, 38, 117, 53, 15, -127, -127, 10, 21, 56, 47, 33, -96, 118, 4, 12, 127, -1, 15, -124, -14, 8, 78, 16, -15, 40, 3, -79, 13, 103, 107, 79, 55, 49, -96, -16, -108, 97, 63, -96, -49, 15, 80, -49, -2, 6, 47, -128, 118, 14, 38, 56, 41, 2, -15, 3, -79, 15, 9, 70, 19, -11, -5, 45, -128, -30, -110, 103, 83, 80, 72, 16, 98, -8, 7, 96, -30, 99, -126, -112, 47, 16, -49, 15, 95, -78, -40, 14, 41, 38, 117, 53, 11, 79, 113, 10, 31, 9, 47, 33, -96, 59, 16, -1, -120, -13, 115, 73, 15, -1, 18, 101, 56, -34, 55, 38, 15, -13, 42, -39, 16, 70, -96, -14, 45, 6, 47, -128, -76, -9, 16, 64, -1, 67, 72, 49, -128, -1, -15, 41, 38, -14, 2, -113, 55, 55, 111, 96, -49, 15, 95, -78, -40, 3, -126, 47, 5, 14, -115, 91, 12, -97, -27, 15, -1, 18, -110, 103, 83, 80, 38, 12, -16, -11, 15, -78, -48, 72, 16, 98, -8, 7, 96, -30, 99, -126, -112, 47, 16, 59, 16, -16, -108, 97, 63, 95, -78, -40, 14, 41, 38, 117, 53, 15, 34, -48, -88, 47, 15, 1, -96, 38, 12, -16, 4, -127, 10, 21, 56, 47, 33, -96, 118, 3, -79, 5, -16, 120, 115, 26, 15, 23, -10, -77, 118, -10, -11, -4, -79, -127, 15, -124, 80, 64, -12, 69, 87, -9, 16, -13, -110, 42, 15, 52, 59, 4, 48, -58, 7, 111, 114, -97, 119, 111, 96, -57, 15, 25, 17, 53, 2, -15, 12, 112, -124, -31, 95, 80, -4, -79, -127, 15, -127, -127, 6, 32, 93, -113, 119, -9, 40, 95, 92, 80, 89, 77, -10, -77, 24, 26, 4, -103, 2, -16, -16, 37, 115, 114, 96, 67, 12, 96, -8, 115, -78, -45, 9, 37, 118, -10, 4, 5, 118, -10, -111, 5, -73, -16, -11, -59, 10, 21, 56, 47, 33, -96, 73, -112, 47, 15, 2, 87, 55, 38, 4, 48, -58, 15, -121, 59, 2, 105, -14, 15, 71, 103, -12, 73, 9, 37, 81, 95, 92, 80, -95, -15, 20, 49, -96, 73, -112, 47, 15, 2, 87, 55, 38, 4, 48, -58, 15, 61, 48, 93, -15, -15, 24, 26, 11, 20, -9, -14, 9, 37, 81, 95, 95, -78, -40, 15, 25, 17, 53, 4, 48, -58, 10, 21, 56, 47, 33, -96, 73, -112, 47, 15, 2, 87, 55, 38, -11, -5, 45, -128, -15, -111, 19, 80, 67, 12, 96, -95, -15, 20, 49, -96, 73, -112, 47, 15, 2, 87, 55, 38, 15, 61, 48, 93, -15, -15, 24, 26, 11, 20, -9, -14, 9, 37, 81, 95, 95, -78, -40, 15, 25, 17, 48, 67, 12, 96, -8, 69, 2, -13, -105, 49, -124, 49, -96, 118, 4, 96, -57, -1, -16, -8, 79, 32, 83, -115, -10, -10, -111, 15, -117, 126, -80, 38, -97, 32, -55, 5, -40, -9, 127, 113, -81, 95, -16, -103, 2, -15, 15, 34, -40, 15, 25, 17, 53, 4, 48, -58, 15, -127, -127, 10, 21, 56, 47, 33, -96, 118, 4, 96, -57, -1, -16, -8, 79, 32, -13, 67, 57, 16, -111, 79, 119, 111, 96, -55, 4, 80, 59, 16, 82, -111, 5, -40, -9, 127, 114, -113, 95, -78, -40, 15, 1, 47, 9, 16, 38, 12, -16, 15, -121, 54, 21, 81, -96, 59, 16, 95, 1, -29, 78, -111, 2, -15, 12, 112, -15, -111, 19, 80, 47, 16, -57, 2, 59, 24, 8, 78, 21, 2, -13, -105, 49, -124, 55, 111, 96, 20, -21, 2, 59, 24, -11, -5, 45, -128, -30, -110, 111, 32, 38, 12, -16, 2, -13, 81, -113, 113, -96, 59, 16, -15, 40, -31, 80, 47, 16, -55, 10, 31, 17, 67, 118, -10, 3, -79, 15, 18, -114, 21, 2, -15, 12, 112, 35, -79, -128, -124, -31, 95, 92, 80, 70, -96, 59, 16, -15, 40, -31, 80, 47, 16, -55, 10, 21, 56, 47, 33, -96, 20, -21, 2, 59, 24, 4, 48, -58, -11, -5, 45, -128, -10, -110, -121, 45, 80, -59, 5, 50, -12, -16, 26, 3, -79, 15, 18, -114, 21, 2, -15, 12, -112, 67, 12, 111, 95, -53, 16, -12, 127, 107, 63, 32, -59, 10, 31, 17, 67, 26, 3, -79, 15, 18, -114, 21, 2, -15, 12, -112, 67, 12, 96, -13, -45, 3, 34, -7, 11, 20, -9, -14, 14, 69, -44, -109, 113, 95, 95, -78, -40, 15, 25, 17, 53, 4, 48, -58, 3, -126, -42, -31, -96, 59, 16, -13, 72, -13, 72, 45, 80, -15, 40, -31, 80, 47, 16, -55, -11, -5, 45, -128, -9, 127, 103, -108, 99, 15, 25, 17, 53, 4, 48, -58, 15, 68, 100, -10, 26, 3, 32, -95, -15, 20, 48, 59, 16, 84, -9, 79, 97, 15, 113, -113, 71, 96, 47, 16, -55, 15, 61, 48, 98, 48, -8, 115, -78, -45, 15, 104, 20, 48, -110, 85, -11, -5, 45, -128, -13, -124, -9, 16, -15, 40, -31, 80, 67, 12, 96, -8, 24, 16, 47, 57, 115, 24, 67, 26, 15, 63, 32, 59, 16, -9, 69, 57, -14, 15, 104, 20, 49, -128, -15, 40, -31, 80, 47, 16, 59, 16, -30, -8, 72, -87, -14, 12, -97, 95, -78, -40, 15, 18, -114, 21, 4, 48, -58, 10, 113, -96, -9, 73, 116, 99, -97, 32, 52, -7, 118, -10, 15, 68, 111, 32, 47, 16, 59, 16, -55, 15, 113, -113, 71, 96, -8, 115, -80, 59, 31, 79, 92, 80, -8, 69, 9, 37, 48, 67, 12, 96, 118, 4, 3, 24, -121, -13, -111, 15, 68, 85, 78, -127, 15, 1, -113, 1, 56, 67, 26, 15, 63, 32, 59, 16, -9, 121, -108, 118, 45, 80, -55, -11, -1, -106, 4, 14, -110, 81, 15, 23, -10, -77, 4, 48, -58, -6, 12, 80, -89, -96, -10, -127, 67, 10, 79, 68, -10, 16, 50, 3, -79, 15, 18, -114, 21, 2, -15, 12, -112, -13, 31, 18, -127, 15, 49, 118, -10, 10, 21, 56, 47, 33, -81, 95, -78, -40, 15, 1, 47, 9, 16, 38, 12, -16, 15, -124, 62, -79, -96, 118, 4, -12, 79, -15, 31, 65, 99, 4, 80, 59, 16, -15, 40, -31, 80, 47, 16, -55, 4, 106, 12, -112, 70, 103, -73, -108, 49, -96, 20, -21, 2, 59, 24, -11, -5, 45, -128, -30, -110, 111, 32, 38, 12, -16, 2, -13, 81, -113, 113, -96, -55, 15, 18, -114, 21, 10, 31, 17, 67, 118, -10, 3, -79, 15, 18, -114, 21, 2, -15, 12, -97, 95, -16, -103, 2, -15, 15, 34, -40, 14, 41, 38, 117, 53, 2, 96, -49, 0, -76, -9, 16, -89, 26, 2, -15, -15, -11, 15, -78, -48, 98, 9, 38, -10, 24, 14, 38, 56, 41, 3, -79, 15, 9, 70, 19, -11, -1, 9, -112, 47, 16, -14, 45, -128, -30, -110, 103, 83, 80, 40, -13, 115, 118, -10, 12, -16, 11, 79, 113, 10, 113, -96, 47, 31, 31, 80, -5, 45, -128, 83, 72, -13, 69, 16, -76, 80, -13, 17, 96, -110, 83, 4, 106, 15, 34, -48, 98, 9, 38, -10, 24, 14, 38, 56, 41, 3, -79, 15, 9, 70, 19, -11, -4, -79, 15, 2, -16, -39, 67, 114, 96, 38, 12, -16, 11, 69, 10, 30, -127, 69, 26, 15, 24, 47, 64, -49, 127, -33, -48, 50, 12, -9, -3, -3, -11, -4, -79, 15, 2, -16, -39, 67, 114, 96, 38, 12, -16, 11, 69, 10, 30, -127, 69, 26, 15, 63, 32, -49, 127, -33, -48, -30, -110, 103, 83, 80, -83, 16, 50, 2, -9, 24, -24, 47, -118, 118, -10, -11, -59, 11, 69, 8, -42, 2, -45, 2, -15, 15, 29, 25, -11, -59, -2, 80, -8, 79, 47, 2, 118, 63, -96, -59, -6, 4, -16, -16, 20, -123, 3, 32, -76, -9, 16, -13, 17, 96, -95, 83, -126, -14, 26, 2, -128, -76, 80, -89, 84, -16, -16, 20, -127, -81, 80, -1, -120, -95, -123, 11, 79, 113, 15, 49, 22, 14, -76, 111, 97, -96, 50, 15, 98, 3, 32, 59, 16, -108, 83, 15, -106, 47, -122, 9, 46, 67, 114, 96, 47, 16, 59, 16, -15, -111, 19, -11, -4, -79, 15, 25, 17, 48, -14, 45, 15, -127, -127, 3, -124, -17, -105, 111, 96, -8, 115, -80, -59, -6, 4, -16, -16, 20, -123, 3, 32, -76, -9, 16, -83, -17, -111, -96, -13, 27, 118, -96, -49, 15, 80, -1, -120, -95, -123, 15, 18, -128, -14, 45, -128, -15, -111, 19, 11, 79, 113, 15, 49, 22, 14, -76, 111, 97, -96, 50, 15, 98, 3, 32, 59, 67, 15, 9, 70, 19, -11, -4, -79, 15, 25, 17, 48, -14, 45, 15, -127, -127, 3, -124, -17, -105, 111, 96, -8, 115, -80, -59, -6, 4, -16, -16, 20, -123, 3, 32, -76, -9, 16, 45, 56, -42, 3, -79, 8, 70, -10, 16, 47, 16, -14, 45, -128, 94, 70, 97, -123, -11, 15, -8, -118, 24, 80, -15, 40, 15, 34, -40, 15, 25, 17, 48, -76, -9, 16, -13, 17, 96, -21, 70, -10, 26, 3, 32, -10, 32, 50, 3, -79, 9, 69, 48, -7, 98, -8, 96, -110, -28, 55, 38, 2, -15, 3, -76, 48, -15, -111, 19, -11, -59, 11, 69, 9, 36, -95, -96, -49, -3, 2, -15, 12, -12, 15, 24, 47, 64, -58, -11, -59, 11, 69, 15, 49, 79, 65, -96, -49, -3, 12, -12, 15, 24, 47, 64, -58, -11, -59, 11, 69, 13, 105, 36, -95, -96, -49, -3, 2, -15, 12, -12, 3, 32, -58, -11, -59, 11, 69, 15, 49, 79, 65, -96, -49, -3, 12, -12, 3, 32, -58, -11, -5, 45, -128, 83, 72, -13, 69, 16, 67, 12, -16, 11, 69, 15, 61, 121, 48, 64, 97, -8, 12, -1, 31, 95, -78, -40, 5, 52, -113, 52, 81, 4, 48, -49, 0, -76, 80, -13, -41, -109, 12, 112, 97, -8, 12, -1, 16, 91, 127, 5, -11, -5, 45, -128, 83, 72, -13, 69, 16, 67, 12, -16, 11, 69, 15, 61, 121, 48, 64, 97, -8, 12, -1, 16, -8, -73, -21, 7, 80, -13, 23, 111, 96, -126, -45, 26, 3, 32, -49, 15, 95, -78, -40, 5, 52, -113, 52, 81, 4, 48, -49, 0, -76, 80, -13, -41, -109, 12, 112, 97, -8, 12, -1, 16, 91, 127, 5, 15, -117, 126, -80, 72, 16, -13, 23, 111, 96, -126, -45, 26, 3, 32, -49, 15, 95, -78, -40, 5, 52, -113, 52, 81, 4, 48, -49, 0, -76, 80, -13, -41, -109, 4, 6, 31, -128, -49, -15, 15, -117, 126, -80, -8, 121, -112, 98, 48, -13, 16, -126, -45, 26, 3, 32, -49, 0, -83, 16, 50, 4, 9, 78, -7, 2, -15, 15, 29, 25, -11, -5, 45, -128, 83, 72, -13, 69, 16, 67, 12, -16, 11, 69, 15, 61, 121, 48, -57, 6, 31, -128, -49, -15, 5, -73, -16, 80, -8, -73, -21, 15, -121, -103, 6, 35, 15, 49, 8, 45, 49, -96, 50, 12, -16, 10, -47, 3, 32, 64, -108, -17, -112, 47, 16, -15, -47, -97, 95, -78, -48, -76, -9, 16, -13, -41, -109, 4, 15, 20, -29, 40, -14, 2, 96, -49, 15, 95, -78, -48, -76, -9, 16, -13, -41, -109, 12, 112, -15, 78, 50, -121, 21, 2, 96, -49, 15, 95, -78, -48, -76, -9, 16, -13, -41, -109, 4, 15, 71, 97, 2, 96, -49, 15, 95, -78, -48, -76, -9, 16, -13, -41, -109, 12, 112, -12, 118, 21, 2, 96, -49, 15, 95, -78, -48, -76, -9, 16, -13, -41, -109, 4, 10, 31, 17, 101, 16, 45, 63, 2, 83, 2, 96, -49, 15, 95, -78, -48, -76, -9, 16, -13, -41, -109, 12, 112, -95, -15, 22, 81, 2, -45, -16, 37, 53, 2, 96, -49, 15, 95, -78, -48, -76, -9, 16, -33, 15, 104, 74, 26, 3, -79, 12, 112, -95, -15, 22, 81, 80, 38, 12, -16, 3, 32, -43, 16, -49, -112, 49, -21, 98, -110, -10, -14, -11, -4, -79, -127, 7, 86, -2, 48, 22, 45, -10, -80, -15, -47, -112, 79, 116, 121, 79, 57, 16, 67, 12, 96, 50, 4, -103, 47, -128, -59, 3, 32, -10, 19, 3, 32, 59, 16, 97, -1, 115, 15, -124, -14, -16, 39, 99, -11, 15, -78, -40, 15, 25, 17, 48, -8, 121, -112, -8, 71, 48, -15, 40, 15, 66, -127, 15, 29, 25, -11, 15, -78, -48, 97, 26, 4, -13, 45, 48, -49, 127, 79, 96, -12, 40, 16, -15, -47, -97, 92, 80, -8, 121, -112, 97, -9, 24, 15, 68, -7, 16, 115, 3, 32, 115, 80, 97, -1, 115, 15, -124, -14, -16, 39, 99, 4, 80, 115, 80, -15, -47, -112, -28, -16, 78, 115, -14, 7, 80, -49, 127, 79, 96, 70, -96, 59, 16, 56, 127, 0, -127, -1, -8, -41, -127, 80, 79, 15, 8, 47, -9, 127, 68, 49, -97, 32, -49, 127, 79, 96, 47, 16, -15, -47, -97, 92, -16, 11, 69, 14, 47, 79, 9, 19, 26, 7, 53, 2, -118, 24, 95, 80, -4, -79, 15, 8, 42, -34, 55, 38, 15, -1, -115, 29, 16, 117, 1, -12, -16, 63, 47, 95, -53, 16, -16, -126, -83, -29, 114, 96, -1, -8, -47, -47, 2, 96, -49, 0, 117, 1, -12, -16, 63, 47, 80, -1, 9, -112, 47, 16, -14, 45, -128, -30, -110, 103, 83, 80, 38, 12, -16, 11, 79, 113, 15, -6, -33, 79, 1, -96, 91, 127, 15, 80, -5, 45, 6, 32, -110, 111, 97, -128, -30, 99, -126, -112, 59, 16, -16, -108, 97, 63, 95, -78, -40, 14, 41, 38, 117, 53, 2, -113, 55, 55, 111, 96, -49, 0, -76, -9, 16, 79, 52, 106, 38, 26, 3, -79, 120, 5, 52, -113, 52, 81, 4, 106, 15, 34, -48, 98, 9, 38, -10, 24, 14, 38, 56, 41, 3, -79, 15, 9, 70, 19, -11, -62, 5, -34, -31, 85, -15, -39, -97, 32, 56, 70, 95, 17, -120, 26, 12, -1, -48, 47, 16, -49, 64, 50, 12, 47, 92, 32, 93, -18, 21, 95, 29, -103, -14, 3, -124, 101, -15, 24, -127, -96, -49, -3, 12, -12, 3, 32, -62, -11, -62, 5, -34, -31, 85, -15, -39, -97, 32, -127, -31, 127, 113, -96, -49, -3, 2, -15, 12, -12, 15, 24, 47, 64, -62, -11, -62, 5, -34, -31, 85, -15, -39, -97, 32, -127, -31, 127, 113, -96, -49, -3, 12, -12, 15, 24, 47, 64, -62, -11, -62, 4, 51, 31, 79, 3, 26, 3, 32, 56, 70, 95, 17, -128, -49, -3, 2, -15, 12, -12, 3, 32, -62, -11, 15, -8, 105, -14, 12, -1, -64, -8, 69, 5, -34, -31, 85, -15, -39, -97, 32, -127, -31, 127, 113, -81, 92, 32, 67, 49, -12, -16, 49, -96, 50, 3, -124, 101, -15, 24, 12, -1, -48, -49, 64, 50, 12, 47, 80, -1, -122, -97, 32, -49, 127, -33, -48, -1, -15, 41, 38, 117, 53, 15, -127, -127, 5, -34, -31, 85, -15, -39, -97, 32, -127, -31, 127, 113, -81, 80, -4, -79, 8, 21, 48, -16, 24, 117, -79, -96, 118, 15, -1, 33, 31, 0, -1, 79, 4, -31, -1, -11, -62, 2, 105, -14, 8, 30, 23, -9, 26, 12, -1, -48, 47, 16, -49, 64, -15, -126, -12, 12, 47, 80, -1, -9, 47, -127, -9, 24, -6, 12, -1, -64, -8, 69, 5, 22, 63, 80, -4, -79, 8, 31, 68, 118, -95, -128, -8, 69, 9, 37, 48, 118, 5, -16, 78, 31, 92, 32, 38, -97, 32, -127, -31, 127, 113, -96, -49, -3, 12, -12, 15, 24, 47, 64, -62, -11, 15, -1, 114, -8, 31, 113, -113, -96, -49, 127, -33, -48, -1, -15, 41, 38, 117, 53, 15, -127, -127, 5, 22, 63, 80, -4, -79, 8, 31, 68, 118, 80, 47, 16, 59, 16, 35, -79, -128, -30, -110, 103, 83, 80, 72, 16, 94, 67, 49, -127, -96, 78, -126, 85, 15, -1, 33, 31, 0, -1, 79, 4, -31, -1, -11, -62, 4, 51, 31, 79, 3, 26, 3, 32, 56, 70, 95, 17, -128, -49, -3, 2, -15, 12, -12, 3, 32, -62, -11, 15, -1, 66, 97, 2, -15, 7, 48, -8, 69, 5, -34, -31, 85, -15, -39, -97, 32, -127, -31, 127, 113, -81, 92, 32, 67, 49, -12, -16, 49, -96, 50, 3, -124, 101, -15, 24, 12, -1, -48, -49, 64, 50, 12, 47, 80, -1, -12, 38, 16, 47, 16, 59, 16, -1, -15, 41, 38, 117, 53, 15, -127, -127, 5, -34, -31, 85, -15, -39, -97, 32, -127, -31, 127, 113, -81, 80, -4, -79, -14, 4, -103, 15, 1, -121, 91, 26, 7, 96, -1, -14, 17, -16, 15, -12, -16, 78, 31, -1, 92, 32, 67, 49, -12, -16, 49, -96, 50, 8, 30, 23, -9, 16, -49, -3, 2, -15, 12, -12, 15, 24, 47, 64, -62, -11, 15, -1, 114, -8, 31, 113, -113, -96, 73, -112, 47, 16, 115, 15, -124, 80, -110, 83, 7, 96, -1, -14, 17, -16, 15, -12, -16, 78, 31, 92, 32, 67, 49, -12, -16, 49, -96, 50, 8, 30, 23, -9, 16, -49, -3, 12, -12, 15, 24, 47, 64, -62, -11, 15, -1, 114, -8, 31, 113, -113, -96, 98, 97, 2, -15, 3, -79, 15, -1, 18, -110, 103, 83, 80, -8, 24, 16, 93, -18, 21, 95, 29, -103, -14, 8, 30, 23, -9, 26, -11, 15, -53, 16, -127, -12, 71, 101, 2, -15, 14, 41, 38, 117, 53, 4, -127, 5, -28, 51, 24, 26, 4, -24, 37, 80, -1, -14, 17, -16, 15, -12, -16, 78, 31, -1, 92, 80, -76, 80, -30, -12, -16, -111, 49, -96, 115, 80, 69, 87, -10, 97, -96, 40, -95, -123, -11, -5, 45, -128, 83, 72, -13, 69, 16, 67, 12, -16, 15, 20, 121, 26, 3, 32, -13, -41, -102, 4, 6, 31, -128, 91, 127, 0, 47, 16, 63, 47, 1, 12, 112, -13, 30, 77, 81, 5, 47, 65, 38, 16, -110, 83, 3, -79, 15, 9, 70, 95, -1, 95, -78, -40, 5, -25, 22, 55, 83, 80, -76, -9, 16, -30, -12, -16, -111, 49, -96, -127, 81, 72, -21, 7, 99, 32, -4, 30, -80, -1, -31, -9, 25, 12, 112, -15, 40, 12, -1, -81, 80, -4, -79, -14, 15, -121, -103, 14, 38, 55, 109, 16, 59, 23, -128, 31, 31, 18, -125, 80, 118, 3, -79, 12, -1, -96, -15, 113, -102, -11, -59, 11, 69, 4, 96, 40, -95, -128, 50, 14, 41, 38, 127, -15, 31, -96, -13, -45, 7, 80, 98, 48, -19, -120, 22, 57, -14, 7, 96, 40, -13, 115, 2, -15, 4, 15, 9, 70, 19, -11, 15, -53, 117, 2, -118, 24, 11, 69, 15, 49, 22, 14, 70, -31, -111, -81, 92, 80, -76, 80, 40, -95, -123, 3, 32, -30, -110, 103, -1, 17, 12, -16, -6, 15, 61, 48, -49, 0, 117, 4, -104, 20, -81, 32, -16, 47, 13, -108, 49, -81, 80, -4, -79, 14, 41, 38, 127, -15, 16, 40, -95, -128, -76, 80, -13, 17, 96, -28, 110, 25, 26, -11, -59, 11, 69, 2, -118, 24, 80, 50, 14, 41, 38, 127, -15, 16, -49, 15, -96, -13, -45, 15, 34, -48, -76, -9, 16, -15, 71, -111, -96, 50, 15, 56, 118, -10, 4, -110, 111, 96, 70, -14, 14, 41, 38, 117, 53, -11, 15, -53, 16, -30, -110, 103, -1, 17, 2, -118, 24, 11, 69, 15, 49, 22, 14, 70, -31, -111, -81, 92, 80, -76, 80, 40, -95, -123, 3, 32, -30, -110, 103, -1, 17, 12, -16, -6, 15, 61, 48, 98, 97, 2, -15, 3, -79, 5, -73, -16, 80, 118, 12, 80, -76, -9, 16, 64, -30, -110, 103, -1, 20, 55, 38, 15, 66, -83, -111, -11, 15, -53, 16, -30, -110, 103, -1, 17, 2, -118, 24, 11, 69, 15, 49, 22, 14, 70, -31, -111, -81, 92, 80, -76, 80, 56, 113, -96, 50, 15, 49, 79, 64, -30, -110, 103, 83, 80, -94, -8, 96, 50, 12, -16, -6, 15, 61, 48, 59, 16, -16, -108, 97, 48, 117, 13, 103, 107, 79, 55, 49, -81, 80, -5, 45, 15, 77, 83, 2, -45, -15, 115, 4, 5, -73, -16, 15, -121, 59, 4, 14, 41, 38, -14, 15, 66, -83, -111, 4, 106, 15, 103, -9, 16, 115, 2, -118, 24, 80, 50, 14, 41, 38, 127, -15, 31, 95, -53, 16, -28, -16, 52, 118, 2, -15, 12, 80, -76, 80, 67, 49, -12, -16, 49, -96, 50, 15, 49, 79, 64, -30, -110, 103, 83, 80, -94, -8, 96, 50, 12, -16, -6, 15, 61, 48, -8, 69, 2, -9, 24, -115, -111, -96, -13, -14, 3, -79, 15, 56, 122, -10, 16, -24, 31, -128, 87, 110, 16, -14, 45, -128, -16, 18, -16, -111, 14, 70, 98, 48, 93, -113, 119, -9, 16, 38, 3, -79, 5, -40, -15, 78, 16, 47, 16, 64, -16, -108, 97, 63, 95, -78, -40, 14, 41, 38, 117, 53, 4, 51, 31, 79, 3, 118, -10, 3, 32, 81, 48, -33, 0, 91, 47, 0, 38, 12, -16, 15, -127, -127, 8, 26, -34, 26, 3, 32, -16, -126, 50, -16, -108, 95, 71, -32, -13, -110, -13, 80, -8, -79, 96, 59, 31, 32, -108, 106, 26, 2, 96, 59, 16, 93, -113, 20, -31, 10, -47, 3, 32, 59, 23, -128, 118, 79, 55, -105, 63, 32, 50, 5, -40, -9, 127, 113, 2, 96, -16, -108, 97, 53, -11, -1, 9, -112, 47, 16, -14, 45, -128, -30, -110, 103, 83, 80, 69, 84, -39, 55, 111, 96, -49, 0, -76, -9, 16, -13, 17, 96, -7, 121, -111, -96, -13, -14, 15, 18, -114, 21, 15, 24, 47, 64, 59, 16, 40, -13, 115, 118, -10, 5, 52, -113, 52, 81, -11, -49, -10, 11, 69, 15, 49, 22, 10, 117, -12, 70, 57, 26, 15, 18, -128, -49, 127, -97, -64, 47, 16, -12, 118, 24, 73, 80, -8, -73, -21, 11, 79, 113, 10, 31, 2, 87, 49, -96, 38, 12, -16, -11, -49, -10, 11, 69, 15, 49, 22, 10, 117, -12, 70, 57, 26, 15, 18, -128, -49, 127, -97, -64, 47, 16, -12, 118, 24, 73, 80, 67, 3, -79, 5, 52, -113, 52, 81, 2, -113, 55, 55, 111, 96, -49, 15, 92, -1, 92, -1, 96, -76, 80, -13, 17, 96, -89, 95, 68, 99, -111, -81, 80, -4, -79, 5, -24, 79, 0, -8, 69, 9, 31, 19, 7, 96, -95, 31, 0, 95, 4, -31, -11, -49, -10, 11, 69, 15, 49, 22, 10, 117, -12, 70, 57, 26, 15, 18, -128, -49, 127, -97, -64, 47, 16, -12, 118, 24, 73, 80, -8, -73, -21, 11, 79, 113, 10, 31, 2, 87, 49, -96, 38, 12, -16, -11, 15, -4, -109, 127, 68, 49, 8, 30, -14, -23, 118, -10, 11, 69, 4, -107, 32, -12, 74, 16, -49, 112, -127, 82, -40, -31, 80, 79, 116, 121, 79, 57, 16, -15, 40, 7, -12, -12, 26, 116, 49, 13, 81, 15, -1, -71, 21, 80, 127, 16, 35, -79, -128, 91, 127, 5, 15, -127, -127, 5, -24, 79, 15, 1, -96, -79, -127, 3, -73, 80, -14, 20, -113, -1, -49, 92, -1, 96, -76, 80, -13, 17, 96, -89, 95, 68, 99, -111, -96, -15, 40, 12, -9, -7, -4, 2, -15, 15, 71, 97, -124, -107, 4, 48, 59, 16, 83, 72, -13, 69, 16, 40, -13, 115, 118, -10, 12, -16, -11, 15, -4, -109, 127, 68, 49, 8, 30, -14, -23, 118, -10, 11, 69, 4, -107, 32, -12, 74, 16, -49, 112, -127, 82, -40, -31, 80, 79, 116, 121, 79, 57, 16, -15, 40, 7, -12, -12, 26, 116, 49, 13, 81, 15, -1, -71, 21, 80, 127, 16, 35, -79, -128, 91, 127, 5, 15, -127, -127, 5, -24, 79, 15, 1, -96, -79, -127, 3, -73, 80, -14, 20, -113, -1, -49, 95, -78, -40, 14, 41, 38, 117, 53, 5, 19, 57, 118, -10, 12, -16, 11, 79, 113, 15, 18, -42, -96, 64, 83, -124, 111, 97, 4, -125, 127, 20, -29, 15, 50, 37, 55, 111, 96, -14, 45, -128, -127, 81, 72, -21, 7, 96, -49, -6, 15, 63, 32, -57, 8, 21, 45, -114, 21, -11, -5, 45, -128, -127, -31, 99, 15, 56, 20, -7, 59, -126, -33, 107, 7, 96, -49, -6, 11, 69, 4, -107, 32, -10, 127, 113, 96, -14, 45, 3, -79, 12, -7, 15, 49, 97, -15, 115, -11, -59, 11, 69, 15, 50, -12, -13, 26, 12, -16, -6, 15, -105, -103, 118, -10, 12, 127, -33, -48, -30, -110, 103, 83, 95, 92, 80, -76, 80, -13, 47, 79, 49, -96, -49, 15, -96, -95, 83, -126, -14, 118, -10, 2, 97, 7, 101, 52, -103, 67, 114, 111, 92, 80, -76, 80, -13, 47, 79, 49, -96, -49, 15, -96, -95, 83, -126, -14, 118, -10, 12, 112, -95, -15, 22, 81, 95, -96, -15, 78, 50, -121, 21, 4, 106, 15, 71, 97, 95, 92, 80, -76, 80, -13, 47, 79, 49, -96, -49, 15, -96, -7, 121, -105, 111, 96, -57, -3, -3, 14, 41, 38, 117, 53, -6, 4, 106, 10, 21, 56, 47, 39, 111, 96, 38, 28, -1, 80, 118, 83, 73, -108, 55, 38, -11, -59, 11, 69, 15, 50, -12, -13, 26, 12, -16, -6, 15, -105, -103, 118, -10, 12, 127, -33, -48, -30, -110, 103, 83, 95, -96, 70, -96, -95, 83, -126, -14, 118, -10, 12, 112, -95, -15, 22, 81, 95, -96, -15, 78, 50, -121, 21, 4, 106, 15, 71, 97, 95, 92, 80, -76, 80, -13, 47, 79, 49, -96, -49, 15, -96, -7, 121, -105, 111, 96, -57, -3, -3, 14, 41, 38, 117, 53, -11, 15, -14, -108, 97, 52, -113, 32, -95, -15, 22, 81, 80, 83, 47, 15, 1, -96, -49, -14, 2, -15, 15, 34, -40, 15, 50, -12, -13, 95, 92, 80, -76, 80, -13, 47, 79, 49, -96, -49, 15, -96, -95, 83, -126, -14, 118, -10, 2, 97, -49, -11, 7, 101, 52, -103, 67, 114, 111, 80, -1, 41, 70, 19, 72, -14, 10, 31, 17, 101, 21, 5, 50, -16, -16, 26, 12, -1, 32, 47, 16, -14, 45, -128, -13, 47, 79, 53, -11, -59, 11, 69, 15, 50, -12, -13, 26, 12, -16, -6, 10, 21, 56, 47, 39, 111, 96, -57, 15, 20, -29, 40, 113, 80, 70, -96, -12, 118, 21, -11, 15, -14, -108, 97, 52, -113, 32, -95, -15, 22, 81, 80, 83, 47, 15, 1, -96, -49, -14, 2, -15, 15, 34, -40, 15, 50, -12, -13, 95, 92, 80, -76, 80, -13, 47, 79, 49, -96, -49, 15, -96, -7, 121, -105, 111, 96, -57, -3, -3, 14, 41, 38, 117, 53, -6, 4, 106, 10, 21, 56, 47, 39, 111, 96, 38, 28, -1, 80, 118, 83, 73, -108, 55, 38, -11, 0, -1, 41, 70, 19, 72, -14, 10, 31, 17, 101, 21, 5, 50, -16, -16, 26, 12, -1, 32, 47, 16, -14, 45, -128, -13, 47, 79, 53, -11, -59, 11, 69, 15, 50, -12, -13, 26, 12, -16, -6, 15, -105, -103, 118, -10, 12, 127, -33, -48, -30, -110, 103, 83, 95, -96, 70, -96, -95, 83, -126, -14, 118, -10, 12, 112, -95, -15, 22, 81, 95, -96, -15, 78, 50, -121, 21, 4, 106, 15, 71, 97, 95, 80, -1, 41, 70, 19, 72, -14, 10, 31, 17, 101, 21, 5, 50, -16, -16, 26, 12, -1, 32, 47, 16, -14, 45, -128, -13, 47, 79, 53, -11, -4, -79, 12, 80, -76, 80, -13, 47, 79, 49, -96, -49, 15, -96, -7, 121, -105, 111, 96, -57, -3, -3, 2, -15, 15, 34, -40, 14, 41, 38, 117, 53, -11, -4, -79, 12, 80, -76, 80, -13, 47, 79, 49, -96, -49, 15, -96, -95, 83, -126, -14, 118, -10, 2, 97, -49, -11, 2, -15, 15, 34, -40, 7, 101, 52, -103, 67, 114, 101, -11, -4, -79, 12, 80, -76, 80, -13, 47, 79, 49, -96, -49, 15, -96, -95, 83, -126, -14, 118, -10, 12, 112, 47, 16, -14, 45, -128, -95, -15, 22, 81, 95, -96, -15, 78, 50, -121, 21, 4, 106, 15, 71, 97, 95, 95, -53, 16, -59, 11, 69, 15, 50, -12, -13, 26, 12, -16, -6, 15, -105, -103, 118, -10, 12, 127, -33, -48, 47, 16, -14, 45, -128, -30, -110, 103, 83, 95, -96, 70, -96, -95, 83, -126, -14, 118, -10, 2, 97, 2, -15, 15, 34, -40, 7, 101, 52, -103, 67, 114, 101, -11, -4, -79, 12, 80, -76, 80, -13, 47, 79, 49, -96, -49, 15, -96, -7, 121, -105, 111, 96, -57, -3, -3, 2, -15, 15, 34, -40, 14, 41, 38, 117, 53, -6, 4, 106, 10, 21, 56, 47, 39, 111, 96, -57, 2, -15, 15, 34, -40, 10, 31, 17, 101, 21, -6, 15, 20, -29, 40, 113, 80, 70, -96, -12, 118, 21, -11, -4, -79, 12, 80, -76, 80, -13, 47, 79, 49, -96, -49, 15, -96, -7, 121, -105, 111, 96, -57, -3, -3, 2, -15, 15, 34, -40, 14, 41, 38, 117, 53, -11, 15, -14, -108, 97, 52, -113, 32, -95, -15, 22, 81, 80, -95, 83, -126, -14, 26, 12, -1, 32, 47, 16, 59, 16, 118, -30, -12, 118, -10, 15, 50, -12, -13, 95, 95, -53, 16, -59, 11, 69, 15, 50, -12, -13, 26, 12, -16, -6, 10, 21, 56, 47, 39, 111, 96, 38, 28, -1, 80, 47, 16, -14, 45, -128, 118, 83, 73, -108, 55, 38, 95, 80, -1, 41, 70, 19, 72, -14, 10, 31, 17, 101, 21, 10, 21, 56, 47, 33, -96, -49, -14, 2, -15, 3, -79, 7, 110, 47, 71, 111, 96, -13, 47, 79, 53, -11, -4, -79, 12, 80, -76, 80, -13, 47, 79, 49, -96, -49, 15, -96, -95, 83, -126, -14, 118, -10, 12, 112, 47, 16, -14, 45, -128, -95, -15, 22, 81, 95, -96, -15, 78, 50, -121, 21, 4, 106, 15, 71, 97, 95, 80, -1, 41, 70, 19, 72, -14, 10, 31, 17, 101, 21, 10, 21, 56, 47, 33, -96, -49, -14, 2, -15, 3, -79, 7, 110, 47, 71, 111, 96, -13, 47, 79, 53, -11, -4, -79, 12, 80, -76, 80, -13, 47, 79, 49, -96, -49, 15, -96, -7, 121, -105, 111, 96, -57, -3, -3, 2, -15, 15, 34, -40, 14, 41, 38, 117, 53, -6, 4, 106, 10, 21, 56, 47, 39, 111, 96, 38, 28, -1, 80, 47, 16, -14, 45, -128, 118, 83, 73, -108, 55, 38, 95, 80, -1, 41, 70, 19, 72, -14, 10, 31, 17, 101, 21, 10, 21, 56, 47, 33, -96, -49, -14, 2, -15, 3, -79, 7, 110, 47, 71, 111, 96, -13, 47, 79, 53, -11, -4, -79, 12, 80, -76, 80, -13, 47, 79, 49, -96, -49, 15, -96, -7, 121, -105, 111, 96, -57, -3, -3, 2, -15, 15, 34, -40, 14, 41, 38, 117, 53, -6, 4, 106, 10, 21, 56, 47, 39, 111, 96, -57, 2, -15, 15, 34, -40, 10, 31, 17, 101, 21, -6, 15, 20, -29, 40, 113, 80, 70, -96, -12, 118, 21, -11, 15, -14, -108, 97, 52, -113, 32, -95, -15, 22, 81, 80, -95, 83, -126, -14, 26, 12, -1, 32, 47, 16, 59, 16, 118, -30, -12, 118, -10, 15, 50, -12, -13, 95, 95, -1, 54, -10, 118, 16, -124, -89, 67, 114, 96, -76, 80, -7, 121, -111, -96, -57, -3, -3, 14, 41, 38, 117, 53, 3, -124, -9, 25, 118, -10, 7, 96, -59, -11, -59, 11, 74, 2, -118, 24, 80, 50, 15, 71, 97, 12, -16, -6, 15, 61, 48, 59, 16, -15, -111, 19, 10, 33, 86, -2, 48, -76, -9, 16, 70, -14, 8, 31, 66, 49, 15, 71, 103, 111, 96, -12, 42, -39, 21, -11, 15, -53, 16, 40, -95, -128, -76, 80, -13, 17, 96, -28, 110, 25, 26, -11, -1, -1, 33, -12, 35, 16, -12, 118, 118, -10, 8, 47, 50, 53, 15, 24, 47, 64, -59, 11, 74, 2, -118, 24, 80, 50, 15, 71, 97, 12, -16, -6, 15, 61, 48, 59, 16, -16, -108, 97, 48, 117, 7, 107, 79, 55, 49, -81, 80, -4, -79, 2, -118, 24, 11, 69, 15, 49, 22, 14, 70, -31, -111, -81, 95, -1, -14, 31, 66, 49, 15, 71, 103, 111, 96, -126, -13, 35, 80, -15, -126, -12, 12, 80, -76, -96, 40, -95, -123, 3, 32, -12, 118, 16, 118, 10, 17, -16, 5, -16, 78, 31, 80, -4, -79, 2, -118, 24, 11, 69, 15, 49, 22, 14, 70, -31, -111, -81, 95, -78, -40, 8, 30, 22, 48, -13, -127, 79, -109, -72, 45, -10, -80, 118, 12, -1, -96, -76, 80, 73, 82, 15, 103, -9, 22, 15, 34, -48, 59, 16, -49, -112, -67, -103, 3, -14, -16, 31, 80, -4, 32, -13, -41, -102, 5, -73, -16, 80, -8, 115, -80, 59, 117, 10, 21, 127, 102, -6, 15, 98, 3, 32, 59, 16, -1, 75, 127, 0, -1, -14, 21, 127, 102, 10, 116, -110, -10, -6, 5, 25, 30, 48, -1, 15, 116, 121, 79, 57, 16, -1, -9, -39, -112, -4, -14, -16, 21, -6, 4, 106, 15, 8, 21, 80, -1, -15, 47, 15, 32, -1, 65, -111, -29, 26, 15, -1, 33, 87, -10, 111, 92, 80, -76, 80, -110, 74, 26, 12, -1, -48, 47, 16, -49, 64, -15, -126, -12, 12, 95, 92, 80, -76, 80, -13, 20, -12, 26, 2, -9, 24, 12, -1, -48, -49, 64, -15, -126, -12, 12, 95, 95, -78, -40, 3, 24, -124, -15, 40, -12, 118, -10, 1, -15, -15, 40, 53, 2, 96, -49, 0, -76, -9, 16, -49, -7, 3, -79, 12, 16, 50, 12, -1, -13, -11, -49, 0, -76, 80, -13, -41, -109, 4, 6, 31, -128, -49, -112, -16, -108, 97, 52, -113, 32, 94, 70, 97, -113, 92, 80, -76, 80, -13, 17, 96, -110, 74, 26, 15, -121, 59, 12, -1, -48, 47, 16, -49, 64, -13, -14, 3, -79, 15, 71, 103, 111, 96, -126, -13, 35, 80, 47, 16, -59, 15, -126, -113, -105, 111, 96, 38, 12, -16, -11, -1, 0, -13, 67, 57, 16, 50, 47, -112, -16, -108, -31, 4, 48, -58, -11, 15, -14, -127, 85, 3, -79, 15, -1, 98, 50, 15, 61, 51, 38, 3, 32, -9, 113, -8, 3, -79, 15, -3, -1, -15, -1, -1, 32, -127, -30, -118, 118, -10, 2, -15, 3, -79, 15, 52, 51, -111, -11, -4, 127, 15, -1, -16, 15, -78, -48, -28, 96, -73, -95, 13, 103, -12, -16, 40, 52, 99, 15, 65, 85, 79, 97, 80, -13, -14, 14, -105, -17, -105, 111, 96, 59, 16, -21, 30, -7, -12, 72, -7, 7, 96, 59, 16, -12, 21, 84, -10, 21, 3, 115, -111, -13, 72, -11, 15, -78, -48, -28, 96, -127, 91, 47, -128, 59, 21, 16, -12, 21, 84, -10, 21, 4, 48, 70, -14, 3, 127, 65, 15, 63, 32, -23, 126, -7, 118, -10, 2, 96, 59, 16, -12, 79, 102, 127, 31, 39, 111, 96, -10, -108, 85, 7, 96, 59, 16, 55, 57, 31, 52, -113, 80, -4, 127, 15, -1, -16, 15, -62, 4, -86, 15, -124, -14, -16, 39, 99, 95, -96, 81, -111, -29, 4, 5, -73, -16, -6, 3, -79, 96, -23, 126, -7, 2, 96, 59, 16, -95, 87, -127, -96, -95, 83, 118, 67, 114, 96, -8, -73, -111, 11, 41, -89, 111, 96, -94, -8, 96, 59, 16, -1, 75, 127, 19, 15, -111, -14, -11, 15, -78, -48, -28, 96, 73, 82, 10, -124, -10, 1, -1, 119, 83, 118, -10, 15, -124, -14, -16, 39, 99, 80, 50, 15, 66, -9, 16, 59, 31, 64, 50, 4, 6, 31, -128, -110, -28, 55, 38, -11, -4, 127, 15, -1, -16, 15, -62, 10, 21, 127, 102, 15, 34, -40, 2, -8, 96, 91, 127, 5, -6, 15, 8, 21, 80, -2, -1, 111, -1, -10, -2, -6, 5, 25, 30, 48, -2, -1, 15, 116, 121, 79, 57, 16, -1, -9, -39, -112, -4, -14, -16, 21, -2, -6, 15, 7, -17, -112, 38, 16, -15, -126, -12, 3, -79, 10, -126, -16, -94, -8, 111, -96, 70, -96, -73, 48, 59, 16, -2, -1, -15, 47, 15, 47, -32, -13, -45, 50, 111, 95, -57, -16, -1, -1, 0, -1, 34, -16, -33, 0, -79, -97, 0, 117, 4, -9, 71, -108, -13, -111, 2, -9, 24, 15, 68, 111, 32, 47, 16, 59, 16, -89, 95, 9, 79, 33, -96, 83, 67, 117, 55, -27, -11, 15, -10, 40, 1, -1, 116, -12, -16, -111, 15, 34, -48, -28, 96, -23, 126, -7, 2, 96, -16, -108, 97, 48, 83, 67, 117, 55, -27, 7, 96, 59, 16, 93, -12, -12, 72, -14, 15, -121, 106, 47, -128, 50, 15, 97, 48, 74, -89, 55, 38, 73, 10, 19, 71, -107, -11, -1, 0, 95, 68, -103, 14, 47, 65, 48, -76, 80, -24, 69, -79, -96, 118, 50, 12, -16, 15, 56, 118, -10, 118, -10, 6, 31, -128, -12, 118, 24, 73, 80, 70, -96, 73, 49, -121, 111, 96, 59, 16, -16, -108, 97, 63, -27, 1, 111, 119, -126, 111, 65, 99, -11, -1, 0, -12, 26, 125, -12, -1, -16, 87, -1, 17, -96, -30, -12, 19, 11, 69, 14, -124, 91, 26, 7, 99, 32, -49, 0, -13, -121, 111, 103, 111, 96, 64, 87, -10, 103, -15, 126, 70, 48, -1, -8, -44, 99, 115, -14, 2, -15, 15, 71, 97, -124, -107, 3, 32, 59, 16, -16, -108, 97, 63, 95, -16, 9, 72, -10, 16, -30, -12, 19, 11, 69, 14, -124, 91, 26, 7, 99, 32, -49, 0, -13, -121, 111, 103, 111, 96, 64, -8, 122, 16, -9, 72, 113, 63, 32, 47, 16, 97, -8, 15, 71, 97, -124, -107, 4, 106, 10, -124, 83, 126, 73, -97, 32, 73, 49, -121, 111, 96, 59, 16, -16, -108, 97, 63, -27, 1, 111, 119, -126, 111, 65, 99, -11, -1, 0, -67, -10, 16, -30, -12, 19, 11, 69, 14, -124, 91, 26, 7, 99, 32, -49, 0, 31, 79, 49, -86, 118, -10, 15, 116, 83, 15, -1, -115, 70, 55, 55, 21, 2, -15, 15, 71, 97, -124, -107, 7, 96, 59, 16, -16, -108, 97, 48, 70, -96, -124, -89, -28, -103, -14, 4, -109, 24, 118, -10, 7, 53, 1, 111, 119, -126, 111, 65, 99, -11, -1, 0, 95, 68, -103, 14, 47, 65, 48, -76, 80, -24, 69, -79, -96, 118, 50, 15, 34, -40, 15, 9, 70, 19, 12, -16, -6, 15, -105, -103, 118, -10, 15, -1, -33, -1, -17, -5, 2, -15, 15, 34, -40, 14, 41, 38, 117, 53, -11, 15, -53, 16, -30, -12, 19, 15, 56, 45, -10, -77, 4, -86, 115, 114, 100, -112, -12, 118, 24, 73, 80, 70, -96, -76, 80, 73, 49, -127, -96, 59, 16, -16, -108, 97, 63, -27, 12, 31, 95, -16, 15, 65, -89, -33, 79, -1, 5, 127, -15, 26, 14, 47, 65, 48, -76, 80, -24, 69, -79, -96, 118, 50, 15, 34, -40, 15, 9, 70, 19, 12, -16, -6, 15, -105, -103, 118, -10, 15, -1, -10, -1, -2, -1, -80, 47, 16, -14, 45, -128, -30, -110, 103, 83, 95, 80, -4, -79, 14, 47, 65, 48, -13, -126, -33, 107, 48, 74, -89, 55, 38, 73, 15, 71, 97, -124, -107, 4, 106, 11, 69, 4, -109, 24, 26, 3, -79, 15, 9, 70, 19, -2, 80, -63, 4, 106, 12, 31, 95, -16, 9, 72, -10, 16, -30, -12, 19, 11, 69, 14, -124, 91, 26, 7, 99, 32, -14, 45, -128, -16, -108, 97, 48, -49, 15, -96, -7, 121, -105, 111, 96, -1, -1, 127, -1, -17, -5, 2, -15, 15, 34, -40, 14, 41, 38, 117, 53, -11, 15, -53, 16, -30, -12, 19, 15, 56, 45, -10, -77, 5, 127, 102, 127, 23, -28, 99, 15, -1, -115, 70, 55, 55, 21, 2, -15, 15, 71, 97, -124, -107, 4, 106, 11, 69, 4, -109, 24, 26, 3, -79, 15, 9, 70, 19, -2, 80, -63, -6, 12, 31, -96, 70, -96, -63, -11, -1, 0, -67, -10, 16, -30, -12, 19, 11, 69, 14, -124, 91, 26, 7, 99, 32, -14, 45, -128, -16, -108, 97, 48, -49, 15, -96, -7, 121, -105, 111, 96, -1, -1, -81, -1, -17, -5, 2, -15, 15, 34, -40, 14, 41, 38, 117, 53, -11, 15, -53, 16, -30, -12, 19, 11, 69, 1, -12, -13, 26, -95, -96, -9, 69, 48, 83, 40, 21, 2, -15, 15, 71, 97, -124, -107, 4, 106, 11, 69, 4, -109, 24, 26, 3, -79, 15, 9, 70, 19, -2, 80, -63, -6, 12, 31, -96, 70, -96, -63, -11, -59, 11, 69, 8, -42, 2, -45, 2, -15, 15, 29, 25, -11, 15, -53, 16, -15, -111, 19, -2, 80, 95, 1, 26, 11, 69, 15, 49, 22, 10, 30, -127, 69, 26, 3, 32, -1, -6, 72, -16, 12, 127, 95, -78, -40, 5, -25, 22, 55, 83, 80, 38, 12, -16, 11, 79, 113, 3, -124, 101, -12, -45, 26, 14, 47, 79, 66, 96, -12, 67, 24, 116, -107, 7, 99, 32, -57, -7, -4, 1, 78, -80, 47, 16, -1, -104, 38, 125, -12, -6, 15, -1, -12, 40, 70, 125, -12, 4, 106, 15, -1, 97, -113, 68, 103, -33, 79, 95, -16, 15, 52, 51, -111, 3, 34, -7, 15, 9, 78, 16, 67, 12, 111, 80, -5, 45, -128, -49, -15, 15, -124, 80, -95, 83, -126, -14, 26, -11, 15, -53, 16, 94, -127, 79, 69, 2, -15, 12, -9, -3, -3, 14, 41, 38, 117, 53, 1, -21, 32, 118, 15, 34, -40, 15, 56, 71, 111, 95, -16, 15, 52, 51, -111, 3, 34, -7, 15, 9, 78, 16, 67, 12, 111, 80, -5, 45, -128, -49, -15, 15, -124, 80, -95, 83, -126, -14, 26, -11, 15, -16, -103, 12, -9, -3, -3, 14, 41, 38, 117, 53, 11, 79, 113, 15, -6, 39, 97, -96, -8, 115, -80, 59, 16, -30, 95, 71, -32, 73, -97, 92, 80, -76, 80, -13, 47, 79, 49, -96, -49, 15, -96, -7, 121, -105, 111, 96, 47, 31, 16, 73, -112, 59, 16, 22, 31, 79, 32, -30, -110, 103, 83, 95, 92, 80, -76, 80, -13, 47, 79, 49, -96, -49, 15, -96, -7, 121, -105, 111, 96, 73, -112, 47, 16, -14, 45, -128, -30, -110, 103, 83, 95, 95, -16, 15, 52, 51, -111, 3, 34, -7, 15, 9, 78, 16, 67, 12, 111, 80, -5, 45, -128, -49, -15, 10, 21, 56, 47, 33, -96, -49, -15, -6, 3, 79, -105, 111, 96, 98, 10, 79, 68, -10, 31, 95, -16, 15, 52, 51, -111, 3, 34, -7, 15, 9, 78, 16, 67, 12, 111, 80, -5, 45, -128, -49, -15, 15, -124, 80, -95, 83, -126, -14, 26, 15, 63, 32, -49, -15, -6, 15, -117, 126, -80, 50, 47, -112, 98, 10, 79, 68, -10, 31, 95, -16, 15, 52, 51, -111, 3, 34, -7, 15, 9, 78, 16, 67, 12, 111, 80, -5, 45, -128, -49, -15, 10, 21, 56, 47, 33, -96, -49, -15, -6, 11, 47, -127, -9, 24, -6, 7, 48, 50, 47, -112, 82, -12, 16, -92, -12, 79, 97, 7, 96, 59, 16, -15, -124, -14, -11, -1, 0, -13, 67, 57, 16, 50, 47, -112, -16, -108, -31, 4, 48, -58, -11, 15, -78, -40, 12, -1, 16, -8, 69, 10, 21, 56, 47, 33, -96, -13, -14, 12, -1, 31, -96, -8, -73, -21, 15, -124, 80, -92, -12, 79, 97, -96, 118, 3, -79, 15, 24, 79, 47, 95, -16, 15, 52, 51, -111, 3, 34, -7, 15, 9, 78, 16, 67, 12, 111, 80, -1, -12, 23, 59, 24, 15, 34, -40, 12, -1, 16, 98, -128, -49, -15, 15, -124, 80, -95, 83, -126, -14, 26, 7, 96, 59, 16, 118, -25, -95, 99, -11, -1, 0, -13, 67, 57, 16, 50, 47, -112, -16, -108, -31, 4, 48, -58, -11, 15, -78, -40, 12, -1, 31, -1, -100, 112, -95, 83, -126, -14, 26, 12, -1, 31, -1, -100, 127, -96, 52, -7, 118, -10, 6, 32, -92, -12, 79, 97, -11, -1, 0, -13, 67, 57, 16, 50, 47, -112, -16, -108, -31, 4, 48, -58, -11, 15, -78, -40, 12, -1, 31, -1, -100, 112, -8, 69, 10, 21, 56, 47, 33, -96, -13, -14, 12, -1, 31, -1, -100, 127, -96, -8, -73, -21, 3, 34, -7, 6, 32, -92, -12, 79, 97, -11, -1, 0, -13, 67, 57, 16, 50, 47, -112, -16, -108, -31, 4, 48, -58, -11, 15, -78, -40, 12, -1, 31, -1, -100, 112, -95, 83, -126, -14, 26, 12, -1, 31, -1, -100, 127, -96, -78, -8, 31, 113, -113, -96, 115, 3, 34, -7, 5, 47, 65, 10, 79, 68, -10, 16, 118, 3, -79, 15, 24, 79, 47, 95, -16, 15, 52, 51, -111, 3, 34, -7, 15, 9, 78, 16, 67, 12, 111, 80, -5, 45, -128, -49, -15, -1, -7, -57, 15, -124, 80, -95, 83, -126, -14, 26, 15, 63, 32, -49, -15, -1, -7, -57, -6, 15, -117, 126, -80, -8, 69, 10, 79, 68, -10, 26, 7, 96, 59, 16, -15, -124, -14, -11, -1, 0, -13, 67, 57, 16, 50, 47, -112, -16, -108, -31, 4, 48, -58, -11, 15, -1, 65, 115, -79, -128, -14, 45, -128, -49, -15, -1, -7, -57, 6, 40, 12, -1, 31, -1, -100, 112, -8, 69, 14, 47, 79, 9, 19, 25, -14, 10, 21, 56, 47, 33, -96, 118, 3, -79, 7, 110, 122, 22, 63, 95, -16, 15, 52, 51, -111, 3, 34, -7, 15, 9, 78, 16, 67, 12, 96, 79, 100, 118, 83, 12, -97, 80, -57, 2, -15, 15, 34, -40, 15, 18, -114, 21, 10, 21, 56, 47, 33, -96, 73, -112, 47, 16, 59, 16, 22, 31, 79, 32, -15, 40, -31, 95, -96, 52, -7, 118, -10, 6, 32, -28, 93, 73, 55, 21, -11, -1, 0, -13, 67, 57, 16, 50, 47, -112, -16, -108, -31, 4, 48, -58, 4, -10, 71, 101, 48, -55, -11, 15, -16, -103, 2, -15, 15, 34, -40, 15, 18, -114, 21, 15, -127, -127, 10, 21, 56, 47, 33, -96, -13, -14, 12, 112, 47, 16, 59, 16, 22, 31, 79, 47, -27, 15, 18, -114, 21, -11, -1, 0, -13, 67, 57, 16, 50, 47, -112, -16, -108, -31, 4, 48, -58, 4, -10, 71, 101, 48, -55, -11, 12, 112, 47, 16, -14, 45, -128, -15, 40, -31, 80, -95, 83, -126, -14, 26, 4, -103, 2, -15, 3, -79, 1, 97, -12, -14, 15, 18, -114, 21, -6, 11, 47, -127, -9, 24, -6, 12, 112, 47, 16, -14, 45, -128, 91, 127, 5, 15, -127, -127, 10, 21, 56, 47, 33, -81, 95, -16, 15, 52, 51, -111, 3, 34, -7, 15, 9, 78, 16, 67, 12, 96, 79, 100, 118, 83, 12, -97, 80, -1, 9, -112, 47, 16, -14, 45, -128, -15, 40, -31, 80, -8, 24, 16, -95, 83, -126, -14, 26, 15, 63, 32, -57, 2, -15, 3, -79, 1, 97, -12, -14, -2, 80, -15, 40, -31, 95, 80, -5, 45, 15, 68, 100, -10, 26, 3, 32, -95, 83, -126, -14, 12, 112, 47, 16, 59, 16, 22, 31, 79, 47, -27, 15, 18, -114, 21, -11, -1, 0, -13, 67, 57, 16, 50, 47, -112, -16, -108, -31, 4, 48, -58, 4, -10, 71, 101, 48, -55, -11, 15, -1, 65, 115, -79, -128, -14, 45, -128, -57, 15, 18, -114, 21, 6, 40, 3, -79, 1, 97, -12, -14, -2, 80, -57, 15, 18, -114, 21, 15, -127, -127, 14, 47, 79, 9, 19, 25, -14, 15, -121, -16, 26, 2, -45, -11, 15, -78, -48, -110, 83, 12, 112, 70, -96, 59, 16, 22, 31, 79, 32, -110, 83, 12, 127, 95, -16, 15, 52, 51, -111, 3, 34, -7, 15, 9, 78, 16, 67, 12, 96, 79, 100, 118, 83, 12, -97, 80, -57, 2, -15, 15, 34, -40, 15, 18, -114, 21, 10, 21, 56, 47, 33, -96, -49, -15, -6, 3, 79, -105, 111, 96, 98, 14, 69, -44, -109, 113, 95, 95, -16, 15, 52, 51, -111, 3, 34, -7, 15, 9, 78, 16, 67, 12, 96, 79, 100, 118, 83, 12, -97, 80, -5, 45, -128, -49, -15, 15, -124, 80, -95, 83, -126, -14, 26, 15, 63, 32, -57, 2, -15, 3, -79, 1, 97, -12, -14, -2, 80, -15, 40, -31, 95, 95, -16, 15, 52, 51, -111, 3, 34, -7, 15, 9, 78, 16, 67, 12, 96, 79, 100, 118, 83, 12, -97, 80, -57, 2, -15, 15, 34, -40, 15, 18, -114, 21, 10, 21, 56, 47, 33, -96, -49, -15, -6, 11, 47, -127, -9, 24, -6, 12, 112, 47, 16, -14, 45, -128, -15, 40, -31, 80, -8, 24, 16, -95, 83, -126, -14, 26, -11, -1, 0, -13, 67, 57, 16, 50, 47, -112, -16, -108, -31, 4, 48, -58, 4, -10, 71, 101, 48, -55, -11, 15, -78, -40, 12, -1, 16, -8, 69, 10, 21, 56, 47, 33, -96, -13, -14, 12, 112, 47, 16, 59, 16, 22, 31, 79, 47, -27, 15, 18, -114, 21, -11, 15, -78, -48, -12, 70, 79, 97, -96, 50, 10, 21, 56, 47, 32, -57, 2, -15, 3, -79, 3, -79, 120, 15, 18, -114, 21, -11, -1, 0, -13, 67, 57, 16, 50, 47, -112, -16, -108, -31, 4, 48, -58, 7, 111, 114, -97, 119, 111, 96, -57, 8, 78, 21, -11, 12, 112, 47, 16, -14, 45, -128, -15, 40, -31, 80, -95, 83, -126, -14, 26, 4, -103, 3, -79, 1, 97, -12, -14, 15, 18, -114, 21, 15, -121, 59, 45, 48, 64, 87, 111, 105, 16, -28, 93, 73, 63, 47, 95, -16, 15, 52, 51, -111, 3, 34, -7, 15, 9, 78, 16, 67, 12, 96, 118, -9, 41, -9, 118, -10, 12, 112, -124, -31, 95, 80, -5, 45, 9, 37, 48, -57, 2, -15, 15, 34, -40, 12, 112, -15, 40, -31, 95, 80, -1, 9, -112, 47, 16, 59, 16, 22, 31, 79, 32, -15, 40, -31, 80, -8, 24, 16, -95, 83, -126, -14, 26, -11, -1, 0, -13, 67, 57, 16, 50, 47, -112, -16, -108, -31, 4, 48, -58, 7, 111, 114, -97, 119, 111, 96, -57, 8, 78, 21, -11, 15, -78, -40, 1, 99, 120, 16, 72, -12, 74, 64, 47, 16, -57, 15, 18, -114, 21, 15, -124, 80, -95, 83, -126, -14, 26, 15, 63, 32, -57, 1, 97, -12, -14, 15, 18, -114, 21, -11, 15, -78, -48, -89, -90, -2, 48, -12, 70, 79, 97, 3, 32, -95, 83, -126, -14, 4, 5, 118, -10, -111, 5, -73, -16, -11, -1, 0, -13, 67, 57, 16, 50, 47, -112, -16, -108, -31, 4, 48, -58, 7, 111, 114, -97, 119, 111, 96, -57, 8, 78, 21, -11, 15, -78, -40, 1, 99, 120, 16, 72, -12, 74, 64, 47, 16, -57, 15, 18, -114, 21, 15, -124, 80, -95, 83, -126, -14, 26, 15, 63, 32, -57, 1, 97, -12, -14, 15, 18, -114, 21, -11, 15, -53, 31, 32, -110, 83, 12, 112, -15, 40, -31, 95, 95, -16, 15, 52, 51, -111, 3, 34, -7, 15, 9, 78, 16, 67, 12, 96, 118, -9, 41, -9, 118, -10, 12, 112, -124, -31, 95, 80, -5, 45, 9, 37, 48, -57, 2, -15, 15, 34, -40, 12, 112, -15, 40, -31, 80, -8, -73, -111, 3, -79, -14, 9, 37, 48, -57, 2, -15, 3, -79, 120, 12, 112, -15, 40, -31, 95, 95, -78, -40, 11, 47, 65, 15, 9, 70, 19, 7, 80, -49, 15, 80, -5, 45, -128, -16, 18, -16, -111, 4, -127, 8, 20, -81, 32, 50, 9, 20, -9, 16, 59, 16, 97, 83, 4, 106, 1, -1, 127, 9, 40, 16, 59, 16, -42, 127, 113, -123, 31, 80, -1, -10, 34, -96, -99, -17, -97, 95, -78, -48, -76, -9, 16, -15, 45, 106, 4, 15, 9, 70, 19, 2, -18, -33, 7, 26, 15, 63, 32, 82, -12, 18, 97, 1, -107, 31, 80, -49, 0, 117, 14, -40, -127, 99, -97, 32, 47, -122, 26, 15, 63, 32, -55, -11, -5, 45, 11, 79, 113, 15, 18, -42, -96, 64, 97, -8, 15, 9, 70, 19, 15, -117, 126, -80, -42, -15, 40, 61, 100, 49, -97, 32, 117, 6, 35, 11, 79, 55, 52, -13, -111, 15, 63, 32, -14, 45, -11, 12, -1, 32, 47, 16, -14, 45, -128, -30, -110, 103, 83, 80, -8, 121, -112, -89, 16, 20, -21, 15, 33, 72, 7, -15, 15, 34, -48, -30, -110, 103, -1, 17, 12, -16, -11, -5, 45, 11, 79, 113, 15, 18, -42, -96, 64, 97, -8, 11, 79, 55, 52, -13, -111, 15, 9, 70, 19, -11, 0, -5, 45, -128, -30, -110, 103, 83, 80, -8, 121, -112, -10, -126, -8, 15, 63, 32, -33, 0, 50, 12, -1, 32, -16, 24, 15, 33, 72, 7, -15, 15, 34, -48, -30, -110, 103, -1, 17, 12, -16, -11, -5, 45, 11, 79, 113, 15, 18, -42, -96, 64, 97, -8, 15, 9, 70, 19, 15, 61, 48, -14, 45, 10, 38, -2, 48, -7, 98, -8, 7, -15, 7, 48, 117, 11, 79, 55, 52, -13, -111, 2, -128, 98, 48, -14, 19, -11, 12, -16, 15, -121, -103, 8, 31, 68, 118, 4, 15, 79, 37, 49, -113, 32, -42, 55, -112, -14, 45, 15, 119, 87, 48, 115, 15, -121, 59, 4, 15, 25, 17, 48, -8, 115, -80, -13, 19, 49, -128, 94, 70, 97, -123, -11, -5, 45, 11, 79, 113, 15, 18, -42, -96, 64, 97, -8, 15, 9, 70, 19, 15, -117, 126, -80, -14, 45, 11, 79, 113, 3, -79, 4, -13, 121, 115, -14, 3, 32, -12, 79, -111, 11, 79, 55, 52, -13, -111, -11, 15, -1, -89, 59, 3, 24, -124, -15, 40, -12, 118, -10, -6, 15, 34, -40, 14, 41, 38, 117, 53, 15, -121, -103, 15, 104, 47, -128, -13, -14, 13, -16, 3, 32, -49, -14, 15, 1, -128, -14, 20, -128, 127, 16, -14, 45, 14, 41, 38, 127, -15, 16, -49, 15, 92, -16, 11, 69, 15, 61, 121, 48, 69, 15, 68, 111, 32, -12, 118, 21, 4, 80, 59, 16, -19, -120, 22, 48, -16, 47, 13, -108, 55, 38, 14, 70, 2, -16, 24, 67, 31, 80, -1, 13, 50, 15, 61, 121, -89, 111, 96, 47, 16, -12, 118, 21, 7, 80, 49, -12, -16, 40, 72, 121, -14, 15, 57, 46, -7, 26, -11, -49, 0, -76, 80, -13, -41, -109, 4, 80, -12, 70, -14, 15, 71, 97, 80, 69, 3, -79, 15, 9, 70, 19, 14, 70, 5, -33, 15, 2, -125, -11, 15, -16, -45, 32, -13, -41, -102, 118, -10, 2, -15, 15, 71, 97, 80, 117, 5, 50, -16, -16, 26, -11, -49, 0, -76, 80, -13, -41, -109, 4, 80, -12, 70, -14, 15, 20, -29, 40, 113, 80, 69, 3, -79, 14, -40, -127, 99, 15, 2, -16, -39, 67, 114, 96, -28, 96, 47, 1, -124, 49, -11, 15, -16, -45, 32, -13, -41, -102, 118, -10, 2, -15, 15, 20, -29, 40, 113, 80, 117, 3, 31, 79, 2, -124, -121, -97, 32, -13, -110, -17, -111, -81, 92, -16, 11, 69, 15, 61, 121, 48, 69, 15, 68, 111, 32, -15, 78, 50, -121, 21, 4, 80, 59, 16, -16, -108, 97, 48, -28, 96, 93, -16, -16, 40, 63, 80, -1, 13, 50, 15, 61, 121, -89, 111, 96, 47, 16, -15, 78, 50, -121, 21, 7, 80, 83, 47, 15, 1, -81, 92, -16, 11, 69, 15, 61, 121, 48, 69, 15, 68, 111, 32, -95, -15, 22, 81, 80, 69, 3, -79, 14, -40, -127, 99, 15, 2, -16, -39, 67, 114, 96, -28, 96, 47, 1, -124, 49, -11, 15, -16, -45, 32, -13, -41, -102, 118, -10, 2, -15, 10, 31, 17, 101, 21, 7, 80, 49, -12, -16, 40, 72, 121, -14, 15, 57, 46, -7, 26, -11, -49, 0, -76, 80, -13, -41, -109, 4, 80, -12, 70, -14, 10, 31, 17, 101, 21, 4, 80, 59, 16, -16, -108, 97, 48, -28, 96, 93, -16, -16, 40, 63, 80, -1, 13, 50, 15, 61, 121, -89, 111, 96, 47, 16, -95, -15, 22, 81, 80, 117, 5, 50, -16, -16, 26, -11, -4, -79, 15, 18, -114, 21, 2, -15, 12, -1, -1, -128, -76, -9, 16, -13, 17, 96, -95, -23, 72, 26, 3, -79, 15, -121, 102, 24, 2, -15, 3, -73, 80, -10, 79, 65, -11, 15, -78, -48, 72, 16, 74, -9, 117, 26, 3, 32, 78, -31, -16, 48, 59, 23, -128, 93, -16, -127, -12, 78, -14, -6, 3, -78, -33, 107, 15, 34, -48, -12, 79, 32, -30, 99, 118, -47, 3, -79, 15, 23, -10, -77, -11, -5, 45, 11, 79, 113, 15, 49, 22, 10, 30, -108, -127, -96, 59, 16, -8, 118, 97, -128, 47, 16, 59, 117, 15, 100, -12, 31, 80, -5, 45, 15, 68, -14, 14, 38, 55, 109, 16, 50, 15, 9, 79, 32, 59, 45, -10, -65, -96, 127, 16, -14, 45, 15, -121, 91, 3, 32, -127, 73, -97, 32, -115, -13, 1, -9, 24, -14, 38, 31, -27, 6, 37, 16, 118, 15, 34, -40, 15, 104, 70, -96, -9, 126, 50, -113, 47, 95, -78, -33, -96, 73, 38, -10, 15, -121, 59, 12, -1, -1, -128, -76, -9, 16, -13, 17, 96, -95, -23, 72, 26, 3, -79, 15, -121, 102, 24, 80, 47, 16, 59, 117, 15, 100, -12, 31, 80, -5, 45, 15, 68, -14, 14, 38, 55, 109, 16, 50, 15, 9, 79, 32, 59, 45, -10, -65, -96, 127, 16, -14, 45, 15, -121, 91, 3, 32, 67, 49, -12, -16, 48, 50, 7, -12, -16, -126, -9, 16, -14, 45, -128, 83, 70, -89, 111, 96, 79, 66, 111, 96, -14, 45, -128, -15, 25, -110, -8, 10, 126, 52, 50, -123, -11, -5, 45, 4, -127, 10, 20, -81, 80, -1, 9, -112, -14, 45, -128, -16, -108, 97, 53, 11, 79, 113, 15, 49, 22, 2, -9, 24, -115, 96, 70, -96, -14, 45, -128, 95, 4, -31, 91, 127, 5, 10, 31, 17, 67, 26, -11, -4, -79, 2, -118, 24, 3, 32, -13, -41, -102, 4, 5, -28, 102, 24, 4, 48, -49, 0, -8, 69, 14, 70, -31, -111, -96, 69, 15, 34, -48, 73, -127, 74, -14, 11, 79, 113, 4, 5, -28, 102, 24, 3, -79, -127, -11, -5, 45, -128, 83, 72, -13, 69, 16, 67, 12, -16, 15, 61, 121, 48, -57, 6, 31, -128, 91, 127, 15, -1, -75, -1, -4, 2, -15, 3, -14, -16, 16, -49, -15, 15, 61, 48, 59, 31, 32, -8, 24, 16, -110, 83, 7, 96, 70, 4, -81, 71, 103, 83, -124, 55, -9, 16, -10, 34, -15, -11, 15, -78, -40, 15, 61, -127, 77, -24, 67, 80, -28, 96, 38, -97, 32, -7, 17, -16, 4, 96, 31, 33, 2, 96, -1, -2, -1, -1, 63, -1, -48, -15, -111, 19, 80, 67, 4, 3, 127, 65, -11, -1, 9, -112, 56, 78, 21, 2, -15, 12, -1, -32, -76, -9, 16, -13, 17, 96, 25, 127, 71, 100, 49, -96, -15, -126, -12, 3, -79, 15, 100, -108, -1, 127, 47, -96, -12, 79, 32, 59, 31, 32, -127, 83, 7, 96, -16, 20, -31, -11, -1, 9, -112, 56, 78, 21, 2, -15, 1, -9, 24, -14, 2, 59, 24, 8, 127, 116, -112, -76, -9, 16, -13, 17, 96, 25, 127, 71, 100, 49, -96, -15, -126, -12, 3, -79, 15, 100, -108, -1, 127, 47, 80, -5, 45, 4, -110, 97, 4, -127, 9, 31, 19, 3, 32, -115, -111, 3, -79, 13, 103, -9, 24, 81, -1, -11, -59, 11, 69, 4, -18, 47, 79, 9, 117, -79, -96, 73, -112, 59, 16, -127, -12, 35, 16, 49, -120, 79, 18, -113, 71, 111, 96, -14, 45, 4, -127, 14, -40, -127, 99, -97, 32, -28, -16, 79, 57, 16, 47, 16, -16, 24, -15, 40, -12, 118, -10, 4, 48, -49, 15, 92, -1, 95, -12, 47, 65, 38, 16, -76, 80, 95, -127, -16, 48, -49, 112, -12, 118, 21, 15, 24, 47, 64, -14, 45, -128, -49, -13, 15, 71, 97, 15, 23, 25, -96, 67, 12, 111, 92, 80, -76, 80, 67, 49, -12, -16, 49, -96, 50, 9, 79, 32, -12, 118, 21, -11, 15, -53, 16, 40, -95, -128, -76, 80, -13, 17, 96, -28, 110, 25, 26, 15, 49, -28, -43, 16, 98, 5, -73, -16, 7, 96, 59, 16, -15, -111, 19, 11, 69, 4, 15, 71, 97, 9, 79, 39, 111, 96, -16, 42, -11, -49, -11, -4, -79, 15, -13, -14, 83, 24, -14, 15, -56, 74, 24, 11, 69, 10, 30, 122, 26, 3, 32, -12, 79, -111, 4, 98, 59, 24, 15, 4, 85, 3, -72, 45, -10, -80, -7, 98, -8, 96, 95, 4, -31, 3, 32, 118, -24, 20, 81, 4, -18, 21, 80, 50, 11, 117, 15, -124, -127, 95, 95, -1, 45, 16, 50, 3, -79, 8, 127, 98, -123, 2, -15, 15, -124, -113, 0, 78, -31, -111, -124, 55, 38, -6, 12, -9, -3, -3, 2, -15, 15, 34, -40, 14, 41, 38, 117, 53, 2, 96, -59, 11, 79, 113, 10, 113, -81, 92, 80, -76, 80, 95, -127, -16, 48, -49, 112, -12, 118, 21, 15, 24, 47, 64, 64, -49, -2, 12, -1, 48, -12, 118, 16, -15, 113, -102, 4, 48, -58, -11, -59, 11, 69, 10, 117, -16, 24, 81, -96, -49, 112, -12, 118, 21, -11, -59, 11, 69, 7, 110, -127, 69, 26, 4, 15, 71, 97, -15, 113, -102, 15, 63, 32, -49, 112, -12, 118, 21, -11, -59, 11, 69, 15, 49, 22, 5, 50, -16, -16, 26, 7, 96, 64, -49, -2, 12, -1, 48, -12, 118, 16, -15, 113, -102, 4, 48, -58, -11, -59, 11, 69, 15, 49, 22, 5, 50, -16, -16, 26, 7, 96, 64, -49, -2, 12, -1, 48, -12, 118, 16, -15, 113, -102, 4, 48, -58, -11, 15, -78, -40, 15, 25, 17, 48, -76, 80, 52, -7, 22, 12, 112, -92, -12, 79, 97, 15, 2, 118, 53, 15, 61, 48, 98, 97, 2, -15, 15, 34, -40, 5, -73, -16, 80, -8, 24, 16, -95, 83, -126, -14, 26, -11, -59, 11, 69, 15, 49, 22, 5, 50, -16, -16, 26, 7, 96, 64, -49, -2, 12, -1, 48, -12, 118, 16, -15, 113, -102, 4, 48, -58, -11, 15, -78, -40, 15, 25, 17, 48, -76, 80, 52, -7, 22, 12, 112, -92, -12, 79, 97, 15, 2, 118, 53, 4, 106, 12, 112, 47, 16, -14, 45, -128, 91, 127, 5, 15, -127, -127, 10, 21, 56, 47, 33, -81, 92, -1, 92, -1, 96, -76, 80, -13, 17, 96, 70, 103, -73, -108, 49, -96, 118, 4, 12, -1, -32, -49, -13, 15, 71, 97, 15, 23, 25, -96, 67, 12, 111, 92, 80, -76, 80, -13, 17, 96, 83, 47, 15, 1, -96, 118, 15, 34, -40, 12, -1, 48, -12, 118, 16, -15, 113, -102, 4, 48, -58, -11, -59, 11, 69, 15, 49, 22, 5, 50, -16, -16, 26, 7, 96, -14, 45, -128, -49, -13, 15, 71, 97, 15, 23, 25, -96, 67, 12, 111, 80, -5, 45, -128, -12, 118, 21, 11, 79, 113, 7, 111, 25, 126, 49, -96, -57, 10, 79, 68, -10, 16, -16, 39, 99, 95, -96, -13, -45, 15, 34, -48, -89, -90, -2, 48, -12, 70, 79, 97, 3, 32, -95, 83, -126, -14, 4, 111, 32, 91, 127, 5, -11, -59, 11, 69, 15, 49, 22, 5, 50, -16, -16, 26, 7, 96, -14, 45, -128, -49, -13, 15, 71, 97, 15, 23, 25, -96, 67, 12, 111, 80, -5, 45, -128, -12, 118, 21, 11, 79, 113, 7, 111, 25, 126, 49, -96, -57, 10, 79, 68, -10, 16, -16, 39, 99, 80, 70, -96, -14, 45, 11, 79, 113, 10, 21, 56, 47, 33, -96, -57, 2, -15, 3, -79, 5, -73, -16, 95, 92, -1, 92, 80, -76, 80, -13, 17, 96, 70, 103, -73, -108, 49, -96, 118, 15, 34, -40, 12, -1, 48, -12, 118, 16, -15, 113, -102, 4, 48, -58, -11, -49, 0, -76, 80, -13, -41, -109, 4, 6, 31, -128, -49, -15, -11, -49, 0, -76, 80, -13, -41, -109, 4, 6, 31, -128, -49, -15, -11, 15, -12, -73, -16, 80, -33, 0, 50, 12, 127, -97, -64, 118, 3, 35, 73, 11, -39, -112, -8, 23, -10, -77, 14, 70, 6, 47, -128, -13, 16, -13, -41, -109, 4, 48, 59, 117, 15, 20, -25, -105, 63, 47, 92, -16, 11, 69, 15, 61, 121, 48, 64, 97, -8, 12, -1, 31, 80, -1, 75, 127, 5, 2, -15, 4, 111, 32, 87, -1, 17, 14, 70, 6, 47, -128, -13, 16, -13, -41, -109, 11, 24, 31, 95, -78, -40, 8, 30, 22, 48, -13, -127, 79, -109, -72, 45, -10, -80, 118, 12, -1, -96, -76, 80, 73, 82, 15, 103, -9, 22, 15, 34, -48, 59, 16, -49, -112, -67, -103, -11, 15, -62, 10, 21, 127, 102, 5, 52, -113, 52, 81, 80, -8, 115, -80, 59, 117, 11, -39, -97, -96, -10, 32, 50, 3, -79, 15, -12, -73, -16, 15, -1, 33, 87, -10, 96, -89, 73, 47, 111, -96, 81, -111, -29, 15, -12, 52, -113, 52, 81, 95, -96, -1, 15, 116, 121, 79, 57, 16, -1, -9, -39, -112, -4, -14, -16, 21, -6, 4, 106, 15, 8, 21, 80, -1, -15, 47, 15, 32, -1, 65, -111, -29, 26, 15, -1, 33, 87, -10, 111, 95, -53, 16, -12, 118, 24, 73, 15, 4, -17, -111, 48, -15, 40, -12, 26, 4, 48, -49, 0, -76, 80, -89, 87, 99, 31, 104, 67, 26, 15, 49, -28, -43, 16, 59, 16, -16, -108, 97, 48, -94, 21, 6, 35, 11, 79, 113, 4, 15, 68, 85, 4, -18, 25, 24, 67, 40, -11, -4, -79, 15, 71, 97, -124, -112, -16, 78, -7, 19, 15, 18, -113, 65, -96, 67, 12, -16, 11, 69, 10, 117, 118, 49, -10, -124, 49, -96, -13, 30, 77, 81, 15, 34, -48, -89, -90, -2, 48, 52, -113, 97, 48, 59, 16, -12, 69, 80, 78, -31, -111, -124, 50, -113, 80, -1, -15, -105, -17, -112, 38, 3, -79, 15, -12, 19, 15, -1, 33, 83, 15, 61, 51, 38, 7, 96, 59, 16, -1, 67, 72, -13, 69, 16, 55, -111, 3, 32, 52, -113, 97, 48, 59, 16, 78, -31, -111, -124, 50, -113, 92, -16, 11, 69, 15, 8, 42, -34, 26, 4, 15, 71, 97, -124, -112, -16, 78, -7, 19, 15, -117, 126, -80, -76, 80, 64, -95, 83, 118, 67, 114, 96, 47, 16, -49, 15, 92, -16, 11, 69, 15, 8, 42, -34, 26, 4, 15, 71, 97, -124, -112, -16, 78, -7, 19, 15, -117, 126, -80, -76, 80, -13, 17, 96, -30, -12, -13, 118, 26, 15, -121, 59, 4, 98, 59, 24, 15, 4, -17, -111, 48, -79, 74, 118, -10, 15, 18, -128, -49, 15, 95, -78, -40, 15, 68, 85, 4, -18, 25, 24, 67, 40, 4, 48, -49, 0, -76, 80, 93, -18, 21, 95, 29, -103, -14, 14, 79, 3, -40, 26, 4, 15, 4, -17, -111, 60, -1, 64, -30, 99, 71, 103, 111, 96, -49, 127, -97, -64, 47, 16, -12, 118, 24, 73, 95, 95, -78, -40, 15, 68, 85, 4, -18, 25, 24, 67, 40, 4, 48, -49, 0, -8, 69, 15, 4, -125, 116, -103, -14, 5, -34, -31, 85, -15, -39, -97, 32, 118, 14, 79, 3, -40, 118, -10, 4, 12, -9, -7, -4, 15, 71, 97, -124, -112, -16, 78, -7, 19, -49, -12, -11, 15, -4, 100, -13, -111, 3, 32, -30, -12, -16, -111, 49, -97, 32, 89, 47, -128, 59, 16, -16, 78, -7, 19, -6, 12, 127, -33, -48, 47, 16, -14, 45, -128, -30, -110, 103, 83, 80, -8, 24, 16, -7, 121, -111, -96, 118, 3, -79, 14, 41, -105, 87, 38, -11, -5, 45, -128, -12, 69, 80, 78, -31, -111, -124, 50, -128, 67, 12, -16, 15, -124, 80, -16, 72, 55, 73, -97, 32, 93, -18, 21, 95, 29, -103, -14, 7, 96, -28, -16, 61, -121, 111, 96, 64, -49, 127, -97, -64, -12, 118, 24, 73, 15, 4, -17, -111, 60, -1, 79, 80, -1, -58, -15, 40, 61, 100, 49, -97, 47, -96, -57, -3, -3, 2, -15, 15, 34, -40, 14, 41, 38, 117, 53, 4, 106, 12, 112, 47, 16, -14, 45, -128, -95, -15, 22, 81, 80, -8, 24, 16, -95, 83, -126, -14, 26, 7, 96, 59, 16, -30, -103, 117, 114, 111, 92, -16, 15, -124, 80, -13, 47, 79, 52, -118, 26, 15, -121, 59, 4, 12, -9, -7, -4, 15, 71, 97, -124, -112, -16, 78, -7, 19, -49, -12, -11, 12, 127, -33, -48, 47, 16, -14, 45, -128, -30, -110, 103, 83, 80, -8, 24, 16, -7, 121, -111, -96, -13, -14, 3, -79, 14, 41, -105, 87, 38, -11, -49, 0, -8, 69, 15, 50, -12, -13, 72, -95, -96, -8, 115, -80, 64, -49, 127, -97, -64, -12, 118, 24, 73, 15, 4, -17, -111, 60, -1, 79, 80, -57, -3, -3, 2, -15, 15, 34, -40, 14, 41, 38, 117, 53, 4, 106, 12, 112, 47, 16, -14, 45, -128, -95, -15, 22, 81, 80, -8, 24, 16, -95, 83, -126, -14, 26, 15, 63, 32, 59, 16, -30, -103, 117, 114, 111, 92, -16, 15, -124, 80, 70, 103, -73, -108, 49, -96, -13, -14, 4, 15, 71, 97, -124, -112, -16, 78, -7, 19, -49, -12, -11, 0, -1, 9, -112, 47, 16, -14, 45, -128, -30, -110, 103, 83, 80, -8, 24, 16, -7, 121, -111, -81, 92, 80, -89, -90, -2, 48, -10, 19, 4, -103, 3, -79, 12, -12, 7, 48, 67, 49, -12, -16, 49, -96, 50, 3, -124, 101, -15, 24, 15, 24, 47, 64, 59, 16, -12, 118, 24, 73, 15, 4, -17, -111, 48, 69, 4, 98, 59, 24, 15, 9, 79, 33, -128, 83, 41, 16, 115, 15, 23, -123, 63, 80, -1, -122, -97, 32, -57, -7, -4, 2, -15, 12, -12, 15, -124, 80, 78, 61, 73, -97, 32, 78, -1, -8, -41, -127, -81, 92, 80, -89, -90, -2, 48, -10, 19, 4, 111, 32, 47, 16, 59, 16, -49, 64, 115, 4, 51, 31, 79, 3, 26, 3, 32, 56, 70, 95, 17, -128, -15, -126, -12, 3, -79, 15, 71, 97, -124, -112, -16, 78, -7, 19, 4, 80, 70, 35, -79, -128, -16, -108, -14, 24, 5, 50, -111, 7, 48, -15, 120, 83, -11, -62, 15, -124, 80, -42, 79, 57, 16, 50, 3, -124, 101, -15, 24, 12, 127, -97, -64, 47, 16, -49, 64, 45, 48, 47, 16, 59, 16, -57, -7, -4, 8, 31, -1, -115, 21, 63, 92, 80, 67, 49, -12, -16, 49, -96, 50, 13, 81, 4, 5, 52, -113, 100, 49, 4, 48, -58, -6, 15, 61, 48, 98, 5, 52, -113, 100, 49, 1, -1, 119, 83, 80, 59, 24, 31, 95, -8, 97, 2, -15, 15, 34, -40, 5, -73, -16, 80, 118, 12, 80, -8, 69, 10, 21, 56, 47, 33, -96, -8, -79, 96, 115, 80, 22, -10, 118, 21, 2, -9, 24, -1, -16, -127, 78, 49, -96, 56, -14, 118, -10, 3, 32, 78, -73, 31, 113, 15, -1, -92, -113, 0, -1, -1, 63, -33, 92, 112, 47, 16, -14, 45, -128, 91, 127, 5, 7, 96, -59, 15, -127, -127, 10, 21, 56, 47, 33, -96, -83, 16, 50, 1, 111, 103, 97, 5, 56, 71, 111, 92, 80, -8, 69, 10, 21, 56, 47, 33, -96, 118, 4, 15, 68, 85, 127, 113, 8, 20, -29, 40, 4, -18, 122, 22, 48, -83, 16, 50, 13, 101, 79, 17, 2, -16, 24, 67, 118, -10, 15, 8, 46, 26, -40, 21, -11, -59, 4, 51, 31, 79, 3, 26, 3, 32, -43, 16, 59, 16, 83, 72, -10, 67, 16, 67, 12, -16, 3, 32, -127, 78, -80, -58, 15, 61, 48, -30, -39, -96, 98, 48, -13, 30, 77, 81, 6, 32, 83, 72, -10, 67, 16, -30, -39, -96, -13, 16, -95, 49, -29, 26, 4, 48, 59, 16, -95, 83, 118, 67, 114, 111, 92, 80, 67, 49, -12, -16, 49, -96, 50, 13, 81, 3, -79, 5, 52, -113, 100, 49, 4, 48, -49, 0, 50, 8, 20, -21, 12, -16, 15, 61, 48, -30, -39, -96, 98, 48, -13, 30, 77, 81, 3, -79, 10, 21, 55, 100, 55, 38, 7, 80, 45, 48, 47, 16, -124, 111, 97, -11, -59, 4, 51, 31, 79, 3, 26, 3, 32, -43, 16, 59, 16, 83, 72, -10, 67, 16, 67, 12, -16, 3, 32, -127, 78, -80, -49, 0, -13, -45, 14, 45, -102, 6, 35, 15, 49, -28, -43, 16, 91, 127, 5, 2, -15, 3, -14, -16, 16, -49, -15, 4, -127, 3, 34, 15, 68, 85, 127, 113, -11, -59, 4, 51, 31, 79, 3, 26, 3, 32, -43, 16, 59, 16, 83, 72, -10, 67, 16, 67, 12, -16, 3, 32, -127, 78, -80, -49, 0, -13, -45, 14, 45, -102, 6, 35, 15, 49, -28, -43, 16, 59, 16, 83, 72, -13, 69, 16, 67, 12, -16, 15, 57, 46, -7, 26, 7, 63, 80, -4, -79, 15, 9, 70, 19, 4, 48, 20, -21, 1, 106, 15, 77, 83, 15, 49, 2, -8, 97, -96, -13, -14, 15, 34, -48, 40, 4, 15, 24, 113, 106, 2, -15, 15, 34, -40, 95, 92, 80, 67, 49, -12, -16, 49, -96, 50, 13, 81, 3, -79, 5, 52, -113, 100, 49, 4, 48, -49, 0, -13, -45, 14, 45, -102, 6, 35, 15, 49, -28, -43, 16, 59, 16, 83, 72, -13, 69, 16, 67, 12, -16, 7, 80, 98, 48, 47, -122, 26, 15, 63, 32, -14, 45, 2, -128, 64, -15, -121, 22, -96, 47, 16, -14, 45, -123, -11, -1, -9, 17, -87, 21, 80, 50, 3, -79, 10, 70, -10, 24, -6, 12, 80, 67, 49, -12, -16, 49, -96, 50, 13, 81, 3, -79, 5, 52, -113, 100, 49, 4, 48, -49, 0, 50, 8, 20, -21, 12, -16, -11, 0, -4, -79, 15, 25, 17, 48, 97, -9, 24, 4, -120, 127, 113, -81, 80, -4, -79, 10, 117, 52, 110, 16, 40, 15, 68, 85, 15, 77, 83, 11, 79, 113, 15, 49, 22, 3, 34, 15, 104, 20, 63, 92, 80, -43, 26, 3, -79, 5, 52, -113, 100, 49, 4, 48, -49, 0, 50, 8, 20, -21, 12, -16, 9, 37, 118, -10, 2, 105, -14, 12, 112, 91, 127, 5, 3, 32, 59, 16, 56, 20, -21, 24, 45, 80, -9, 39, -81, 80, 15, -53, 31, 32, -8, 24, 16, -15, 40, 61, 100, 49, -11, 0, -4, -79, -14, 1, -1, 126, 17, -95, -96, 59, 16, -28, -16, 79, 55, -105, 63, 32, 47, 16, 59, 16, -10, 67, 21, -11, -59, 13, 81, -96, 59, 16, 83, 72, -10, 67, 16, 67, 12, -16, 3, 32, -127, 78, -80, -49, 0, -110, 87, 111, 96, -57, 5, -73, -16, 80, 50, 3, -79, 13, 111, 18, -113, 103, -9, 118, -10, 15, 114, 122, -11, 15, -1, 63, -9, -31, 26, 118, -10, 3, -79, 14, 79, 4, -13, 121, 115, -14, 2, -15, 15, 34, -40, 5, 52, -113, 100, 49, 80, 117, 6, 35, 8, 30, 47, 79, 65, 106, 26, -11, -59, 13, 81, -96, 59, 16, 83, 72, -10, 67, 16, 67, 12, -16, 3, 32, -127, 78, -80, -49, 0, -42, -15, 40, 61, 100, 49, -97, 32, -110, 87, 111, 96, -57, 5, -73, -16, 80, 50, 3, -79, 15, 104, 20, 48, -42, -7, 98, -8, 111, 80, -1, -13, -1, 126, 17, -89, 111, 96, 59, 16, -28, -16, 79, 55, -105, 63, 32, 47, 16, -14, 45, -128, 83, 72, -10, 67, 21, 7, 80, -92, 111, 97, -126, -43, -11, -59, 13, 81, -96, 59, 16, 83, 72, -10, 67, 16, 67, 12, -16, 3, 32, -127, 78, -80, -49, 0, -110, 87, 111, 96, 70, 13, 111, 49, -105, 31, 116, -13, -111, 12, -9, 5, -73, -16, 95, 80, -4, -79, 15, -6, -33, 79, 0, -8, 69, 15, 20, -128, 118, 1, -1, 126, 21, 80, 47, 16, 59, 16, -28, -16, 79, 55, -105, 55, 21, 2, -15, 5, 52, -113, 52, 81, 80, 118, -9, 41, -9, 26, -11, -59, 11, 69, 13, 105, 36, -95, -96, -49, 127, -97, -64, 47, 16, -12, 118, 24, 73, 80, 50, 12, -16, 7, 96, -16, -127, -16, 72, 67, 114, 96, -15, 40, 15, -6, -33, 79, 7, 111, 96, 59, -126, -33, 107, 3, -79, 5, 52, -113, 100, 49, -11, -59, 11, 69, 13, 105, 36, -95, -96, -49, 127, -33, -48, -30, -110, 103, 83, 80, 50, 12, -16, 7, 96, -16, -127, -16, 72, 67, 114, 96, -15, 40, 15, -6, -33, 79, 7, 111, 96, 59, -126, -33, 107, 3, -79, 5, 52, -113, 100, 49, -11, -59, 11, 69, 13, 105, 36, -95, -96, -49, 127, -33, -48, -30, -110, 103, 83, 80, 70, -96, -49, 127, -97, -64, 47, 16, -12, 118, 24, 73, 80, 50, 12, -16, 7, 96, -16, -127, -16, 72, 67, 114, 96, -15, 40, 15, -6, -33, 79, 7, 111, 96, 59, -126, -33, 107, 3, -79, 5, 52, -113, 100, 49, -11, -1, -6, -127, -17, -108, -10, 16, -89, 94, 47, 113, -127, -96, 67, 15, 34, -40, 15, 52, 51, -111, 4, 48, -58, 11, 69, 15, 50, 37, 49, -96, -14, 45, -128, -127, 81, 72, -21, 7, 96, -49, -6, 15, 63, 32, -49, 112, -127, 82, -40, -31, 95, 95, -1, -88, 30, -7, 79, 97, 15, 24, 47, 64, 59, 16, -13, 67, 57, 16, 59, 67, 2, -18, -40, -127, -96, 118, 2, -113, 55, 48, 47, 16, -58, 11, 69, 15, 50, 37, 49, -96, -14, 45, -128, -127, 81, 72, -21, 7, 96, -49, -6, 15, 63, 32, -49, 112, -127, 82, -40, -31, 95, 95, -78, -40, 15, 25, 17, 48, -15, 45, 106, 15, -120, 30, -7, 79, 97, 15, 24, 47, 64, 59, 16, -13, 67, 57, 16, 67, 12, 96, -8, -73, -21, 11, 69, 15, 50, 37, 49, -96, -14, 45, -128, -127, 81, 72, -21, 7, 96, -49, -6, 15, 63, 32, -49, 112, -127, 82, -40, -31, 95, 92, 80, -8, 69, 13, 100, -13, -111, 3, 32, 22, -10, 79, 97, 7, 63, -27, 1, 111, 103, 97, 80, -83, 16, 50, 15, 52, -97, -97, 32, 31, -1, -115, 127, 15, 65, 99, -11, 15, -1, 54, -10, 118, 17, -123, 3, -73, 111, -112, 59, 31, 32, -76, -9, 16, 59, 16, -16, -126, -13, -111, -12, 15, 23, -1, 113, -96, -15, 40, 3, -79, 3, 127, 65, 15, 49, 118, -10, -11, -59, -2, 80, -124, -12, 5, -30, 47, 5, 11, 79, 113, 15, 8, 42, -34, 26, 12, 127, 79, 96, 47, 16, -15, -47, -112, -15, -126, -12, 7, 99, 24, 83, 25, -108, -128, -65, 42, -126, -10, 22, -11, -5, 45, -128, 83, 72, -13, 69, 16, 67, 12, -16, 11, 69, 5, -8, 31, 3, 12, -9, 15, 71, 97, 80, -15, -126, -12, 4, 12, -1, -32, -49, -13, 15, 71, 97, 15, 23, 25, -96, 67, 12, 111, 92, 80, -8, 69, 13, 100, -13, -111, 3, 32, -30, -12, -16, -111, 49, 7, 63, -27, 15, 65, -113, 97, 2, -118, 24, 80, 69, 3, -79, 15, -124, -14, -16, 39, 99, 10, 21, 55, 100, 55, 38, 15, -124, 86, -2, 48, 64, -15, -111, 19, -11, -59, 15, -124, 80, -42, 79, 57, 16, 50, 14, 47, 79, 9, 19, 16, 115, -2, 80, -12, 24, -10, 16, 40, -95, -123, 4, 80, 59, 16, -95, 83, 118, 67, 114, 96, -15, -111, 19, 15, -124, 86, -2, 48, 38, 16, 47, 16, -14, 45, -123, -11, -49, -10, 11, 69, 15, 49, 22, 15, 65, -113, 97, -96, 118, 50, 12, 95, 95, -53, 16, -1, -6, 40, -12, -78, -111, 12, 80, -8, 69, 11, 20, -89, 111, 96, -15, 40, 11, 69, 15, 116, 103, 91, 26, -11, 15, -8, -118, 24, 80, -76, -9, 16, -13, 17, 96, -21, 70, -10, 26, 3, 32, -10, 32, 50, 3, -79, 9, 69, 48, -7, 98, -8, 96, -110, -28, 55, 38, 2, -15, 3, -79, 15, -1, -94, -113, 75, 41, 31, 95, -78, -40, 14, 41, 38, -14, 2, 96, -49, 0, -127, -16, 40, 53, 4, 15, 52, 51, -111, 3, 34, -7, 15, 9, 78, 16, 118, 2, -113, 55, 63, 80, -5, 45, -128, -15, 40, -31, 80, -8, 24, 16, 98, 48, 118, -9, 41, -9, 26, -11, -59, 8, 31, 2, -125, 80, 64, -13, 67, 57, 16, 50, 47, -112, -16, -108, -31, 4, 48, -58, -11, 15, -78, -40, 15, 18, -114, 21, 15, -127, -127, 6, 35, 7, 111, 114, -97, 113, -81, 95, -78, -40, 14, 41, 38, 117, 53, 7, 96, -59, 11, 79, 113, 15, 68, -95, 15, 98, 42, 13, 81, 2, -15, 3, -79, 120, 3, 127, 65, 7, 110, -127, 69, 118, -10, 3, -79, 120, 2, 111, -1, 15, 50, 72, -96, 109, -12, -13, 24, 15, 63, 32, -57, -3, -3, 14, 41, 38, 117, 53, -11, -49, 0, -94, 21, 6, 35, 11, 79, 113, 1, 98, -33, 107, 15, 71, 97, -124, -107, 4, -9, 71, -108, -13, -111, 3, 32, -15, -105, 111, 96, 70, -14, 15, 4, -17, -111, 53, 3, -73, 80, -14, 20, -113, 95, -10, -42, -92, -12, 22, 52, -112, -21, 70, -10, 21, 7, 96, 59, 16, 22, -9, 120, 38, -12, 22, 48, 47, 16, -49, 0, -76, -9, 16, -16, 24, -12, 70, 22, 57, -14, 4, -109, 24, 26, 3, -79, 15, 9, 70, 19, -2, 80, -63, -11, 15, -53, 117, 14, -76, 111, 97, 11, 69, 14, 70, -31, -111, -96, 73, -112, -16, -108, 97, 52, -113, 32, -16, -126, -83, -29, 114, 111, 95, -78, -40, 5, -40, -9, 31, 34, -123, 2, 96, -49, 0, -76, -9, 16, -89, 94, 47, 113, -127, -96, 64, -16, -127, -9, 114, -43, -97, 32, -42, -7, 98, -8, 96, -95, -16, 37, 115, 2, -15, 12, -12, -6, 5, 127, 102, 127, 23, -28, 99, -97, 32, 118, -24, 20, 87, 111, 96, 59, 16, -16, -108, 97, 63, -27, 14, 38, -31, 99, -124, 55, 38, -11, -5, 45, -128, -16, 67, -126, -103, 118, -10, 12, 80, -76, 80, 52, -113, 97, 49, -96, -59, 15, 18, -128, 118, 49, -114, 31, 3, -11, -5, 45, -128, -16, 47, 13, -108, 55, 38, 5, -43, -16, 30, 53, 15, 34, -48, 72, 16, 64, -43, -40, -16, 24, -11, 15, -53, 23, -128, -16, -126, -83, -29, 127, 119, 63, 32, 117, 2, -15, -15, 15, -1, -33, -33, -5, 4, 106, 3, -79, 120, 15, 104, 47, -125, -80, -124, 49, 15, -124, 80, -76, -97, 113, -96, -108, 83, 15, 33, 72, -11, 15, -14, -127, 85, 15, -17, -1, 98, 50, -2, 3, 32, -9, 73, 122, 67, 16, -14, 45, -128, -30, -16, -14, 2, -15, 15, -12, 52, -123, -1, -11, -5, 45, -128, -30, -110, 103, 83, 80, 93, 95, 1, -29, 3, -76, 48, -14, 45, 4, -127, 7, 96, -15, 78, 48, 59, 16, -55, 1, -12, -16, 24, 40, -11, 15, -53, 23, -128, -16, -126, -83, -29, 127, 119, 63, 32, 117, 2, -15, -15, 15, -1, -33, -33, -5, 4, 106, 3, -79, 120, 15, 104, 47, -125, -80, -124, 49, 15, -124, 80, -76, -97, 113, -96, -108, 83, 15, 33, 72, -11, 15, -14, -127, 85, 15, -17, -1, 98, 50, -2, 3, 32, 22, 49, -128, -14, 45, -128, -1, -49, -1, 79, -7, -1, -1, 31, -4, -1, -13, 15, -12, 52, -123, -1, -11, 5, 24, 116, -112, 109, -12, -13, 24, -11, -59, 11, 69, 8, 31, 29, 81, -96, 50, 15, 66, -9, 31, -96, -94, -33, 51, 118, -10, 15, 34, -40, 4, -45, -78, -121, 63, 32, 50, 8, -39, 31, 80, -1, 40, 21, 80, 59, 16, -2, -1, -10, 35, 47, -32, -13, -45, 50, 96, 50, 1, 99, 24, 15, 34, -40, 15, -4, -1, -12, -1, -97, -1, -15, -1, -49, -1, 48, -1, 67, 72, 95, -1, 80, 81, -121, 73, 6, -33, 79, 49, -128, 70, -96, 69, 81, -125, 15, 34, -40, 4, -45, -78, -121, 63, 47, 95, -78, -40, 15, 25, 17, 48, -28, -16, 52, 118, 80, -76, -9, 16, 83, 79, 97, -96, 64, 83, -121, -7, 16, 70, -96, -95, -12, 70, -96, -15, -127, 16, 25, 30, 55, 38, 95, 80, -1, -12, 38, 16, 47, 16, -14, 45, -128, -15, -111, 19, 80, -12, 47, 113, -96, 59, 117, 15, 33, 72, -11, 15, -14, -127, 85, 15, -17, -1, 98, 50, -2, 3, 32, 22, 49, -128, -14, 45, -128, -1, -49, -1, 79, -7, -1, -1, 31, -4, -1, -13, 15, -12, 52, -123, -1, -11, 5, 24, 116, -112, 109, -12, -13, 24, -11, -59, 11, 69, 10, 31, 17, -29, 26, 15, 24, 47, 64, -14, 45, -128, -124, 111, -107, 10, -47, 3, 32, -14, 45, -128, 118, 79, 55, -105, 63, 32, 50, 15, 8, 47, -6, 30, 48, -111, -10, 115, 127, 68, 49, 15, 2, -8, 24, -11, 15, -14, -127, 85, 3, -79, 15, -17, -1, 98, 50, -2, 15, 61, 51, 38, 3, 32, 22, 49, -128, -14, 45, -128, -1, -49, -1, 79, -7, -1, -1, 31, -4, -1, -13, 15, -12, 52, -123, -1, -11, 5, 24, 116, -112, 109, -12, -13, 24, -11, -4, -79, 14, -127, -8, 2, -15, 12, 80, -76, 80, 82, -102, 2, -15, -15, 12, 127, -5, 2, -15, 3, -79, 120, 14, 72, -10, 32, 38, 3, -79, 15, 57, 78, -7, 15, 68, -113, -111, 48, 50, 15, 4, -96, 59, 23, -128, 84, -108, -121, 21, -11, 15, -14, -127, 85, 3, -79, 15, -17, -1, 98, 50, -2, 15, 61, 51, 38, 3, 32, -24, 78, -7, 10, 47, -122, 2, 96, 59, 117, 7, -103, 31, 100, -112, 78, 55, -9, 115, -14, -11, -1, 104, 17, -94, -12, 15, 23, -10, -77, 24, 80, 38, 12, -16, 11, 79, 113, 4, 51, 78, -7, 26, 4, 106, 10, 21, 56, 47, 33, -96, -57, 2, -15, 15, 34, -40, 15, 71, 97, 95, 80, -1, 40, 21, 80, 59, 16, -2, -1, -10, 35, 47, -32, -13, -45, 50, 96, 50, 8, 21, 50, -127, 9, 79, -128, 70, -96, 40, -95, -113, 95, -10, -127, 26, 47, 64, -15, 127, 107, 49, -123, 2, 96, -49, 0, -76, -9, 16, 83, 41, 22, 12, 127, -97, -64, 47, 16, -49, 64, -15, -126, -12, 15, 34, -40, 5, 50, -17, -97, 7, -111, 95, 80, -1, 40, 21, 80, 59, 16, -2, -1, -10, 35, 47, -32, -13, -45, 50, 96, 50, 8, 21, 50, -127, 9, 79, -128, 70, -96, 40, -95, -113, 95, -53, 16, -1, 63, 37, 49, -113, 32, -4, -124, -95, -128, -76, 80, -127, -15, -43, 26, 3, 32, -10, 127, 113, 3, -79, 14, 79, 3, 71, 96, 47, 16, -59, 4, 96, 77, -89, 22, -31, -11, 15, -7, 48, -12, 79, 32, -13, 16, -83, 16, 50, 4, 96, 118, 93, -15, -15, 126, 113, 99, 15, -1, -115, 70, 55, 63, 32, 47, 16, -12, 118, 24, 73, 80, -28, -120, 113, -96, -13, -14, 15, 34, -40, 15, 25, 17, 63, 92, -1, 96, -76, 80, -13, 17, 96, 79, 53, 40, -13, 26, 15, 63, 32, 59, 16, -1, 63, 37, 49, -113, 32, -4, -124, -95, -113, 80, -4, -79, 3, -124, -95, -128, -76, 80, -10, 127, 113, 96, -14, 45, 12, 112, 49, -21, 98, -110, -10, -14, 4, -81, 116, 110, 21, -11, 15, -53, 16, 56, 74, 24, 5, -33, 111, 97, 83, 80, 59, 67, 15, 34, -48, -9, 117, 115, 2, 59, 24, 3, -124, -95, -123, 4, 80, 59, 31, 32, -12, 79, 32, -28, -120, -14, 10, 127, 31, 17, -127, 99, 7, 49, -12, 80, 47, 16, 118, 49, -127, 83, -11, -49, -10, 11, 69, 15, 49, 22, 4, -13, 82, -113, 49, -96, -13, -14, 3, -79, 15, -13, -14, 83, 24, -14, 15, -56, 74, 24, -11, 15, -7, 96, -127, 61, -122, -6, 3, -79, 3, -124, -95, -128, -76, 80, -10, 127, 113, 96, -14, 45, 12, 112, 49, -21, 98, -110, -10, -14, 4, -81, 116, 110, 21, -11, -49, -10, 11, 69, 15, 49, 22, 4, -13, 82, -113, 49, -96, -13, -14, 3, -79, 15, -13, -14, 83, 24, -14, 15, -56, 74, 24, -11, 15, -78, -48, -76, -9, 16, -13, 17, 96, -10, 127, 113, 96, 59, 16, -16, -108, 101, 15, 18, -128, 64, -42, 127, -1, -115, 16, -16, 72, 48, 50, 15, 9, 78, 16, 38, 15, 34, -40, 5, -73, -16, 95, 80, -4, -79, 3, -124, -95, -128, 93, -10, -10, 21, 53, 15, 34, -48, -9, 117, 115, 2, 59, 24, 3, -124, -95, -123, -11, -49, -10, 11, 69, 15, 49, 22, 4, -13, 82, -113, 49, -96, -13, -14, 3, -79, 15, -13, -14, 83, 24, -14, 15, -56, 74, 24, -11, 15, -7, 96, -127, 61, -122, -6, 15, 34, -48, -76, -9, 16, -13, 17, 96, -10, 127, 113, 96, 59, 16, -16, -108, 101, 15, 18, -128, 64, 97, -8, 5, -73, -16, 11, -39, -97, 80, -4, -79, 3, -124, -95, -128, 93, -10, -10, 21, 53, 15, 34, -48, -9, 117, 115, 2, 59, 24, 3, -124, -95, -123, -11, -49, -10, 11, 69, 15, 49, 22, 4, -13, 82, -113, 49, -96, -13, -14, 3, -79, 15, -13, -14, 83, 24, -14, 15, -56, 74, 24, -11, 15, -1, 114, -8, 31, 113, -113, -96, 59, 16, 56, 74, 24, 15, -124, 80, -42, 79, 57, 16, 50, 3, 20, -21, 15, 34, -48, 70, -14, 59, 118, -10, 6, 31, -113, 92, -1, 96, -76, 80, -13, 17, 96, 79, 53, 40, -13, 26, 15, 63, 32, 59, 16, -1, 63, 37, 49, -113, 32, -4, -124, -95, -113, 80, -1, -9, 47, -127, -9, 24, -6, 3, -79, 3, -124, -95, -128, -8, 69, 13, 100, -13, -111, 3, 32, 49, 78, -80, -14, 45, 4, 111, 35, -73, 111, 96, 97, -8, -11, 15, -53, 16, 56, 74, 24, 5, 79, 37, 3, -76, 48, -14, 45, 15, 71, -10, -77, 11, 79, 113, 15, 49, 51, 24, 9, -34, -7, 15, -121, 59, 4, 10, 127, 31, 17, -127, 99, 3, -124, -95, -113, 92, -1, 96, -76, 80, -13, 17, 96, 79, 53, 40, -13, 26, 15, 63, 32, 59, 16, -1, 63, 37, 49, -113, 32, -4, -124, -95, -113, 80, -1, -106, 8, 19, -40, 111, -96, -14, 45, 11, 79, 113, 15, 49, 22, 15, 103, -9, 22, 3, -79, 15, 9, 70, 80, -15, 40, 4, 15, 2, -8, 24, -15, -39, 15, 9, 70, 19, 72, -14, 10, 31, 119, -31, -11, 15, -53, 16, 56, 74, 24, 5, -33, 111, 97, 83, 80, -14, 45, 15, 119, 87, 48, 35, -79, -128, 56, 74, 24, 95, 95, -53, 16, -1, 63, 37, 49, -113, 32, -4, -124, -95, -128, -59, 15, -124, 80, -79, 74, 118, -10, 15, 18, -128, -76, 80, -9, 70, 117, -79, -81, 80, -1, -120, -95, -123, 11, 79, 113, 15, 49, 22, 14, -76, 111, 97, -96, 50, 15, 98, 3, 32, 59, 16, -108, 83, 15, -106, 47, -122, 9, 46, 67, 114, 96, 47, 16, 59, 16, -4, -124, -95, -113, 95, -53, 16, -1, 55, 97, 15, -10, 113, -102, 12, 80, -8, 69, 11, 20, -89, 111, 96, -15, 40, 11, 69, 15, 116, 103, 91, 26, -11, 15, -8, -118, 24, 80, -76, -9, 16, -13, 17, 96, -21, 70, -10, 26, 3, 32, -10, 32, 50, 3, -79, 9, 69, 48, -7, 98, -8, 96, -110, -28, 55, 38, 2, -15, 3, -79, 15, 23, 25, -81, 92, -16, 10, 33, 80, 98, 48, -76, -9, 16, 22, 45, -10, -80, -12, 118, 24, 73, 80, 79, 116, 121, 79, 57, 16, 50, 14, 38, 55, 109, 16, 115, 80, 77, 50, 15, 61, 121, -96, 40, -95, -123, -11, -1, 0, -13, 67, 57, 16, 50, 47, -112, -16, -108, -31, 4, 48, -58, 4, -10, 71, 101, 48, -55, -11, 15, -78, -40, 12, -1, 16, -95, 83, -126, -14, 26, 4, -103, 12, 112, 47, 16, 59, 16, 22, 31, 79, 32, -15, 40, -31, 95, 95, -16, 15, 52, 51, -111, 3, 34, -7, 15, 9, 78, 16, 67, 12, 96, 79, 100, 118, 83, 12, -97, 80, -1, 9, -112, -57, 2, -15, 15, 34, -40, 15, 18, -114, 21, 15, -127, -127, 10, 21, 56, 47, 33, -96, -13, -14, 12, -1, 31, 95, -16, 15, 52, 51, -111, 3, 34, -7, 15, 9, 78, 16, 67, 12, 96, 79, 100, 118, 83, 12, -97, 80, -1, -12, 23, 59, 24, 15, 34, -40, 12, -1, 16, 98, -128, 59, 16, 22, 31, 79, 47, -27, 12, 112, -15, 40, -31, 80, -8, 24, 16, -30, -12, -16, -111, 49, -97, 32, -8, 127, 1, -96, 45, 63, 80, -4, -79, 1, 97, -12, -14, 9, 37, 48, -57, -11, -1, 0, -13, 67, 57, 16, 50, 47, -112, -16, -108, -31, 4, 48, -58, 4, -10, 71, 101, 48, -55, -11, 15, -1, 65, 115, -79, -128, -14, 45, -128, -57, 15, 18, -114, 21, 6, 40, 12, -1, 16, -8, 24, 16, -30, -12, -16, -111, 49, -97, 32, -8, 127, 1, -96, 45, 63, 80, -5, 45, 9, 37, 48, -57, -11, -5, 45, -128, -124, -31, 10, 31, 23, 103, 55, 38, 11, 69, 15, 49, 22, 3, 79, 79, 1, -127, -96, -8, 115, -65, 80, -1, 67, 67, 117, 55, -27, 11, 79, 113, 15, 49, 22, 4, -109, 24, 26, 3, 32, -13, -121, 111, 96, -14, 45, 7, 99, 32, -30, -12, -16, -105, 70, -31, 15, -121, 59, 3, -79, 14, 37, -12, 126, 14, 42, 31, 95, -53, 16, -1, 63, 37, 49, -113, 32, -4, -124, -95, -128, 31, 33, 80, 59, 16, -28, -16, 52, 118, 2, -15, 12, 80, 93, 95, 7, -25, 45, 89, -14, 4, 106, 5, -33, 111, 97, 83, 80, 59, 67, 11, 16, 117, 5, 55, -103, 8, 30, 47, 113, -121, 111, 96, -15, -126, -12, 3, -79, 9, 69, 48, 56, 70, 84, -29, 114, 96, -8, 115, -80, -14, 45, -11, -59, 11, 69, 5, 50, -111, 96, -49, -3, 2, -15, 12, -12, 15, 24, 47, 64, -59, -11, -1, -113, 53, 41, 19, 16, -49, 15, 95, -12, 56, 38, -10, 15, 29, 106, 79, 65, 99, 73, 15, 18, -114, 21, 11, 79, 113, 8, 31, 55, -125, -79, -96, -49, 15, 92, 80, 67, 49, -12, -16, 49, -96, 50, 1, -1, 113, -19, 49, 3, -124, 101, -15, 24, 2, -118, 24, 80, -8, 115, -80, -49, 96, 118, -9, 41, -9, 118, -10, 1, 115, -79, -128, -15, -47, -112, 40, 14, 41, 38, 117, 53, -11, 15, -53, 16, 67, 49, -12, -16, 48, -15, 71, -111, -81, 92, 80, 67, 49, -12, -16, 49, -96, 50, 1, -1, 113, -19, 49, 3, -124, 101, -15, 24, 2, -118, 24, 80, 67, 12, -16, 7, 111, 114, -97, 119, 111, 96, -15, -47, -97, 80, -1, 41, 70, 19, 80, -76, -9, 16, 98, 15, -124, -14, 3, 32, 83, 40, 16, -15, -47, -97, 92, 80, -76, -96, 40, -95, -123, 3, 32, 56, 70, 95, 17, -128, -28, -113, 98, 3, 32, 40, 15, 24, 47, 64, 64, -49, -1, 111, 80, -1, 0, -15, -45, 121, 16, -16, -40, 93, 115, -11, -59, 4, 51, 31, 79, 3, 26, 3, 32, -110, 74, 12, -12, 15, 24, 47, 64, 64, -16, -108, 97, 48, -14, 45, 10, 38, -2, 48, -30, 99, -126, -97, 80, -1, -120, -95, -128, -76, 80, -13, 17, 96, -28, 110, 25, 26, -11, -59, 4, 51, 31, 79, 3, 26, 3, 32, -110, 74, 12, -12, 15, 24, 47, 64, 64, -15, -111, 19, 15, 34, -48, -94, 111, -29, 14, 38, 56, 41, -11, 15, -8, -118, 24, 11, 69, 15, 49, 22, 14, 70, -31, -111, -81, 92, 80, 67, 49, -12, -16, 49, -96, 50, 5, 19, 7, 63, -27, 4, -12, 45, 99, 2, -15, 12, -12, 2, 96, -13, 36, -118, 3, 32, -49, -4, -11, 15, -4, 111, 18, -125, -42, 67, 25, -14, 12, 96, -30, -39, -90, -2, 48, -16, -126, -9, 122, 16, 22, 45, -10, -65, 80, -1, 105, 17, 48, -8, 121, -112, -8, 71, 48, -42, 55, -112, 79, 57, 16, 50, 15, 29, -97, 23, -103, 3, -79, 2, -118, 24, -11, -59, 4, 51, 31, 79, 3, 26, 3, 32, 81, 48, 115, -2, 80, 109, -12, -13, 24, 2, -15, 12, -12, 2, 96, -13, 36, -118, 3, 32, -49, -4, -11, 15, -4, 111, 18, -125, -42, 67, 25, -14, 12, 96, -30, -39, -90, -2, 48, -16, -126, -9, 122, 16, 22, 45, -10, -80, -16, 18, -16, -111, -11, 15, -10, -111, 19, 15, -121, -103, 15, -124, 115, 13, 99, 121, 4, -13, -111, 3, 32, -15, -39, -15, 121, -112, 59, 16, 40, -95, -113, 92, 80, 67, 49, -12, -16, 49, -96, 50, 9, 36, -96, -49, 64, 40, 15, 24, 47, 64, -95, 31, 0, 95, 4, -31, -11, 15, -53, 16, 67, 49, -12, -16, 48, -8, 69, 13, 101, -34, -31, 85, -15, -39, -11, -59, 4, 51, 31, 79, 3, 26, 3, 32, 91, 70, -10, -76, 112, -49, 127, -33, -48, -30, -110, 103, 83, 80, -15, -126, -12, 12, 111, 80, -4, -79, 4, 51, 31, 79, 3, 15, -124, 80, -42, 93, -18, 21, 95, 29, -97, 92, 80, 67, 49, -12, -16, 49, -96, 50, 5, 49, 73, 12, -9, -12, -10, 2, -15, 15, 29, 25, 15, 24, 47, 64, -58, -11, 15, -53, 16, 67, 49, -12, -16, 48, -8, 69, 13, 101, -34, -31, 85, -15, -39, -11, -59, 15, 20, 121, 26, 3, 32, -110, 74, 15, 29, 25, 15, 24, 47, 64, -58, -11, -59, 7, 80, 67, 12, -16, 4, 106, 11, 69, 15, 49, 22, 8, 24, 45, 49, -96, 50, 12, -16, -11, -59, 7, 80, 67, 12, -16, 4, 106, 11, 69, 15, 49, 22, 8, 24, 45, 49, -96, 50, 12, -16, -11, 15, -4, 111, 18, -125, -47, 99, -97, 32, 115, 10, 33, 80, 98, 48, -76, -9, 16, 22, 45, -10, -80, -15, -47, -112, 38, 15, 50, 72, -96, 50, 15, 68, -7, 16, 59, 16, -1, -94, -40, 97, -14, 5, 32, 59, 16, -15, -111, 19, 15, -121, -103, 15, -124, 115, 15, 18, -128, -15, -40, 59, 24, 7, 101, 56, -34, 55, 38, 95, 92, -16, 11, 69, 2, -118, 24, 80, 50, 15, 61, 121, -96, 64, -12, 118, 24, 73, 15, 4, -17, -111, 63, -96, -13, -45, 1, 115, -79, -128, -94, 21, 111, -29, 11, 79, 113, 4, 15, 68, 85, 4, -18, 25, 24, 67, 40, -6, 2, -128, -76, 86, -2, 48, 52, -113, 97, 49, -96, 59, 16, 78, -31, -111, -124, 50, -113, 80, -4, -79, 2, -118, 24, 3, 32, -13, -41, -102, 11, 69, 15, 49, 22, 14, 70, -31, -111, -81, 92, -16, 11, 69, 2, -118, 24, 80, 50, 15, 61, 121, -96, -16, -108, 97, 52, -113, 32, 118, 83, 73, -108, 55, 38, 80, -13, 31, 34, 106, 3, -79, 15, 68, -1, 119, -12, -33, 64, 73, -110, -8, 26, -11, 15, -53, 16, 40, -95, -123, 11, 79, 113, 15, 49, 22, 8, 26, -34, 26, 3, 32, 59, 16, -12, 79, -9, 127, 77, -12, 4, -103, 47, -124, -13, -111, -11, -49, -11, -1, 0, -12, -14, 83, 24, 114, -43, 3, -124, -89, 111, 96, -9, 21, 81, -112, -13, -126, 74, -28, 83, 118, -10, 4, 15, 8, 47, 2, 84, -112, -76, 80, -13, 17, 96, -95, 49, -29, 26, 1, 99, 24, 118, -10, 15, -106, 47, -122, 5, -16, 78, 31, 92, 80, -76, 80, 127, 79, 8, 47, 113, -96, -49, 0, -15, -126, -12, 4, 15, 116, -99, 16, 47, 16, -57, -1, -80, 50, 12, 127, -5, -11, -59, 7, 80, -19, -120, 22, 57, -14, 13, 100, -13, -111, 3, 32, 127, 79, 8, 47, 113, 3, -79, 15, 116, -99, 16, 47, 16, -49, 0, -13, 31, 34, 106, 12, 127, -5, -11, -59, 11, 69, 8, 19, -126, -1, -16, -13, 47, 79, 49, -96, -49, 15, -96, -42, -94, 118, -10, 12, 127, -5, 2, -15, 7, 53, 3, 24, -124, -15, 40, -12, 118, -10, -11, -49, 0, -76, 80, 40, -95, -123, 3, 32, 49, -120, 79, 18, -113, 64, -13, 31, 34, 106, 3, -79, 15, 68, -1, 119, -12, -33, 64, 73, -110, -8, 26, -11, 15, -53, 16, 40, -95, -123, 11, 79, 113, 15, 49, 22, 8, 26, -34, 26, 3, 32, 59, 16, -12, 79, -9, 127, 77, -12, 4, -103, 47, -124, -13, -111, -11, -49, -11, -4, -79, 15, -13, -14, 83, 24, -14, 15, -56, 74, 24, 11, 69, 13, 97, -1, 127, 9, 126, 79, 57, -14, 14, -76, 111, 97, -96, -73, 80, -30, -40, 81, 4, 106, -1, -1, 82, -128, 95, 1, 26, -11, 15, -14, 24, -76, -16, 80, 82, -12, 19, -73, 111, 96, 83, 72, 57, 26, 11, 127, 79, -1, -5, -5, 45, -128, -12, 118, 24, 73, 15, 4, -17, -111, 48, -76, 80, -16, 24, -12, 70, 22, 57, -14, 12, -1, -112, 59, 16, -95, -15, 77, -109, 12, 16, 38, 12, -16, 15, 63, 32, -57, -1, -65, 95, -16, 15, 71, 97, -124, -112, -16, 78, -7, 19, 11, 69, 15, 1, -113, 68, 97, 99, -97, 32, -49, -7, 3, -79, 10, 31, 20, -39, 48, -63, 2, 96, -49, 0, -13, -14, 12, 127, -5, -11, -5, 45, -128, -12, 118, 24, 73, 15, 4, -17, -111, 48, -76, 80, -49, -7, 3, -79, 12, 16, 38, 12, -16, 3, 32, -49, -1, 63, 95, -16, 15, 71, 97, -124, -112, -16, 78, -7, 19, 11, 69, 12, -1, -112, 59, 16, -63, 2, 96, -49, 0, 50, 12, -1, -13, -11, -59, 11, 69, 3, -121, 26, 3, 32, -13, 20, -12, 14, 41, 38, 117, 53, 10, 47, -122, 3, 32, -49, 15, -96, -13, -45, 3, -79, 15, 9, 70, 19, -2, 80, 83, 72, -13, 69, 16, -8, 45, -102, 15, -105, -103, 3, -79, -12, 4, -103, 15, 49, -15, 40, 16, 59, 31, 32, -108, 106, -11, 15, -53, 16, -13, -121, -81, 97, 14, -127, -8, 8, 21, -25, 106, 80, 59, 16, 40, -95, -113, 95, -78, -40, 5, -25, 22, 55, 83, 80, -76, -9, 16, -30, -12, -16, -111, 49, -96, -127, 81, 72, -21, 7, 99, 32, -4, 30, -80, -1, -31, -9, 25, 12, 112, -15, 40, 12, -1, -81, 80, -4, -79, 120, 15, 8, 127, 68, -113, 32, -127, 81, 72, -21, 15, 18, -19, 80, -15, 40, 6, 31, -9, 48, -14, 20, -128, 117, 3, -79, 12, -1, -96, -15, 113, -102, -11, -59, 11, 69, 1, -1, 113, -19, 49, -96, 40, -95, -123, 3, 32, -15, 41, -110, -8, 4, 15, 25, 17, 48, 70, -96, 79, -124, 115, 80, -15, -40, 59, 24, 10, 120, 30, 55, 38, -11, -59, 11, 74, 2, -118, 24, 80, 50, 15, 18, -103, 47, -128, 64, -15, -111, 19, 15, -117, 126, -80, -89, -90, -2, 48, -12, 47, 113, -11, 15, -53, 16, -24, 31, -128, 79, -124, 115, 80, -15, -40, 59, 24, 2, -118, 24, 95, 95, -78, -40, 5, 52, -113, 52, 81, 4, 48, -49, 0, -13, -41, -109, 12, 112, 97, -8, 12, -1, 31, -1, -75, -1, -4, 15, 61, 48, -83, 16, 50, 4, 9, 78, -7, 2, -15, 15, -1, -33, -1, -7, -1, -1, 79, -1, -11, -1, -1, 112, -1, 105, 17, 48, -1, -97, -1, 32, -1, -1, 33, -1, -8, -41, 87, 55, 38, 15, 18, -113, 69, 3, -79, -14, 11, 79, 113, 15, 49, 22, 15, 65, -113, 97, -96, -8, 115, -80, -59, 15, -117, 126, -80, -15, 40, 61, 100, 49, -97, 32, -76, -16, -16, 22, -96, 50, 15, 49, 6, 20, -113, 63, 47, 95, -1, 63, -9, 79, 71, 100, 55, 38, 2, -15, 15, -120, 30, -7, 79, 97, 15, 24, 47, 64, 59, 16, -13, 67, 57, 16, 67, 12, 96, -42, -30, -9, 24, 26, 15, 9, 70, 80, -15, 40, 4, 6, 31, -128, -16, 72, 48, 50, 15, 9, 78, 16, 38, 15, 34, -40, 5, -73, -16, 95, 95, -1, 63, -9, 79, 71, 100, 55, 38, 2, -15, 15, -120, 30, -7, 79, 97, 15, 24, 47, 64, 59, 16, -13, 67, 57, 16, 67, 12, 96, -42, -30, -9, 24, 26, 15, 9, 70, 80, -15, 40, 4, 6, 31, -128, 91, 127, 0, -67, -103, -11, -59, 11, 69, 15, 49, 22, 10, 117, -12, 70, 57, 26, 15, 18, -128, -49, 127, -97, -64, 47, 16, -12, 118, 24, 73, 80, 67, 3, -79, 5, 52, -113, 52, 81, 2, -113, 55, 55, 111, 96, -49, 15, 80, -1, -106, 3, -79, 15, 8, 46, 21, 80, -14, 45, 11, 79, 113, 10, 117, -30, -9, 24, 26, 4, 6, 31, -128, 49, -21, 98, -110, -10, -14, -11, -59, 11, 69, 15, 49, 22, 10, 117, -12, 70, 57, 26, 15, 18, -128, -49, 127, -97, -64, 47, 16, -12, 118, 24, 73, 80, 67, 3, -79, 5, 52, -113, 52, 81, 2, -113, 55, 55, 111, 96, -49, 15, 80, -1, -106, 3, -79, 15, 8, 46, 21, 80, -14, 45, 11, 79, 113, 15, 100, 118, 26, 4, 8, 21, 20, -114, -80, -111, -9, 25, 7, 96, -49, -6, -11, -59, 11, 69, 15, 49, 22, 10, 117, -12, 70, 57, 26, 15, 18, -128, -49, 127, -97, -64, 47, 16, -12, 118, 24, 73, 80, -8, -73, -21, 11, 79, 113, 10, 31, 2, 87, 49, -96, 38, 12, -16, -11, 15, -7, 48, -76, 80, 73, 82, 15, 68, -95, 12, -9, 8, 21, 45, -114, 21, 4, -9, 71, -108, -13, -111, 15, 18, -128, 127, 79, 65, -89, 67, 16, -43, 31, 80, -1, -106, 3, -79, 15, 8, 46, 21, 80, -14, 45, 11, 79, 113, 10, 117, -30, -9, 24, 26, 4, 6, 31, -128, 49, -21, 98, -110, -10, -14, -11, -59, 11, 69, 15, 49, 22, 10, 117, -12, 70, 57, 26, 15, 18, -128, -49, 127, -97, -64, 47, 16, -12, 118, 24, 73, 80, 67, 3, -79, 5, 52, -113, 52, 81, 2, -113, 55, 55, 111, 96, -49, 15, 80, -1, -109, 11, 69, 4, -107, 32, -12, 74, 16, -49, 112, -127, 82, -40, -31, 80, 79, 116, 121, 79, 57, 16, -15, 40, 7, -12, -12, 26, 116, 49, 13, 81, -11, 15, -7, 96, 59, 16, -16, -126, -31, 85, 15, 34, -48, -76, -9, 16, -10, 71, 97, -96, 64, -111, -9, 25, 7, 96, -49, -6, -11, -59, 11, 69, 15, 49, 22, 10, 117, -12, 70, 57, 26, 15, 18, -128, -49, 127, -97, -64, 47, 16, -12, 118, 24, 73, 80, -8, -73, -21, 11, 79, 113, 10, 31, 2, 87, 49, -96, 38, 12, -16, -11, -59, 11, 69, 15, 49, 22, 10, 117, -12, 70, 57, 26, 15, 18, -128, -49, 127, -97, -64, 47, 16, -12, 118, 24, 73, 80, 67, 3, -79, 5, 52, -113, 52, 81, 2, -113, 55, 55, 111, 96, -49, 15, 92, 80, -76, 80, -13, 17, 96, -89, 95, 68, 99, -111, -96, -15, 40, 12, -9, -7, -4, 2, -15, 15, 71, 97, -124, -107, 15, -117, 126, -80, -76, -9, 16, -95, -16, 37, 115, 26, 2, 96, -49, 15, 80, -1, -55, 55, -12, 67, 16, -127, -17, 46, -105, 111, 96, -76, 80, 73, 82, 15, 68, -95, 12, -9, 8, 21, 45, -114, 21, 4, -9, 71, -108, -13, -111, 15, 18, -128, 127, 79, 65, -89, 67, 16, -43, 16, -1, -5, -111, 85, 7, -15, 2, 59, 24, 5, -73, -16, 80, -8, 24, 16, 94, -124, -16, -16, 26, 11, 24, 16, 59, 117, 15, 33, 72, -1, -4, -11, -59, 11, 69, 15, 49, 22, 10, 117, -12, 70, 57, 26, 15, 18, -128, -49, 127, -97, -64, 47, 16, -12, 118, 24, 73, 80, 67, 3, -79, 5, 52, -113, 52, 81, 2, -113, 55, 55, 111, 96, -49, 15, 80, -1, -55, 55, -12, 67, 16, -127, -17, 46, -105, 111, 96, -76, 80, 73, 82, 15, 68, -95, 12, -9, 8, 21, 45, -114, 21, 4, -9, 71, -108, -13, -111, 15, 18, -128, 127, 79, 65, -89, 67, 16, -43, 16, -1, -5, -111, 85, 7, -15, 2, 59, 24, 5, -73, -16, 80, -8, 24, 16, 94, -124, -16, -16, 26, 11, 24, 16, 59, 117, 15, 33, 72, -1, -4, -11, -1, 0, -13, 67, 57, 16, 50, 47, -112, -16, -108, -31, 4, 48, -58, -11, 15, -78, -48, -95, 83, -126, -14, 26, 12, -1, 16, -7, 121, -105, 111, 96, -49, 127, -33, -48, 47, 16, 59, 23, -128, -30, -110, 103, 83, 80, 118, 3, -79, 15, 52, -113, 100, 118, -11, -5, 45, -128, -127, -31, 99, 15, 56, 20, -7, 59, -126, -33, 107, 7, 96, -49, -6, 11, 69, 4, -107, 32, 52, -33, 107, 48, -14, 45, 11, 47, -128, 50, 15, 61, 121, -96, -49, -112, -95, -15, 22, 81, 95, 80, -1, 9, -112, 31, -9, 117, 55, 111, 96, -16, -108, 97, 52, -113, 32, -95, -15, 22, 81, 80, -76, -9, 16, -13, 17, 96, -33, 15, 104, 74, 26, 3, 32, 59, 16, 97, -8, 3, 30, -74, 41, 47, 111, 47, 92, -16, 15, -124, 80, -13, 47, 79, 52, -118, 26, 15, -121, 59, 4, 15, 4, -17, -111, 60, -1, 64, -30, 99, 71, 103, 111, 96, -49, 127, -97, -64, 47, 16, -12, 118, 24, 73, 95, 80, -1, -9, 47, -127, -9, 24, -6, 3, -79, 15, 4, -17, -111, 48, -89, -90, -2, 48, -92, -12, 79, 97, 4, 111, 32, 47, 16, -14, 45, -128, 118, 83, 73, -108, 55, 38, 80, 40, 15, -105, -103, 4, 111, 32, -30, -110, 103, 83, 95, 92, 80, 67, 49, -12, -16, 49, -96, 50, 8, 20, -21, 12, 96, -9, 116, 5, 52, -113, 100, 49, -6, 15, 61, 48, -30, -39, -96, 98, 48, -13, 30, 77, 81, 6, 32, 83, 72, -10, 67, 16, -30, -39, -96, -13, 16, -95, 49, -29, 26, 4, 48, 59, 16, -95, 83, 118, 67, 114, 111, 95, -78, -48, -30, -39, -90, -2, 48, -10, 127, 113, 12, 80, 79, -124, -14, 15, 49, -28, -43, 16, 59, 67, 15, 9, 79, 33, -128, 117, 10, 20, -81, 95, -78, -48, -30, -39, -90, -2, 48, -10, 127, 113, 12, 80, 79, -124, -14, 15, 49, -28, -43, 16, 59, 24, 16, -8, 24, 16, 82, -12, 16, 47, 16, -14, 45, -128, -30, -110, 103, 83, 80, 38, 15, 50, 72, -81, 95, -78, -48, -30, -39, -90, -2, 48, -10, 127, 113, 12, 80, 79, -124, -14, 15, 49, -28, -43, 16, -55, 10, 122, 111, -29, 11, 79, 113, 3, -79, 4, -81, 71, 103, 83, -124, 55, -9, 16, -28, -16, 78, 115, -14, 3, 32, -12, 71, 99, 71, 96, 59, 16, -15, -111, 19, -2, 80, -127, -30, -118, 95, 92, -1, -32, 67, 49, -12, -16, 49, -96, 50, 15, 103, -9, 16, -14, 45, 4, 15, 25, 17, 63, -96, -13, -45, 15, 34, -48, -94, 111, -29, 11, 79, 113, 1, 98, -33, 107, 1, -1, 126, 21, 80, -95, 87, -10, 96, -28, -16, 78, 115, -14, 3, 32, -30, -12, -16, -111, 49, 3, -79, 3, -124, 101, 78, 55, 38, -11, -49, -2, 5, 109, -13, 15, 34, -40, 4, 51, 31, 79, 3, 26, 15, 103, -15, 48, 70, -96, -127, -15, -43, 16, 59, 16, -15, -111, 19, -11, -49, -10, 11, 69, 5, -34, -31, 85, -15, -39, -97, 32, -13, 17, 96, -10, 127, 113, 96, 50, 12, -97, 92, -1, -32, -76, -9, 16, -10, 127, 113, 96, -14, 45, 12, -1, 111, 92, -1, 96, -76, 80, -13, 17, 96, 79, 53, 40, -13, 26, 15, 63, 32, 59, 16, -1, 63, 37, 49, -113, 32, -4, -124, -95, -113, 80, -1, -106, 8, 19, -40, 111, -96, -14, 45, 11, 79, 113, 15, 49, 22, 15, 103, -9, 22, 12, 112, 47, 16, 59, 16, -4, -124, -95, -113, -27, 4, -33, -9, 121, -108, -113, 32, 91, 127, 5, 15, 18, -128, -14, 45, -128, 47, -122, 13, 81, -11, -49, -10, 11, 69, 15, 49, 22, 4, -13, 82, -113, 49, -96, -13, -14, 3, -79, 15, -13, -14, 83, 24, -14, 15, -56, 74, 24, -11, 15, -7, 96, -127, 61, -122, -6, 3, -79, 3, -124, -95, -128, 56, 113, -96, 50, 15, 103, -9, 16, -14, 45, 4, 5, -73, -16, -6, 15, 61, 48, -14, 45, 15, -127, -127, 13, 100, -13, -111, 3, 32, 83, 40, 16, 59, 16, -95, 87, -10, 96, -127, -30, -118, 80, 97, -31, 85, 72, -14, 15, 18, -128, -33, 15, -111, 31, 15, 92, -1, 95, -16, 15, 68, 85, 15, 4, -17, -111, 48, 79, 15, 1, 72, 80, 50, 15, 49, 2, 96, 64, -30, -103, 117, 114, 96, -30, -40, 81, 15, -121, 59, 12, -16, -6, 15, -117, 126, -80, -19, -120, 22, 57, -14, 7, 80, -42, 79, 57, 16, 50, 5, 79, 17, -97, 32, -28, 62, -80, 59, 16, -16, 78, -7, 19, -11, -5, 45, -128, 83, 72, -13, 69, 16, 67, 12, -16, 7, 80, 94, -79, -83, -111, -96, 50, 14, 47, 79, 9, 19, 16, 73, -112, -127, -12, 71, 103, 111, 96, -16, -126, -83, -29, 114, 96, 115, 31, 69, 3, -73, 80, -14, 20, -113, 95, -78, -48, -76, -9, 16, -127, -31, 127, 113, -96, 38, 16, -13, 67, 57, 16, -127, -30, -118, 118, -10, 3, -73, 80, -14, 20, -113, 95, -78, -48, -76, -9, 16, -127, -31, 127, 113, -96, -57, 15, 52, 51, -111, 8, 30, 40, -89, 111, 101, 3, -73, 80, -14, 20, -113, 92, 80, 117, 6, 35, 4, -103, 47, -127, -96, 50, 3, -124, 101, -15, 24, 14, 41, 38, 117, 53, 3, 32, 70, 35, -79, -128, -16, -108, -14, 24, -11, -49, 0, -76, 80, -13, 17, 96, 77, 50, 3, 24, -124, -15, 40, -12, 26, 3, 32, 64, -9, 73, -47, 2, -15, 12, 127, -5, -11, -5, 45, -128, -127, -31, 99, 15, 56, 20, -7, 59, -126, -33, 107, 7, 96, -49, -6, 11, 69, 4, -107, 32, 52, -33, 107, 48, -14, 45, 11, 47, -128, 50, 15, 61, 121, -96, 59, 16, -49, -112, 94, 70, 97, -113, 80, -1, 9, -112, 31, -9, 117, 55, 111, 96, -16, -108, 97, 52, -113, 32, 94, 70, 97, -123, 11, 79, 113, 15, 49, 22, 13, -16, -10, -124, -95, -96, 50, 3, -79, 6, 31, -128, 49, -21, 98, -110, -10, -14, -11, -1, -1, 72, 17, -89, 111, 96, 78, 55, -9, 115, 113, 80, 38, 12, 80, -76, -9, 16, 47, 113, -113, 25, 47, -127, -96, -105, -9, 118, -10, 5, -16, 78, 31, 80, 12, -9, -3, -3, 14, 41, 38, 117, 53, 11, 79, 113, 15, 49, 22, 15, 49, 79, 65, -96, -94, -8, 96, 50, 12, -16, -11, -5, 45, -128, 118, 49, -103, 127, 97, 110, 16, -10, 67, -79, -121, 111, 96, 78, 55, -9, 115, 113, 80, -30, -12, -13, 118, 26, 15, -121, 59, 5, -14, 97, -113, 103, 83, 126, 5, -25, 22, -31, 11, 79, 113, 4, 122, 26, 15, 34, -40, 8, 21, 20, -114, -80, 31, 31, 18, -125, 80, 118, 12, -1, -96, -13, -14, 12, 112, -127, 82, -40, -31, 95, 92, 80, -76, 80, -95, -10, -124, -95, -96, -49, 0, -15, -126, -12, 4, 15, 116, -99, 16, 47, 16, -57, -1, -80, 50, 12, 127, -5, -11, -59, 7, 80, -19, -120, 22, 57, -14, 13, 100, -13, -111, 3, 32, -95, -10, -124, -95, 3, -79, 15, 116, -99, 16, 47, 16, -49, 0, -13, 31, 34, 106, 12, 127, -5, -11, -5, 45, -128, 22, -10, 118, 17, -123, 2, 96, -49, 0, -76, -9, 16, -12, 70, 79, 97, -96, 50, 7, -12, -16, -126, -9, 16, 59, 16, -42, -95, -119, -14, 118, -10, 12, 16, -13, -14, 15, -1, -13, -1, -65, 95, -78, -48, -76, -9, 16, 118, -15, 32, 38, 4, 6, 31, -128, -16, -108, 97, 63, 80, -1, -97, 16, -14, 45, 14, 41, 38, 127, -15, 16, -49, 15, -96, -14, 45, 14, 70, 15, 68, -7, 16, 115, 80, -9, 73, -47, 12, 127, -5, -11, -59, 15, -124, 80, -42, 79, 57, 16, 50, 13, 81, 3, -79, 5, 52, -113, 100, 49, 4, 48, -49, 0, -13, 30, 77, 81, 15, 34, -48, -76, -96, -30, -110, 103, 83, 80, 38, 15, 50, 72, -96, 70, -96, -94, 6, 35, 14, 38, 56, 41, 3, -79, 15, 9, 70, 19, -11, -49, -10, 11, 69, 15, 49, 22, 4, 102, 123, 121, 67, 26, 7, 96, 64, -49, -2, 12, -1, 48, -12, 118, 16, -15, 113, -102, 4, 48, -58, -11, -59, 11, 69, 15, 49, 22, 10, 79, 68, -10, 26, 15, 63, 32, 64, -95, 50, 100, 55, 111, 96, -49, -2, 12, -1, 48, -12, 118, 16, -15, 113, -102, 4, 48, -58, -11, 15, -78, -40, 15, 25, 17, 48, -76, 80, 52, -7, 22, 12, 112, -92, -12, 79, 97, 15, 2, 118, 53, 15, 61, 48, 98, 97, 2, -15, 15, 34, -40, 5, -73, -16, 80, -8, 24, 16, -95, 83, -126, -14, 26, -11, -59, 11, 69, 3, 79, -111, 96, -92, -12, 79, 97, 15, 24, 47, 64, 64, -95, 50, 100, 55, 111, 96, -49, -2, 12, -1, 48, -12, 118, 16, -15, 113, -102, 4, 48, -58, -11, 15, -78, -40, 15, 25, 17, 48, -76, 80, 52, -7, 22, 12, 112, -92, -12, 79, 97, 15, 2, 118, 53, 4, 106, 12, 112, 47, 16, -14, 45, -128, 91, 127, 5, 15, -127, -127, 10, 21, 56, 47, 33, -81, 92, -1, 96, -76, 80, -13, 17, 96, 70, 103, -73, -108, 49, -96, 118, 15, 34, -40, 12, -1, 48, -12, 118, 16, -15, 113, -102, 4, 48, -58, -11, -59, 11, 69, 15, 49, 22, 10, 79, 68, -10, 26, 15, 63, 32, -14, 45, -128, -95, 50, 100, 55, 111, 96, -49, -13, 15, 71, 97, 15, 23, 25, -96, 67, 12, 111, 80, -5, 45, -128, -12, 118, 21, 11, 79, 113, 7, 111, 25, 126, 49, -96, -57, 10, 79, 68, -10, 16, -16, 39, 99, 95, -96, -13, -45, 15, 34, -48, -89, -90, -2, 48, -12, 70, 79, 97, 3, 32, -95, 83, -126, -14, 4, 111, 32, 91, 127, 5, -11, -59, 11, 69, 15, 49, 22, 10, 79, 68, -10, 26, 15, 63, 32, -14, 45, -128, -95, 50, 100, 55, 111, 96, -49, -13, 15, 71, 97, 15, 23, 25, -96, 67, 12, 111, 80, -5, 45, -128, -12, 118, 21, 11, 79, 113, 7, 111, 25, 126, 49, -96, -57, 10, 79, 68, -10, 16, -16, 39, 99, 80, 70, -96, -14, 45, 11, 79, 113, 10, 21, 56, 47, 33, -96, -57, 2, -15, 3, -79, 5, -73, -16, 95, 92, 80, -76, 80, 56, 113, -96, 50, 15, 49, 79, 64, -30, -110, 103, 83, 80, 50, 10, 17, -16, 5, -16, 78, 31, 80, -4, -73, 80, 40, -95, -128, -76, 80, -13, 17, 96, -28, 110, 25, 26, -11, -5, 45, -128, -15, -111, 19, 92, -1, 80, -76, -9, 16, -13, 47, 79, 49, -96, -49, 15, -96, -7, 121, -105, 111, 96, -57, -3, -3, 14, 41, 38, 117, 53, -11, -5, 45, -128, -15, -111, 19, 92, -1, 80, -76, -9, 16, -13, 47, 79, 49, -96, -49, 15, -96, -95, 83, -126, -14, 118, -10, 2, 97, 7, 101, 52, -103, 67, 114, 111, 95, -78, -40, 15, 25, 17, 53, -49, -11, 11, 79, 113, 15, 50, -12, -13, 26, 12, -16, -6, 10, 21, 56, 47, 39, 111, 96, -57, 10, 31, 17, 101, 21, -6, 15, 20, -29, 40, 113, 80, 70, -96, -12, 118, 21, -11, -5, 45, -128, -15, -111, 19, 92, -1, 80, -76, -9, 16, -13, 47, 79, 49, -96, -49, 15, -96, -7, 121, -105, 111, 96, -57, -3, -3, 14, 41, 38, 117, 53, -6, 4, 106, 10, 21, 56, 47, 39, 111, 96, 38, 28, -1, 80, 118, 83, 73, -108, 55, 38, -11, -5, 45, -128, -15, -111, 19, 92, -1, 80, -76, -9, 16, -13, 47, 79, 49, -96, -49, 15, -96, -7, 121, -105, 111, 96, -57, -3, -3, 14, 41, 38, 117, 53, -6, 4, 106, 10, 21, 56, 47, 39, 111, 96, -57, 10, 31, 17, 101, 21, -6, 15, 20, -29, 40, 113, 80, 70, -96, -12, 118, 21, -11, -5, 45, -128, -15, -111, 19, 92, -1, 80, -76, -9, 16, -13, 47, 79, 49, -96, -49, 15, -96, -7, 121, -105, 111, 96, -57, -3, -3, 14, 41, 38, 117, 53, -11, 15, -14, -108, 97, 52, -113, 32, -95, -15, 22, 81, 80, 83, 47, 15, 1, -96, -49, -14, 2, -15, 15, 34, -40, 15, 50, -12, -13, 95, 95, -78, -40, 15, 25, 17, 53, -49, -11, 11, 79, 113, 15, 50, -12, -13, 26, 12, -16, -6, 10, 21, 56, 47, 39, 111, 96, 38, 28, -1, 80, 118, 83, 73, -108, 55, 38, -11, 15, -14, -108, 97, 52, -113, 32, -95, -15, 22, 81, 80, 83, 47, 15, 1, -96, -49, -14, 2, -15, 15, 34, -40, 15, 50, -12, -13, 95, 95, -78, -40, 15, 25, 17, 53, -49, -11, 11, 79, 113, 15, 50, -12, -13, 26, 12, -16, -6, 10, 21, 56, 47, 39, 111, 96, -57, 15, 20, -29, 40, 113, 80, 70, -96, -12, 118, 21, -11, 15, -14, -108, 97, 52, -113, 32, -95, -15, 22, 81, 80, 83, 47, 15, 1, -96, -49, -14, 2, -15, 15, 34, -40, 15, 50, -12, -13, 95, 95, -78, -40, 15, 25, 17, 53, -49, -11, 11, 79, 113, 15, 50, -12, -13, 26, 12, -16, -6, 15, -105, -103, 118, -10, 12, 127, -33, -48, -30, -110, 103, 83, 95, -96, 70, -96, -95, 83, -126, -14, 118, -10, 2, 97, -49, -11, 7, 101, 52, -103, 67, 114, 111, 80, 15, -14, -108, 97, 52, -113, 32, -95, -15, 22, 81, 80, 83, 47, 15, 1, -96, -49, -14, 2, -15, 15, 34, -40, 15, 50, -12, -13, 95, 95, -78, -40, 15, 25, 17, 53, -49, -11, 11, 79, 113, 15, 50, -12, -13, 26, 12, -16, -6, 15, -105, -103, 118, -10, 12, 127, -33, -48, -30, -110, 103, 83, 95, -96, 70, -96, -95, 83, -126, -14, 118, -10, 12, 112, -95, -15, 22, 81, 95, -96, -15, 78, 50, -121, 21, 4, 106, 15, 71, 97, 95, 80, -1, 41, 70, 19, 72, -14, 10, 31, 17, 101, 21, 5, 50, -16, -16, 26, 12, -1, 32, 47, 16, -14, 45, -128, -13, 47, 79, 53, -11, -49, -8, 15, 25, 17, 53, 11, 79, 113, 15, 50, -12, -13, 26, 12, -16, -6, 15, -105, -103, 118, -10, 12, 127, -33, -48, 47, 16, -14, 45, -128, -30, -110, 103, 83, 95, 92, -1, -128, -15, -111, 19, 80, -76, -9, 16, -13, 47, 79, 49, -96, -49, 15, -96, -95, 83, -126, -14, 118, -10, 2, 97, -49, -11, 2, -15, 15, 34, -40, 7, 101, 52, -103, 67, 114, 101, -11, -49, -8, 15, 25, 17, 53, 11, 79, 113, 15, 50, -12, -13, 26, 12, -16, -6, 10, 21, 56, 47, 39, 111, 96, -57, 2, -15, 15, 34, -40, 10, 31, 17, 101, 21, -6, 15, 20, -29, 40, 113, 80, 70, -96, -12, 118, 21, -11, -49, -8, 15, 25, 17, 53, 11, 79, 113, 15, 50, -12, -13, 26, 12, -16, -6, 15, -105, -103, 118, -10, 12, 127, -33, -48, 47, 16, -14, 45, -128, -30, -110, 103, 83, 95, -96, 70, -96, -95, 83, -126, -14, 118, -10, 2, 97, 2, -15, 15, 34, -40, 7, 101, 52, -103, 67, 114, 101, -11, -49, -8, 15, 25, 17, 53, 11, 79, 113, 15, 50, -12, -13, 26, 12, -16, -6, 15, -105, -103, 118, -10, 12, 127, -33, -48, 47, 16, -14, 45, -128, -30, -110, 103, 83, 95, -96, 70, -96, -95, 83, -126, -14, 118, -10, 12, 112, 47, 16, -14, 45, -128, -95, -15, 22, 81, 95, -96, -15, 78, 50, -121, 21, 4, 106, 15, 71, 97, 95, 92, -1, -128, -15, -111, 19, 80, -76, -9, 16, -13, 47, 79, 49, -96, -49, 15, -96, -7, 121, -105, 111, 96, -57, -3, -3, 2, -15, 15, 34, -40, 14, 41, 38, 117, 53, -11, 15, -14, -108, 97, 52, -113, 32, -95, -15, 22, 81, 80, -95, 83, -126, -14, 26, 12, -1, 32, 47, 16, 59, 16, 118, -30, -12, 118, -10, 15, 50, -12, -13, 95, 92, -1, -128, -15, -111, 19, 80, -76, -9, 16, -13, 47, 79, 49, -96, -49, 15, -96, -95, 83, -126, -14, 118, -10, 2, 97, -49, -11, 2, -15, 15, 34, -40, 7, 101, 52, -103, 67, 114, 101, -11, 15, -14, -108, 97, 52, -113, 32, -95, -15, 22, 81, 80, -95, 83, -126, -14, 26, 12, -1, 32, 47, 16, 59, 16, 118, -30, -12, 118, -10, 15, 50, -12, -13, 95, 92, -1, -128, -15, -111, 19, 80, -76, -9, 16, -13, 47, 79, 49, -96, -49, 15, -96, -95, 83, -126, -14, 118, -10, 12, 112, 47, 16, -14, 45, -128, -95, -15, 22, 81, 95, -96, -15, 78, 50, -121, 21, 4, 106, 15, 71, 97, 95, 80, -1, 41, 70, 19, 72, -14, 10, 31, 17, 101, 21, 10, 21, 56, 47, 33, -96, -49, -14, 2, -15, 3, -79, 7, 110, 47, 71, 111, 96, -13, 47, 79, 53, -11, -49, -8, 15, 25, 17, 53, 11, 79, 113, 15, 50, -12, -13, 26, 12, -16, -6, 15, -105, -103, 118, -10, 12, 127, -33, -48, 47, 16, -14, 45, -128, -30, -110, 103, 83, 95, -96, 70, -96, -95, 83, -126, -14, 118, -10, 2, 97, -49, -11, 2, -15, 15, 34, -40, 7, 101, 52, -103, 67, 114, 101, -11, 15, -14, -108, 97, 52, -113, 32, -95, -15, 22, 81, 80, -95, 83, -126, -14, 26, 12, -1, 32, 47, 16, 59, 16, 118, -30, -12, 118, -10, 15, 50, -12, -13, 95, 92, -1, -128, -15, -111, 19, 80, -76, -9, 16, -13, 47, 79, 49, -96, -49, 15, -96, -7, 121, -105, 111, 96, -57, -3, -3, 2, -15, 15, 34, -40, 14, 41, 38, 117, 53, -6, 4, 106, 10, 21, 56, 47, 39, 111, 96, -57, 2, -15, 15, 34, -40, 10, 31, 17, 101, 21, -6, 15, 20, -29, 40, 113, 80, 70, -96, -12, 118, 21, -11, 15, -14, -108, 97, 52, -113, 32, -95, -15, 22, 81, 80, -95, 83, -126, -14, 26, 12, -1, 32, 47, 16, 59, 16, 118, -30, -12, 118, -10, 15, 50, -12, -13, 95, 95, -78, -40, 15, 25, 17, 53, -49, -11, 11, 79, 113, 8, 19, -126, -1, -16, -13, 47, 79, 49, -96, -49, 15, -96, -42, -94, 118, -10, 12, 127, -5, 2, -15, 7, 53, 3, 24, -124, -15, 40, -12, 118, -10, -11, -49, -8, 15, 25, 17, 53, 11, 79, 113, 8, 19, -126, -1, -16, -13, 47, 79, 49, -96, -49, 15, -96, -42, -94, 118, -10, 12, 127, -5, 2, -15, 7, 53, 3, 24, -124, -15, 40, -12, 118, -10, -11, -5, 45, -128, -15, -111, 19, 92, -1, 80, -76, -9, 16, -13, 47, 79, 49, -96, -49, 15, -96, -7, 121, -105, 111, 96, 47, 31, 16, 73, -112, 59, 16, 22, 31, 79, 32, -30, -110, 103, 83, 95, 92, -1, -128, -15, -111, 19, 80, -76, -9, 16, -13, 47, 79, 49, -96, -49, 15, -96, -7, 121, -105, 111, 96, 73, -112, 47, 16, -14, 45, -128, -30, -110, 103, 83, 95, 92, 80, -15, 71, -111, -96, 50, 9, 79, 32, -12, 118, 21, 3, -73, 80, -14, 20, -128, -83, 16, 50, 3, 30, -74, 126, 73, 10, 127, 31, 23, -19, -109, 113, 95, 92, -16, 15, 20, 121, 26, 3, 32, -15, -105, 111, 96, 64, -12, 118, 24, 73, 15, 4, -17, -111, 48, -83, 16, 50, 3, 30, -74, 126, 73, 10, 127, 31, 23, -19, -109, 113, 95, 80, -1, -14, -47, 3, 32, 31, -9, -31, 85, 127, 113, 15, 25, 17, 48, -12, 70, 29, -9, 24, 118, -10, 7, 96, 59, 16, -13, 67, 57, 16, 72, 20, -6, 5, 47, 65, 2, -15, 15, 34, -40, 15, 25, 17, 53, 14, 45, -102, 6, 35, 15, 4, -125, 126, 127, 4, 49, 7, 96, 59, 16, -13, 67, 57, 16, 67, 12, 96, 70, -96, -8, 121, -112, -13, 16, -42, 79, 57, 16, 50, 15, 29, -97, 23, -103, 3, -79, 120, 4, 85, 127, 102, 26, 3, 69, -7, 80, 59, 117, 15, 33, 72, -11, -49, 0, -8, 69, 15, 50, -12, -13, 72, -95, -96, -8, 115, -80, 64, -49, 127, -97, -64, -12, 118, 24, 73, 15, 4, -17, -111, 60, -1, 79, 80, -1, 98, -125, -42, 67, 25, -14, -6, 6, 32, 38, 16, -8, 69, 11, 47, 65, 4, 48, 59, 16, 55, -12, 31, 95, -1, 116, -17, -111, -96, -124, -31, 10, 117, -30, -9, 24, 26, -11, 12, -1, -32, -124, -31, 5, 52, 55, 83, 126, 80, -76, -9, 16, -13, 17, 96, 73, 49, -127, -96, 50, 15, 56, 118, -10, 3, -79, -12, 7, 99, 32, -30, -12, -16, -105, 70, -31, 15, -121, 59, 3, -79, 14, 37, -12, 126, 14, 42, 31, 80};                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                    /* MEMORY_MSG:0x0000 */
 uint8_t acMSG[387] = {0x62, 0xa5, 0x7c, 0x63, 0x69, 0x99, 0x6c, 0x9b, 0x7c, 0x83, 0x2d, 0x84, 0x5a, 0x53, 0x6f, 0x49, 0x43, 0x44, 0x31, 0x4f, 0x5e, 0x6e, 0x6d, 0x5f, 0x37, 0x37, 0x54, 0x3d, 0x70, 0x69, 0x56, 0x53, 0x67, 0x65, 0x4b, 0x59, 0x84, 0x42, 0x56, 0x1a, 0xa6, 0x9e, 0xcc, 0x26, 0x24, 0x24, 0x20, 0x2f, 0x37, 0x4f, 0x58, 0x6b, 0x73, 0x26, 0x28, 0x22, 0x24, 0x2e, 0x30, 0x47, 0xb1, 0x98, 0x48, 0x2e, 0x5f, 0x69, 0x33, 0x2f, 0x34, 0x30, 0x5d, 0x97, 0x71, 0xa9, 0x5f, 0x98, 0x6e, 0xc0, 0x29, 0x69, 0x89, 0x71, 0x6f, 0x87, 0x8c, 0xaa, 0xba, 0xb5, 0x6c, 0x56, 0x57, 0x49, 0xed, 0xee, 0x75, 0x4e, 0x33, 0x36, 0x4a, 0x5b, 0x6b, 0x6e, 0x75, 0x79, 0x97, 0xa6, 0x42, 0x4a, 0x59, 0x71, 0x84, 0x87, 0x8f, 0x9e, 0xba, 0xc9, 0x45, 0x7c, 0x81, 0x6c, 0xf4, 0x26, 0x2a, 0x43, 0x2f, 0x5b, 0x74, 0xe1, 0xd6, 0xb3, 0xc7, 0x6e, 0x7b, 0x91, 0x90, 0xb1, 0xc6, 0xd5, 0xca, 0x55, 0x82, 0x78, 0x7c, 0x42, 0x3a, 0x54, 0x62, 0x71, 0x6d, 0x61, 0x60, 0x6e, 0x7d, 0x79, 0x7b, 0x83, 0x7a, 0x9d, 0xb5, 0xaf, 0x6c, 0x6c, 0x87, 0xa2, 0x8d, 0x8b, 0xb8, 0x9d, 0x84, 0x78, 0x5d, 0x9e, 0x82, 0xb8, 0xc5, 0x85, 0x6a, 0x8d, 0x72, 0x8b, 0x70, 0xa6, 0xad, 0xd3, 0x5c, 0x5c, 0xcc, 0x62, 0x84, 0x6f, 0x4c, 0x7d, 0x7b, 0x5e, 0x41, 0x1e, 0x30, 0x3a, 0x94, 0x91, 0x42, 0x39, 0xa2, 0x99, 0x3f, 0x1c, 0x73, 0x50, 0xfe, 0x73, 0xcb, 0x48, 0x6c, 0x6e, 0xdb, 0xdd, 0x7b, 0x99, 0x5e, 0xae, 0x7f, 0x4b, 0x4c, 0x78, 0x42, 0x5b, 0x83, 0x73, 0x7a, 0xc1, 0x89, 0xab, 0xad, 0xa8, 0xac, 0xa8, 0x68, 0x64, 0x7e, 0x69, 0x78, 0x78, 0x9d, 0x54, 0x55, 0x65, 0x66, 0x21, 0x90, 0x65, 0x4f, 0x7b, 0x57, 0x9e, 0x93, 0x38, 0xcc, 0xf6, 0xc1, 0xd3, 0xc6, 0xb6, 0x8d, 0x90, 0xb0, 0xdf, 0x7e, 0xc2, 0xb6, 0x7f, 0xd4, 0xc6, 0x92, 0x8c, 0x55, 0x63, 0x64, 0x99, 0x82, 0x8f, 0x97, 0x26, 0x11, 0x36, 0x78, 0x72, 0x4f, 0x5e, 0x5d, 0xab, 0xb5, 0x57, 0x5d, 0x59, 0x24, 0x2c, 0xb7, 0xb0, 0x99, 0x6f, 0x3b, 0x4a, 0x48, 0x84, 0x84, 0x53, 0x51, 0x39, 0x37, 0xa3, 0x97, 0x4e, 0x5f, 0xe4, 0x7a, 0x65, 0x94, 0x96, 0xd8, 0xd2, 0x54, 0x55, 0xeb, 0xec, 0x6e, 0xb3, 0xb2, 0x78, 0x40, 0x5a, 0x7e, 0x85, 0x3c, 0x2d, 0x1e, 0x9f, 0xc1, 0x87, 0x61, 0x38, 0x38, 0x3f, 0x38, 0xb4, 0x7c, 0x93, 0x39, 0x48, 0x59, 0x63, 0x72, 0x3e, 0xa2, 0xa1, 0x3d, 0xb0, 0xa7, 0x53, 0x44, 0x47, 0x5b, 0x6c, 0x7c, 0x7f, 0x86, 0x8a, 0xa8, 0xb7, 0x49, 0x51, 0x60, 0x78, 0x8b, 0x8e, 0x96, 0xa5, 0xc1, 0xd0, 0x59, 0x54, 0x53, 0x46, 0x46, 0x4c, 0xce, 0x6f, 0x82}; /* 1030:5934 */
 char rgMSGLookupTable[72] = " eotasnirldh\\ucpfybm.gvwk,YT0'AzPMSXFxOIj%UVL-CDEN!GHq*W()25:QR1B/46Z78?";                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                 /* 1030:5ac6 */
 int16_t aiMSGChunkOffset[7] = {0, 2854, 6582, 10933, 14692, 18914, 22612};                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                               /* 1030:5ab8 */
 uint8_t acMSG[387];                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                      /* MEMORY_MSG:0x5934 */
+char rgcMsgArgs[387] = {3, 4, 2, 3, 3, 2, 2, 3, 2, 3, 1, 1, 2, 1, 3, 2, 2, 2, 1, 1, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 3, 3, 3, 3, 1, 1, 3, 2, 1, 2, 2, 1, 4, 4, 4, 4, 2, 3, 3, 4, 3, 4, 1, 2, 1, 2, 1, 2, 3, 3, 3, 1, 1, 1, 1, 4, 4, 4, 4, 5, 5, 5, 5, 4, 4, 4, 4, 1, 2, 3, 1, 3, 2, 3, 2, 2, 1, 1, 3, 3, 2, 4, 4, 3, 2, 3, 2, 3, 4, 4, 4, 4, 4, 5, 5, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 2, 2, 2, 1, 2, 4, 4, 4, 2, 5, 1, 0, 0, 0, 0, 1, 1, 1, 1, 2, 3, 4, 4, 2, 2, 3, 3, 2, 2, 3, 3, 3, 3, 3, 5, 5, 5, 5, 5, 3, 3, 4, 4, 6, 4, 4, 5, 5, 3, 4, 4, 5, 6, 1, 2, 2, 2, 1, 2, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 3, 1, 0, 2, 4, 1, 1, 2, 5, 2, 2, 4, 5, 6, 5, 3, 4, 5, 4, 2, 3, 2, 2, 1, 1, 2, 2, 3, 4, 5, 4, 5, 2, 4, 2, 4, 2, 1, 2, 1, 3, 3, 4, 4, 3, 3, 4, 4, 4, 4, 3, 3, 4, 3, 3, 3, 1, 2, 5, 1, 1, 2, 1, 1, 2, 2, 1, 2, 2, 2, 0, 1, 1, 0, 1, 2, 2, 3, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 4, 4, 5, 5, 0, 1, 4, 1, 1, 2, 2, 2, 2, 2, 4, 4, 2, 3, 3, 2, 3, 3, 1, 1, 1, 4, 3, 3, 1, 1, 4, 4, 4, 4, 2, 3, 1, 1, 4, 1, 1, 3, 4, 4, 5, 3, 3, 4, 4, 3, 2, 3, 2, 1, 1, 2, 1, 1, 2, 2, 2, 1, 2, 1, 0, 1, 1, 2, 2, 3, 2, 4, 3, 2, 2, 2, 4, 5, 6, 3, 4, 5, 1, 3, 2, 3, 4, 4, 4, 4, 4, 5, 5, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 3, 3, 2, 2, 1, 1, 1, 3, 1}; /* MEMORY_MSG:0x5b0e */
+
+/* Templates decoded so far, by idm; see PszGetCompressedString. */
+static char *rgpszMSGCache[sizeof(acMSG)];
+static char rgchMSGArena[sizeof(aMSGCmpr) * 2 + sizeof(acMSG)];
+static int32_t ichMSGArena;
 
 /* functions */
 int16_t FFindPlayerMessage(int16_t iPlr, int16_t iMsg, int16_t iObj)
 {
     uint8_t *lpbMax;
     uint8_t *lpb;
-
-    /* TODO: implement */
+    MSGKEY *pmk;
+    MSGBIG mb;
+    int16_t iPlrMsg;
+
+    if (FSyncMsgTurnIndex(&vmsgtidx))
+    {
+        return (int16_t)(CFindTurnMsgs(&vmsgtidx, iPlr, iMsg, iObj, &pmk) > 0);
+    }
+    lpb = (uint8_t *)lpMsg;
+    lpbMax = lpb + imemMsgCur;
+    while (lpb + cbMsgTurn <= lpbMax)
+    {
+        lpb += CbUnpackTurnMsg(lpb, &iPlrMsg, &mb);
+        if (iPlrMsg == iPlr && mb.iMsg == iMsg && mb.wGoto == iObj)
+        {
+            return 1;
+        }
+    }
     return 0;
 }
 
@@ -29,8 +57,54 @@ int16_t FGetNMsgbig(int16_t iMsg, MSGBIG *pmb)
     uint8_t *lpb;
     uint16_t u;
 
-    /* TODO: implement */
-    return 0;
+    if (iMsg < 0 || iMsg >= cMsg)
+    {
+        return 0;
+    }
+    lpb = (uint8_t *)lpMsg;
+    lpbMax = lpb + imemMsgCur;
+    if (FSyncMsgIndex(&vmsgidx))
+    {
+        lpb += vmsgidx.rgib[iMsg];
+    }
+    else
+    {
+        for (; iMsg > 0 && lpb < lpbMax; iMsg--)
+        {
+            lpmh = (MSGHDR *)lpb;
+            u = lpmh->grWord;
+            lpb += sizeof(MSGHDR);
+            iMax = rgcMsgArgs[lpmh->iMsg];
+            for (i = 0; i < iMax; i++, u >>= 1)
+            {
+                lpb += 1 + (u & 1);
+            }
+        }
+    }
+    if (lpb + sizeof(MSGHDR) > lpbMax)
+    {
+        return 0;
+    }
+    lpmh = (MSGHDR *)lpb;
+    pmb->iMsg = lpmh->iMsg;
+    pmb->wGoto = lpmh->wGoto;
+    memset(pmb->rgParam, 0, sizeof(pmb->rgParam));
+    u = lpmh->grWord;
+    lpb += sizeof(MSGHDR);
+    iMax = rgcMsgArgs[lpmh->iMsg];
+    for (i = 0; i < iMax; i++, u >>= 1)
+    {
+        if (u & 1)
+        {
+            pmb->rgParam[i] = (int16_t)(lpb[0] | (lpb[1] << 8));
+            lpb += 2;
+        }
+        else
+        {
+            pmb->rgParam[i] = *lpb++;
+        }
+    }
+    return 1;
 }
 
 void DecorateMsgTitleBar(uint16_t hdc, RECT *prc)
@@ -83,8 +157,11 @@ int16_t IdmGetMessageN(int16_t iMsg)
 {
     MSGBIG mb;
 
-    /* TODO: implement */
-    return 0;
+    if (!FGetNMsgbig(iMsg, &mb))
+    {
+        return -1;
+    }
+    return mb.iMsg;
 }
 
 int16_t FFinishPlrMsgEntry(int16_t dInc)
@@ -135,9 +212,7 @@ void MarkPlanetsPlayerLost(int16_t iPlayer)
 
 char *PszFormatMessage(int16_t idm, int16_t *pParams)
 {
-
-    /* TODO: implement */
-    return NULL;
+    return PszFormatString(PszGetCompressedMessage(idm), pParams);
 }
 
 int16_t FSendPlrMsg2XGen(int16_t fPrepend, int16_t iMsg, int16_t iObj, int16_t p1, int16_t p2)
@@ -206,8 +281,18 @@ void MarkPlayersThatSentMsgs(int16_t iPlayer)
 
 void ResetMessages(void)
 {
-
-    /* TODO: implement */
+    imemMsgCur = 0;
+    iMsgCur = -1;
+    cMsg = 0;
+    iMsgSendCur = 0;
+    memset(bitfMsgSent, 0, sizeof(bitfMsgSent));
+    memset(bitfMsgFiltered, 0, sizeof(bitfMsgFiltered));
+    vlpmsgplrIn = NULL;
+    vlpmsgplrOut = NULL;
+    vcmsgplrIn = 0;
+    vcmsgplrOut = 0;
+    FreeMsgIndex(&vmsgidx);
+    InvalidateMsgTurnIndex(&vmsgtidx);
 }
 
 int16_t FRemovePlayerMessage(int16_t iPlr, int16_t iMsg, int16_t iObj)
@@ -215,9 +300,32 @@ int16_t FRemovePlayerMessage(int16_t iPlr, int16_t iMsg, int16_t iObj)
     uint8_t *lpbMax;
     uint8_t *lpb;
     int16_t cDel;
-
-    /* TODO: implement */
-    return 0;
+    MSGBIG mb;
+    int16_t iPlrMsg;
+
+    if (FSyncMsgTurnIndex(&vmsgtidx))
+    {
+        return CRemoveTurnMsgs(&vmsgtidx, iPlr, iMsg, iObj);
+    }
+    cDel = 0;
+    lpb = (uint8_t *)lpMsg;
+    lpbMax = lpb + imemMsgCur;
+    while (lpb + cbMsgTurn <= lpbMax)
+    {
+        if (CbUnpackTurnMsg(lpb, &iPlrMsg, &mb) && iPlrMsg == iPlr && mb.iMsg == iMsg && mb.wGoto == iObj)
+        {
+            lpb[1] = (uint8_t)(lpb[1] | (idmMsgDeleted & 0xff));
+            lpb[2] = (uint8_t)(lpb[2] | (idmMsgDeleted >> 8));
+            cDel++;
+        }
+        lpb += cbMsgTurn + (lpb[0] >> 4);
+    }
+    if (cDel > 0)
+    {
+        CompactTurnMsgs(&vmsgtidx);
+    }
+    cMsg = (int16_t)(cMsg - cDel);
+    return cDel;
 }
 
 char *PszFormatString(char *pszFormat, int16_t *pParamsReal)
@@ -246,8 +354,17 @@ char *PszFormatString(char *pszFormat, int16_t *pParamsReal)
     /* label FinishString @ MEMORY_MSG:0x8ae9 */
     /* label DoNothing @ MEMORY_MSG:0x8b07 */
 
-    /* TODO: implement */
-    return NULL;
+    /* Expanding straight into szWork would let a name lookup (which also
+     * returns szWork) clobber the text built so far. A template with an
+     * escape that cannot be expanded is shown as it is, escapes and all. */
+    if (CchFormatString(szBuf, sizeof(szBuf), pszFormat, pParamsReal) == cchFmtBad)
+    {
+        strncpy(szBuf, pszFormat, sizeof(szBuf) - 1);
+        szBuf[sizeof(szBuf) - 1] = '\0';
+    }
+    strncpy(szWork, szBuf, sizeof(szWork) - 1);
+    szWork[sizeof(szWork) - 1] = '\0';
+    return szWork;
 }
 
 char *PszGetCompressedMessage(int16_t idm)
@@ -263,8 +380,17 @@ char *PszGetCompressedMessage(int16_t idm)
     char *pch;
     int16_t iChunk;
 
-    /* TODO: implement */
-    return NULL;
+    if (rgpszMSGCache[idm] != NULL)
+    {
+        return rgpszMSGCache[idm];
+    }
+
+    /* laid out like the STR catalog */
+    pszOut = &rgchMSGArena[ichMSGArena];
+    i = CchDecodeNibbleString(pszOut, aMSGCmpr, acMSG, aiMSGChunkOffset, rgMSGLookupTable, idm);
+    ichMSGArena += i + 1;
+    rgpszMSGCache[idm] = pszOut;
+    return pszOut;
 }
 
 int16_t MsgDlg(uint16_t hwnd, uint16_t message, uint16_t wParam, int32_t lParam)
@@ -312,8 +438,34 @@ int16_t IMsgPrev(int16_t fFilteredOnly)
     int16_t i;
     int16_t idm;
 
-    /* TODO: implement */
-    return 0;
+    i = iMsgCur;
+    if (fViewFilteredMsg && !fFilteredOnly)
+    {
+        return (int16_t)(iMsgCur > 0 ? iMsgCur - 1 : -1);
+    }
+    /* player-to-player messages come after cMsg and are never filtered */
+    if (i - 1 >= cMsg)
+    {
+        return (int16_t)(i - 1);
+    }
+    if (i > cMsg)
+    {
+        i = cMsg;
+    }
+    if (FSyncMsgIndex(&vmsgidx))
+    {
+        return IMsgIndexPrev(&vmsgidx, i, fFilteredOnly);
+    }
+    do
+    {
+        i--;
+        if (i < 0)
+        {
+            return -1;
+        }
+        idm = IdmGetMessageN(i);
+    } while ((((bitfMsgFiltered[idm >> 3] >> (idm & 7)) & 1) == 0) == fFilteredOnly);
+    return i;
 }
 
 int16_t IMsgNext(int16_t fFilteredOnly)
@@ -321,15 +473,35 @@ int16_t IMsgNext(int16_t fFilteredOnly)
     int16_t i;
     int16_t idm;
 
-    /* TODO: implement */
-    return 0;
+    i = iMsgCur;
+    if (fViewFilteredMsg && !fFilteredOnly)
+    {
+        return (int16_t)(iMsgCur < cMsg + vcmsgplrIn - 1 ? iMsgCur + 1 : -1);
+    }
+    if (i + 1 < cMsg && FSyncMsgIndex(&vmsgidx))
+    {
+        i = IMsgIndexNext(&vmsgidx, i, fFilteredOnly);
+        if (i >= 0)
+        {
+            return i;
+        }
+        i = (int16_t)(cMsg - 1);
+    }
+    do
+    {
+        i++;
+        if (i >= cMsg)
+        {
+            return (int16_t)(i < cMsg + vcmsgplrIn ? i : -1);
+        }
+        idm = IdmGetMessageN(i);
+    } while ((((bitfMsgFiltered[idm >> 3] >> (idm & 7)) & 1) == 0) == fFilteredOnly);
+    return i;
 }
 
 char *PszFormatIds(int16_t ids, int16_t *pParams)
 {
-
-    /* TODO: implement */
-    return NULL;
+    return PszFormatString(PszGetCompressedString(ids), pParams);
 }
 
 int16_t FSendPlrMsg(int16_t iPlr, int16_t iMsg, int16_t iObj, int16_t p1, int16_t p2, int16_t p3, int16_t p4, int16_t p5, int16_t p6, int16_t p7)
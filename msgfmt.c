@@ -0,0 +1,253 @@
+
+#include <stdio.h>
+#include <string.h>
+
+#include "types.h"
+#include "globals.h"
+
+#include "msgfmt.h"
+#include "msg.h"
+#include "msgidx.h"
+#include "strings.h"
+#include "util.h"
+
+/* A name lookup that comes back NULL (not decompiled yet) writes nothing. */
+static int16_t CchPutSz(char *pchOut, int16_t cchOut, char *psz)
+{
+    int16_t cch;
+
+    if (psz == NULL)
+    {
+        return 0;
+    }
+    cch = (int16_t)strlen(psz);
+    if (cch > cchOut)
+    {
+        memcpy(pchOut, psz, cchOut);
+        return cchFmtTrunc;
+    }
+    memcpy(pchOut, psz, cch);
+    return cch;
+}
+
+static int16_t CchFmtInt(char *pchOut, int16_t cchOut, int16_t **ppParams)
+{
+    char szT[8];
+
+    (void)snprintf(szT, sizeof(szT), "%d", *(*ppParams)++);
+    return CchPutSz(pchOut, cchOut, szT);
+}
+
+/* counts that never go negative, e.g. colonists in hundreds */
+static int16_t CchFmtUnsigned(char *pchOut, int16_t cchOut, int16_t **ppParams)
+{
+    char szT[8];
+
+    (void)snprintf(szT, sizeof(szT), "%u", (uint16_t)*(*ppParams)++);
+    return CchPutSz(pchOut, cchOut, szT);
+}
+
+static int16_t CchFmtPlanet(char *pchOut, int16_t cchOut, int16_t **ppParams)
+{
+    return CchPutSz(pchOut, cchOut, PszGetPlanetName(*(*ppParams)++));
+}
+
+static int16_t CchFmtFleet(char *pchOut, int16_t cchOut, int16_t **ppParams)
+{
+    return CchPutSz(pchOut, cchOut, PszGetFleetName(*(*ppParams)++));
+}
+
+/* "the Humanoids" */
+static int16_t CchFmtPlayer(char *pchOut, int16_t cchOut, int16_t **ppParams)
+{
+    return CchPutSz(pchOut, cchOut, PszPlayerName(*(*ppParams)++, 0, 1, 1, 0, NULL));
+}
+
+/* "The Humanoids", to start a sentence */
+static int16_t CchFmtPlayerCap(char *pchOut, int16_t cchOut, int16_t **ppParams)
+{
+    return CchPutSz(pchOut, cchOut, PszPlayerName(*(*ppParams)++, 1, 1, 1, 0, NULL));
+}
+
+/* "Energy" through "Biotechnology" */
+static int16_t CchFmtTechField(char *pchOut, int16_t cchOut, int16_t **ppParams)
+{
+    int16_t iTech;
+
+    iTech = *(*ppParams)++;
+    if (iTech < 0 || iTech > idsBiotechnology - idsEnergy)
+    {
+        return cchFmtBad;
+    }
+    return CchPutSz(pchOut, cchOut, PszGetCompressedString((int16_t)(idsEnergy + iTech)));
+}
+
+/* cargo in hold order: Ironium, Boranium, Germanium, Colonists */
+static int16_t CchFmtCargo(char *pchOut, int16_t cchOut, int16_t **ppParams)
+{
+    int16_t iCargo;
+
+    iCargo = *(*ppParams)++;
+    if (iCargo < 0 || iCargo > idsColonists2 - idsIronium)
+    {
+        return cchFmtBad;
+    }
+    return CchPutSz(pchOut, cchOut, PszGetCompressedString((int16_t)(idsIronium + iCargo)));
+}
+
+/* globals */
+PFNFMTESC vrgpfnFmtEsc[cchFmtEscMax] = {
+    ['i'] = CchFmtInt,    ['v'] = CchFmtUnsigned, ['p'] = CchFmtPlanet,    ['s'] = CchFmtFleet,
+    ['l'] = CchFmtPlayer, ['L'] = CchFmtPlayerCap, ['j'] = CchFmtTechField, ['m'] = CchFmtCargo,
+};
+
+/* Expand pszFormat into pszOut, at most cchOut chars with the NUL. Returns
+ * the length, which may be exactly cchOut - 1; cchFmtTrunc if the text did
+ * not fit; cchFmtBad at an escape with no handler. pszOut is terminated
+ * whenever cchOut > 0 and holds what was expanded before any failure.
+ * pParams may be NULL for templates without escapes. */
+int16_t CchFormatString(char *pszOut, int16_t cchOut, char *pszFormat, int16_t *pParams)
+{
+    int16_t rgParamNone[7];
+    PFNFMTESC pfn;
+    char *pch;
+    int16_t cch;
+    int16_t cchEsc;
+    uint8_t ch;
+
+    if (cchOut <= 0)
+    {
+        return cchFmtTrunc;
+    }
+    if (pParams == NULL)
+    {
+        memset(rgParamNone, 0, sizeof(rgParamNone));
+        pParams = rgParamNone;
+    }
+    cch = 0;
+    for (pch = pszFormat; *pch != '\0'; pch++)
+    {
+        if (*pch == '\\' && pch[1] != '\0' && pch[1] != '\\')
+        {
+            ch = (uint8_t)*++pch;
+            pfn = ch < cchFmtEscMax ? vrgpfnFmtEsc[ch] : NULL;
+            cchEsc = pfn != NULL ? pfn(pszOut + cch, (int16_t)(cchOut - 1 - cch), &pParams) : cchFmtBad;
+            if (cchEsc < 0)
+            {
+                if (cchEsc == cchFmtTrunc)
+                {
+                    cch = (int16_t)(cchOut - 1);
+                }
+                pszOut[cch] = '\0';
+                return cchEsc;
+            }
+            cch = (int16_t)(cch + cchEsc);
+            continue;
+        }
+        if (cch == cchOut - 1)
+        {
+            pszOut[cch] = '\0';
+            return cchFmtTrunc;
+        }
+        if (*pch == '\\' && pch[1] == '\\')
+        {
+            pch++;
+        }
+        pszOut[cch++] = *pch;
+    }
+    pszOut[cch] = '\0';
+    return cch;
+}
+
+/* One host MSGTURN record at lpb: recipient, message and parameters.
+ * The record is packed (MSGTURN's header byte, then MSGHDR at +1), so it
+ * is read byte by byte. Parameters whose grWord bit is set take a word,
+ * the rest a byte; cbParams says where they end. Returns the record's
+ * size. */
+int16_t CbUnpackTurnMsg(uint8_t *lpb, int16_t *piPlr, MSGBIG *pmb)
+{
+    uint8_t *lpbParam;
+    uint8_t *lpbMax;
+    uint16_t grbit;
+    uint16_t w;
+    int16_t i;
+
+    *piPlr = (int16_t)(lpb[0] & 0x0f);
+    w = (uint16_t)(lpb[1] | (lpb[2] << 8));
+    pmb->iMsg = (int16_t)(w & 0x1ff);
+    pmb->wGoto = (int16_t)(lpb[3] | (lpb[4] << 8));
+    memset(pmb->rgParam, 0, sizeof(pmb->rgParam));
+    lpbParam = lpb + cbMsgTurn;
+    lpbMax = lpbParam + (lpb[0] >> 4);
+    grbit = (uint16_t)(w >> 9);
+    for (i = 0; i < 7 && lpbParam < lpbMax; i++, grbit >>= 1)
+    {
+        if (grbit & 1)
+        {
+            pmb->rgParam[i] = (int16_t)(lpbParam[0] | (lpbParam[1] << 8));
+            lpbParam += 2;
+        }
+        else
+        {
+            pmb->rgParam[i] = *lpbParam++;
+        }
+    }
+    return (int16_t)(cbMsgTurn + (lpb[0] >> 4));
+}
+
+/* Render lpMsg's queued messages into rgmd[iPlr] for each recipient below
+ * cplr. Each template is decoded once however many players get it. A
+ * message that exactly fills the rest of a digest fits. Returns the number
+ * of messages rendered. */
+int16_t CFormatTurnMsgs(MSGDIGEST *rgmd, int16_t cplr)
+{
+    MSGDIGEST *pmd;
+    MSGBIG mb;
+    uint8_t *lpb;
+    uint8_t *lpbMax;
+    int16_t iPlr;
+    int16_t cchLeft;
+    int16_t cch;
+    int16_t cRendered;
+
+    for (iPlr = 0; iPlr < cplr; iPlr++)
+    {
+        rgmd[iPlr].cMsg = 0;
+        rgmd[iPlr].cMsgTrunc = 0;
+        rgmd[iPlr].cMsgBad = 0;
+        rgmd[iPlr].cch = 0;
+    }
+    cRendered = 0;
+    lpb = (uint8_t *)lpMsg;
+    lpbMax = lpb + imemMsgCur;
+    while (lpb + cbMsgTurn <= lpbMax)
+    {
+        lpb += CbUnpackTurnMsg(lpb, &iPlr, &mb);
+        if (lpb > lpbMax || iPlr >= cplr || mb.iMsg == idmMsgDeleted)
+        {
+            continue;
+        }
+        pmd = &rgmd[iPlr];
+        if (pmd->cMsgTrunc > 0)
+        {
+            pmd->cMsgTrunc++;
+            continue;
+        }
+        cchLeft = (int16_t)(pmd->cchMax - pmd->cch);
+        cch = CchFormatString(pmd->pch + pmd->cch, cchLeft, PszGetCompressedMessage(mb.iMsg), mb.rgParam);
+        if (cch == cchFmtBad)
+        {
+            pmd->cMsgBad++;
+            continue;
+        }
+        if (cch < 0)
+        {
+            pmd->cMsgTrunc++;
+            continue;
+        }
+        pmd->cch = (int16_t)(pmd->cch + cch + 1);
+        pmd->cMsg++;
+        cRendered++;
+    }
+    return cRendered;
+}
@@ -0,0 +1,58 @@
+#ifndef MSGFMT_H_
+#define MSGFMT_H_
+
+#include "types.h"
+
+/*
+ * Message formatting into caller buffers.
+ *
+ * PszFormatString and PszFormatMessage expand a template into one static
+ * buffer, so a second message overwrites the first. CchFormatString does
+ * the same expansion into a buffer the caller passes in. It allocates
+ * nothing and keeps no state between calls.
+ *
+ * A template is plain text with backslash escapes (\p planet, \l player,
+ * \i number, ...). Each escape takes the next parameter. The escape's
+ * letter picks its handler in vrgpfnFmtEsc. The templates use escapes
+ * whose expansion is not decompiled yet (\n location, \V quantity, \X and
+ * more). An escape with no handler makes the whole expansion fail with
+ * cchFmtBad rather than print a sentence with a hole in it.
+ *
+ * CFormatTurnMsgs renders the messages the host queued this turn (the
+ * MSGTURN records in lpMsg) for every player in one pass. Each player's
+ * messages go into that player's MSGDIGEST, one after another, each one
+ * NUL-terminated. The digest buffers belong to the caller; they can come
+ * from the htMsg heap or the stack. Messages stay in order: once one does
+ * not fit, the player's later ones are left out too.
+ */
+
+#define cchFmtEscMax 128
+#define cbMsgTurn 5 /* packed MSGTURN, before the parameters */
+#define cchFmtTrunc (-1) /* did not fit */
+#define cchFmtBad (-2)   /* an escape that cannot be expanded */
+
+/* Writes at most cchOut chars (no NUL) for the escape and returns how many
+ * it wrote: cchFmtTrunc if the text was longer, cchFmtBad if the parameter
+ * is out of range. *ppParams points at the escape's parameter; move it
+ * past whatever the escape uses. */
+typedef int16_t (*PFNFMTESC)(char *pchOut, int16_t cchOut, int16_t **ppParams);
+
+typedef struct _msgdigest
+{
+    int16_t cMsg;      /* messages rendered */
+    int16_t cMsgTrunc; /* messages that did not fit, and those after */
+    int16_t cMsgBad;   /* messages CchFormatString could not expand */
+    int16_t cch;       /* chars used in pch, NULs included */
+    int16_t cchMax;
+    char *pch;
+} MSGDIGEST;
+
+/* globals */
+extern PFNFMTESC vrgpfnFmtEsc[cchFmtEscMax];
+
+/* functions */
+int16_t CchFormatString(char *pszOut, int16_t cchOut, char *pszFormat, int16_t *pParams);
+int16_t CbUnpackTurnMsg(uint8_t *lpb, int16_t *piPlr, MSGBIG *pmb);
+int16_t CFormatTurnMsgs(MSGDIGEST *rgmd, int16_t cplr);
+
+#endif /* MSGFMT_H_ */
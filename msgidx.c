@@ -0,0 +1,362 @@
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "types.h"
+#include "globals.h"
+
+#include "msgidx.h"
+#include "msg.h"
+#include "msgfmt.h"
+
+/* globals */
+MSGIDX vmsgidx;
+MSGTURNIDX vmsgtidx;
+
+/* Size of the player-side record at lpb: MSGHDR, then rgcMsgArgs[iMsg]
+ * parameters, a word where grWord has the bit and a byte otherwise. */
+static uint16_t CbMsgHdrRecord(uint8_t *lpb)
+{
+    MSGHDR *lpmh;
+    uint16_t cb;
+    uint16_t u;
+    int16_t i;
+
+    lpmh = (MSGHDR *)lpb;
+    cb = sizeof(MSGHDR);
+    u = lpmh->grWord;
+    for (i = 0; i < rgcMsgArgs[lpmh->iMsg]; i++, u >>= 1)
+    {
+        cb = (uint16_t)(cb + 1 + (u & 1));
+    }
+    return cb;
+}
+
+static int16_t FMsgFiltered(int16_t idm)
+{
+    return (int16_t)((bitfMsgFiltered[idm >> 3] >> (idm & 7)) & 1);
+}
+
+/* Index the cMsg records in lpMsg. */
+int16_t FIndexMessages(MSGIDX *pmi)
+{
+    uint8_t *lpb;
+    uint16_t ib;
+    int16_t i;
+    size_t cb;
+
+    FreeMsgIndex(pmi);
+    cb = (size_t)(cMsg > 0 ? cMsg : 1) * (sizeof(uint16_t) + 3 * sizeof(int16_t));
+    pmi->pvBlock = malloc(cb);
+    if (pmi->pvBlock == NULL)
+    {
+        return 0;
+    }
+    pmi->rgib = (uint16_t *)pmi->pvBlock;
+    pmi->rgidm = (int16_t *)(pmi->rgib + (cMsg > 0 ? cMsg : 1));
+    pmi->rgiShown = pmi->rgidm + (cMsg > 0 ? cMsg : 1);
+    pmi->rgiHidden = pmi->rgiShown + (cMsg > 0 ? cMsg : 1);
+
+    lpb = (uint8_t *)lpMsg;
+    ib = 0;
+    for (i = 0; i < cMsg; i++)
+    {
+        if (ib + sizeof(MSGHDR) > (uint16_t)imemMsgCur)
+        {
+            FreeMsgIndex(pmi);
+            return 0;
+        }
+        pmi->rgib[i] = ib;
+        pmi->rgidm[i] = ((MSGHDR *)(lpb + ib))->iMsg;
+        ib = (uint16_t)(ib + CbMsgHdrRecord(lpb + ib));
+    }
+    pmi->cMsg = cMsg;
+    pmi->fValid = 1;
+    RefilterMsgIndex(pmi);
+    return 1;
+}
+
+/* Make pmi match lpMsg and the filters. */
+int16_t FSyncMsgIndex(MSGIDX *pmi)
+{
+    if (!pmi->fValid || pmi->cMsg != cMsg)
+    {
+        return FIndexMessages(pmi);
+    }
+    if (memcmp(pmi->bitfFiltered, bitfMsgFiltered, sizeof(pmi->bitfFiltered)) != 0)
+    {
+        RefilterMsgIndex(pmi);
+    }
+    return 1;
+}
+
+/* Re-split the messages after bitfMsgFiltered changed. */
+void RefilterMsgIndex(MSGIDX *pmi)
+{
+    int16_t i;
+
+    memcpy(pmi->bitfFiltered, bitfMsgFiltered, sizeof(pmi->bitfFiltered));
+    pmi->cShown = 0;
+    pmi->cHidden = 0;
+    for (i = 0; i < pmi->cMsg; i++)
+    {
+        if (FMsgFiltered(pmi->rgidm[i]))
+        {
+            pmi->rgiHidden[pmi->cHidden++] = i;
+        }
+        else
+        {
+            pmi->rgiShown[pmi->cShown++] = i;
+        }
+    }
+}
+
+/* Position of the first entry in rgi greater than iMsg. */
+static int16_t IUpperBound(int16_t *rgi, int16_t c, int16_t iMsg)
+{
+    int16_t iLo;
+    int16_t iHi;
+    int16_t iMid;
+
+    iLo = 0;
+    iHi = c;
+    while (iLo < iHi)
+    {
+        iMid = (int16_t)((iLo + iHi) >> 1);
+        if (rgi[iMid] <= iMsg)
+        {
+            iLo = (int16_t)(iMid + 1);
+        }
+        else
+        {
+            iHi = iMid;
+        }
+    }
+    return iLo;
+}
+
+/* The first filtered (fFiltered) or shown message after iMsg, -1 if none. */
+int16_t IMsgIndexNext(MSGIDX *pmi, int16_t iMsg, int16_t fFiltered)
+{
+    int16_t *rgi;
+    int16_t c;
+    int16_t i;
+
+    rgi = fFiltered ? pmi->rgiHidden : pmi->rgiShown;
+    c = fFiltered ? pmi->cHidden : pmi->cShown;
+    i = IUpperBound(rgi, c, iMsg);
+    return i < c ? rgi[i] : -1;
+}
+
+/* The last filtered (fFiltered) or shown message before iMsg, -1 if none. */
+int16_t IMsgIndexPrev(MSGIDX *pmi, int16_t iMsg, int16_t fFiltered)
+{
+    int16_t *rgi;
+    int16_t c;
+    int16_t i;
+
+    rgi = fFiltered ? pmi->rgiHidden : pmi->rgiShown;
+    c = fFiltered ? pmi->cHidden : pmi->cShown;
+    i = IUpperBound(rgi, c, (int16_t)(iMsg - 1));
+    return i > 0 ? rgi[i - 1] : -1;
+}
+
+void FreeMsgIndex(MSGIDX *pmi)
+{
+    free(pmi->pvBlock);
+    memset(pmi, 0, sizeof(MSGIDX));
+}
+
+static int32_t LMsgKey(int16_t iMsg, int16_t iObj)
+{
+    return ((int32_t)iMsg << 16) | (uint16_t)iObj;
+}
+
+/* Position of the first key in rgmk not below lKey. */
+static int16_t ILowerBoundKey(MSGKEY *rgmk, int16_t c, int32_t lKey)
+{
+    int16_t iLo;
+    int16_t iHi;
+    int16_t iMid;
+
+    iLo = 0;
+    iHi = c;
+    while (iLo < iHi)
+    {
+        iMid = (int16_t)((iLo + iHi) >> 1);
+        if (rgmk[iMid].lKey < lKey)
+        {
+            iLo = (int16_t)(iMid + 1);
+        }
+        else
+        {
+            iHi = iMid;
+        }
+    }
+    return iLo;
+}
+
+/* Index the MSGTURN records appended to lpMsg since the last call. */
+int16_t FSyncMsgTurnIndex(MSGTURNIDX *pmti)
+{
+    MSGKEY *rgmk;
+    MSGBIG mb;
+    uint8_t *lpb;
+    int32_t lKey;
+    int16_t iPlr;
+    int16_t cb;
+    int16_t i;
+
+    if (!pmti->fValid)
+    {
+        for (iPlr = 0; iPlr < 16; iPlr++)
+        {
+            pmti->rgcmk[iPlr] = 0;
+        }
+        pmti->ibIndexed = 0;
+        pmti->cbDead = 0;
+        pmti->fValid = 1;
+    }
+    lpb = (uint8_t *)lpMsg;
+    while (pmti->ibIndexed + cbMsgTurn <= (uint16_t)imemMsgCur)
+    {
+        cb = CbUnpackTurnMsg(lpb + pmti->ibIndexed, &iPlr, &mb);
+        if (mb.iMsg == idmMsgDeleted)
+        {
+            pmti->cbDead = (uint16_t)(pmti->cbDead + cb);
+        }
+        else
+        {
+            if (pmti->rgcmk[iPlr] == pmti->rgcmkMax[iPlr])
+            {
+                rgmk = (MSGKEY *)realloc(pmti->rgrgmk[iPlr],
+                                         (pmti->rgcmkMax[iPlr] + 32) * sizeof(MSGKEY));
+                if (rgmk == NULL)
+                {
+                    pmti->fValid = 0;
+                    return 0;
+                }
+                pmti->rgrgmk[iPlr] = rgmk;
+                pmti->rgcmkMax[iPlr] = (int16_t)(pmti->rgcmkMax[iPlr] + 32);
+            }
+            /* equal keys stay in record order */
+            rgmk = pmti->rgrgmk[iPlr];
+            lKey = LMsgKey(mb.iMsg, mb.wGoto);
+            i = ILowerBoundKey(rgmk, pmti->rgcmk[iPlr], lKey + 1);
+            memmove(&rgmk[i + 1], &rgmk[i], (pmti->rgcmk[iPlr] - i) * sizeof(MSGKEY));
+            rgmk[i].lKey = lKey;
+            rgmk[i].ib = pmti->ibIndexed;
+            pmti->rgcmk[iPlr]++;
+        }
+        pmti->ibIndexed = (uint16_t)(pmti->ibIndexed + cb);
+    }
+    return 1;
+}
+
+/* iPlr's queued copies of (iMsg, iObj): how many, and in *ppmk the first
+ * of them (they are adjacent). Keys of removed copies sort in front of any
+ * live ones, since removal takes every copy and later ones are inserted
+ * after their equals; they are skipped. */
+int16_t CFindTurnMsgs(MSGTURNIDX *pmti, int16_t iPlr, int16_t iMsg, int16_t iObj, MSGKEY **ppmk)
+{
+    MSGKEY *rgmk;
+    int32_t lKey;
+    int16_t i;
+    int16_t c;
+
+    *ppmk = NULL;
+    if (iPlr < 0 || iPlr >= 16 || !FSyncMsgTurnIndex(pmti))
+    {
+        return 0;
+    }
+    rgmk = pmti->rgrgmk[iPlr];
+    lKey = LMsgKey(iMsg, iObj);
+    i = ILowerBoundKey(rgmk, pmti->rgcmk[iPlr], lKey);
+    while (i < pmti->rgcmk[iPlr] && rgmk[i].lKey == lKey && rgmk[i].ib == ibMsgRemoved)
+    {
+        i++;
+    }
+    for (c = 0; i + c < pmti->rgcmk[iPlr] && rgmk[i + c].lKey == lKey; c++)
+    {
+    }
+    if (c > 0)
+    {
+        *ppmk = &rgmk[i];
+    }
+    return c;
+}
+
+/* Take iPlr's copies of (iMsg, iObj) out of the queue. The records are
+ * marked idmMsgDeleted in lpMsg and their keys left in place as
+ * tombstones, so a removal costs a lookup plus the copies removed. Once
+ * the dead records are half of lpMsg they are squeezed out in one pass. */
+int16_t CRemoveTurnMsgs(MSGTURNIDX *pmti, int16_t iPlr, int16_t iMsg, int16_t iObj)
+{
+    MSGKEY *pmk;
+    MSGBIG mb;
+    uint8_t *lpb;
+    int16_t iPlrMsg;
+    int16_t cDel;
+    int16_t i;
+
+    cDel = CFindTurnMsgs(pmti, iPlr, iMsg, iObj, &pmk);
+    for (i = 0; i < cDel; i++)
+    {
+        lpb = (uint8_t *)lpMsg + pmk[i].ib;
+        pmti->cbDead = (uint16_t)(pmti->cbDead + CbUnpackTurnMsg(lpb, &iPlrMsg, &mb));
+        lpb[1] = (uint8_t)(lpb[1] | (idmMsgDeleted & 0xff));
+        lpb[2] = (uint8_t)(lpb[2] | (idmMsgDeleted >> 8));
+        pmk[i].ib = ibMsgRemoved;
+    }
+    cMsg = (int16_t)(cMsg - cDel);
+    if (cDel > 0 && pmti->cbDead * 2 > imemMsgCur)
+    {
+        CompactTurnMsgs(pmti);
+    }
+    return cDel;
+}
+
+/* Squeeze records marked idmMsgDeleted out of lpMsg. */
+void CompactTurnMsgs(MSGTURNIDX *pmti)
+{
+    MSGBIG mb;
+    uint8_t *lpb;
+    uint16_t ibSrc;
+    uint16_t ibDst;
+    int16_t iPlr;
+    int16_t cb;
+
+    lpb = (uint8_t *)lpMsg;
+    ibDst = 0;
+    for (ibSrc = 0; ibSrc + cbMsgTurn <= (uint16_t)imemMsgCur; ibSrc = (uint16_t)(ibSrc + cb))
+    {
+        cb = CbUnpackTurnMsg(lpb + ibSrc, &iPlr, &mb);
+        if (mb.iMsg == idmMsgDeleted)
+        {
+            continue;
+        }
+        if (ibDst != ibSrc)
+        {
+            memmove(lpb + ibDst, lpb + ibSrc, cb);
+        }
+        ibDst = (uint16_t)(ibDst + cb);
+    }
+    imemMsgCur = (int16_t)ibDst;
+    InvalidateMsgTurnIndex(pmti);
+}
+
+void InvalidateMsgTurnIndex(MSGTURNIDX *pmti)
+{
+    pmti->fValid = 0;
+}
+
+void FreeMsgTurnIndex(MSGTURNIDX *pmti)
+{
+    int16_t iPlr;
+
+    for (iPlr = 0; iPlr < 16; iPlr++)
+    {
+        free(pmti->rgrgmk[iPlr]);
+    }
+    memset(pmti, 0, sizeof(MSGTURNIDX));
+}
@@ -0,0 +1,88 @@
+#ifndef MSGIDX_H_
+#define MSGIDX_H_
+
+#include "types.h"
+
+/*
+ * Message indexes.
+ *
+ * lpMsg is a run of variable-length records, so reaching message n means
+ * walking the n records before it. IMsgNext and IMsgPrev walk it once per
+ * step over every filtered message in between, and the host walks it
+ * again for every FFindPlayerMessage. Late in a game that is thousands
+ * of records per click.
+ *
+ * MSGIDX is the player's side. ReadPlayerMessages leaves cMsg MSGHDR
+ * records in lpMsg. The index keeps each record's offset and idm, and
+ * splits the message numbers into two ascending lists: shown and filtered
+ * (by bitfMsgFiltered). FGetNMsgbig is then a lookup, and IMsgNext and
+ * IMsgPrev are a binary search in one list. FSyncMsgIndex rebuilds the
+ * index when cMsg changes and re-splits it when the filters change.
+ *
+ * MSGTURNIDX is the host's side. lpMsg holds the MSGTURN records being
+ * queued for every player. Each player has a list of (iMsg, iObj) keys
+ * with record offsets, kept sorted, so FFindPlayerMessage is a binary
+ * search. FRemovePlayerMessage marks the records it removes idmMsgDeleted
+ * and turns their keys into tombstones (ib = ibMsgRemoved); it moves
+ * nothing. CompactTurnMsgs squeezes the marked records out of lpMsg in one
+ * pass and drops the index, which the next lookup rebuilds. It runs when
+ * a removal leaves half of lpMsg dead, and whoever needs lpMsg to hold
+ * exactly cMsg records (writing it out) calls it first; readers such as
+ * CFormatTurnMsgs just skip marked records. Records appended to lpMsg are
+ * picked up on the next lookup. Anything else that moves records must call
+ * InvalidateMsgTurnIndex.
+ */
+
+#define idmMsgDeleted 0x1ff
+#define ibMsgRemoved 0xffff /* tombstone key: its record is marked deleted */
+
+typedef struct _msgidx
+{
+    int16_t fValid;
+    int16_t cMsg;       /* records indexed */
+    uint16_t *rgib;     /* message i's offset in lpMsg */
+    int16_t *rgidm;
+    int16_t *rgiShown;  /* messages not filtered, ascending */
+    int16_t cShown;
+    int16_t *rgiHidden; /* filtered messages, ascending */
+    int16_t cHidden;
+    uint8_t bitfFiltered[49]; /* bitfMsgFiltered when last split */
+    void *pvBlock;
+} MSGIDX;
+
+typedef struct _msgkey
+{
+    int32_t lKey; /* iMsg << 16 | (uint16_t)iObj */
+    uint16_t ib;  /* record offset in lpMsg */
+} MSGKEY;
+
+typedef struct _msgturnidx
+{
+    int16_t fValid;
+    uint16_t ibIndexed; /* lpMsg bytes indexed so far */
+    uint16_t cbDead;    /* bytes of lpMsg marked idmMsgDeleted */
+    int16_t rgcmk[16];
+    int16_t rgcmkMax[16];
+    MSGKEY *rgrgmk[16];
+} MSGTURNIDX;
+
+/* globals */
+extern MSGIDX vmsgidx;
+extern MSGTURNIDX vmsgtidx;
+
+/* functions */
+int16_t FIndexMessages(MSGIDX *pmi);
+int16_t FSyncMsgIndex(MSGIDX *pmi);
+void RefilterMsgIndex(MSGIDX *pmi);
+int16_t IMsgIndexNext(MSGIDX *pmi, int16_t iMsg, int16_t fFiltered);
+int16_t IMsgIndexPrev(MSGIDX *pmi, int16_t iMsg, int16_t fFiltered);
+void FreeMsgIndex(MSGIDX *pmi);
+
+int16_t FSyncMsgTurnIndex(MSGTURNIDX *pmti);
+int16_t CFindTurnMsgs(MSGTURNIDX *pmti, int16_t iPlr, int16_t iMsg, int16_t iObj, MSGKEY **ppmk);
+int16_t CRemoveTurnMsgs(MSGTURNIDX *pmti, int16_t iPlr, int16_t iMsg, int16_t iObj);
+void CompactTurnMsgs(MSGTURNIDX *pmti);
+void InvalidateMsgTurnIndex(MSGTURNIDX *pmti);
+void FreeMsgTurnIndex(MSGTURNIDX *pmti);
+
+#endif /* MSGIDX_H_ */
@@ -1,8 +1,15 @@
 
+#include <math.h>
+
 #include "types.h"
 
 #include "planet.h"
+#include "econsnap.h"
 #include "globals.h"
+#include "produce.h"
+#include "race.h"
+#include "strings.h"
+#include "util.h"
 
 /* functions */
 void DrawPlanShip(uint16_t hdc, int16_t grbit)
@@ -264,8 +271,46 @@ int16_t CResourcesAtPlanet(PLANET *lppl, int16_t iplr)
     /* block (block) @ MEMORY_PLANET:0x7990 */
     /* label LFinishUp @ MEMORY_PLANET:0x7af5 */
 
-    /* TODO: implement */
-    return 0;
+    lPop = lppl->rgwtMin[3];
+    if (lPop == 0)
+    {
+        return 0;
+    }
+    iEff = GetRaceStat(&rgplr[iplr], 0);
+    lPopMax = CalcPlanetMaxPop(lppl->id, iplr);
+    if (lPop > lPopMax)
+    {
+        /* colonists past capacity only pull half their weight */
+        lPop = lPopMax + (lPop - lPopMax) / 2;
+        if (lPop > lPopMax * 2)
+        {
+            lPop = lPopMax * 2;
+        }
+    }
+    if (GetRaceStat(&rgplr[iplr], 0xe) == 8)
+    {
+        iEnergy = rgplr[iplr].rgTech[0];
+        if (iEnergy < 1)
+        {
+            iEnergy = 1;
+        }
+        cRes = (int16_t)sqrt((double)iEnergy * (double)lPop / (double)iEff);
+    }
+    else
+    {
+        cFact = CMaxOperableFactories(lppl, iplr, 0);
+        if ((int16_t)lppl->cFactories < cFact)
+        {
+            cFact = (int16_t)lppl->cFactories;
+        }
+        pctVal = GetRaceStat(&rgplr[iplr], 1);
+        cRes = (int16_t)(lPop / iEff + ((int32_t)cFact * pctVal + 9) / 10);
+    }
+    if (cRes == 0)
+    {
+        cRes = 1;
+    }
+    return cRes;
 }
 
 int16_t CMaxOperableDefenses(PLANET *lppl, int16_t iplr, int16_t fNextYear)
@@ -288,8 +333,45 @@ char *PszProductionETA(PLANET *lppl, PLPROD *lpplprod, int16_t iItem, int16_t *e
     /* debug symbols */
     /* block (block) @ MEMORY_PLANET:0x3160 */
 
-    /* TODO: implement */
-    return NULL;
+    EstimateItemProdSched(lppl, lpplprod, iItem, &iTurnBegin, &iTurnEnd);
+    if (etaFirst != NULL)
+    {
+        *etaFirst = iTurnBegin;
+    }
+    if (etaLast != NULL)
+    {
+        *etaLast = iTurnEnd;
+    }
+
+    if (iTurnBegin <= 0)
+    {
+        return PszGetCompressedString(idsSkipped);
+    }
+    if (iTurnBegin >= 100)
+    {
+        return PszGetCompressedString(idsNever);
+    }
+    if (iTurnEnd >= 100)
+    {
+        ids = idsPercentQuestionYears;
+        snprintf(szWork, sizeof(szWork), PszGetCompressedString(ids), (int)iTurnBegin);
+    }
+    else if (iTurnEnd <= iTurnBegin)
+    {
+        ids = idsPercentYear;
+        c = (int16_t)snprintf(szWork, sizeof(szWork), PszGetCompressedString(ids), (int)iTurnBegin);
+        if (iTurnBegin != 1 && c > 0 && c < (int16_t)sizeof(szWork) - 1)
+        {
+            szWork[c] = 's';
+            szWork[c + 1] = '\0';
+        }
+    }
+    else
+    {
+        ids = idsPercentPercentYears;
+        snprintf(szWork, sizeof(szWork), PszGetCompressedString(ids), (int)iTurnBegin, (int)iTurnEnd);
+    }
+    return szWork;
 }
 
 int16_t FCanTerraformLppl(PLANET *lppl, int16_t *rgEnvMin, int16_t *rgEnvMax, int16_t *rgEnvCost, int16_t fHelp)
@@ -352,8 +434,27 @@ int16_t CMaxOperableFactories(PLANET *lppl, int16_t iplr, int16_t fNextYear)
     int32_t lPop;
     int16_t iEff;
 
-    /* TODO: implement */
-    return 0;
+    cMax = CMaxFactories(lppl, iplr);
+    iEff = GetRaceStat(&rgplr[iplr], 3);
+    lPop = lppl->rgwtMin[3];
+    if (fNextYear)
+    {
+        lPop += ChgPopFromPlanet(lppl, 0);
+    }
+    cCur = lPop * iEff / 100;
+    if (cCur < cMax)
+    {
+        cMax = (int16_t)cCur;
+    }
+    if (cMax < 1)
+    {
+        cMax = 1;
+    }
+    if (GetRaceStat(&rgplr[iplr], 0xe) == 8)
+    {
+        cMax = 0;
+    }
+    return cMax;
 }
 
 int16_t CMaxFactories(PLANET *lppl, int16_t iplr)
@@ -362,8 +463,18 @@ int16_t CMaxFactories(PLANET *lppl, int16_t iplr)
     int32_t lPopMax;
     int16_t iEff;
 
-    /* TODO: implement */
-    return 0;
+    lPopMax = CalcPlanetMaxPop(lppl->id, iplr);
+    iEff = GetRaceStat(&rgplr[iplr], 3);
+    cMax = lPopMax * iEff / 100;
+    if (cMax < 10)
+    {
+        cMax = 10;
+    }
+    if (GetRaceStat(&rgplr[iplr], 0xe) == 8)
+    {
+        cMax = 0;
+    }
+    return (int16_t)cMax;
 }
 
 void DrawMassWarpGauge(uint16_t hdc, RECT *prc, int16_t iBest, int16_t iCur)
@@ -422,8 +533,20 @@ int16_t CMaxMines(PLANET *lppl, int16_t iplr)
     int32_t lPopMax;
     int16_t iEff;
 
-    /* TODO: implement */
-    return 0;
+    /* Not decompiled: invented as CMaxFactories driven by the
+     * mines-operated stat. */
+    lPopMax = CalcPlanetMaxPop(lppl->id, iplr);
+    iEff = GetRaceStat(&rgplr[iplr], 6);
+    cMax = lPopMax * iEff / 100;
+    if (cMax < 10)
+    {
+        cMax = 10;
+    }
+    if (GetRaceStat(&rgplr[iplr], 0xe) == 8)
+    {
+        cMax = 0;
+    }
+    return (int16_t)cMax;
 }
 
 int16_t FProdIsTerra(PROD *lpprod)
@@ -589,12 +712,50 @@ int32_t CalcPlanetMaxPop(int16_t idpl, int16_t iplr)
     int32_t lMaxPop;
     int32_t pctDesire;
     int16_t ihuldef;
+    PLANET *lppl;
+    PLAYER *pplr = &rgplr[iplr];
 
     /* debug symbols */
     /* block (block) @ MEMORY_PLANET:0x70ce */
 
-    /* TODO: implement */
-    return 0;
+    lppl = LpplFromId(idpl);
+    if (lppl == NULL)
+    {
+        return 0;
+    }
+    pl = *lppl;
+    if (GetRaceStat(pplr, 0xe) == 8)
+    {
+        /* AR lives on its starbase: capacity comes from the hull. */
+        if (pl.iPlayer != iplr || !pl.fStarbase || rglpshdefSB[iplr] == NULL)
+        {
+            return 0;
+        }
+        ihuldef = ((SHDEF *)((uint8_t *)rglpshdefSB[iplr] + (int32_t)pl.isb * 0x93))->hul.ihuldef - 0x20;
+        if (ihuldef < 0 || ihuldef >= 5)
+        {
+            return 0;
+        }
+        lMaxPop = rglPopMac[ihuldef];
+    }
+    else
+    {
+        pctDesire = PctPlanetDesirability(&pl, iplr);
+        lMaxPop = pctDesire < 5 ? 500 : pctDesire * 100;
+        if (GetRaceStat(pplr, 0xe) == 0)
+        {
+            lMaxPop -= lMaxPop / 2;
+        }
+        else if (GetRaceStat(pplr, 0xe) == 9)
+        {
+            lMaxPop += lMaxPop / 5;
+        }
+    }
+    if (GetRaceGrbit(pplr, 9))
+    {
+        lMaxPop += lMaxPop / 10;
+    }
+    return lMaxPop;
 }
 
 void FillShipDD(int16_t idSkip)
@@ -655,6 +816,9 @@ void UninhabitPlanet(PLANET *lppl)
     /* block (block) @ MEMORY_PLANET:0x876c */
 
     /* TODO: implement */
+
+    /* the planet lost its owner and population */
+    InvalidateEconTable(&vecon);
 }
 
 int16_t StargateRangeFromLppl(PLANET *lppl, int16_t iplr, int16_t ish)
@@ -723,8 +887,28 @@ int16_t CMaxOperableMines(PLANET *lppl, int16_t iplr, int16_t fNextYear)
     int32_t lPop;
     int16_t iEff;
 
-    /* TODO: implement */
-    return 0;
+    /* Not decompiled: invented as CMaxOperableFactories with the mine stats. */
+    cMax = CMaxMines(lppl, iplr);
+    iEff = GetRaceStat(&rgplr[iplr], 6);
+    lPop = lppl->rgwtMin[3];
+    if (fNextYear)
+    {
+        lPop += ChgPopFromPlanet(lppl, 0);
+    }
+    cCur = lPop * iEff / 100;
+    if (cCur < cMax)
+    {
+        cMax = (int16_t)cCur;
+    }
+    if (cMax < 1)
+    {
+        cMax = 1;
+    }
+    if (GetRaceStat(&rgplr[iplr], 0xe) == 8)
+    {
+        cMax = 0;
+    }
+    return cMax;
 }
 
 int16_t CMinesOperating(PLANET *lppl)
@@ -733,8 +917,15 @@ int16_t CMinesOperating(PLANET *lppl)
     int16_t cMinesOp;
     int16_t cMines;
 
-    /* TODO: implement */
-    return 0;
+    /* Not decompiled: invented as the lesser of the mines built and CMaxOperableMines. */
+    iplr = lppl->iPlayer;
+    if (iplr == -1)
+    {
+        return 0;
+    }
+    cMines = (int16_t)lppl->cMines;
+    cMinesOp = CMaxOperableMines(lppl, iplr, 0);
+    return cMines < cMinesOp ? cMines : cMinesOp;
 }
 
 void PlanetClick(int16_t x, int16_t y, int16_t sks, int16_t fRightBtn)
@@ -804,6 +995,13 @@ int16_t CFactoriesOperating(PLANET *lppl)
     int16_t cFacts;
     int16_t cFactsOp;
 
-    /* TODO: implement */
-    return 0;
+    /* Not decompiled: invented as the lesser of the factories built and CMaxOperableFactories. */
+    iplr = lppl->iPlayer;
+    if (iplr == -1)
+    {
+        return 0;
+    }
+    cFacts = (int16_t)lppl->cFactories;
+    cFactsOp = CMaxOperableFactories(lppl, iplr, 0);
+    return cFacts < cFactsOp ? cFacts : cFactsOp;
 }
@@ -0,0 +1,229 @@
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "types.h"
+#include "globals.h"
+
+#include "plidx.h"
+#include "file.h"
+#include "utilgen.h"
+
+/* globals */
+PLIDX vplidx = {0};
+
+#define rtEOF 0
+#define rtBOF 8
+
+static int16_t FAllocPlanetIndex(PLIDX *pidx, int16_t cpl)
+{
+    uint8_t *pb;
+
+    pb = (uint8_t *)malloc((size_t)cpl * (3 * sizeof(int32_t) + sizeof(int16_t) + 2 * sizeof(uint8_t)));
+    if (pb == NULL)
+    {
+        return 0;
+    }
+    pidx->pvBlock = pb;
+    pidx->rgib = (int32_t *)pb;
+    pb += cpl * sizeof(int32_t);
+    pidx->rglSeed1 = (int32_t *)pb;
+    pb += cpl * sizeof(int32_t);
+    pidx->rglSeed2 = (int32_t *)pb;
+    pb += cpl * sizeof(int32_t);
+    pidx->rgcb = (int16_t *)pb;
+    pb += cpl * sizeof(int16_t);
+    pidx->rgrt = pb;
+    pb += cpl;
+    pidx->rgfLoaded = pb;
+    pidx->cpl = cpl;
+    memset(pidx->rgfLoaded, 0, cpl);
+    memset(pidx->rgib, 0xff, cpl * sizeof(int32_t));
+    return 1;
+}
+
+/* The walk itself. The XOR stream is the global one; the caller saves it. */
+static int16_t FScanPlanetRecords(PLIDX *pidx)
+{
+    RTBOF rtbof;
+    HDR hdr;
+    uint8_t rgb[2];
+    int32_t ib;
+    int32_t lSeed1;
+    int32_t lSeed2;
+    uint32_t lXor;
+    int16_t id;
+
+    if (fread(&hdr, sizeof(HDR), 1, pidx->fp) != 1 || hdr.rt != rtBOF || hdr.cb < sizeof(RTBOF) ||
+        fread(&rtbof, sizeof(RTBOF), 1, pidx->fp) != 1 || fseek(pidx->fp, hdr.cb - sizeof(RTBOF), SEEK_CUR) != 0 ||
+        memcmp(rtbof.rgid, "J3J3", 4) != 0)
+    {
+        return 0;
+    }
+    SetFileXorStream(rtbof.lidGame, rtbof.lSaltTime, (int16_t)rtbof.turn, rtbof.iPlayer, (int16_t)rtbof.fCrippled);
+
+    for (;;)
+    {
+        if (fread(&hdr, sizeof(HDR), 1, pidx->fp) != 1)
+        {
+            return 0;
+        }
+        if (hdr.rt == rtEOF)
+        {
+            return 1;
+        }
+        if ((hdr.rt != rtPlanet && hdr.rt != rtPlanetPart) || hdr.cb < 4)
+        {
+            SkipFileXor((hdr.cb + 3) >> 2);
+            if (fseek(pidx->fp, hdr.cb, SEEK_CUR) != 0)
+            {
+                return 0;
+            }
+            continue;
+        }
+
+        /* only the first word is decrypted: id:11, iPlayer:5 */
+        ib = ftell(pidx->fp);
+        GetFileSeeds(&lSeed1, &lSeed2);
+        if (fread(rgb, 1, 2, pidx->fp) != 2)
+        {
+            return 0;
+        }
+        lXor = LGetNextFileXor();
+        id = (int16_t)(((rgb[0] ^ (lXor & 0xff)) | ((rgb[1] ^ ((lXor >> 8) & 0xff)) << 8)) & 0x7ff);
+        SkipFileXor(((hdr.cb + 3) >> 2) - 1);
+        if (fseek(pidx->fp, hdr.cb - 2, SEEK_CUR) != 0)
+        {
+            return 0;
+        }
+        if (id >= pidx->cpl)
+        {
+            continue;
+        }
+        pidx->rgib[id] = ib;
+        pidx->rglSeed1[id] = lSeed1;
+        pidx->rglSeed2[id] = lSeed2;
+        pidx->rgcb[id] = (int16_t)hdr.cb;
+        pidx->rgrt[id] = (uint8_t)hdr.rt;
+    }
+}
+
+/* Index the planet records of a game file open at its BOF. lpPlanets
+ * must hold game.cPlanMax planets; they are reset to bare ids unless
+ * fPreInited. Takes over fp (FreePlanetIndex closes it). */
+int16_t FIndexPlanetRecords(PLIDX *pidx, FILE *fp, int16_t iPlayer, int16_t fHistory, int16_t fPreInited)
+{
+    int32_t lSeed1Sav;
+    int32_t lSeed2Sav;
+    int16_t fOk;
+    int16_t id;
+
+    memset(pidx, 0, sizeof(PLIDX));
+    pidx->fp = fp;
+    pidx->iPlayer = iPlayer;
+    pidx->fHistory = fHistory;
+    pidx->fPreInited = fPreInited;
+    if (fp == NULL || lpPlanets == NULL || !FAllocPlanetIndex(pidx, game.cPlanMax))
+    {
+        FreePlanetIndex(pidx);
+        return 0;
+    }
+    GetFileSeeds(&lSeed1Sav, &lSeed2Sav);
+    fOk = FScanPlanetRecords(pidx);
+    SetFileSeeds(lSeed1Sav, lSeed2Sav);
+    if (!fOk)
+    {
+        FreePlanetIndex(pidx);
+        return 0;
+    }
+    for (id = 0; id < pidx->cpl && !fPreInited; id++)
+    {
+        memset(&lpPlanets[id], 0, sizeof(PLANET));
+        lpPlanets[id].id = id;
+        lpPlanets[id].iPlayer = -1;
+    }
+    cPlanet = pidx->cpl;
+    pidx->fValid = 1;
+    return 1;
+}
+
+/* lpPlanets[id], decoded from the file the first time it is asked for. */
+PLANET *LpplIndexedPlanet(PLIDX *pidx, int16_t id)
+{
+    static uint8_t rgbSav[sizeof(rgbCur)];
+    PLANET *lppl;
+    PLANET plSav;
+    HDR hdrSav;
+    int32_t lSeed1Sav;
+    int32_t lSeed2Sav;
+    int16_t cb;
+
+    if (id < 0 || id >= pidx->cpl)
+    {
+        return NULL;
+    }
+    lppl = &lpPlanets[id];
+    if (pidx->rgfLoaded[id])
+    {
+        return lppl;
+    }
+    pidx->rgfLoaded[id] = 1;
+    pidx->cplLoaded++;
+    if (pidx->rgib[id] < 0)
+    {
+        return lppl;
+    }
+
+    /* FReadPlanet reads hdrCur/rgbCur; whoever is mid-record keeps theirs */
+    hdrSav = hdrCur;
+    memcpy(rgbSav, rgbCur, hdrCur.cb);
+    GetFileSeeds(&lSeed1Sav, &lSeed2Sav);
+
+    cb = pidx->rgcb[id];
+    if (fseek(pidx->fp, pidx->rgib[id], SEEK_SET) == 0 && fread(rgbCur, 1, cb, pidx->fp) == (size_t)cb)
+    {
+        hdrCur.rt = pidx->rgrt[id];
+        hdrCur.cb = (uint16_t)cb;
+        SetFileSeeds(pidx->rglSeed1[id], pidx->rglSeed2[id]);
+        XorFileBuf((uint8_t *)rgbCur, cb);
+
+        /* iPlayer only picks the first-sighting messages; decode as
+         * nobody and set fFirstYear the way the player's load would */
+        plSav = *lppl;
+        if (!FReadPlanet(-1, lppl, pidx->fHistory, pidx->fPreInited))
+        {
+            *lppl = plSav;
+        }
+        else if (!pidx->fHistory && pidx->iPlayer != -1)
+        {
+            lppl->fFirstYear = !pidx->fPreInited || (plSav.fFirstYear && plSav.turn == game.turn);
+        }
+    }
+
+    SetFileSeeds(lSeed1Sav, lSeed2Sav);
+    memcpy(rgbCur, rgbSav, hdrSav.cb);
+    hdrCur = hdrSav;
+    return lppl;
+}
+
+/* Decode whatever is left, for code that walks lpPlanets itself. */
+int16_t FLoadAllIndexedPlanets(PLIDX *pidx)
+{
+    int16_t id;
+
+    for (id = 0; id < pidx->cpl && pidx->cplLoaded < pidx->cpl; id++)
+    {
+        (void)LpplIndexedPlanet(pidx, id);
+    }
+    return (int16_t)(pidx->cplLoaded == pidx->cpl);
+}
+
+void FreePlanetIndex(PLIDX *pidx)
+{
+    if (pidx->fp != NULL)
+    {
+        fclose(pidx->fp);
+    }
+    free(pidx->pvBlock);
+    memset(pidx, 0, sizeof(PLIDX));
+}
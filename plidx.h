@@ -0,0 +1,63 @@
+#ifndef PLIDX_H_
+#define PLIDX_H_
+
+#include <stdio.h>
+
+#include "types.h"
+
+/*
+ * Lazily decoded planets.
+ *
+ * Loading a game decodes every planet record with FReadPlanet before
+ * anything can look at one. A tool that wants one player's score or a
+ * single planet's report pays for all of them. PLIDX makes one quick pass
+ * over the file instead. For each planet record it reads the 2-byte
+ * header and the first word of the payload (the planet id). It keeps the
+ * payload's offset and the XOR-stream seeds there. Then it skips the rest
+ * with fseek and SkipFileXor. A planet is read and decoded the first time
+ * LpplFromId asks for it.
+ *
+ * The caller allocates lpPlanets for game.cPlanMax planets; the index
+ * keeps it dense (cPlanet == game.cPlanMax) while it is active.
+ * Planets not decoded yet hold only their id and iPlayer -1, or, with
+ * fPreInited, whatever the caller put there (the history planets, as
+ * FLoadGame does before reading a player file). LpplFromId is the lazy
+ * path. Code that walks lpPlanets directly has to call
+ * FLoadAllIndexedPlanets first.
+ *
+ * A player view gets the same fFirstYear bits as an eager load, but no
+ * first-sighting messages: those go out in id order from FLoadGame, and
+ * sending them in whatever order planets are asked for would not match.
+ */
+
+#define rtPlanet 0x0d
+#define rtPlanetPart 0x0e
+
+typedef struct _plidx
+{
+    FILE *fp;
+    int16_t fValid;
+    int16_t iPlayer;  /* passed through to FReadPlanet */
+    int16_t fHistory;
+    int16_t fPreInited; /* lpPlanets held history planets */
+    int16_t cpl;      /* ids 0..cpl-1 */
+    int16_t cplLoaded;
+    int32_t *rgib;    /* payload offset by id, -1: no record */
+    int32_t *rglSeed1; /* XOR stream at the payload */
+    int32_t *rglSeed2;
+    int16_t *rgcb;    /* payload length */
+    uint8_t *rgrt;
+    uint8_t *rgfLoaded;
+    void *pvBlock;
+} PLIDX;
+
+/* globals */
+extern PLIDX vplidx;
+
+/* functions */
+int16_t FIndexPlanetRecords(PLIDX *pidx, FILE *fp, int16_t iPlayer, int16_t fHistory, int16_t fPreInited);
+PLANET *LpplIndexedPlanet(PLIDX *pidx, int16_t id);
+int16_t FLoadAllIndexedPlanets(PLIDX *pidx);
+void FreePlanetIndex(PLIDX *pidx);
+
+#endif /* PLIDX_H_ */
@@ -0,0 +1,490 @@
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "types.h"
+#include "globals.h"
+
+#include "prodeta.h"
+#include "mine.h"
+#include "planet.h"
+#include "turn2.h"
+#include "util.h"
+
+#define grobjAuto 1
+#define iItemAutoAlchemy 3
+
+/* globals */
+PFNBUILDPROD lpfnEtaBuildProd = CBuildProdItem;
+
+static PRODETA **rglpprodeta; /* indexed by planet id */
+static int16_t clpprodetaMax;
+static ETAPLR *rglpetaplr[16];
+
+static PRODETA *LpprodetaFromId(int16_t id)
+{
+    PRODETA **rglppe;
+    int16_t c;
+
+    if (id < 0)
+    {
+        return NULL;
+    }
+    if (id >= clpprodetaMax)
+    {
+        c = (int16_t)(id + 32);
+        rglppe = (PRODETA **)realloc(rglpprodeta, c * sizeof(PRODETA *));
+        if (rglppe == NULL)
+        {
+            return NULL;
+        }
+        memset(rglppe + clpprodetaMax, 0, (c - clpprodetaMax) * sizeof(PRODETA *));
+        rglpprodeta = rglppe;
+        clpprodetaMax = c;
+    }
+    if (rglpprodeta[id] == NULL)
+    {
+        rglpprodeta[id] = (PRODETA *)calloc(1, sizeof(PRODETA));
+    }
+    return rglpprodeta[id];
+}
+
+/* The owner's snapshot generation, bumped if its PLAYER record or any of
+ * its designs changed since the last look. 0 if out of memory. */
+static uint16_t WGenEtaPlayer(int16_t iPlayer)
+{
+    ETAPLR *petaplr;
+    uint8_t *lpbShdef;
+    uint8_t *lpbShdefSB;
+
+    petaplr = rglpetaplr[iPlayer];
+    if (petaplr == NULL)
+    {
+        petaplr = (ETAPLR *)calloc(1, sizeof(ETAPLR));
+        if (petaplr == NULL)
+        {
+            return 0;
+        }
+        rglpetaplr[iPlayer] = petaplr;
+    }
+    lpbShdef = (uint8_t *)rglpshdef[iPlayer];
+    lpbShdefSB = (uint8_t *)rglpshdefSB[iPlayer];
+    if (petaplr->wGen != 0 && memcmp(&petaplr->plr, &rgplr[iPlayer], sizeof(PLAYER)) == 0 &&
+        (lpbShdef == NULL || memcmp(petaplr->rgbShdef, lpbShdef, sizeof(petaplr->rgbShdef)) == 0) &&
+        (lpbShdefSB == NULL || memcmp(petaplr->rgbShdefSB, lpbShdefSB, sizeof(petaplr->rgbShdefSB)) == 0))
+    {
+        return petaplr->wGen;
+    }
+    memcpy(&petaplr->plr, &rgplr[iPlayer], sizeof(PLAYER));
+    if (lpbShdef != NULL)
+    {
+        memcpy(petaplr->rgbShdef, lpbShdef, sizeof(petaplr->rgbShdef));
+    }
+    if (lpbShdefSB != NULL)
+    {
+        memcpy(petaplr->rgbShdefSB, lpbShdefSB, sizeof(petaplr->rgbShdefSB));
+    }
+    petaplr->wGen = (uint16_t)(petaplr->wGen == 0xffff ? 1 : petaplr->wGen + 1);
+    return petaplr->wGen;
+}
+
+/* Room for a queue of cprod items. Returns 1 if the old checkpoints are
+ * still laid out the same way. */
+static int16_t FGrowProdEta(PRODETA *ppe, int16_t cprod, int16_t *pfKept)
+{
+    PROD *rgprodKey;
+    ETAITEM *rgitem;
+    PROD *rgprodCp;
+    PLPROD *lpplprod;
+    int16_t c;
+
+    *pfKept = 1;
+    if (cprod <= ppe->cprodMax && ppe->lpplprodWork != NULL)
+    {
+        return 1;
+    }
+    c = (int16_t)((cprod | 15) + 1);
+    rgprodKey = (PROD *)malloc(c * sizeof(PROD));
+    rgitem = (ETAITEM *)malloc(c * sizeof(ETAITEM));
+    rgprodCp = (PROD *)malloc((size_t)cEtaCpMax * c * sizeof(PROD));
+    lpplprod = (PLPROD *)malloc(sizeof(PLPROD) + c * sizeof(PROD));
+    if (rgprodKey == NULL || rgitem == NULL || rgprodCp == NULL || lpplprod == NULL)
+    {
+        free(rgprodKey);
+        free(rgitem);
+        free(rgprodCp);
+        free(lpplprod);
+        return 0;
+    }
+    free(ppe->rgprodKey);
+    free(ppe->rgitem);
+    free(ppe->rgprodCp);
+    free(ppe->lpplprodWork);
+    ppe->rgprodKey = rgprodKey;
+    ppe->rgitem = rgitem;
+    ppe->rgprodCp = rgprodCp;
+    ppe->lpplprodWork = lpplprod;
+    ppe->cprodMax = c;
+    *pfKept = 0;
+    return 1;
+}
+
+/* The checkpointed year at or before iPass. */
+static int16_t IPassEtaCp(int16_t iPass)
+{
+    return (int16_t)((iPass - 1) / dEtaCpPass * dEtaCpPass + 1);
+}
+
+/* Keep the state at the start of iPass if it is a checkpoint year. */
+static void SaveEtaCheckpoint(PRODETA *ppe, int16_t iPass, PLANET *ppl, PROD *pprodPartial)
+{
+    int16_t icp;
+
+    if ((iPass - 1) % dEtaCpPass != 0)
+    {
+        return;
+    }
+    icp = (int16_t)((iPass - 1) / dEtaCpPass);
+    memcpy(&ppe->rgcp[icp].pl, ppl, sizeof(PLANET));
+    ppe->rgcp[icp].prodPartial = *pprodPartial;
+    memcpy(&ppe->rgprodCp[icp * ppe->cprodMax], ppe->lpplprodWork->rgprod, ppe->cprod * sizeof(PROD));
+}
+
+/* One year of EstimateItemProdSched's loop, recording every item's answer
+ * instead of just one. */
+static void RunEtaPass(PRODETA *ppe, int16_t iPass, PLANET *ppl, PROD *pprodPartial)
+{
+    ETAITEM *pitem;
+    PROD *lpprod;
+    int32_t rglQuan[3];
+    int32_t rgRes[4];
+    int32_t cRes;
+    int32_t cResearch;
+    int16_t cBuilt;
+    int16_t mdStatus;
+    int16_t fAlchemy;
+    int16_t iMac;
+    int16_t i;
+    int16_t j;
+
+    iMac = ppe->cprod;
+    EstMineralsMined(ppl, rglQuan, -1, 1);
+    for (j = 0; j < 3; j++)
+    {
+        rgRes[j] = ppl->rgwtMin[j];
+    }
+    cRes = CResourcesAtPlanet(ppl, ppl->iPlayer);
+    cResearch = 0;
+    if (!ppl->fNoResearch)
+    {
+        cResearch = cRes * rgplr[ppl->iPlayer].pctResearch / 100;
+        cRes -= cResearch;
+    }
+    rgRes[3] = cRes;
+    if (iPass == 1)
+    {
+        ppe->cResPass1 = cRes;
+        ppe->cResearchPass1 = cResearch;
+    }
+
+    fAlchemy = 0;
+    for (i = -1; i < iMac; i++)
+    {
+        pitem = i >= 0 ? &ppe->rgitem[i] : NULL;
+        if (pitem != NULL && pitem->iPassReached == 0)
+        {
+            pitem->iPassReached = (uint8_t)iPass;
+        }
+        lpprod = i == -1 ? pprodPartial : &ppe->lpplprodWork->rgprod[i];
+        if (lpprod->cItem == 0)
+        {
+            continue;
+        }
+        if (lpprod->iItem == iItemAutoAlchemy && lpprod->grobj == grobjAuto)
+        {
+            if (i < iMac - 1)
+            {
+                /* auto alchemy only runs last; asked about directly it has no ETA */
+                if (pitem != NULL && pitem->iPassDone == 0)
+                {
+                    pitem->iFirst = -1;
+                    pitem->iLast = -1;
+                    pitem->iPassDone = (uint8_t)iPass;
+                }
+                fAlchemy = 1;
+                continue;
+            }
+            lpprod->cItem = 0x3fc;
+        }
+        mdStatus = 0;
+        cBuilt = lpfnEtaBuildProd(ppl, lpprod, i == -1 ? NULL : pprodPartial, rgRes, fAlchemy, &mdStatus, 0);
+        if (pitem != NULL && pitem->iPassDone == 0)
+        {
+            if (cBuilt > 0 && pitem->iFirst == 0)
+            {
+                pitem->iFirst = iPass;
+            }
+            if (mdStatus == 2)
+            {
+                if (pitem->iFirst != 0)
+                {
+                    pitem->iLast = (int16_t)(iPass - 1);
+                }
+                pitem->iPassDone = (uint8_t)iPass;
+            }
+            else if (mdStatus == 0 || mdStatus == 1)
+            {
+                pitem->iLast = iPass;
+                pitem->iPassDone = (uint8_t)iPass;
+            }
+        }
+        fAlchemy = 0;
+        if (lpprod->grobj == grobjAuto)
+        {
+            if (lpprod->iItem == 0 || lpprod->iItem == 8)
+            {
+                ppl->cMines += cBuilt;
+            }
+            else if (lpprod->iItem == 1 || lpprod->iItem == 7)
+            {
+                ppl->cFactories += cBuilt;
+            }
+        }
+        if (mdStatus > 4)
+        {
+            break;
+        }
+    }
+
+    for (j = 0; j < 3; j++)
+    {
+        ppl->rgwtMin[j] = rgRes[j];
+    }
+    ChgPopFromPlanet(ppl, 1);
+}
+
+static int16_t FAllEtaDone(PRODETA *ppe)
+{
+    int16_t i;
+
+    for (i = 0; i < ppe->cprod; i++)
+    {
+        if (ppe->rgitem[i].iPassDone == 0)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Forget everything decided in year iPass or later and, from index iprod
+ * on, everything at all. */
+static void RollBackEta(PRODETA *ppe, int16_t iPass, int16_t iprod)
+{
+    ETAITEM *pitem;
+    int16_t i;
+
+    for (i = 0; i < ppe->cprod; i++)
+    {
+        pitem = &ppe->rgitem[i];
+        if (i >= iprod)
+        {
+            memset(pitem, 0, sizeof(ETAITEM));
+            continue;
+        }
+        if (pitem->iPassReached >= iPass)
+        {
+            pitem->iPassReached = 0;
+        }
+        if (pitem->iPassDone >= iPass)
+        {
+            pitem->iPassDone = 0;
+            pitem->iLast = 0;
+        }
+        if (pitem->iPassDone == 0 && pitem->iFirst >= iPass)
+        {
+            pitem->iFirst = 0;
+        }
+    }
+}
+
+/* Bring the planet's schedule up to date with lppl and its queue, resuming
+ * from the last year that can't have changed. */
+PRODETA *LpprodetaSimulate(PLANET *lppl, PLPROD *lpplprod)
+{
+    PRODETA *ppe;
+    PLANET plKey;
+    PLANET pl;
+    PROD prodPartial;
+    int16_t cprod;
+    int16_t iprodDiff;
+    int16_t iPass;
+    int16_t fSame;
+    int16_t fKept;
+    int16_t icp;
+    uint16_t wGenPlr;
+
+    if (lpplprod == NULL)
+    {
+        lpplprod = lppl->lpplprod;
+    }
+    cprod = lpplprod != NULL ? lpplprod->iprodMac : 0;
+    if (lppl->iPlayer < 0 || lppl->iPlayer >= game.cPlayer)
+    {
+        return NULL;
+    }
+    ppe = LpprodetaFromId(lppl->id);
+    if (ppe == NULL)
+    {
+        return NULL;
+    }
+    wGenPlr = WGenEtaPlayer(lppl->iPlayer);
+    if (wGenPlr == 0)
+    {
+        return NULL;
+    }
+    memcpy(&plKey, lppl, sizeof(PLANET));
+    plKey.lpplprod = NULL;
+
+    /* Mining rounds with Random() while a turn is generated, so don't trust
+     * anything simulated under different conditions. */
+    fSame = ppe->fValid && !gd.fGeneratingTurn && ppe->turn == game.turn && ppe->wGenPlr == wGenPlr &&
+            memcmp(&ppe->plKey, &plKey, sizeof(PLANET)) == 0;
+    if (!FGrowProdEta(ppe, cprod, &fKept))
+    {
+        return NULL;
+    }
+    fSame = (int16_t)(fSame && fKept);
+
+    iPass = 1;
+    iprodDiff = 0;
+    if (fSame)
+    {
+        while (iprodDiff < cprod && iprodDiff < ppe->cprod &&
+               memcmp(&ppe->rgprodKey[iprodDiff], &lpplprod->rgprod[iprodDiff], sizeof(PROD)) == 0)
+        {
+            iprodDiff++;
+        }
+        if (cprod != ppe->cprod && iprodDiff > 0 && iprodDiff >= (cprod < ppe->cprod ? cprod : ppe->cprod))
+        {
+            /* the old or new last item stops being last, which matters to alchemy */
+            iprodDiff--;
+        }
+        if (iprodDiff == cprod && cprod == ppe->cprod)
+        {
+            return ppe;
+        }
+        iPass = iprodDiff < ppe->cprod && ppe->rgitem[iprodDiff].iPassReached != 0
+                    ? ppe->rgitem[iprodDiff].iPassReached
+                    : (int16_t)(ppe->cpass + 1);
+        iPass = IPassEtaCp(iPass);
+        RollBackEta(ppe, iPass, iprodDiff);
+    }
+    else
+    {
+        memcpy(&ppe->plKey, &plKey, sizeof(PLANET));
+        ppe->fValid = 1;
+        ppe->turn = game.turn;
+        ppe->wGenPlr = wGenPlr;
+    }
+
+    memset(ppe->rgitem + ppe->cprod, 0, (cprod > ppe->cprod ? cprod - ppe->cprod : 0) * sizeof(ETAITEM));
+    if (!fSame)
+    {
+        memset(ppe->rgitem, 0, cprod * sizeof(ETAITEM));
+    }
+    ppe->cprod = cprod;
+    if (cprod > 0)
+    {
+        memcpy(ppe->rgprodKey, lpplprod->rgprod, cprod * sizeof(PROD));
+    }
+
+    /* working queue: what the walk had done to the unchanged prefix by year
+     * iPass, then the caller's queue from the first edit on */
+    ppe->lpplprodWork->cbItem = sizeof(PROD);
+    ppe->lpplprodWork->iprodMax = (uint8_t)ppe->cprodMax;
+    ppe->lpplprodWork->iprodMac = (uint8_t)cprod;
+    if (iPass == 1)
+    {
+        memcpy(&pl, lppl, sizeof(PLANET));
+        memset(&prodPartial, 0, sizeof(PROD));
+        if (cprod > 0)
+        {
+            memcpy(ppe->lpplprodWork->rgprod, lpplprod->rgprod, cprod * sizeof(PROD));
+        }
+    }
+    else
+    {
+        icp = (int16_t)((iPass - 1) / dEtaCpPass);
+        memcpy(&pl, &ppe->rgcp[icp].pl, sizeof(PLANET));
+        prodPartial = ppe->rgcp[icp].prodPartial;
+        memcpy(ppe->lpplprodWork->rgprod, &ppe->rgprodCp[icp * ppe->cprodMax], iprodDiff * sizeof(PROD));
+        memcpy(ppe->lpplprodWork->rgprod + iprodDiff, lpplprod->rgprod + iprodDiff, (cprod - iprodDiff) * sizeof(PROD));
+    }
+    pl.lpplprod = ppe->lpplprodWork;
+
+    ppe->cpass = (int16_t)(iPass - 1);
+    while (iPass < cEtaPassMax)
+    {
+        SaveEtaCheckpoint(ppe, iPass, &pl, &prodPartial);
+        RunEtaPass(ppe, iPass, &pl, &prodPartial);
+        ppe->cpass = iPass++;
+        if (FAllEtaDone(ppe))
+        {
+            break;
+        }
+    }
+    SaveEtaCheckpoint(ppe, iPass, &pl, &prodPartial);
+    return ppe;
+}
+
+/* The answer EstimateItemProdSched gives for iItem. */
+void GetProdEtaItem(PRODETA *ppe, int16_t iItem, int16_t *piFirst, int16_t *piLast)
+{
+    ETAITEM *pitem;
+
+    if (iItem < 0)
+    {
+        /* not an item: the first year's resources, with research for -1 */
+        *piFirst = (int16_t)(ppe->cResPass1 + (iItem == -1 ? ppe->cResearchPass1 : 0));
+        *piLast = 0;
+        return;
+    }
+    if (iItem >= ppe->cprod || ppe->rgitem[iItem].iPassDone == 0)
+    {
+        *piFirst = iItem < ppe->cprod && ppe->rgitem[iItem].iFirst != 0 ? ppe->rgitem[iItem].iFirst : 100;
+        *piLast = 100;
+        return;
+    }
+    pitem = &ppe->rgitem[iItem];
+    *piFirst = pitem->iFirst;
+    *piLast = pitem->iLast;
+}
+
+void FreeProdEtaCache(void)
+{
+    int16_t id;
+    PRODETA *ppe;
+
+    for (id = 0; id < clpprodetaMax; id++)
+    {
+        ppe = rglpprodeta[id];
+        if (ppe == NULL)
+        {
+            continue;
+        }
+        free(ppe->rgprodKey);
+        free(ppe->rgitem);
+        free(ppe->rgprodCp);
+        free(ppe->lpplprodWork);
+        free(ppe);
+    }
+    free(rglpprodeta);
+    rglpprodeta = NULL;
+    clpprodetaMax = 0;
+    for (id = 0; id < 16; id++)
+    {
+        free(rglpetaplr[id]);
+        rglpetaplr[id] = NULL;
+    }
+}
@@ -0,0 +1,93 @@
+#ifndef PRODETA_H_
+#define PRODETA_H_
+
+#include "types.h"
+
+/*
+ * Memoized production schedule.
+ *
+ * EstimateItemProdSched answers "when does item iItem start and finish" by
+ * copying the planet and its queue and running CBuildProdItem over the whole
+ * queue year by year, up to 99 years, for every item the dialog draws. The
+ * queue walk does not depend on which item is asked about (apart from
+ * stopping early), so one run can answer every item at once.
+ *
+ * PRODETA keeps, per planet id, the result of one such run for every item
+ * plus the simulated planet, partial item and queue at the start of every
+ * dEtaCpPass-th year. When the same planet is asked about again:
+ *
+ *   - same planet, owner and queue: the answers are returned as is;
+ *   - queue edited at index k: nothing before the first year the queue walk
+ *     reached k can change, so the run resumes from the last checkpoint at
+ *     or before that year and only the years after it are simulated again;
+ *   - anything else the walk reads changed (the planet, the turn, the
+ *     owner's PLAYER record or its ship and starbase designs, which set
+ *     what items cost): the run starts over.
+ *
+ * The owner is compared through ETAPLR, one snapshot per player whose
+ * generation goes up whenever the record or a design differs from it, so
+ * a design edit invalidates every planet of that player without each
+ * PRODETA carrying its own copy. DestroyCurGame frees the whole cache.
+ *
+ * Results match what EstimateItemProdSched computes item by item.
+ */
+
+#define cEtaPassMax 100 /* years 1..99 are simulated, 100 is "never" */
+#define dEtaCpPass 4    /* years between checkpoints */
+#define cEtaCpMax ((cEtaPassMax + dEtaCpPass - 1) / dEtaCpPass)
+#define cEtaShdef 16    /* ship design slots per player */
+#define cEtaShdefSB 10  /* starbase design slots per player */
+#define cbEtaShdef 0x93 /* design stride in rglpshdef */
+
+typedef struct _etaitem
+{
+    uint8_t iPassReached; /* first year the queue walk got to this item, 0 never */
+    uint8_t iPassDone;    /* year the answer became final, 0 still open */
+    int16_t iFirst;
+    int16_t iLast;
+} ETAITEM;
+
+typedef struct _etacp
+{
+    PLANET pl;
+    PROD prodPartial;
+} ETACP;
+
+/* What the walk reads from the owner, as last seen. */
+typedef struct _etaplr
+{
+    uint16_t wGen;
+    PLAYER plr;
+    uint8_t rgbShdef[cEtaShdef * cbEtaShdef];
+    uint8_t rgbShdefSB[cEtaShdefSB * cbEtaShdef];
+} ETAPLR;
+
+typedef struct _prodeta
+{
+    int16_t fValid;
+    PLANET plKey; /* planet as last simulated, lpplprod cleared */
+    uint16_t turn;
+    uint16_t wGenPlr;      /* ETAPLR.wGen of the owner */
+    int16_t cprod;         /* queue length as last simulated */
+    int16_t cprodMax;      /* room in rgprodKey / rgitem / rgprodCp rows */
+    int16_t cpass;         /* years simulated */
+    int32_t cResPass1;     /* first year's resources after research */
+    int32_t cResearchPass1;
+    PROD *rgprodKey;       /* [cprodMax] queue as last simulated */
+    ETAITEM *rgitem;       /* [cprodMax] */
+    PROD *rgprodCp;        /* [cEtaCpMax][cprodMax] queue at each checkpoint */
+    PLPROD *lpplprodWork;  /* queue the simulated planet points at */
+    ETACP rgcp[cEtaCpMax]; /* state at the start of years 1, 1 + dEtaCpPass, ... */
+} PRODETA;
+
+typedef int16_t (*PFNBUILDPROD)(PLANET *lppl, PROD *lpprod, PROD *pprodPartial, int32_t *rgRes, int16_t fAlchemy, int16_t *pmdStatus, int16_t fCalcOnly);
+
+/* globals */
+extern PFNBUILDPROD lpfnEtaBuildProd; /* CBuildProdItem; tests swap in a scripted builder */
+
+/* functions */
+PRODETA *LpprodetaSimulate(PLANET *lppl, PLPROD *lpplprod);
+void GetProdEtaItem(PRODETA *ppe, int16_t iItem, int16_t *piFirst, int16_t *piLast);
+void FreeProdEtaCache(void);
+
+#endif /* PRODETA_H_ */
@@ -2,6 +2,7 @@
 #include "types.h"
 
 #include "produce.h"
+#include "prodeta.h"
 
 /* functions */
 void ProdCommandHandler(uint16_t hwnd, uint16_t wParam, int32_t lParam)
@@ -158,11 +159,22 @@ void EstimateItemProdSched(PLANET *lppl, PLPROD *lpplprod, int16_t iItem, int16_
     int16_t iMac;
     int32_t rgRes[4];
     PROD * lpprod;
+    PRODETA *ppe;
 
     /* debug symbols */
     /* label LCleanUp @ MEMORY_PRODUCE:0x5469 */
 
-    /* TODO: implement */
+    /* The year-by-year walk itself lives in prodeta.c, which keeps the
+       result for the whole queue and only re-simulates what an edit can
+       have changed. */
+    ppe = LpprodetaSimulate(lppl, lpplprod);
+    if (ppe == NULL)
+    {
+        *piFirst = iItem < 0 ? 0 : 100;
+        *piLast = iItem < 0 ? 0 : 100;
+        return;
+    }
+    GetProdEtaItem(ppe, iItem, piFirst, piLast);
 }
 
 void DrawProductionDlg(uint16_t hwnd, uint16_t hdc, RECT *prc, int16_t iDraw)
@@ -2,6 +2,7 @@
 #include "types.h"
 
 #include "race.h"
+#include "globals.h"
 
 /* globals */
 int16_t rgRaceAdvDisPts[14] = {-235, -25, -159, -201, 40, -240, -155, 160, 240, 255, 325, 180, 70, 30};
@@ -371,9 +372,13 @@ int16_t FTrackRaceDlg2(uint16_t hwnd, POINT pt, int16_t kbd)
 
 int16_t PctTrueMaxGrowth(int16_t iplr)
 {
+    PLAYER *pplr = &rgplr[iplr];
 
-    /* TODO: implement */
-    return 0;
+    if (GetRaceStat(pplr, 0xe) == 0)
+    {
+        return (int16_t)(pplr->pctIdealGrowth * 2);
+    }
+    return pplr->pctIdealGrowth;
 }
 
 int16_t FSaveRace(char *szFileSuggest, PLAYER *pplr)
@@ -1,7 +1,11 @@
 
+#include <string.h>
+
 #include "types.h"
 
 #include "save.h"
+#include "log.h"
+#include "utilgen.h"
 
 /* functions */
 void WriteRt(int16_t rt, int16_t cb, void *rg)
@@ -146,7 +150,39 @@ void WriteBattlePlan(BTLPLAN *lpbtlplan, int16_t fLog)
     char szPlanName[32];
     int16_t cOut;
 
-    /* TODO: implement */
+    /* iplr/iplan/tactic word, then targets and name unless it's a delete */
+    memcpy(rgb, lpbtlplan, 4);
+    if (!lpbtlplan->fDelete)
+    {
+        pb = rgb + 4;
+        /* a plain name has to fit after the length byte, with its NUL */
+        strncpy(szPlanName, lpbtlplan->szName, sizeof(rgb) - 6);
+        szPlanName[sizeof(rgb) - 6] = '\0';
+        cOut = 0x1f;
+        if (szPlanName[0] == '\0' || !FCompressUserString(szPlanName, (char *)pb + 1, &cOut))
+        {
+            strcpy((char *)pb + 1, szPlanName);
+            *pb = 0;
+            pb += strlen(szPlanName) + 2;
+        }
+        else
+        {
+            *pb = (uint8_t)cOut;
+            pb += cOut + 1;
+        }
+    }
+    else
+    {
+        pb = rgb + 2;
+    }
+    if (fLog)
+    {
+        WriteMemRt(rtBtlPlan, (int16_t)(pb - rgb), rgb);
+    }
+    else
+    {
+        WriteRt(rtBtlPlan, (int16_t)(pb - rgb), rgb);
+    }
 }
 
 int16_t FWriteDataFile(char *pszFileBase, int16_t iPlayer, int16_t fAppend)
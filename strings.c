@@ -4,13 +4,28 @@
 #include "strings.h"
 
 /* globals */
-char aSTRCmpr[28209]; /* MEMORY_STRINGS:0x0000 */
+char aSTRCmpr[28209] = {-7, -95, 12, 116, -9, 22, -127, 11, 31, 52, 116, 52, 87, 15, 52, -111, 15, -1, -12, -15, 8, 17, -16, -128, 53, 15, 81, 15, 4, -120, 71, -14, 5, 96, -43, 102, -50, 63, 79, -23, 47, 17, 96, -107, -14, 15, 52, -111, 15, -1, -12, -13, 2, -18, 18, 104, 3, 80, -11, 16, -43, 102, -50, 63, -8, 12, 114, -11, -111, 3, 80, -107, 43, 15, 52, -111, -12, -7, -95, 10, 72, 53, 111, 16, -13, 73, 16, -1, -1, 70, 2, -18, 18, 104, 3, 80, -11, 16, -43, 102, -50, 63, 64, -1, -13, 72, 53, 100, -46, -112, -78, 50, 15, -124, -103, 7, 83, 15, 81, 2, -9, 36, -110, -11, -111, -12, -7, -95, 15, 34, -16, 16, -13, 73, 16, -1, -1, 79, -128, 46, -31, 38, -128, 53, 15, 81, 13, 86, 108, -29, -1, -128, -57, 47, 89, 16, 53, 9, 82, -80, -13, 73, 31, 79, -12, 39, -4, 48, 94, 23, 15, 52, -111, 15, -1, -12, -8, -12, -7, -95, 12, 116, -9, 22, -127, 13, 97, 35, 69, 112, -13, 73, 16, -1, -1, 79, -128, 46, -31, 38, -128, 53, 15, 81, 4, 127, 114, -108, -65, 79, -3, -103, 31, 34, -112, -14, 47, 1, 3, 67, -111, 4, 112, -1, -1, 79, -113, 79, -1, 68, 113, 15, -1, -97, -8, 15, -1, -12, -8, -1, -128, -94, -128, 32, -11, 43, 12, 116, -9, 22, -127, 11, 31, 52, 116, 52, 87, 14, 38, 47, 1, 49, 111, 79, -1, 68, 113, 15, -1, -10, -1, -128, -1, -1, 79, -113, -8, 10, 40, 2, 15, 82, -80, -57, 79, 113, 104, 16, -79, -13, 71, 67, 69, 112, -30, 98, -16, 19, 22, -12, -1, -12, 71, 16, -1, -1, -113, -8, 15, -1, -12, -8, -1, -128, -94, -128, 32, 79, 14, 101, -31, 96, 124, -16, -11, 22, 5, -13, 14, -110, -15, 22, 15, 52, -111, -113, 79, -1, 68, 113, 15, 107, -1, -128, -57, 47, 89, 16, 53, 9, 82, -80, 58, 16, 98, -47, 15, 52, -111, 15, -49, 104, -4, -12, -1, -12, 71, 16, -10, -80, -94, -128, 39, 4, -16, -26, 94, 22, 15, 116, -45, 86, -15, 13, 87, -76, 52, 87, 11, 31, 52, 116, 52, 87, -12, -1, 37, -58, 12, 116, -9, 22, -127, 11, 31, 52, 116, 52, 87, 15, 52, -111, -1, -128, -1, -1, 79, -113, -8, 2, -18, 18, 104, 3, 80, -11, 16, 53, 80, -118, 86, 63, 79, -102, 16, -13, 73, 16, -1, -1, 79, -128, -75, 24, 7, 83, 15, 81, -107, 127, 32, 53, 3, -92, -128, -9, 22, -124, 87, 5, -13, 15, -93, 38, -113, -1, -13, -1, -16, 80, -14, 47, 1, 13, -58, 97, 115, -97, 16, -107, 43, 27, -12, -1, 37, -64, -46, 127, -61, 13, -94, 127, 33, 3, -95, 15, -1, -15, 85, -16, 15, 50, -45, 86, 12, 115, 73, 2, 15, 34, -16, 16, 72, 5, -31, 127, 79, -1, 69, -14, 15, 52, -111, 10, 40, 6, 18, -38, 27, 3, -95, 15, 2, -1, -92, -16, -49, 0, 41, -107, -8, 47, 89, 16, -124, -1, -1, 17, -12, 15, -12, 95, 15, 2, 123, -128, -8, 73, -112, 117, 48, -11, 16, 97, -43, 107, 27, -12, -1, -9, 114, -11, -111, 3, 80, -42, 18, 49, 3, -95, 9, 95, 32, -13, 73, 16, -1, -1, 79, 63, 79, -1, 119, 47, 89, 16, 53, 13, 97, 35, 16, 58, 16, -92, -125, 86, -15, 15, 52, -111, 15, -1, -12, 111, 79, -1, 119, 47, 89, 16, 53, 13, 97, 35, 16, 58, 16, -91, -125, 15, 52, -111, 15, -1, -12, -81, 79, -1, 119, 47, 89, 16, 53, 13, 97, 35, 16, 58, 16, -57, 79, 113, 104, 16, -79, -13, 71, 67, 69, 112, -13, 73, 16, -1, -1, 79, 31, 79, -102, 16, -91, -125, 15, 52, -111, 15, -1, -12, -96, 72, 15, 2, 111, -47, -80, 40, 15, 81, 71, -14, 4, 112, -56, 16, -11, -15, 2, 117, 58, 22, 4, 120, 50, 125, 16, 95, 48, -6, 50, 104, -1, -1, 48, -1, 86, 16, -15, 92, 8, -58, 16, -15, 92, 15, -126, 115, 3, 80, 94, 23, 4, 63, -1, -33, -4, 102, 86, 15, -122, 67, 71, -14, 3, 80, -13, 73, 16, -1, -1, 79, -113, -1, -13, -1, -9, 114, -11, -111, 3, 80, -107, 43, 15, 84, 63, 2, -24, -1, -1, 63, -1, 119, 47, 89, 16, 53, 4, 116, 52, 41, 79, -1, -15, 16, -6, 50, 104, -1, -1, 63, -1, 119, 47, 89, 16, 53, 5, -31, 112, 58, 16, -91, -125, 15, 52, -111, 15, -1, -12, -81, 79, -1, 92, 48, 95, 48, -1, 1, -16, 86, -15, -1, -1, 63, -1, 119, 47, 89, 16, 53, 5, -31, 112, 58, 16, 113, -8, 3, -58, 112, -13, 73, 16, -1, -1, 67, -12, -1, 116, -111, 15, -1, -12, 48, 72, 5, -61, 5, -13, 11, 35, 31, 79, -9, 73, 16, -1, -1, 79, -128, 72, 7, 83, 15, 54, 95, 0, 58, 72, 15, 34, -16, 31, 79, -102, 16, -107, -14, 15, 52, -111, 15, -1, -12, -13, 4, -128, -16, 86, 16, 97, -47, 115, 3, -94, 112, 58, 16, -14, 47, 1, 15, 21, -64, 38, 16, 54, -15, 71, -14, 3, 80, -107, 43, -12, 15, -3, -14, 117, 100, 127, 32, -107, -14, 15, 52, -111, -12, -7, -95, 2, -16, 92, 115, 5, -13, 13, 38, -14, 80, -15, 92, 15, 2, -15, 8, -31, -44, -13, -15, 10, 22, 16, -16, -56, 48, -11, 16, -11, 19, -8, 17, 112, -1, -10, 2, 123, 15, -1, -8, -1, 63, -13, -1, 48, 86, 15, 81, 63, -127, 23, 15, -1, 111, 96, 39, -80, -1, -10, -1, 63, -13, -10, -12, -7, -95, 97, 4, -121, -4, 48, 23, 92, -14, -96, -13, 97, 16, -16, 31, 5, 111, 16, 53, 15, 5, -76, -13, -15, 3, -95, 14, 101, -68, -45, 69, 112, -76, 41, 95, 47, 79, -102, 72, 15, 1, -120, 47, 33, 3, -15, -31, 10, 40, 15, 81, 23, 15, 52, -109, 22, 27, 5, -61, 2, 123, 15, -124, -103, 7, 83, 15, 81, 8, -91, -8, 112, -11, -15, 11, 31, 50, -55, 48, 39, -15, -16, 86, 31, 64, -1, 37, -64, -8, 73, -112, -125, 73, -112, -11, 16, -127, 115, 3, -95, -127, 15, 1, -120, 47, 33, -128, 39, -80, 53, 8, -91, -8, 3, -95, -16, -1, -128, -39, 77, -3, 5, 112, 58, 16, -16, 47, 39, 79, 63, 20, 127, 32, -14, -110, -120, -12, -1, 89, -112, 58, 16, -16, 24, -126, -14, 24, 15, 21, -64, -94, -9, 16, -11, 17, 112, -127, 115, 3, -92, -128, -15, 18, 96, 38, 16, -13, 73, 49, 97, -80, 92, 63, 64, -1, -33, 48, -15, 92, 15, -126, 115, 3, 80, -9, 65, -8, 3, -95, -127, 15, 1, -120, 47, 33, -113, -8, 13, -108, -33, -48, 87, 3, -95, 15, 2, -14, 116, -13, -15, 71, -14, 15, 41, 40, -113, 79, -7, 38, 116, 127, 47, -80, -7, -95, 13, 89, 87, 79, -1, -15, 16, -16, 72, -124, 87, 13, 39, 117, 48, -11, 16, -46, 102, 65, -80, 92, 48, -11, 29, 44, -127, 7, 87, 16, 95, 48, -15, 92, 96, -118, 78, -128, 71, 3, -92, -128, -13, -111, 19, 10, 47, 113, 2, 13, 89, 87, 79, -1, -15, 35, 69, 112, -16, 91, -55, 16, 71, 3, -95, -16, -12, -1, -16, 83, 31, -80, -1, 89, -112, -118, 78, -128, 71, 3, -95, 15, 57, 17, 48, -8, 73, -112, -11, 16, -76, -113, 2, 115, -111, -80, 53, 14, 101, -9, 75, 16, -116, -18, -108, 24, 15, 53, 96, 58, 16, -43, -107, 116, -125, -113, 79, -1, 5, 49, -5, 15, -11, -103, 8, -92, -24, 4, 112, 58, 16, -13, -111, 19, 15, -124, -103, 15, 81, 11, 72, -16, 39, 57, 27, -12, 15, -91, -16, 16, 95, 48, 58, 16, -16, 71, 22, 41, -128, -46, 112, -11, 16, 97, -43, -9, 22, 27, -12, -1, -16, 83, 31, -80, -1, 89, -112, -118, 78, -128, 71, 3, -95, 15, 57, 17, 48, -8, 73, -112, -11, 16, -76, -113, 2, 115, -111, -65, 64, -1, 89, -112, 95, 48, 58, 16, -16, 71, 22, 41, -128, -8, 73, -112, -11, 16, -107, -125, -1, -1, 63, -9, -63, -112, -1, -9, -126, -14, 16, -9, -113, 64, -1, -110, 110, 15, -82, 17, -65, -86, 65, -101, 15, -12, 95, 113, 98, -14, 16, -9, -113, 64, -1, 97, -13, 23, -127, 15, -1, -3, -62, 127, -102, 72, 1, 127, 36, 113, 13, 39, 5, 121, -15, 15, 81, 15, 5, -57, 49, -80, 87, 3, -95, 15, -16, 71, 79, -1, 31, -12, 89, 87, 79, -1, -15, 22, 15, -1, 60, -103, 2, 123, 6, 31, -1, 44, 70, 24, 3, -95, 14, 100, -16, 38, -15, 6, 45, 66, -112, 54, 36, 48, -4, -1, -13, -15, -31, 111, -1, 31, -4, -1, -82, 39, -124, 87, -4, -12, -7, -92, -128, 23, -14, 71, 16, -42, 18, 49, -128, -27, -8, 22, -13, -55, 15, -126, -9, 24, 5, -13, 6, 43, 66, 52, 87, 2, 123, 15, -124, -103, 15, -44, -103, 8, 95, 1, 5, -13, 15, 21, -58, 13, 89, 87, 72, 56, 4, -13, 3, -95, 15, 4, -66, 84, 115, 5, -13, 15, 21, -58, 6, 45, 31, -56, 15, -15, 43, 66, 52, 87, 15, 82, 123, 4, -121, -4, 48, 35, 9, 18, -125, 15, -1, -1, 47, -1, -81, 15, -15, -12, -7, -92, -128, 23, -14, 71, 16, 97, -1, -14, -60, 97, -128, 58, 16, -111, -120, 22, 6, 45, 66, -112, 54, 36, 48, -4, -1, -33, 14, 101, -9, 27, 15, 60, 25, 1, -13, -13, 77, 65, 125, -15, -4, -12, -7, -92, -128, 23, -14, 71, 16, 97, -1, -14, -60, 97, -128, 58, 16, -111, -120, 22, 6, 45, 66, -112, 54, 36, 48, -4, -1, -33, 14, 101, -9, 27, 15, 60, 25, 1, -13, -13, 77, 65, 125, -15, -4, 2, 123, 7, 83, 15, -49, -1, 5, 15, -15, 47, 0, -6, -43, 94, 15, -4, 127, 36, 113, -113, -49, 79, -102, 72, 1, 127, 36, 113, 6, 31, -1, 44, 70, 24, 3, -95, 9, 24, -127, 96, 98, -44, 41, 3, 98, 67, 15, -49, -1, 5, 15, -15, 47, 0, -6, -43, 94, 15, -4, 127, 36, 113, -113, -49, 79, -102, 72, 8, 50, 111, 34, 49, 6, 31, -1, 44, 70, 24, 3, -95, 14, 100, -16, 38, -15, 6, 45, 66, -112, 54, 36, 48, 95, 48, -4, -1, -41, 49, 104, 49, -103, 38, 15, -106, 47, 113, -111, 111, -49, 79, -102, 72, 15, 2, -120, 11, 100, -9, 22, 6, 31, -1, 44, 70, 24, 3, -95, 14, 100, -16, 38, -15, 6, 45, 66, -112, 54, 36, 48, 95, 48, -4, -2, 45, -3, 19, 15, -22, -15, -124, -40, -4, -12, -7, -92, -128, -84, -103, 15, -124, -103, 10, 47, 113, 2, 15, 92, 73, 63, -1, 20, 112, -115, 39, 113, 96, 79, 48, 58, 16, -4, -1, -1, 82, -33, -48, 95, 48, -1, 89, -112, -7, 98, -79, -113, -64, -26, 79, 2, 111, 16, 98, -44, 41, 3, 98, 67, 4, -128, -127, -111, -45, 27, -12, -1, -57, 31, 15, 16, -13, -111, 19, -128, 117, 48, 86, -11, 67, 71, -14, 2, 14, -110, 113, 48, -46, 112, -11, 16, -79, 49, -45, 27, 12, -32, 53, 15, 107, 9, 79, 42, 48, -15, 18, 104, 2, -8, 47, 31, 79, -4, 113, -16, -15, 15, 57, 17, 56, 13, 39, 117, 48, -11, 16, -79, 49, -45, 27, 15, 95, 16, 58, 72, 8, -46, 119, 22, 12, 121, 24, -128, 58, 31, 16, 38, 16, 35, 3, -95, 8, 47, 1, 9, 93, 35, 69, 112, 40, 3, -95, 8, -46, 119, 22, -12, -7, -92, -128, -115, 39, 113, 96, 72, 13, 46, 47, 89, 16, 95, 48, -79, 49, 111, 4, 116, 127, 32, 32, -23, 39, 19, -4, -128, 23, -9, 70, 87, -16, 23, 48, 39, -80, -43, -16, -27, -124, 52, 87, 15, -118, 73, 16, 71, 5, 111, 84, 48, 95, 48, 58, 16, -23, 39, 19, -12, -7, -92, -128, -115, 39, 113, 96, -46, 112, -79, 49, 111, 4, 113, 2, 14, -110, 113, 63, -56, 15, 82, -124, -48, -125, 35, -128, -13, 101, -16, 2, 11, 72, 50, 125, 16, 95, 48, -50, 3, 80, -10, -80, -108, -14, -93, 15, 17, 38, -113, 64, -7, -95, 8, -46, 119, 22, 15, -124, -103, 2, -104, 80, -114, 83, 1, 113, -16, -15, 15, 57, 17, 56, 2, 51, 31, 14, 52, 127, 32, 53, 10, 75, 16, -11, 26, 71, -80, -23, 39, 19, -128, -8, 67, -92, 112, 98, 127, 33, -12, -7, -92, -128, -115, 39, 113, 96, -46, 112, -79, 49, 111, 4, 113, 2, 14, -110, 113, 63, -56, 15, 82, -124, -48, -125, 35, -128, -13, 101, -16, 2, 11, 72, 50, 125, 16, 95, 48, -1, -1, -113, -1, -96, -108, -14, -93, 15, 17, 38, -113, 64, -1, -45, 2, -104, 80, -79, -42, 18, -127, -128, 58, 16, 98, 127, 33, 2, 48, -8, -92, -38, 1, 113, -16, -15, 8, -92, -24, 13, 39, 8, 17, 3, -95, 8, -92, -32, -11, -15, 15, -1, -97, -13, -10, -12, -7, -92, -128, -115, 39, 113, 96, 72, 13, 46, 47, 89, 16, 95, 48, -31, 113, 54, 35, 71, -14, 3, -95, 11, 31, 49, 120, 24, 5, -13, 1, 113, -16, -15, 15, 57, 17, 56, 2, -103, 95, -124, 127, 32, -15, 92, 3, 80, -125, 18, -112, 58, 20, 96, -46, 111, 37, -12, -7, -92, -128, -115, 39, 113, 96, -46, 112, -79, 49, 111, 4, 113, 2, 14, -110, 113, 63, -56, 8, 50, 56, 15, 54, 95, 0, 32, -76, -125, 39, -47, 5, -13, 15, -1, 111, -1, -97, -13, 9, -12, -15, -12, 15, -102, 72, 8, -46, 119, 22, 4, -128, -46, -30, -11, -111, 5, -13, 14, 23, 19, 98, 52, 127, 32, 58, 16, -79, -13, 23, -127, -128, 95, 48, 23, 31, 15, 16, -13, -111, 19, -128, 39, -80, -23, 39, 19, -128, 41, -107, -8, 71, -14, 15, 21, -64, 53, 8, 49, 41, 3, -95, 70, 13, 38, -14, 95, 79, -102, 72, 8, -46, 119, 22, 6, 31, -1, 44, 70, 24, 3, -95, 14, 100, -16, 38, -15, 6, 45, 66, -112, 54, 36, 48, -4, -6, -50, 22, 15, -93, 18, -109, -81, -49, 79, -102, 72, 13, -107, 47, -48, 97, -1, -14, -60, 97, -128, 58, 16, -26, 79, 2, 111, 16, 98, -44, 41, 3, 98, 67, 15, -49, -84, -31, 96, -6, 49, 41, 58, -4, -12, -7, -92, -128, 38, -16, 86, 5, 96, -118, 65, -101, 6, 31, -1, 44, 70, 24, 3, -95, 14, 100, -16, 38, -15, 6, 45, 66, -112, 54, 36, 48, -4, -6, -50, 22, 15, -93, 18, -109, -81, -49, 79, -102, 72, 8, -92, 25, -80, 97, -1, -14, -60, 97, -128, 58, 16, -26, 79, 2, 111, 16, 98, -44, 41, 3, 98, 67, 15, -49, -3, 119, 22, -1, -15, -6, 54, 23, -14, 58, -4, -12, -7, -92, -128, -118, 65, -101, 11, 29, 97, 40, 24, 3, -95, 6, 39, -14, 16, 35, 15, -118, 77, -96, 23, 31, 15, 16, -118, 78, -128, -46, 112, -127, 16, 58, 16, -118, 78, 15, 95, 16, -1, -1, 111, -1, -81, 111, 79, -102, 72, 2, 111, 5, 96, -79, -42, 18, -127, -128, 58, 16, 98, 127, 33, 2, 48, -8, -92, -38, 1, 113, -16, -15, 8, -92, -24, 13, 39, 8, 17, 3, -95, 8, -92, -32, -11, -15, 15, -1, -97, -1, -81, 111, 79, -102, 72, 2, 111, 5, 96, 41, -123, 2, -45, -128, 40, 14, 38, 48, -118, 65, -101, 15, -118, 77, -96, -8, 73, -112, 47, 88, 86, -11, 15, -1, -81, -13, 11, 47, 2, -14, 16, -27, 71, 56, -12, -7, -92, -128, -118, 65, -101, 2, -104, 80, -43, 115, 36, 120, 2, 112, 38, -16, 86, 13, 95, 14, 87, 23, 48, -8, -92, -38, 15, -124, -103, 2, -11, -123, 111, 80, -1, -1, -81, -1, -96, -78, -16, 47, 33, 14, 84, 115, -113, 64, -7, -92, -128, -118, 65, -101, 2, -104, 80, -26, 95, 116, -79, -128, -1, -1, -81, -1, -85, -32, 95, 48, 38, -16, 86, -1, -128, -1, -6, -10, 15, -1, -9, 47, 15, 4, 127, 47, -8, 15, -1, 111, -13, -10, 13, -107, 47, -44, 127, 47, -8, 2, 123, 2, 15, -1, -81, -13, -1, -1, 47, -1, -97, -1, -96, -115, 39, 113, 111, 79, -102, 72, 15, 85, -16, -11, 15, -124, -103, 7, 83, 15, 81, 2, -9, 36, -110, -11, -111, 4, -13, 3, -95, 14, 100, -16, 38, -15, 6, 45, 16, 54, 36, 48, 72, 15, -49, -3, 119, 22, -1, -15, -6, 54, 23, -14, 58, -4, -12, -6, 50, 111, 34, 49, -128, 38, 16, 117, 48, 47, 114, 73, 47, 89, 16, 79, 48, 58, 16, -26, 79, 2, 111, 16, 98, -47, 3, 98, 67, 4, -128, -4, -1, -13, -15, -31, 111, -1, 31, -4, -1, -82, 39, -124, 87, -4, -12, -1, 66, 111, 37, -5, 15, -111, -38, 117, -107, -14, -15, 15, -93, 35, -56, -1, -49, -6, -31, -45, 27, 15, -15, 24, 18, 109, -96, -1, -31, 113, -13, 67, -113, -12, -58, 97, 115, -97, 16, -1, 17, -127, 38, -38, 71, -14, -1, 17, -123, -58, -47, 15, -11, -103, 93, 35, 69, 127, -9, -63, -112, -1, 66, -30, -44, 63, 31, -80, 15, -12, 38, -14, 80, -1, 66, -30, -44, 63, 31, -80, 15, -11, 111, 5, 96, -6, 54, 23, -14, 58, -5, 0, -1, -41, 67, 66, 52, -9, 31, -80, 15, -15, 24, 92, 109, 24, 7, 17, -79, -80, 53, 13, 95, 14, -111, 49, -5, 0, -1, -56, 52, -16, 35, 27, 3, 79, 1, 3, 80, -43, -16, -23, 19, 69, 127, -80, 15, -11, 119, -62, -112, 97, -123, -58, -47, -128, -13, 101, -16, 2, -103, 14, -110, 113, 56, -5, 0, -7, 83, 41, 6, 24, 92, 109, 24, 8, -31, 115, 5, 112, 97, -127, 38, -38, 9, 40, 48, -15, 18, 111, -80, 15, -15, 24, 92, 109, 24, 15, 92, -65, 33, 49, -80, -13, 86, 6, 24, 18, 109, -81, -80, 15, -1, 1, -1, -93, 15, 17, 38, -4, -128, -26, 95, -1, -9, 29, 49, -80, 97, -127, 38, -38, 15, 92, -65, 33, 63, -80, 15, -1, 1, -1, -93, 15, 52, 25, -80, 53, 6, 24, 18, 109, -81, -80, 15, -1, -1, 15, -94, -16, 16, -13, 65, -101, -1, -1, -15, -1, -57, 22, -14, -15, -1, -111, 46, 87, -113, -26, 94, -55, -124, 87, -1, 69, 120, 54, -51, 52, 87, -1, -55, 29, 54, 87, 77, -113, -2, 69, 49, -38, 117, -107, -14, -15, -1, -1, -16, -1, -12, 95, -127, -125, 15, 52, 25, -65, -1, -1, 31, -4, 113, 111, -80, 15, -7, 18, -17, -80, 15, -26, 94, -5, 0, -1, 69, 120, 63, -80, 15, -4, -111, -45, -5, 0, -1, -28, 95, -80, 15, -11, 97, 15, 21, -64, -116, 97, 15, 21, -64, -8, 39, 48, 53, 11, 25, 19, 16, 58, 16, -36, 102, 23, 48, -8, 47, 30, 84, 115, -1, -3, -7, -92, -128, -14, 47, 1, 4, -128, 41, 97, 43, -15, 15, 81, 71, -14, 10, 88, 49, -80, -11, -15, 2, 117, 58, 22, 4, 120, 50, 125, 16, 95, 48, -6, 50, 104, -1, -1, 48, -1, -107, -55, -80, -15, 92, 9, 79, -47, 3, 80, -8, 36, 48, -13, 86, 2, 7, 31, -128, 60, 103, -1, -3, -1, -2, 117, 3, 40, -3, 10, 22, 31, -1, -16, -7, 98, 120, -27, 99, -1, 69, -107, 116, -1, -1, 17, -1, 17, -16, 83, 16, -1, 4, 116, 127, 47, -16, 22, -14, 16, -8, 67, -96, -1, 121, 17, 63, -83, 98, -32, -1, 121, 17, 63, -1, 66, -15, 15, -16, 71, 16, -1, 116, 25, -65, -30, 54, 89, -1, 21, -61, 31, -106, 39, -113, 49, 96, -1, 121, 17, 63, -1, -25, 80, 45, 52, 87, -1, -1, 15, -1, 69, 43, 15, -11, -103, 15, -11, -9, 36, -110, -11, -111, -1, -9, 121, 82, -80, -1, 89, -97, -1, 69, 43, 15, -4, -1, -94, -45, -97, 31, 79, 79, 79, -1, 119, -107, 43, 15, -4, -1, -94, -45, -97, 31, 79, 79, 79, -9, 73, -112, -1, -9, -32, 53, 15, 111, 79, 79, 79, -7, 36, 48, -13, 86, 15, 111, 79, 79, 79, -1, 69, 43, 15, -10, -57, 114, -14, 31, -95, 48, -1, 95, 5, -57, 48, 53, -12, -12, -12, -6, 19, 15, -7, 47, 30, 84, 115, 3, 95, 79, 79, 79, -1, 69, 43, 15, -1, 94, 52, -16, 41, -1, -16, 95, 85, -65, 31, -4, 113, -16, 65, -113, -1, 1, -61, 98, -104, 15, -1, -2, 15, -4, 113, -16, 65, -113, -4, -9, 22, -15, 87, 16, -1, -33, 14, 101, -9, 16, -2, -110, 113, 48, -1, -9, 123, 80, -7, 22, 98, -13, 86, -16, 71, -14, -1, 4, 113, -113, -9, 45, 53, 100, 24, -1, 97, -13, 23, -127, -113, -11, -99, -95, -16, -15, -1, 4, 112, -7, 22, 98, -13, 86, -16, -1, 2, -1, -96, -7, 22, 98, -13, 86, -16, -1, 4, 113, 98, -112, -2, 45, -3, 19, -113, -9, 45, 53, 111, 31, -16, 71, 31, -10, 31, 49, 120, 24, 15, -16, 71, 22, 41, 15, -11, -99, -95, -16, -15, -7, 22, 98, -13, 86, -16, 15, -4, 127, 116, 101, 127, 1, 115, -1, -8, 23, 24, 72, 15, -10, 31, 116, -47, -1, -42, 87, 76, -16, 15, -16, 71, 22, 41, 15, -30, -33, -47, 63, -2, 86, 39, 76, -16, 15, -16, 71, 22, 41, 15, -30, -33, -47, 63, -1, -127, 111, 2, 116, -49, 0, -1, 4, 113, 98, -112, -2, 45, -3, 19, -1, 4, -1, -95, -80, -1, 4, 113, 98, -112, -2, 45, -3, 19, -1, -108, 123, 95, -120, -6, 50, 104, -12, 71, 79, -16, 72, -33, -1, -4, 78, -1, -11, 107, 22, -113, -16, 36, 127, -86, 78, -7, 73, 24, -2, -110, 113, 63, -108, -111, -113, -83, 39, -1, -1, -59, 95, 15, -95, -111, -45, 69, 127, -9, 73, 24, -1, -110, 67, -1, 116, -111, -1, -10, -7, -58, 127, -83, 39, -1, 5, -79, -1, -4, -1, -7, -1, -6, -6, -46, 127, -9, 73, 49, 111, -1, -49, -1, -97, -1, -81, -83, 39, -1, -49, -9, 73, 49, 111, -1, -49, -1, -97, -1, -81, -83, 39, -1, 4, 113, -113, -83, 39, -1, 18, -78, 111, -16, 71, 22, 41, -6, -46, -111, -1, -12, 47, 21, -61, -1, -8, -107, -11, 41, -6, 19, 52, 127, 40, -6, 63, 25, 31, -1, 111, -7, 75, 58, -6, 63, 25, 31, -1, 111, -1, 49, 79, 42, 63, -93, -15, -111, -1, -10, -1, -13, 20, -14, -93, -1, -7, -6, 63, 25, 31, -1, -97, -7, 75, 58, -6, 63, 25, 31, -1, -97, -1, 49, 79, 42, 63, -93, -15, -111, -1, -7, -1, -13, 20, -14, -93, -1, -7, -7, 85, -97, 82, 111, -1, -126, -16, 31, -3, -1, 111, -15, 24, 89, -61, 69, 127, -10, 31, 50, -55, 63, -30, -120, -8, 86, -65, -26, 95, 38, 24, -113, -2, 45, -3, -50, -113, -15, 30, 86, 63, -23, 39, -1, -108, 127, -15, 30, 86, 63, -9, -111, 19, -1, -108, 127, -15, 30, 86, 63, -4, -1, 121, 17, 63, -7, 71, -1, 17, -27, 99, -1, -29, -97, -7, 71, -1, 17, -27, 99, -2, -110, 127, -9, -101, -1, 17, -27, 99, -2, -110, 127, -91, 99, -1, 17, -27, 99, -1, 121, 17, 63, -9, -101, -1, 17, -27, 99, -1, 121, 17, 63, -91, 99, -1, 17, -27, 99, -1, -49, -9, -111, 19, -1, 121, -65, -15, 30, 86, 63, -4, -1, 121, 63, -91, 99, -1, 17, -27, 99, -1, -29, -97, -9, -101, -1, 17, -27, 99, -1, -29, -97, -91, 99, -1, 17, -27, 99, -1, 97, -13, -1, -8, 98, -22, -6, 92, 123, -1, 127, -1, -1, 79, -1, 52, -125, 86, -15, -1, -41, -13, 80, -1, -4, -1, 79, -15, -6, -31, 27, -1, 12, -124, -33, -106, 45, -3, -113, -106, 45, -3, -1, 117, 115, -113, -11, 100, 41, -1, 86, 66, -97, -2, 89, -65, -11, 100, 41, -1, -45, 41, 77, -1, 86, 66, -97, -2, 89, -65, -3, 50, -108, -33, -1, 1, -8, -1, 17, -27, 99, -113, -1, 5, -1, -13, 88, 63, -1, 2, -16, 24, -1, 1, -120, 47, 33, -1, -12, 95, 47, 36, 127, 47, -14, 92, 10, 47, 113, 0, 87, 15, 64, 15, -14, 92, 15, 2, -15, 15, 92, 73, -80, -50, 3, 80, -1, -1, -10, 10, 95, -127, -9, 22, -1, -128, -15, 92, 96, -43, -107, 116, -125, -128, 38, 16, -36, 102, 23, 57, -15, 13, 46, 47, 89, 16, 95, 48, 94, 22, 35, 71, -14, 5, 121, -15, 0, 95, 48, 58, 31, 15, 79, -11, -18, -97, 16, 86, 11, 31, 52, 113, 2, 14, 101, -68, -45, 69, 112, 49, -16, -23, 35, 31, -15, 79, 42, 48, -39, 77, -3, 5, 112, 58, 16, -11, -100, 16, -76, 47, 5, 123, 3, 80, 46, -23, -15, 2, 14, 101, -68, -45, 69, 112, 49, -16, -23, 35, 16, 53, 3, -92, -128, -1, -14, -63, -63, -1, -128, 86, 13, -91, 88, 16, -1, -1, -16, -1, 76, -125, 95, 4, -1, -1, 17, -1, -1, -15, 3, 80, -79, -13, 71, 16, 32, 49, -16, -23, 35, 16, -11, 40, 27, 5, 112, 58, 16, 44, 53, 15, 92, 73, -80, 67, 31, 8, 4, 112, 58, 16, -36, 102, 23, 48, -1, -14, -63, -63, -12, -7, -92, -128, -27, -80, 71, -42, 18, -127, -128, 58, 16, -13, -63, -112, -46, -30, -44, 63, 16, 95, 48, 58, 16, -118, 78, 15, 95, 16, -10, -65, 15, 47, 79, -102, 72, 14, 91, 4, 125, 97, 40, 24, 3, -95, 13, 38, -14, 80, -46, -30, -44, 63, 16, 95, 48, 58, 16, -118, 78, 15, 95, 16, -10, -65, -33, -97, 79, -102, 72, 14, 91, 4, 125, 97, 40, 24, 3, -95, 13, 38, -14, 80, -46, -30, -44, 63, 16, 95, 48, 58, 16, -118, 78, 15, 95, 16, -1, -7, -1, -6, -1, 63, -33, -97, -8, 14, 101, -9, 75, 24, 2, 15, -1, 111, -13, -10, 13, -107, 47, -48, 39, -80, -1, -6, -1, 59, -32, 95, 48, 38, -16, 86, -12, -7, -92, -128, -27, -80, 41, -107, -8, -128, 32, -118, 78, 3, 80, -43, -107, 116, -1, -1, 17, 2, 14, -110, 113, 48, 39, -80, -8, 73, -112, -76, -113, 2, 115, -111, 3, -95, 8, -92, -32, -50, 87, 2, 102, 79, 114, -112, 39, -80, -43, 127, 113, 99, 4, 48, 71, 53, 8, -50, -23, 65, -128, -13, 86, 3, -95, 13, 89, 87, 72, 56, -12, -7, -92, -128, -16, 91, -55, 16, -43, 115, 36, 120, 2, 112, 31, 14, 63, 16, 86, -11, 67, 41, 10, -55, -112, -8, -92, -38, 13, 39, 15, 81, 11, 30, -107, -15, 27, 4, 112, 86, -11, 67, 5, -13, 2, 112, -57, 71, -94, -11, 67, 27, 14, -110, 113, 63, 64, -7, -95, 14, 91, 2, -104, 80, -43, 115, 36, 120, 15, 116, 98, -112, -8, 18, -27, 120, 13, 46, 47, 89, 16, 95, 48, -3, 73, -108, 127, 32, -1, -7, -1, 63, -13, -1, 48, 23, 31, 15, 16, -43, -107, 116, -125, -128, -31, 96, 35, 50, -33, -33, 79, -102, 72, 11, 31, 116, -47, 2, -103, 95, -120, 2, 8, -92, -32, 53, 15, -1, -9, -49, 14, 3, 80, -23, 39, 19, 38, -15, 8, 50, 111, 34, 49, -113, 64, -7, -95, 6, 39, -14, 16, 39, -80, -8, 20, -14, -93, 9, 79, 4, 56, 2, 97, 11, 19, 22, -16, 71, 27, 15, 95, 16, 58, 16, -79, -125, 71, 35, 69, 112, -125, 38, -14, 35, 31, 79, -102, 16, -79, -13, -111, -45, 86, 11, 29, 97, 40, 24, 3, -95, 11, 47, 2, -14, 16, -75, 113, 15, 95, 16, -11, 18, -16, 15, -127, 46, 87, -128, 53, 3, -95, 8, -92, -32, -11, -15, 12, -32, 53, 15, -1, 111, -13, -10, -12, -1, 73, 82, -3, -128, -57, 38, -16, 27, 10, -55, -104, -1, -128, 97, -68, -44, 127, 32, 58, 16, 98, 127, 33, 2, 48, -8, -92, -38, 8, -46, 119, 22, -128, -79, 49, -45, 4, 48, -11, -15, 12, -32, 53, 15, -1, -1, 95, -1, -81, 111, -12, -107, 47, -40, 2, 127, 16, -118, 78, -1, -128, 97, -68, -44, 127, 32, 58, 16, 98, 127, 33, 2, 48, -8, -92, -38, 8, -46, 119, 22, -128, -79, 49, -45, 4, 48, -11, -15, 12, -32, 53, 15, 107, -10, -10, -12, -1, 73, 82, -3, -128, 39, -15, 8, -92, -32, -11, -15, 12, -32, 53, 15, -1, -10, -1, 63, 111, -8, 2, -45, -128, 40, 2, 15, -1, 111, -13, -10, 15, -1, -9, 47, 15, 1, 96, 39, -80, -16, 39, 28, -9, 22, 71, -14, 15, -1, -9, 19, -12, -1, 17, -16, 31, 15, 81, 96, 53, 9, 82, -80, -43, -107, 116, -125, -128, -11, 31, 53, 97, 1, -16, -11, 38, -3, 71, -14, 5, 112, 58, 16, -16, 72, -124, 87, -1, -1, 63, -102, 72, 15, 5, -68, -111, 13, 87, 50, 71, -128, 101, -11, 83, -128, -46, -30, -11, -111, 5, -13, 15, 4, 116, 127, 32, -50, 3, 80, -3, -7, 5, -13, 1, 45, -96, -16, 71, 22, 41, 15, -1, -21, 30, 23, -76, 127, 32, 87, 13, 87, -47, 115, 98, 52, 87, -1, -1, 0, -13, 101, -16, 2, 112, -57, 71, -94, -11, 67, 27, 14, -110, 113, 48, 58, 16, -118, 78, 4, -128, 86, -11, 67, 71, -14, -12, 15, -102, 16, -13, -111, 19, 15, 12, -125, 10, 47, 113, 5, 107, 22, -128, -127, 48, 53, 15, -49, -15, 31, 5, 49, 15, -16, 71, 71, -14, -4, -12, 15, -102, 72, 15, 5, -68, -111, 2, -104, 80, 45, 56, 2, -128, 32, -1, -1, 111, -13, -10, 13, -107, 47, -33, -8, 15, -1, -10, -1, 63, 96, -1, -1, 114, -16, -16, 22, -1, -128, 39, -80, -94, -97, 48, 32, -16, 39, 28, -9, 22, 71, -14, 15, -1, -9, 19, -12, -1, -110, 103, 71, -14, -5, 15, -102, 72, 15, 57, 17, 48, -43, 115, 36, 120, 7, 80, -118, 78, -128, -8, 67, -96, 97, -16, 83, 16, -16, 71, 71, -14, 15, 5, -68, -111, -128, 87, 3, -95, -16, -12, 15, -102, 72, 15, 4, -120, 69, 112, -8, 73, -112, -11, 16, -57, -116, -35, 24, -113, 60, -97, 79, -7, 38, 116, 127, 47, -80, -7, -92, -128, -13, -111, 19, 13, 87, 50, 71, -128, 117, 8, -92, -24, 15, -124, 58, 2, -65, -1, -9, -56, 49, 96, -16, 91, -55, 24, -12, -1, -110, 103, 71, -14, -5, 15, -14, 92, 15, 12, -125, 15, 81, 2, 48, 32, -23, 39, 19, 3, 80, -31, 111, 53, 111, 0, 97, -16, 83, 16, 49, 102, 47, 53, 111, 4, 127, 47, 79, -1, 5, 49, -5, 15, -14, 92, 13, 39, 5, 121, -15, 15, 4, 113, 12, 116, 122, 47, 84, 49, -80, -23, 39, 19, -113, 79, -7, 38, 116, 127, 47, -80, -7, -92, -128, -13, -111, 19, 10, 40, 7, 80, -16, 71, 16, -110, -15, 71, -14, 14, 91, -113, 79, -7, 38, 116, 127, 47, -80, -7, -92, -128, -13, -111, 19, 10, 40, 7, 80, -11, 18, -16, -128, 53, 8, -8, 17, -32, -13, 86, 15, 4, 113, -113, 79, -102, 72, 15, 57, 17, 48, -46, 112, -79, -125, 101, -15, 12, -32, 53, 15, 105, -80, -16, 71, 24, 14, 22, 15, 17, 38, -12, -7, -92, -128, -13, -111, 19, 13, 39, 9, 47, 16, -10, -101, 15, 4, 113, -128, -31, 96, -15, 18, 111, 79, -102, 16, -30, -120, -8, 86, -80, -15, 92, 10, 47, 113, 1, 115, 22, 27, 4, -128, 71, -43, 102, 29, 63, -8, 14, -111, 40, 16, 54, -15, 2, -14, 36, 127, 79, -102, 16, -30, -120, -8, 86, -72, 15, 21, -64, 63, 30, 27, 4, 112, 58, 16, 63, -123, 15, 52, 25, -72, 2, 97, 7, 83, 3, -95, 8, 47, 1, -1, -128, -23, 18, -127, 6, 17, 115, 22, 3, -95, -16, -12, -1, 37, -64, -94, -9, 16, -11, 17, 112, -56, 71, -14, 3, -92, -128, -79, -16, 80, -9, 22, -124, 87, 5, -13, 15, -93, 38, -113, -1, -13, 15, 53, 96, -16, 86, 16, 58, 39, 15, -1, -97, -13, 11, 47, 24, -12, 15, -107, 13, 87, 52, 124, 16, -56, 71, -14, 3, -92, -128, -14, 47, 1, -1, -128, -127, 16, 58, 16, 86, -79, 100, 127, 32, 71, -13, 86, -16, 35, 69, 112, 47, 114, 73, 47, 89, 16, -13, 101, -16, 3, -95, 15, -1, 49, -98, 15, 1, 124, -12, 15, 33, 113, 98, 49, -128, 6, 24, 92, 109, 24, 1, 45, -96, -15, 18, 111, 64, 0, 95, 48, 58, 24, 16, 97, -123, -58, -47, -128, -94, -9, 16, -11, 17, 112, 41, -107, -46, 49, -80, 53, 6, 24, 18, 109, -81, 64, 15, -102, 35, 9, 18, -9, 24, 0, 97, -123, -58, -47, -128, -13, 86, 12, -127, 15, 95, 16, 58, 16, -23, 39, 19, -12, 15, -14, 92, 96, 97, -123, -58, -47, -128, 35, 3, -95, 14, -110, 113, 48, 38, 16, 31, -1, 44, 41, 3, 80, 58, 16, -113, -1, 44, 38, 16, 101, 83, 5, -13, 4, 56, 14, 94, -55, 35, 69, 127, 79, -23, 39, 19, 38, -15, 11, 35, 32, 117, 48, 47, 114, 73, 47, 89, 16, 53, 1, -125, 79, 2, 49, 15, 4, 113, 98, -112, -16, 71, 71, -14, 6, 35, 24, -12, -7, -92, -128, -118, 78, 11, 24, 79, 39, 11, 81, -128, 117, 48, -94, -9, 16, 39, -15, 1, 127, 36, 113, -113, 64, -1, 37, -64, -16, -56, 48, 43, -80, 23, -14, 71, 24, 15, 81, -13, 86, 16, 58, 16, -79, -124, -14, 112, -8, 73, -112, -11, 16, 45, -47, -29, 27, -12, -1, 2, -1, -92, -16, -49, 0, -43, -107, 116, -125, 15, 38, 95, -125, -96, 98, 49, 14, 22, 15, 17, 38, -5, 0, -1, -11, 113, 6, 24, 92, 109, 16, 72, 15, 33, 113, 98, 49, -80, 18, -38, 15, 17, 38, 15, 53, 96, 31, 113, 111, 16, 13, 89, 87, 72, 56, -12, -1, -49, 113, 111, 16, -1, -10, -1, 48, -13, 45, 53, 100, 24, 14, 101, -68, -47, 0, 97, -123, -58, -47, -128, 18, -38, 15, 17, 38, -12, -1, 114, -45, 86, 65, -128, 97, -1, -14, -60, 97, 0, 97, -123, -58, -47, -128, 53, 15, 92, 73, -65, 79, -4, -9, 22, -15, 15, -1, 111, -13, -1, -113, -13, -1, 63, -13, 13, 89, 87, 72, 56, 15, 2, -15, 5, -31, 98, 49, 12, -32, 53, 0, -13, 45, 53, 100, 24, -12, -1, -49, 113, 111, 16, -1, -10, -1, 48, -16, 71, 24, 14, 101, -68, -47, 12, -32, 53, 0, 95, 48, 18, -38, 15, 4, 113, 98, -112, 31, 113, 111, 16, -15, 18, 111, 64, -1, 4, 113, -128, 97, -1, -14, -60, 97, 0, 97, -123, -58, -47, -128, 53, 15, 92, 73, -65, 79, -4, -9, 22, -15, 15, -1, 111, -13, -1, -113, -13, -1, 63, -13, 13, 89, 87, 72, 56, 15, 2, -15, 5, -31, 98, 49, 12, -32, 53, 0, -16, 71, 24, -12, -1, 87, 124, 41, 15, -15, 24, 92, 109, 24, 15, -1, -1, 112, -2, -110, 113, 48, -1, -4, 41, -63, 15, -5, 8, -1, -14, 99, -1, -2, -2, 94, -55, 35, 69, 112, -1, -80, -1, -57, 22, -14, -15, 15, -111, -38, 15, -1, -14, 15, -1, -16, -12, -6, -58, -13, 45, 16, -16, 71, 22, 41, -113, -16, 71, 22, 41, 13, 87, -47, 115, 98, 52, 87, -113, -16, 71, 24, -1, 114, -45, 86, 65, -113, -10, 31, 49, 120, 24, -6, 50, 104, -1, -1, 48, -8, 40, 12, 114, -11, -111, 3, 80, -126, -9, 16, -15, 92, 96, 98, -47, 11, 35, 32, -13, 73, 31, 64, -2, -111, 40, 16, 54, -15, 2, -14, 36, 127, 79, -102, 16, -6, 19, 57, 22, -4, -128, -1, 97, -108, -14, -93, 1, 127, 36, 113, 15, 2, -15, 5, 121, -15, 15, 81, 15, 5, -57, 49, -80, 87, 11, 24, 79, 39, -128, -11, 40, 27, 5, 112, 58, 16, -1, 4, 116, -1, -15, -1, 69, -107, 116, -1, -1, 17, 96, -84, -103, -12, -7, -95, 15, -1, 86, -11, 67, 41, 15, -12, 87, -125, 108, -45, 69, 112, -1, 5, -68, -111, 15, 2, -15, 5, 121, -15, 15, 81, 15, 5, -57, 49, -80, 87, 11, 24, 79, 39, -128, -11, 40, 27, 5, 112, 58, 16, -1, 69, -107, 116, -1, -1, 17, 96, -84, -103, -12, -1, 76, -125, 95, 0, -1, 18, -47, 15, -7, 79, -1, -15, 38, -80, -1, -15, 15, -93, 30, 15, 107, 5, -13, 15, -1, -6, -1, -4, 65, -8, 15, -15, 45, 16, -1, -15, 15, -30, -14, 16, -10, -80, 95, 48, -1, -1, -81, -11, -65, 114, 125, 27, 15, -1, 1, -8, 15, -1, -126, -16, 16, -1, -108, -1, -1, 18, 107, 15, -1, 16, -6, 49, -32, -10, -80, 95, 48, -1, -1, 111, -1, -60, 31, -128, -1, -8, 47, 1, 15, -30, 98, -16, 19, 22, -128, -1, -15, 15, -30, -14, 16, -10, -80, 95, 48, -1, -1, 111, -26, 79, 2, 111, 16, -1, 18, -44, 41, 15, -106, 36, 63, -10, 24, -42, 78, 52, 87, 5, -13, 15, -106, 36, 63, -14, 92, 15, 12, -125, 1, -1, -82, 39, -80, 53, 8, -58, -9, 79, 113, -12, 15, -14, 92, 2, 97, 15, 36, -9, 23, 2, 8, -16, 41, -112, 39, -80, -38, 18, -32, -43, -107, 127, 16, -84, -103, 2, 123, 2, 112, 23, -14, 71, 16, -8, -92, -38, 3, 98, -9, 25, -128, 35, 15, -7, 38, -32, -1, -1, -96, -56, 71, -14, 7, 80, -13, -63, -97, 64, -1, 37, -58, 6, 45, 16, -8, 73, -112, -14, 101, -8, 2, 48, 63, -124, -47, 3, -95, 15, 38, 95, -125, -96, 98, 49, 15, 21, -64, -127, -111, -45, 4, 112, -125, 30, 15, 53, -58, -1, -1, -10, 10, 95, -127, -9, 22, -1, -128, 58, 16, -16, 47, -6, 79, 12, -16, 14, 94, -55, 35, 69, 112, -13, 86, 2, 15, 36, -9, 23, 14, -110, 113, 48, 72, 13, -61, 4, 112, -94, -97, 63, 64, -7, -95, 13, 95, 14, -111, 49, -97, 16, -13, -111, -1, -92, -11, -111, 15, -16, 19, 32, -1, 5, 110, -96, -84, -103, 15, -124, -103, 15, 81, 2, -9, 36, -110, -11, -111, 5, 121, -15, 3, 80, -15, 92, 96, 98, -47, -12, -1, 37, -64, -46, 112, -121, 18, -3, 3, -90, 92, -14, -96, 23, 31, 15, 16, 49, 102, 67, 86, -15, 2, 123, 1, -1, -95, -36, 49, 8, 60, 119, 71, -14, 8, -58, -26, 72, 16, 35, 50, -33, -40, -12, 15, -14, 92, 2, 97, 15, 36, -9, 23, 3, 94, -1, -15, -74, 47, -127, 96, -39, 82, -3, -128, 39, -80, 41, -112, -15, 92, 96, -118, 78, -128, -94, -9, 16, -1, -1, -11, -1, -6, -10, 13, -107, 47, -44, 127, 32, -11, -60, -109, 4, 127, 64, -1, 66, 111, 37, 11, 81, -128, 117, 48, -79, -42, 18, -127, 15, 21, -58, 13, -107, 47, -44, 127, 32, 47, 84, -108, 52, 24, -12, 15, -102, 16, -6, 49, 41, 58, 15, -2, 95, 15, 81, 96, 39, -80, -1, 21, -14, -63, 2, 97, 2, 48, -15, 92, 96, -76, -114, 88, 41, -1, -128, 40, 2, 97, 2, 8, -46, 119, 22, -1, -128, -118, 65, -101, 2, 123, 2, 111, 5, 96, -8, 67, -96, -125, 18, -109, -81, 16, -26, 94, 22, 52, 24, -12, 15, -97, -123, 8, -46, 119, 22, -128, -8, -92, -38, 2, -103, 95, -128, -15, 92, 3, 80, -125, 18, -112, -16, 71, 22, 41, -128, -13, 101, -16, 1, 113, -16, -15, 15, 57, 17, 56, 2, 123, 14, -110, 113, 56, 2, 97, 2, -104, 80, 47, 114, 73, 47, 89, 31, 64, -1, 37, -64, -16, 47, 16, -126, -13, 25, -15, 3, 98, -9, 25, 3, -90, 92, -14, -96, -16, 71, 16, -13, 65, -101, -128, 35, 5, 113, 15, -126, 110, 8, -31, 27, 15, 50, -125, 22, 3, -94, 112, 58, 16, -108, -16, 67, -113, 79, -14, 92, 6, -55, 16, 58, 16, -11, 35, 57, 16, -13, 65, -101, -12, 15, -14, 92, 96, -43, -107, 116, -125, -128, 35, 50, -33, -48, -11, 19, 49, 111, -8, 15, 21, -58, 8, -92, -24, 2, 97, 15, 50, -125, 22, 4, 112, -11, 35, 57, 31, -8, 2, 123, 15, 21, -64, -11, -60, -101, 15, -127, 46, 87, -128, -1, -7, -1, -6, -10, 13, -95, 46, 22, 3, -94, 112, 83, -95, 96, 98, -47, -113, 79, -14, 92, 8, 50, 99, 3, -95, 15, 34, -16, 16, -8, 67, -96, 32, -3, 117, -8, -111, -65, 33, 5, -13, 15, -111, -38, 15, -1, -6, 15, -127, 46, 87, -128, 39, -80, -7, 29, -96, -1, -10, 4, 112, 23, 22, -14, -15, 2, 123, 14, 101, -20, -104, 69, 127, 64, -1, -9, 127, 53, 99, -57, 35, 25, -15, -1, -128, -15, 92, 96, 98, -47, 11, 81, -121, -4, 48, -57, -79, 104, 50, 123, 3, -95, 7, 29, 24, -124, 63, 16, 95, 48, -11, -60, -101, 71, -14, 2, 127, 16, -11, -61, 3, -95, 15, 5, -125, 15, 82, -124, -48, -23, 39, 19, 38, -15, 11, 31, 49, 120, 24, 2, 123, 7, 80, -16, 71, 16, -13, 65, -101, -113, 79, -14, 92, 2, 97, 2, 112, 31, -6, -31, 99, 2, 48, -13, 75, -71, 71, -14, 15, -124, 58, 14, -110, 113, 50, 111, 16, 23, -9, 70, 87, -16, 23, 56, -12, 15, -14, 92, 8, 50, 99, 3, -95, 15, 34, -16, 16, -8, 67, -96, -7, 29, -96, -1, -1, -96, 71, 15, -2, 69, 49, -38, 117, -107, -14, -15, 2, 123, 2, 8, -92, -32, -46, -30, -11, -111, 5, -13, 3, 22, 98, -13, 86, -16, 71, -14, 14, -110, 113, 56, 15, 54, 95, 0, 86, -11, 67, -12, 15, -14, 92, 13, 39, 2, 111, 0, -15, 92, 96, -118, 78, -128, -8, 67, -96, -11, 95, 15, 88, 3, -94, 48, -57, 49, 102, 47, 53, 111, 0, 23, 31, 15, 16, -8, 86, -101, -113, 64, -7, 22, 98, -13, 86, -16, 71, -14, 13, 88, 56, 15, 21, -64, 117, 58, 71, -14, 2, 123, 14, -110, 113, 56, 15, 21, -64, -111, 47, 113, 6, 31, 113, 99, 3, 80, 58, 20, 96, 86, 79, 36, 114, -112, 23, -9, 70, 87, -16, 23, 56, -12, 15, -23, 39, 19, -128, -15, 92, 5, -8, 112, -94, -9, 16, -50, 3, 80, 32, -1, -10, -1, 63, 96, -38, 39, -47, 5, -13, 14, 22, -16, 39, 23, 57, -15, 4, -16, -26, 95, 116, 127, 32, 39, 1, 127, 116, 101, 127, 1, 115, 15, 114, 100, 47, 89, 16, -11, -15, 15, -1, 111, 96, -31, 96, -15, 18, 111, 79, -14, 92, 2, 97, 8, 54, 87, -14, 2, 123, 10, 38, -80, 53, 11, 31, 49, 35, -12, 15, -14, 92, 96, -43, -107, 116, -125, -128, 97, -31, -112, 35, 50, -33, -40, 15, 81, 51, 22, -1, -128, -15, 92, 96, -118, 78, -128, -95, 41, 15, 50, -125, 22, -1, -128, -15, 92, 10, 47, 113, 8, -31, -44, 41, 15, 82, 51, -111, 11, 31, 116, -47, -128, 58, 35, 14, 101, 49, -45, 15, 21, -58, 8, -92, -24, 2, 123, 13, 39, 9, 47, 16, -6, -31, 27, 15, -106, 46, 15, 4, 113, 15, 52, 25, -72, -12, 15, -14, 92, 10, 47, 113, 2, 11, 31, 116, -47, 3, -94, 48, 45, 56, 2, -128, -11, 83, -96, 32, -118, 65, -101, 2, 123, 2, 111, 5, 111, 64, -1, 37, -58, 14, 18, -47, -1, -15, -107, -9, 71, -14, 14, 21, -23, 16, 97, -13, -56, 16, 53, 15, 92, 73, -80, -6, -16, 38, 48, -1, -27, -16, -11, -113, 64, 15, -23, 39, 19, 38, -15, 11, 31, 49, 120, 24, 13, 88, 48, -15, 92, 15, -1, -8, -1, 63, 96, -111, -120, -1, -128, 58, 92, -14, -96, -8, 18, -27, 120, 13, 88, 48, -15, 92, 15, -1, -97, -1, -81, 96, -16, 86, 31, 64, -1, 37, -58, 13, 89, 87, 72, 56, 2, 97, 2, -11, -111, 3, 80, 97, -26, 91, -51, 16, -8, -92, -111, 15, 81, 71, -14, 3, 98, 120, -27, 99, 27, 15, 95, 16, -15, 92, 96, -13, -111, 19, -113, 79, -14, 92, 2, 97, 2, 112, 31, -6, -31, 99, 4, 112, -110, -15, 71, -14, 15, 4, 113, 15, 52, 25, -72, -12, 15, -14, 92, 10, 47, 113, 2, 15, 114, -125, 2, 102, 47, 16, 95, 48, -16, 71, 16, 63, 30, 24, 2, 48, -15, 92, 96, -76, -114, 88, 41, 2, 123, 3, -8, 80, -57, 79, -1, 44, 16, -84, -103, 11, 24, 79, 39, 15, -118, 77, -96, 38, 16, -16, 43, 16, -13, 86, 15, 4, 113, 11, 72, -31, 104, 41, -12, 15, -14, 92, 96, -16, 71, 16, -13, 65, -101, -128, 45, 48, 40, 8, -46, 119, 22, -128, 39, -80, -15, 92, 10, 47, 113, 3, -95, 2, -11, 73, 67, -15, 3, 80, 97, -16, 83, 16, -79, 53, 114, 49, 15, 21, -58, 5, -8, 112, -6, 50, 123, 38, -80, -16, 71, 16, -13, 65, -101, -113, 64, -1, 37, -64, -16, 47, 16, -126, -13, 25, -15, 3, 98, -9, 25, 3, -8, 80, -8, 38, -32, -114, 17, -72, 15, 50, -125, 22, 3, -94, 112, 58, 16, -125, 35, 27, 9, 79, 4, 56, 3, -90, 92, -14, -96, 23, 31, 15, 16, -16, 71, 16, -13, 65, -101, -113, 64, -1, 37, -64, -125, 38, 48, 58, 16, -14, 47, 1, 15, -124, 58, 15, -1, -112, -16, 71, 16, -110, -15, 71, -14, 8, -92, -24, 2, 123, 15, -111, -38, 15, -1, -112, 71, 15, -26, 94, -55, -124, 87, 2, 123, 15, -2, 69, -7, 29, -81, 79, -14, 92, 96, 98, -47, 1, -1, -83, 25, -128, 35, 2, -35, 25, 22, 35, 71, -14, 15, 4, 113, 98, -112, -30, -33, -47, 56, 3, 80, -76, -125, 39, 48, -23, 39, 19, -113, 64, -1, 37, -64, -125, 38, 48, -8, 67, -96, 32, -1, -110, 110, 15, -1, -96, 45, -47, -111, 98, 53, 96, 35, 15, 21, -58, 10, 95, 1, 8, 50, 111, 82, -127, 2, 123, 15, -111, -38, 15, -1, -8, 15, -4, 113, 111, 47, 31, 64, -1, 37, -64, -8, 73, -112, 31, 113, 115, -62, -103, -15, 15, 81, 2, -11, -111, 3, 80, -13, -108, 127, 32, -30, -33, -47, 56, 2, 48, 58, 16, -16, 71, -80, 124, -16, -11, 71, -14, 8, -31, 27, 5, -13, 15, -7, 38, -32, -1, -10, -1, -1, 111, 64, -1, 37, -64, -46, 112, -13, -108, 127, 32, -113, 2, -103, 22, 14, 45, -3, 19, -128, 39, -80, 41, -112, 95, 48, -15, 92, 96, -30, -33, -47, 56, 10, 47, 113, 14, 23, 19, 98, 52, 127, 32, -115, 39, 113, 104, 1, -16, -11, 27, -79, -80, 71, 3, -95, -16, -12, 15, -14, 92, 15, -124, -103, 8, 50, 99, 3, -95, 15, 34, -16, 16, 95, -121, 71, -14, 2, 8, 29, 87, -80, -23, 39, 19, 8, 95, 1, 11, 72, 50, 125, 16, 47, -126, -15, 4, -13, 3, -95, 12, 116, -9, 22, -127, 8, 79, -1, -15, 16, 72, 127, -61, 3, 71, -15, -12, 15, -30, -33, -47, 56, 15, 21, -64, -13, -108, 127, 32, 58, 35, 2, 97, 127, -61, 15, 60, -103, -15, 13, 44, -14, -93, 10, 47, 113, 2, 13, -94, 125, 16, 95, 48, 49, 102, 47, 53, 111, 4, 127, 32, 58, 16, 50, 111, 33, 48, -23, 39, 19, -12, -1, 37, -58, 6, 45, 16, 31, -6, -47, -104, 4, 112, -11, -60, -101, 71, -14, 8, 50, 111, 34, 49, -113, 64, -1, 37, -64, -125, 38, 48, -8, 67, -96, -7, 29, -96, -1, -6, 4, 112, -2, 101, -20, -104, 69, 112, 39, -80, -1, 69, 120, 54, -51, 52, 87, -12, 15, -14, 92, 8, 50, 99, 3, -95, 15, 34, -16, 16, -8, 67, -96, 32, -127, -43, 123, 14, -110, 113, 48, 79, 48, 58, 16, -57, 79, 113, 104, 16, -124, -1, -1, 17, 4, -121, -4, 48, 52, 127, 31, 64, 15, -2, 83, -96, -23, 39, 19, -128, -94, -9, 16, -125, 38, -14, 35, 24, -12, 15, -4, -9, 23, 60, 41, -97, 16, -15, 92, 15, 2, -15, 15, 92, 73, -80, -125, 38, -14, 35, 24, 15, -118, 77, -96, -94, -9, 16, -57, -108, -16, 67, 27, 13, 46, 47, 84, -108, 52, 24, -12, 15, -93, 38, -14, 35, 24, 13, 88, 48, -15, 92, 15, -1, -97, -1, -81, 96, -111, -120, 3, 80, -11, -60, -101, -12, 15, -14, 92, 96, 98, -47, 13, 39, 2, -61, 95, 2, 52, -46, -103, -15, 8, -46, 112, 39, -15, 1, 113, -16, -15, 14, -110, 113, 48, -8, 67, -96, 32, -125, 38, -14, 35, 16, -8, -92, -38, 4, -128, 71, 6, 39, -14, 16, 95, 48, 87, 16, 95, 48, -15, 92, 96, -125, 38, -14, 35, 24, -12, 15, -4, -1, -83, 17, -76, 127, 32, 58, 16, -126, -13, 19, -15, 9, 79, 4, 56, 5, -13, 8, 50, 111, 34, 49, -128, 72, 9, 24, -128, -108, -3, 25, -15, 3, 80, -3, 73, -112, -15, 92, 96, -118, 78, -113, 79, -14, 92, 96, 98, -47, 11, 31, 113, -107, -31, -80, 71, 2, 112, 41, 49, 103, 35, 16, -23, 39, 31, 64, -1, 37, -58, 14, 21, -23, 16, -46, 119, 83, 8, -58, -9, 79, 113, 5, 112, -23, 39, 19, -128, 39, -80, -108, -9, 16, 71, 5, 111, 84, 48, 87, 15, 21, -58, 8, 50, 111, 82, -127, -113, -8, 15, -118, 77, -96, 38, 16, -1, -7, -1, 63, 96, -38, 18, -31, 96, 53, 15, 92, 73, -65, 64, -1, 37, -64, -46, 119, 83, 15, 92, 73, -80, -23, 39, 19, 38, -15, 4, 120, 50, -103, 35, 69, 120, -1, -128, -11, -61, 15, 21, -58, 14, 21, -23, 16, -94, -9, 16, 39, 4, 115, 100, 120, 77, 2, -11, 73, 67, -15, 3, 80, -16, 71, 16, 39, -80, -115, 39, 15, 53, 96, 23, 31, 15, 16, -13, -111, 19, -113, 64, -1, 37, -64, -46, 112, 97, -16, 83, 16, -16, 71, 16, -15, 92, 96, 95, -121, 15, -123, 105, -72, -12, 15, -3, -13, 2, 8, 50, 111, 82, -127, 4, -128, -79, -125, 101, -15, 27, -1, -128, 41, -112, -15, 92, 96, -43, -107, 116, -125, -128, 86, -11, 67, 71, -14, 3, -94, 48, -8, 86, -101, 2, 97, 15, -44, -103, 27, -12, 15, -14, 92, 96, -27, -20, -110, 52, 87, 15, 2, -1, -92, -16, -49, 8, 2, 97, 11, 19, 22, -16, 71, 27, 15, 95, 16, 58, 16, 63, 30, 16, 95, 48, -125, 38, -11, 40, 16, -15, 92, 10, 47, 113, -12, 15, -14, 92, 15, -124, -103, 1, -9, 23, 60, 41, -97, 16, -11, 16, 47, 89, 16, 53, 15, 92, 73, -80, 58, 16, -1, 97, 35, -96, -6, 50, 111, 79, -14, 92, 96, 98, -47, 11, 81, -128, 117, 48, -114, 29, 66, -108, -1, -1, 17, 4, 112, 32, -124, 127, 41, 16, 38, 18, -12, 15, -14, 92, 8, 50, 99, 3, -95, 15, 34, -16, 16, -8, 67, -96, -7, 29, -96, -1, -1, 96, 71, 2, -103, 2, 97, 40, 2, 123, 2, 112, 40, -123, 99, -16, 23, 48, 95, 48, -118, 78, -113, 64, -1, 37, -58, 15, -83, 92, 63, -8, 15, -10, 24, 54, 95, 17, 111, -8, 2, 123, 15, -9, 100, -14, 35, 16, -84, -103, -128, -94, -9, 16, 32, -11, -60, -109, -1, -15, 71, 14, 23, 19, 98, 52, 127, 32, -115, 39, 113, 96, -8, -92, -38, 15, 38, 95, -120, 15, 5, 97, 14, 95, -127, 111, 60, -112, 40, 15, 21, -58, 15, -4, -111, -45, 101, 116, -40, 3, 29, -96, 71, -42, 18, -127, -113, 64, -1, 37, -58, 15, 2, -1, -92, -16, -49, 0, -23, 39, 19, 38, -15, 14, 94, -55, 35, 69, 112, 72, 15, -1, -97, -13, -10, 15, 38, 18, 49, 96, 58, 39, 5, 58, 22, 6, 45, 24, -12, 15, -3, -16, -26, 95, 113, -80, -1, 124, 25, 15, -4, -13, -13, 77, 65, 125, -15, -7, 83, 41, 15, -111, 102, 47, 53, 111, 4, 127, 47, -11, -65, 114, 125, 27, 15, -15, 31, 5, 49, 15, -16, 71, 71, -14, -1, -33, 14, 101, -9, 27, 15, -93, 38, -11, 40, 24, -1, -8, 23, 22, 41, 79, -1, -15, 27, 15, -15, 24, 18, 109, -81, -1, 121, 52, -16, 35, 16, -1, 17, -33, 29, -108, 127, 47, -16, 71, 22, 41, 15, -11, -99, -95, -16, -15, -1, -16, 80, -1, 18, -16, 15, -83, 85, -32, -1, -57, -14, 71, 24, -1, 74, 18, -32, -1, -57, -14, 71, 24, -1, -11, 121, -15, 15, -2, 40, 77, 15, -15, 31, 5, 49, 15, -16, 71, 71, -14, -1, -16, 80, -1, 91, -9, 39, -47, -80, -6, -46, 119, 22, -113, -1, 69, -8, 15, -93, 38, 52, 127, 32, -2, 94, -55, 35, 69, 127, -2, -111, 27, 71, -14, 15, -4, -65, 33, 15, -111, -38, 117, -107, -14, -15, -1, 17, -14, 23, 22, 35, 71, -14, 15, -86, 65, -101, -128, -7, -92, -128, -14, 79, 113, -128, -15, 92, 3, -95, 15, -9, -63, -112, -1, 4, -1, -1, 17, 96, 39, -80, -1, -8, 41, 47, -6, -15, 15, -83, 85, -32, 23, -14, 71, 24, 2, 123, 4, 125, 97, 40, 24, 15, 21, -58, 8, 50, 99, 71, -14, 15, -26, 94, -55, -124, 87, 3, 29, -96, -11, -15, 15, -1, 96, -111, -9, 25, -12, 15, -11, -103, 1, 127, 36, 113, -128, -56, 16, -1, -10, -1, -6, -10, 9, 24, -128, -13, -63, -97, 79, -11, -103, 95, -120, 15, 21, -64, 53, 3, 22, 98, -13, 86, -16, 15, 95, 16, 71, -9, 24, 52, 127, 32, -123, -111, -97, 16, 71, 15, -2, 69, 49, -38, 117, -107, -14, -15, -12, 15, -14, 92, 15, 2, -15, 3, 22, 98, -13, 86, -16, 2, 15, 114, 100, 47, 89, 16, -50, 3, 80, -1, -1, 111, -13, -10, -12, 15, -111, 102, 47, 53, 111, 4, 127, 32, -43, -125, -128, -1, -1, 111, -13, -10, 9, 24, -113, 79, -1, -124, -9, 24, 15, 21, -64, 58, 97, 16, 43, -76, 52, 87, 41, 15, 4, 116, 127, 32, -84, -103, -128, 39, -80, 63, -123, 7, 31, -128, 101, -11, 83, -113, 64, -1, 37, -64, -8, 73, -112, -125, 38, 48, 58, 16, -14, 47, 1, 15, -124, 58, 3, -8, 80, -1, 4, -65, 33, 63, -1, 31, -16, 71, 22, -113, 64, -1, 101, 127, -61, 14, 77, -3, 15, -49, -1, 87, -97, 16, -1, -30, -124, -48, -1, 17, -16, 83, 16, -1, 4, 116, 127, 47, -64, -8, 67, -96, 58, 72, 5, -29, 69, 127, 79, -1, -124, -9, 24, 15, 21, -64, 63, -123, 7, 31, -128, -125, 38, -11, 40, 16, -79, -124, -14, 120, -12, 15, -102, 16, -6, 50, 107, 93, -3, 2, -103, 95, -120, 15, 21, -64, 53, 15, 92, 73, -80, -108, -14, -93, 8, -92, -24, -12, 15, -102, 16, -1, -9, -109, 98, 15, -93, 35, 69, 112, 72, 2, 15, 53, 111, 4, -78, -11, -111, 15, -127, 46, 87, -128, -23, 35, -13, 86, -16, -12, 15, -14, 92, 96, -125, 38, -11, 40, 24, 13, 88, 48, -1, -7, -1, 63, 96, -111, -120, 2, 123, 2, 97, 15, -1, -97, -13, -10, 13, -107, 47, -47, -65, 79, -14, 92, 96, 98, -47, 3, 47, -47, -128, 32, -91, -108, -125, 77, 2, -18, 101, 45, -96, 53, 6, 24, 18, 109, -81, 64, -1, -11, 121, -15, 10, 41, -13, 5, -13, 3, -95, 6, 24, 92, 109, 24, 11, 27, 77, 35, 27, 3, 80, 97, -127, 38, -38, 15, -124, -103, 15, 81, 2, -18, -108, 27, 3, 80, 58, 16, -36, 102, 23, 48, -13, 65, -101, 5, -13, 6, 24, 18, 109, -81, -1, -1, 96, -91, -8, 31, 113, 111, -8, 15, -1, 111, -1, -81, 96, 95, 48, 58, 16, 53, 50, -112, -8, 73, -112, -11, 16, 46, -23, 65, -80, 53, 2, -103, 5, 58, 22, 15, 52, 25, -72, -12, -1, -102, 23, 15, 21, -64, -115, 98, -32, 32, -13, -111, 19, 2, 48, 32, -125, 38, -11, 40, 31, -8, 15, 21, -64, 97, -43, -9, 22, 15, -1, -65, -13, -10, 5, -13, 3, -95, 15, 4, 113, 98, -104, 2, 123, 8, 95, 1, 5, -13, 3, -95, 6, 24, 92, 109, 24, -12, 15, -102, 16, 97, -123, -58, -47, -128, 38, 16, 47, 114, 73, 47, 89, 16, -13, 86, 12, -127, 3, -95, 7, 31, -6, 48, -15, 18, 111, 64, -6, -42, 46, -28, 127, 32, 35, 2, 14, -110, 113, 48, -14, 79, 113, -128, -15, 92, 10, 41, -13, 3, -95, 8, 50, 111, 82, -127, 2, -16, 92, 115, -12, -1, 89, -107, -8, -128, -15, 92, 3, 80, 60, 103, 6, 24, 92, 109, 24, 4, 115, 80, -16, 71, 22, 41, -128, -13, 92, 96, 52, -16, 24, 15, 5, 97, 1, -13, -13, 77, 65, 115, -97, 16, 58, 39, 5, 58, 22, 6, 45, 24, -12, 15, -102, 72, 15, 2, -15, 15, 81, 14, 22, -13, 86, -16, 27, 2, 48, 39, -15, 14, -110, 113, 48, -15, 92, 5, -8, 127, 79, -1, 5, 1, 127, 36, 113, -128, -8, -92, -38, 3, 98, -9, 25, 2, 48, -1, -110, 110, 15, -1, -96, 86, 15, 38, 18, 49, 96, -11, -58, 116, 127, 32, 117, 15, 60, 25, 15, -124, -103, 15, 81, 2, -9, 36, -110, -11, -111, -12, 15, -1, 53, -8, 31, 113, 111, -8, 3, -95, 15, -3, 115, 22, -114, 45, 31, -1, 31, -1, 111, -13, 1, 127, 36, 113, 15, -124, -103, 15, 81, 2, -9, 36, -110, -11, -111, -12, 15, -102, 72, 11, 100, -9, 16, 54, 47, 113, -104, 2, 48, -1, -110, 110, 15, -1, 111, -13, 15, -124, 58, 92, 48, 50, -3, 71, -14, 11, 47, 2, -14, 31, 79, -14, 92, 13, 39, 3, -90, 95, -128, 23, -14, 71, 24, 3, 95, 33, 58, 22, 2, 48, -94, -97, 48, -43, -125, -1, -1, -10, 10, 95, -127, -9, 22, -1, -128, 35, 8, -31, 27, -128, 71, 1, -1, -83, 24, -128, 95, 48, -1, -110, 110, 15, -1, -6, -1, -128, 58, 22, 16, 72, 2, 15, -1, 111, -13, -10, 13, -94, 125, 16, 58, 16, 23, -14, 71, 24, 15, -123, 127, -61, 1, 127, 34, -14, 31, 64, -1, 37, -64, -125, 38, 48, -8, 67, -96, -2, 101, -20, -104, 69, 112, 87, 16, -111, -9, 25, 10, 79, 42, 22, 3, -94, 112, -15, 92, 15, -123, -55, -80, 83, -95, 111, -124, -127, -12, -7, -95, 5, 121, -15, 15, 4, 116, 127, 32, -118, 78, 2, -9, 36, -110, -11, -111, 3, 80, -15, 92, 15, -124, -103, 15, 81, 3, -95, 15, -16, 71, 79, -1, 31, -16, 71, 22, -12, 15, -102, 72, 3, 98, 67, 5, -9, 22, 100, -79, -128, -4, -1, 91, -9, 39, -47, -80, -1, 17, -16, 83, 16, -1, 4, 116, 127, 47, -49, 64, -1, 37, -58, 15, 2, -1, -92, -16, -49, 0, -27, -20, -110, 52, 87, 14, 22, 14, -110, 113, 48, 72, 4, 125, 97, 40, 27, 15, 95, 16, -1, -10, -1, 63, 111, 79, -1, 5, 14, -110, 113, 48, -31, 113, 54, 35, 71, -14, 8, -46, 119, 22, -128, -8, 73, -112, -11, 16, 47, 114, 73, 47, 89, 16, 53, 15, 21, -49, 64, -1, -13, 95, -127, -9, 22, -1, -128, -43, 127, 113, 115, 69, 114, -112, -115, 39, 113, 104, 15, -124, -103, 10, 47, 113, 3, -95, 70, 6, 39, -14, 16, -75, -49, 89, 27, -12, -1, 37, -64, -8, 73, -112, -125, 38, 48, -8, 67, -96, -1, -1, 111, -13, -10, 15, 49, -8, 22, 13, 89, 87, 72, 56, -12, -1, -16, 31, -128, 49, -38, -128, 71, 67, 66, -103, -15, 13, 88, 48, 63, -124, -47, 2, -128, -16, -51, -96, 53, 15, 92, 73, -65, 64, -1, 88, 8, 85, 112, 40, 15, 21, -64, 31, -6, -47, 27, 2, -103, 5, -13, 3, -95, 3, 29, -96, 97, -1, -14, -60, 97, -16, 23, 56, 15, 95, 16, 87, 16, -111, -9, 25, -1, -128, 58, 16, -43, -125, 11, 101, -24, 15, 82, -33, -48, 53, 7, 86, -16, 41, -12, 15, -16, 71, 66, 60, 100, -1, -1, 18, 52, 87, 5, -35, -58, -128, 35, 15, -1, -81, 96, 32, -111, -9, 25, 2, 123, 14, 31, 40, 2, 48, -1, -1, -14, -1, 63, 111, 79, -11, -103, 8, -92, 25, -72, 2, 97, 15, -1, -8, -1, 63, 96, -125, 101, 127, 33, 96, 58, 39, 3, -95, 9, 72, 49, -80, 98, 52, 127, 47, 64, -6, -92, 25, -72, 6, 31, 33, 113, 98, 49, 15, -1, 111, -13, -10, 5, -13, 15, 2, -1, -92, -16, -49, 0, -125, 97, 127, 35, -96, 47, 51, 22, 1, -9, 22, -15, 6, 92, 123, 5, -13, 15, 82, 51, -111, -12, 15, -1, 53, -8, 31, 113, 111, -8, 15, 21, -58, 2, 111, 5, 96, -8, 73, -112, 87, -97, 16, -11, 16, -1, -6, -1, 63, 96, 95, 48, 67, -128, 98, 49, -80, -125, 97, 127, 35, -81, 79, -102, 72, 6, 95, 85, 48, -16, 71, 22, 6, 31, -1, 44, 70, 24, 3, -95, 9, 24, -127, 96, 98, -44, 41, 3, 98, 67, 15, -49, -11, -65, 114, 125, 27, 15, -15, 31, 5, 49, 15, -16, 71, 71, -14, -4, -12, -7, -92, -128, -16, 71, 71, -14, 10, -55, -112, 97, -1, -14, -60, 97, -128, 58, 16, -111, -120, 22, 6, 45, 66, -112, 54, 36, 48, -4, -1, 91, -9, 39, -47, -80, -1, 17, -16, 83, 16, -1, 4, 116, 127, 47, -49, 79, -102, 72, 6, 95, 85, 48, -16, 71, 22, 15, -124, -103, 7, 83, 15, 81, 2, -9, 36, -110, -11, -111, 4, -13, 3, -95, 9, 24, -127, 96, 98, -44, 41, 3, 98, 67, 15, -49, -1, 87, -97, 16, -1, -30, -124, -48, -1, 17, -16, 83, 16, -1, 4, 116, 127, 47, -64, 72, 8, 25, 29, 49, -65, 79, -102, 72, 15, 4, 113, 6, 31, -1, 44, 70, 24, 3, -95, 14, 100, -16, 38, -15, 6, 45, 66, -112, 54, 36, 48, 95, 48, -4, -6, -30, -47, 15, -10, 31, 5, -108, 52, 87, -4, -12, -7, -92, -128, -16, 71, 16, 97, -1, -14, -60, 97, -128, 58, 16, -26, 79, 2, 111, 16, 98, -44, 41, 3, 98, 67, 5, -13, 15, -49, -82, 45, 16, -1, 97, -16, 89, 67, 69, 127, -64, 86, 15, -49, -3, 119, 22, -1, -15, -6, 54, 23, -14, 58, -4, -12, -7, -92, -128, -84, -103, 6, 31, -1, 44, 70, 24, 3, -95, 14, 100, -16, 38, -15, 6, 45, 66, -112, 54, 36, 48, 95, 48, -4, -1, -13, -15, -31, 111, -1, 31, -4, -1, -82, 39, -124, 87, -4, -12, -7, -92, -128, -84, -103, 4, -128, -57, 47, 114, 73, 47, 89, 16, 79, 48, -15, 92, 10, 47, 113, 3, -95, 6, 45, 16, -76, -126, -65, 114, 115, 47, 33, 5, -13, 15, -49, -1, 87, -97, 16, -11, 40, 77, 6, 31, 5, 49, 15, 4, 116, 127, 47, -49, 79, -102, 72, 14, 38, 48, 97, -1, -14, -60, 97, -128, 58, 16, -26, 79, 2, 111, 16, 98, -44, 41, 3, 98, 67, 5, -13, 15, -49, -3, 119, 22, -1, -15, -6, 54, 23, -14, 58, -4, -12, -7, -92, -128, -30, 99, 6, 31, -1, 44, 70, 24, 3, -95, 14, 100, -16, 38, -15, 6, 45, 66, -112, 54, 36, 48, 95, 48, -4, -1, -110, 96, -1, 5, 127, 33, 111, -49, 79, -102, 72, 10, -55, -112, 97, -1, -14, -60, 97, -128, 58, 16, -26, 79, 2, 111, 16, 98, -44, 41, 3, 98, 67, 5, -13, 15, -49, -7, 38, 15, -16, 87, -14, 22, -4, -12, -7, -92, -128, -84, -103, 6, 31, -1, 44, 70, 24, 3, -95, 14, 100, -16, 38, -15, 6, 45, 66, -112, 54, 36, 48, 95, 48, -4, -6, -50, 22, 15, -93, 18, -109, -81, -49, 79, -102, 72, 10, -55, -112, 97, -1, -14, -60, 97, -128, 58, 16, -26, 79, 2, 111, 16, 98, -44, 41, 3, 98, 67, 5, -13, 15, -49, -3, 119, 22, -1, -15, -6, 54, 23, -14, 58, -4, -12, -7, -92, -128, -84, -103, 6, 31, -1, 44, 70, 24, 3, -95, 14, 100, -16, 38, -15, 6, 45, 66, -112, 54, 36, 48, 95, 48, -4, -1, 89, 49, 103, 35, 16, -1, 17, 41, 67, -15, -4, -12, -7, -92, -128, -23, 39, 19, 38, -15, 11, 31, 49, 120, 16, 72, 12, 114, -9, 36, -110, -11, -111, 15, -124, 58, 3, -95, 14, 100, -16, 38, -15, 6, 45, 66, -112, 54, 36, 48, 95, 48, -4, -1, -110, 96, -1, 5, 127, 33, 111, -64, 86, 15, -49, -11, -109, 22, 114, 49, 15, -15, 18, -108, 63, 31, -49, 79, -107, 50, -112, 49, 102, 47, 53, 111, 4, 127, 32, 97, -1, -14, -60, 97, -128, 58, 16, -111, -120, 22, 6, 45, 66, -112, 54, 36, 63, -8, 15, -49, -107, 50, -112, 49, 102, 47, 53, 111, 4, 127, 47, 79, -49, -102, 72, 14, 38, 48, 72, 7, 83, 2, -9, 36, -110, -11, -111, 3, 80, -4, -1, 89, 49, 103, 35, 16, -1, 17, 41, 67, -15, -4, 6, 45, 24, -12, -7, -92, -128, -30, 99, 6, 31, -1, 44, 70, 24, 3, -95, 14, 100, -16, 38, -15, 6, 45, 66, -112, 54, 36, 48, 95, 48, -4, -1, 89, 49, 103, 35, 16, -1, 17, 41, 67, -15, -4, -12, -7, -92, -128, -30, 99, 6, 31, -1, 44, 70, 24, 3, -95, 14, 100, -16, 38, -15, 6, 45, 66, -112, 54, 36, 48, 95, 48, -4, -1, 73, 36, -16, 15, -11, -65, -1, -9, -56, 49, 111, -49, 79, -102, 72, 15, 5, -76, -13, 65, -80, -16, 71, 71, -14, 6, 95, 85, 48, 49, 102, 47, 53, 111, 8, 4, 122, 47, 84, 49, -80, -23, 39, 19, -128, -11, -15, 15, -1, 111, 96, -31, 96, -15, 18, 111, 64, -1, -45, 10, 40, 2, 14, 88, 67, 79, 113, 1, -13, -13, 29, 48, 87, 15, 54, 65, 123, -97, 16, -23, 39, 19, -113, -8, 2, 7, 31, 34, 52, -9, 16, 31, 63, 49, -45, 5, 112, 113, -61, 98, -112, 39, -80, 23, 31, 15, 16, -23, 39, 19, -113, 64, -1, -45, 2, -104, 80, -26, 95, 116, -79, -128, -1, -7, -1, -6, -10, 13, -107, 47, -44, 127, 47, 79, -102, 72, 15, 85, -16, -11, 11, 81, -128, 117, 48, -3, 73, -112, -43, -107, 116, -125, -128, 86, 11, 24, 54, 95, 16, 71, -125, 41, -110, 52, 87, -113, 64, -7, -92, -128, -11, 95, 15, 80, -4, -57, 49, 102, 47, 53, 111, 8, -4, 14, -110, 113, 56, 3, 95, -126, 107, 3, -95, 70, 5, 100, -14, 71, 41, 8, 50, 49, 12, -32, 53, 15, -1, 111, 96, -31, 96, -9, 38, 66, -11, -111, 14, 22, 15, 85, -16, -11, 71, -14, 6, -57, -12, 15, -23, 39, 19, 38, -15, 11, 31, 49, 120, 24, 10, 47, 113, 7, 80, 31, 63, 49, -45, 5, 112, 58, 72, 15, 85, -16, -11, -12, -1, 89, -107, -8, -128, -15, 92, 3, 80, -16, 91, 79, 63, 16, 39, -15, 5, -13, 2, 14, -110, 113, 63, -56, 3, -90, 17, 1, 127, 116, 101, 127, 1, 115, 15, 114, 100, 47, 89, 24, 12, -32, 53, 15, 107, -10, -10, 15, 54, 95, 0, 67, -128, 86, 79, 36, 114, -112, -9, 41, -63, -12, -1, 89, -107, -8, -128, -15, 92, 3, 80, -16, 91, 79, 63, 16, 32, -23, 39, 19, -4, -128, -10, -128, -11, -15, 12, -32, 53, 15, 107, -10, -10, 15, 54, 95, 0, 67, -128, 86, 79, 36, 114, -112, -9, 41, -63, -12, -7, -92, -128, -115, 39, 113, 96, -8, 73, -112, -11, 16, -57, 47, 114, 73, 47, 89, 16, 79, 48, -15, 92, 10, 47, 113, 3, -95, 9, 24, -127, 96, 98, -44, 41, 3, 98, 67, 15, -49, -1, 5, 15, -11, -65, 114, 125, 27, 15, -83, 39, 113, 104, -4, -12, -7, -92, -128, -84, -103, 6, 31, -1, 44, 70, 24, 3, -95, 14, 100, -16, 38, -15, 6, 45, 16, 54, 36, 48, 95, 48, -4, -6, -30, -47, 15, -10, 31, 5, -108, 52, 87, -4, -12, -1, -33, 48, -15, 92, 15, -127, 97, 3, 80, 49, 102, 47, 53, 111, 0, -1, -128, 58, 16, -23, 39, 19, -4, -128, -9, 41, -63, 15, -123, -55, -80, 79, 14, 101, -9, 16, 53, 15, -102, 72, 15, 114, -100, 16, 72, 15, 107, -10, -10, 5, -61, -124, -79, 3, -95, 10, 47, 84, 50, -11, -111, 6, 39, -14, 16, -13, 86, 15, 21, -58, 6, 45, 31, 79, -102, 72, 15, 114, -100, 16, 72, 15, 107, -10, -10, 2, -8, 47, 16, -13, 101, -16, 3, -95, 4, -79, 41, 15, 114, -100, 16, -13, 86, 15, 21, -58, 6, 45, 31, 79, -1, 5, 111, 2, -112, -1, -4, 65, -8, -6, -58, -13, 45, 16, -1, 4, 113, 98, -112, -1, -4, 65, -8, -1, 4, 113, 98, -112, -1, 69, 125, 23, 54, 35, 69, 112, -1, -4, 65, -8, -2, -110, 113, 48, -1, -4, 41, -63, 15, -1, -60, 31, -113, -27, -20, -110, 52, 87, 15, -1, -60, 31, -113, -1, 5, 15, -23, 47, 17, 96, -1, -41, -13, 80, -1, -4, 65, -8, -1, 91, -80, -1, -110, -15, 15, -27, 71, 56, 15, -16, 91, 31, -83, 39, 113, 96, -1, 69, -9, 22, 47, 33, 15, -1, 95, 113, 105, 47, 31, -16, 71, 16, -1, 116, 25, -72, 15, -1, 95, 113, 105, 47, 31, -9, -111, 19, 15, -30, 58, -128, -1, -11, -9, 22, -110, -15, -1, -37, -111, 15, -9, -111, 19, -128, -1, 116, -109, 22, -2, -110, 113, 48, -1, -16, 47, 1, -128, -1, -11, -9, 22, -110, -15, -6, -92, -32, -1, 97, -124, -14, 112, -1, 116, -109, 22, -1, 97, -124, -14, 112, -1, 116, -109, 22, 15, -16, 23, -49, -4, 113, -16, -15, 15, -86, 78, 15, -12, -110, -120, 15, -9, 73, 49, 111, -4, 113, -16, -15, 15, -12, -110, -120, 15, -9, 73, 49, 96, -1, 1, 124, -1, -1, -59, 95, 0, -1, 1, 124, -6, -92, -32, -1, 69, -57, 56, 15, -1, 95, 113, 105, 47, 31, -83, 39, 113, 96, -1, -49, 63, 49, -45, 79, 113, 15, 111, -12, 89, 87, -15, -1, 118, 20, -14, -93, 22, -6, -43, -61, -1, -110, 104, -92, -17, -1, 115, 73, 67, -15, -1, -27, -16, -11, 22, -1, 4, 113, 111, -9, -63, -112, -7, 98, 120, -27, 99, -1, 37, -64, -16, -56, 48, -94, -9, 16, 35, 9, 18, -125, 5, 113, 14, -110, -15, 22, 4, 112, 58, 16, -14, 47, 1, -1, -1, 63, -102, 16, -7, 98, 120, -27, 99, 15, -12, -107, 47, -44, 127, 32, -16, 91, -55, 16, -16, 47, 16, 117, 48, -11, 16, -23, 45, 27, 5, 112, 32, -84, -103, 3, -94, 48, -43, -55, -80, -27, -120, 79, 89, -15, 15, 81, 12, -127, -80, -13, 86, 5, -13, -13, 23, -124, -9, 16, -20, 110, 88, 24, -12, -1, 37, -64, -46, 112, 31, -6, -31, -45, 3, -94, 48, -1, -10, 4, 112, -10, -80, -23, 39, 19, -128, -8, 73, -112, -11, 16, -94, -11, 67, 47, 89, 16, 53, 15, 21, -58, 6, 45, 31, 79, -11, -103, 14, -110, 113, 56, 15, -124, -103, 15, 81, 10, 47, 84, 50, -11, -111, 3, 80, -15, 92, 96, 98, -47, -12, -1, -4, 70, 60, 41, -97, 16, 41, -112, -23, 39, 19, -128, -8, 73, -112, -11, 16, -94, -11, 67, 47, 89, 16, 53, 15, 21, -58, 6, 45, 31, 79, -3, 125, 97, 40, 24, 8, -31, 27, 4, 112, -11, 35, 57, 16, -11, -15, 15, -1, 111, -1, -14, -10, -80, -113, -1, 44, 38, 16, 95, 48, -16, 95, 113, -16, 23, 63, 79, -1, 5, 48, -1, 33, 48, -1, -33, 14, -111, -16, 23, 49, -65, 79, -102, 72, 1, 127, 36, 113, 15, -124, -103, 15, 81, 12, 114, -9, 36, -110, -11, -111, 4, -13, 15, 21, -64, -94, -9, 16, 58, 16, -111, -120, 22, 6, 45, 66, -112, 54, 36, 48, -4, -1, -16, 80, -1, 18, -16, -115, 85, -32, -1, -57, -14, 71, 24, -4, -12, -1, 20, -14, -93, -1, -15, -39, 77, -3, 5, 112, 58, 16, -11, -100, 16, -76, 47, 5, 123, 3, 80, -11, 100, 127, 32, -50, 2, 14, 94, -50, 15, 1, 124, 9, 72, 52, 127, 32, 41, -112, 58, 16, 95, 95, -1, -9, 29, 56, 15, 21, -64, -127, 16, 35, 3, -95, 8, 25, 29, 49, -80, -8, 47, 30, 84, 115, -12, 15, -95, -111, -45, 2, 112, 67, 31, 0, 53, 13, -94, 127, 33, 3, -95, 15, -126, -15, -27, 71, 48, 50, 111, 33, 63, 79, -14, 92, 96, 60, 103, 10, 40, 15, 81, 23, 8, -49, 95, 4, 51, 27, -12, 15, -12, -94, 127, 33, -128, -16, 43, 16, 47, 51, 22, 15, 21, -58, 3, -58, 112, -94, -128, -11, 17, 112, -116, -11, -16, 67, 49, -80, -16, 47, 16, -11, 16, -107, -125, -12, 15, -7, 92, -101, 15, 21, -64, -108, -3, 16, 53, 12, 120, -49, 95, 4, 48, -15, 92, 96, 60, 103, -1, -3, -7, -95, 7, 31, -128, 60, 103, 4, -128, -36, 102, 23, 57, -15, 15, 81, 71, -14, 15, 33, 113, 98, 49, -80, -11, -15, 3, -95, 10, 88, 63, 64, -7, -95, 7, 31, -128, 60, 103, 15, -124, -103, 15, 81, 9, 82, -79, -65, 79, -1, 5, 113, -1, -1, 47, -10, 72, 23, -14, 47, 33, -1, 87, -15, -6, 50, 111, 82, -127, -1, 86, -16, 27, 15, -86, 78, -113, -2, 95, 15, 81, 104, -1, -1, 47, -9, 97, 79, 42, 49, 104, -1, -9, 114, 111, 1, -80, -6, -92, -24, -1, 124, 25, 15, -106, 39, -114, 86, 56, -1, 118, 20, -14, -93, 22, -113, -10, 72, 23, -14, 47, 33, -1, 100, -127, 127, 34, -14, 16, 79, 48, -38, 41, -111, 127, 33, -65, -16, 71, 79, 4, -1, -1, 17, 11, 47, 2, -14, 16, 53, 8, 25, -13, -1, 2, -1, -92, -16, 79, -1, -15, 16, 113, 48, -78, -16, 47, 33, -1, 2, -1, -92, -16, 79, -1, -15, 16, -78, -16, 47, 33, 6, 35, 69, -1, 2, -1, -92, -16, 79, -1, -15, 16, -78, -16, 47, 33, -1, 100, -127, 127, 34, -14, 31, -12, 38, -14, 95, -1, -123, 53, -1, 1, 111, 33, -1, -8, 83, 95, -26, 31, 127, -1, 1, -1, -93, -1, 17, 114, -16, 31, -1, -11, 19, 52, -123, 127, -82, -108, 63, -82, -108, 48, -1, 89, -97, -16, 22, -14, 31, -12, -94, 127, 33, -1, 73, 18, 111, -9, -63, -97, -12, 38, -14, 80, -1, -13, 89, -65, -3, 101, 116, -49, 15, -2, 86, 39, 76, -16, -1, -8, 22, -16, 39, 76, -16, -1, 69, -107, 116, -125, -113, -30, -33, -47, 48, -6, -95, -103, -2, -110, 113, 56, -5, -6, 50, 111, 82, -127, -113, -65, -1, 119, 38, -16, 27, 15, -86, 78, -113, -65, -4, -115, 86, 48, -6, -92, -24, -5, -1, 66, -28, 50, -112, -6, -92, -24, -5, -7, 29, -96, -1, -12, 31, 113, -104, -5, -1, 17, -123, -58, -47, -113, -65, -83, 86, 31, -65, -15, 39, -3, -5, -1, 76, 102, 23, 63, -9, 65, -101, 15, -1, 95, 48, -6, 60, -65, 31, -1, -65, -1, -65, -1, -65, -1, -65, -1, -65, -1, -65, -102, 72, 15, 85, -16, -11, 15, -124, -103, 7, 83, 15, -44, -103, 2, 127, 16, 95, 48, 32, -23, 39, 19, -4, -128, -27, -20, -110, 52, 87, -12, -7, -92, -128, -11, 95, 15, 80, -8, 73, -112, -3, 73, -112, 46, -26, 95, -6, 79, 2, 49, -97, 16, -10, -65, 79, 107, -10, -10, 5, -13, 2, 14, -110, 113, 63, -56, 14, 94, -55, 35, 69, 112, 18, -38, 15, 17, 38, -12, 15, -3, -13, 2, 14, -110, 113, 48, -94, -128, 117, 11, 31, 49, 120, 24, 3, -92, -128, -11, 95, 15, 80, 72, 15, 44, 38, 39, 49, 27, 3, 80, -3, 73, -112, 35, 9, 18, -125, 15, 107, 13, 89, 87, 72, 56, -12, -7, -92, -128, -11, 95, 15, 80, -8, 73, -112, 117, 48, -78, -16, 47, 33, 2, 14, -110, 113, 63, -56, 15, 4, 113, -128, 86, 15, 50, -45, 86, 65, -113, 79, -102, 72, 15, 85, -16, -11, 15, -124, -103, 11, 24, 54, 95, 16, 46, -26, 95, -6, 79, 2, 49, -97, 16, -10, -80, 95, 48, 32, -23, 39, 19, -4, -128, -16, 71, 24, -1, -128, -13, 45, 53, 100, 24, -1, -128, 39, -65, -1, -14, 86, 11, 31, 49, 120, 24, 1, 45, -96, -15, 18, 111, 79, -10, 79, 63, 52, -36, -109, -15, 15, -1, 65, -9, 25, -1, -9, 116, -9, 22, -127, 15, -92, -1, -1, 17, -2, -110, -15, 22, 15, -15, 45, 31, -10, 23, -124, 63, 31, -23, 47, 17, 96, -2, 88, 67, 69, 120, -1, 91, -9, 39, -47, -80, -1, -8, 47, 1, -7, -92, -128, -11, -61, 53, 112, 41, -107, -8, -128, -15, 92, 3, 80, -43, 127, 52, -14, -58, 16, -16, -55, 52, -1, -15, -23, 47, 17, 96, -14, 47, 1, -128, 39, -80, -36, -125, 95, 0, 50, 73, 86, 2, -65, 114, 125, 27, 15, 34, -16, 16, 94, 52, 87, -113, 64, -1, 37, -64, -75, 7, 83, 7, 17, -80, 53, 14, 97, -120, 3, -92, -128, -11, -61, 53, 112, -13, 86, 8, 50, 123, 38, -80, -124, 127, 41, 16, -23, 47, 17, 96, -14, 47, 1, -113, 79, -86, 85, 52, 127, 32, -1, 116, -118, 4, 112, 32, -1, -30, 102, 25, -1, 80, -1, -110, -97, -48, 71, 3, -95, 15, -30, 111, -33, -87, 17, -17, -126, -97, -44, 127, 32, 71, 15, -30, 98, -76, -127, -7, -95, 15, -2, 79, 32, -1, -62, -113, 31, -4, 49, 103, 41, 15, -2, -108, -120, -1, 108, -33, -48, -1, -13, -57, 63, -11, 15, -2, 38, 31, 53, 83, 15, -1, -11, 47, 31, -7, 41, -3, -1, 80, -1, 28, -16, -11, -111, 4, 112, 58, 16, -1, -1, 92, 127, 41, 31, -3, 127, 49, -45, 27, 15, -15, 85, 48, -1, 66, 114, -97, -1, -11, -57, -14, -111, 15, -94, -13, 38, 79, -16, 77, 101, -1, -15, -1, -13, 38, -65, 82, -103, -1, 21, -103, 22, 15, -2, 41, -97, -7, 41, -112, -6, 54, 17, 63, -2, 79, 32, -1, -12, 18, -14, -63, -1, -12, 87, -14, 15, -15, 82, -80, 53, 15, -16, 86, 116, 127, 47, -107, -49, 42, 15, -1, 12, 56, -1, -23, 43, 16, -1, 28, 119, 22, -1, 111, -1, 31, -10, 47, 31, -7, 86, -101, 15, -7, 38, 15, -3, -1, -33, -3, -1, -61, 22, 116, 63, 16, 71, 15, -1, 49, -103, -1, -1, -17, -1, 1, -8, 15, -1, -126, -16, 31, 79, 79, 79, -1, -2, -1, -11, -31, 112, -1, -8, 47, 1, -12, -12, -12, -1, -1, -17, -12, 87, 52, 124, 16, -1, -8, 47, 1, -1, -49, -1, -2, -1, -92, 48, -6, 50, 104, -1, -1, 48, 46, -31, 38, -128, 53, 10, 47, 113, 7, 80, -23, 39, 19, 38, -15, 11, 31, 49, 120, 24, -12, 10, 40, 14, -110, 113, 50, 111, 16, -79, -13, 23, -127, -128, -8, 67, -96, 46, -26, 95, -6, 79, 2, 49, -97, 16, -10, -65, 111, 96, -43, -9, 22, 47, 33, -12, -1, 86, 16, -15, 92, 8, -58, 16, -15, 92, 15, -126, 115, 3, 80, -79, -111, 49, 1, -9, 22, -15, 58, 71, -14, 4, 112, 58, 72, 14, -110, 113, 63, -56, 14, 101, -68, -45, 69, 112, -1, -14, -63, -63, -1, -3, 60, 53, 100, 41, -7, -61, 86, 66, -112, -1, -8, 47, 1, -7, -95, 3, -61, 86, 66, -112, -94, -128, -11, 17, 112, 108, 112, -11, 31, 53, 97, -12, 15, -7, 92, -101, 15, 21, -64, -108, -3, 16, -79, -125, 101, -15, 3, -94, 48, -14, 47, 1, 2, 123, 8, 50, 99, 2, 48, 58, 16, -11, 31, 36, 116, 127, 47, -1, -33, -14, 92, 2, 97, 13, -58, 97, 115, -97, 16, 108, 119, 71, -14, 3, -95, 15, -93, 38, -113, -1, -13, 3, -61, 86, 66, -97, 64, -1, 101, 15, 21, -64, -8, 39, 48, 53, 1, -1, -92, 48, 58, 16, 60, 53, 100, 41, -1, -3, -7, -61, 86, 66, -97, -80, -7, -58, 112, -8, 73, -112, 117, 48, -11, 16, -14, 23, 22, 35, 27, -12, 15, -14, 92, 10, 47, 113, 7, 83, 15, 17, 48, -43, -16, -23, 19, 27, 2, -103, 5, -13, 3, -95, 3, -61, 86, 66, -112, 50, -113, -40, 15, 53, 96, 58, 72, 3, -58, 127, 79, -100, 53, 100, 41, -5, 15, -102, 16, -26, 91, -51, 52, 87, 15, -1, 44, 28, 16, -75, 24, 7, 83, 13, 87, 50, 71, 3, -95, 6, 31, -1, 44, 24, 49, -80, 67, 31, 15, 64, -2, -111, 40, 16, 94, 23, 3, -95, 14, 101, -68, -45, 69, 112, -76, 41, 95, 32, 39, -80, 54, -15, 2, -14, 36, 127, 79, -100, 53, 100, 41, -5, 15, -14, 92, 10, 47, 113, 15, 36, -9, 23, 3, -95, 15, 57, 17, 48, 58, 16, -8, 101, 127, 32, -79, -125, 71, 35, 69, 127, 64, -2, 97, -120, 3, -95, 15, -10, 25, 19, 16, -3, 31, 16, 53, 11, 25, 19, 16, 58, 16, -79, -125, 71, 35, 69, 112, -8, 47, 30, 84, 115, 2, 123, 3, 111, 16, 47, 34, 71, -12, -7, -61, 86, 66, -97, -80, -1, 37, -64, -94, -9, 16, -14, 79, 113, 112, 58, 16, -13, -111, 19, 2, 3, 40, -3, 2, 48, 67, -128, -79, -125, 71, 35, 69, 112, -8, 47, 30, 84, 115, -12, 15, -23, 18, -127, 8, 19, 3, -95, 15, -7, 47, 30, 84, 115, 15, -110, -113, -48, 53, 15, -1, -25, 80, 50, -113, -48, -95, 97, -1, -1, 15, 79, -100, 53, 100, 41, -5, 15, -14, 92, 10, 47, 113, 15, 36, -9, 23, 3, -95, 15, 57, 17, 48, 58, 16, -8, 101, 127, 32, 50, -113, -48, 35, 4, 56, 11, 24, 52, 114, 52, 87, 15, -126, -15, -27, 71, 63, 64, -2, -111, 40, 16, 97, 97, 43, 3, -95, 3, -61, 86, 66, -112, 49, -1, -93, 2, 123, 3, 111, 16, 47, 34, 71, -12, -7, -61, 86, 66, -97, -80, -1, 37, -64, -94, -9, 16, -107, 43, 27, 3, -95, 15, -122, 87, -14, 13, 38, -14, 80, 87, 3, -95, 15, 57, 17, 63, 64, -2, -111, 40, 16, 97, 97, 43, 3, -95, 3, -61, 86, 66, -112, 49, -1, -93, 2, 123, 3, 111, 16, 47, 34, 71, -12, -7, -61, 86, 66, -97, -80, -7, -95, 14, 101, -68, -45, 69, 112, -1, -14, -63, -63, 11, 81, -128, 117, 48, -43, 115, 36, 112, 58, 16, 100, -14, -93, 13, 92, 115, 5, -13, 4, 49, -16, -113, 64, -1, 17, 97, 43, 3, -95, 3, -61, 86, 66, -112, 49, -1, -93, 2, 123, 3, 111, 16, 47, 34, 71, -12, -7, -61, 86, 66, -97, -80, -1, 37, -64, -118, 92, -101, 7, 83, 11, 25, 19, 16, 32, -118, 78, 11, 24, 79, 39, 2, 48, 58, 72, 14, 84, 115, 4, 112, 58, 16, 60, 53, 100, 41, -12, -7, -61, 86, 66, -97, -80, -1, 37, -64, -118, 92, -101, 7, 83, 13, -56, 53, -16, 79, -1, -15, 16, 32, -118, 78, 11, 24, 79, 39, 2, 48, 58, 72, 14, 84, 115, 4, 112, 58, 16, 60, 53, 100, 41, -12, -7, -61, 86, 66, -97, -80, -1, 37, -64, -94, -9, 16, 41, 97, 43, -15, 13, 94, 65, -80, 58, 16, 46, -26, 94, 100, 35, 16, -118, 78, 11, 24, 79, 39, -12, 15, -26, 93, 17, -80, 53, 3, -95, 7, 31, -6, 48, -125, 30, 4, 112, 58, 16, 60, 53, 100, 41, -12, -7, -61, 86, 66, -97, -80, -1, 37, -64, -94, -9, 16, 54, 65, -80, 53, 13, 94, -15, 3, -95, 15, -122, 87, -14, 8, -92, -32, -79, -124, -14, 127, 64, -1, 17, 97, 43, 3, -95, 3, -61, 86, 66, -112, 71, -125, 108, -45, 69, 120, 2, 123, 3, 111, 16, 47, 34, 71, -12, -7, -61, 86, 66, -97, -80, -1, 37, -64, -94, -9, 23, -4, 48, -23, 45, 27, 3, -95, 13, 86, 97, -45, 7, -49, 15, 81, 96, 95, 48, -43, -16, -27, 113, 115, -128, 71, 3, -95, 8, -107, 63, 79, -100, 53, 100, 41, -5, 15, -14, 92, 10, 47, 113, 14, -110, -47, -80, 58, 16, -8, 101, 127, 32, -43, -16, -27, 113, 115, 4, 112, 58, 16, -119, 83, -12, 15, -10, 98, -14, 3, -95, 13, 95, 14, 87, 23, 48, -11, 45, -3, 3, 80, 58, 16, -108, -125, -11, 95, -6, 2, 123, 3, 111, 16, 47, 34, 71, -12, -7, -61, 86, 66, -97, -80, -1, 37, -64, -16, -56, 48, -13, 71, 72, -96, 58, 16, 60, 53, 100, 41, 3, 40, -3, -128, -11, 31, 53, 97, 1, -1, -92, 52, 127, 32, 58, 72, 11, 66, -107, -14, -12, -7, -61, 86, 66, -97, -80, -1, 37, -64, -94, -9, 23, -4, 48, -15, 19, 15, 52, 116, -118, 27, 13, 97, 35, 71, -14, 3, -95, 7, 31, -128, -79, -124, -14, 112, -15, 19, -12, 15, -9, 89, -107, -8, 3, -95, 3, -61, 86, 66, -112, 71, -125, 108, -45, 69, 120, -1, -128, 58, 23, 10, 67, 3, -95, 15, -10, 87, 16, -11, -61, 53, 127, 79, -100, 53, 100, 41, -5, 15, -14, 92, 10, 47, 113, 127, -61, 14, 77, -3, 27, 3, -95, 13, 86, 97, -45, 4, -16, 47, 33, 15, 53, 96, 58, 72, 11, 24, 79, 39, -12, 15, -26, 24, -128, 58, 16, 100, -14, -93, 2, 102, 95, -128, -57, -79, 96, 58, 16, -118, 78, 4, -16, 47, 33, 2, 123, 10, 67, 3, -95, 15, -10, 87, 16, -11, -61, 53, 112, 47, 34, 71, -12, -7, -61, 86, 66, -97, -80, -1, -4, 22, 79, 63, 16, 58, 35, 15, 21, -64, -94, -9, 16, 32, -1, 18, -76, 35, 71, -14, 15, -1, 63, 27, 101, -1, -15, -1, 18, -16, 15, -83, 85, -17, -8, 15, -1, -10, 15, -14, 47, -44, -16, 86, 32, -1, -12, 79, 42, 48, -2, -94, -127, 104, -1, -128, -1, -7, 15, -12, 38, -11, 87, 77, 2, 111, 5, 104, -1, -128, 32, -1, 124, 25, 15, -110, 127, -48, 39, -80, 32, -1, -30, 51, -111, 15, -12, 95, 14, -61, 22, 2, 123, 3, 111, 16, 47, 34, 71, -12, -7, -61, 86, 66, -97, -80, -1, 37, -64, -75, 127, -61, 10, 47, 113, 3, -95, 6, 79, 42, 48, -30, 99, -128, 87, 3, -95, 11, 24, 79, 39, -12, 15, -1, -63, 100, -13, -15, 3, -94, 48, 58, 16, -118, 78, 10, 40, 2, 15, -1, 69, 127, 32, -1, -13, -49, 14, 15, -1, -6, 1, 127, 36, 113, -1, -128, 32, -1, 26, 71, 80, -6, -46, 119, 22, 2, 123, 3, -8, 80, -1, 21, -11, 95, -1, 31, -16, 71, 22, -113, 79, -100, 53, 100, 41, -5, 15, -14, 92, 11, 87, -4, 48, -94, -9, 16, 58, 16, 100, -14, -93, 14, 38, 56, 5, 112, 58, 16, -79, -124, -14, 127, 64, -1, -4, 22, 79, 63, 16, 58, 35, 3, -95, 8, -92, -32, -94, -128, 32, -1, 98, -69, -15, 15, -1, 69, 127, 32, -1, -12, 31, 40, 15, -1, -1, 80, 23, -14, 71, 16, 39, -80, -1, -1, 96, -1, 4, 113, 15, -10, 72, -31, 120, 22, 15, -1, -81, -13, -113, 79, -100, 53, 100, 41, -5, 15, -14, 92, 11, 87, -4, 48, -94, -9, 16, 58, 16, 100, -14, -93, 14, 38, 56, 5, 112, 58, 16, -79, -124, -14, 127, 64, -1, -4, 22, 79, 63, 16, 58, 35, 3, -95, 8, -92, -32, -94, -128, -1, 18, -76, 35, 71, -14, 15, -1, 63, 27, 101, -1, -15, -1, 18, -16, 15, -83, 85, -32, 23, -14, 71, 24, -1, -128, -1, -1, -14, 15, -2, -110, -33, -48, -1, 66, 48, -11, 95, 15, 88, 2, 123, 2, 15, -9, -63, -112, -7, 39, -3, 2, 123, 3, 111, 16, 47, 34, 71, -12, -7, -61, 86, 66, -97, -80, -1, 37, -64, -75, 127, -61, 10, 47, 113, 3, -95, 13, 86, 97, -45, 10, -55, -112, -127, -111, -45, 27, 4, 112, 58, 16, -84, -103, 11, 101, -21, 95, -121, -12, 15, -23, 18, -127, 8, 25, 29, 48, 58, 16, -26, 94, 22, 10, -55, -112, -79, -124, -14, 112, 39, -80, 97, 54, -15, -12, -7, -61, 86, 66, -97, -80, -1, 37, -64, -75, 127, -61, 10, 47, 113, 3, -95, 13, 86, 97, -45, 8, -92, -32, -127, -111, -45, 27, 4, 112, 58, 16, -118, 78, 11, 101, -21, 95, -121, -12, 15, -23, 18, -127, 8, 25, 29, 48, 58, 16, -26, 94, 22, 8, -92, -32, -79, -124, -14, 112, 39, -80, 97, 54, -15, -12, -7, -61, 86, 66, -97, -80, -7, -95, 7, 47, 1, 5, -13, 3, -92, -128, -79, -124, -14, 112, 71, 3, -95, 1, -76, 63, 85, -1, -96, -16, -56, 48, -11, 16, -4, -1, -8, 35, 22, -4, -12, 15, -12, -94, 127, 33, 3, -95, 7, 47, 1, 2, 123, 10, 67, 3, -95, 15, -10, 87, 16, -11, -61, 53, 112, 47, 34, 71, -12, -7, -61, 86, 66, -97, -80, -7, -95, 7, 47, 1, 5, -13, 3, -92, -128, -79, -124, -14, 112, 71, 3, -95, 1, -76, 63, 85, -1, -96, -16, -56, 48, -11, 16, -4, -1, 4, 113, 15, -1, 66, -15, 22, -4, -12, 15, -12, -94, 127, 33, 3, -95, 7, 47, 1, 2, 123, 10, 67, 3, -95, 15, -10, 87, 16, -11, -61, 53, 112, 47, 34, 71, -12, -7, -61, 86, 66, -97, -80, -1, 37, -64, -94, -9, 23, -4, 48, -127, -111, -45, 27, 3, -95, 6, 79, 42, 48, -13, -111, 19, -128, 53, 15, 1, 111, 33, -12, 15, -15, 22, 18, -80, 58, 16, 60, 53, 100, 41, 4, 120, 54, -51, 52, 87, -128, 39, -80, 54, -15, 2, -14, 36, 127, 79, -100, 53, 100, 41, -5, 15, -14, 92, 10, 47, 113, 127, -61, 2, -69, 27, 3, -95, 6, 79, 42, 48, -30, 99, 5, 112, 58, 72, 11, 24, 79, 39, -12, 15, -1, -63, 100, -13, -15, 3, -94, 48, 58, 16, -125, 38, -11, 40, 16, -94, -128, 32, -6, 50, 111, 34, 49, 15, -1, 111, -13, -1, 63, -1, -14, -1, -7, -1, -6, -1, 63, 79, -100, 53, 100, 41, -5, 15, -14, 92, 10, 47, 113, 127, -61, 15, 81, 23, 2, -113, -47, -80, 53, 15, 1, 111, 33, 2, 127, 16, -13, -111, 19, -128, 58, 72, 15, 17, 38, -12, 15, -12, 39, -47, -112, 58, 72, 11, 66, -107, -14, 2, 123, 6, 22, 18, -80, 58, 16, 60, 53, 100, 41, 4, 120, 54, -51, 52, 87, -113, 79, -16, 71, 16, -1, -12, 47, 17, 111, -93, 71, -14, 22, -1, -8, 35, 22, -7, -61, 86, 66, -97, -80, -1, 37, -64, -94, -9, 23, -4, 48, -14, 79, 113, 112, 58, 16, -1, -1, -60, -32, -1, -11, 107, 22, 3, -95, 6, 79, 42, 48, 114, -16, 31, 64, -1, 17, 97, 43, 3, -95, 3, -61, 86, 66, -112, 71, -125, 108, -45, 69, 120, 2, 123, 3, 111, 16, 47, 34, 71, -12, -1, 102, 94, -1, 69, -97, -102, 16, 60, 53, 100, 41, 4, -128, -13, 71, 72, -95, -65, 64, -1, 37, -64, -46, 112, -43, 115, 71, -63, 3, 80, -23, 47, 16, 58, 72, 15, 34, -16, 16, 86, 8, 50, 99, 2, 7, 31, -128, -14, 47, 1, 15, 54, 95, 0, 58, 16, -13, 73, 16, -16, 23, -49, 79, -1, -33, -1, -33, -1, -48, -1, 18, 123, 95, 0, -1, -3, -1, -3, -1, -3, -1, -3, -1, -3, -1, -3, 15, -1, 119, -3, 117, -8, 112, -2, -110, -15, 22, 15, -1, -33, -1, -33, -1, -33, -4, -1, -82, 39, -124, 87, 14, -110, -15, 22, -6, 86, 111, 31, -8, 13, 39, -4, 48, -13, 71, -80, 32, -23, 39, 19, 5, 96, -13, -111, 19, 15, 95, 16, 58, 35, 7, 47, 1, -12, -1, -13, -49, 2, 112, -43, 115, 101, -103, 27, -1, 95, -3, 13, 87, 54, 89, -111, -65, -1, 60, -16, 39, 15, -1, -19, -58, 97, 115, -97, 16, 71, 45, 52, -9, 31, -1, -16, -1, 37, -58, 14, 94, -55, 35, 69, 112, 87, 0, -8, 73, -112, -14, 101, -8, 15, 95, 16, -10, -101, -1, 63, -13, 3, 80, -10, -101, -1, 63, -13, 7, 31, -6, 48, -15, 18, 111, 64, -8, 73, -112, 117, 48, -14, 101, -8, 7, 31, -6, 48, -15, 18, 111, 79, -1, 119, 47, 89, 16, 53, 13, 97, 35, 16, 113, -8, 3, -58, 112, -13, 73, 16, -1, -1, 67, -12, -1, -9, 114, -11, -111, 3, 80, -50, -78, 49, 3, -58, 112, -13, 73, 16, -1, -1, 67, -12, -1, -16, 83, 31, -80, -10, -80, -15, 18, 104, 5, -13, 11, 35, 32, 97, 43, -12, -1, 69, -16, -23, 19, 69, 127, -80, -1, -110, -15, -27, 71, 48, -7, 40, -3, -5, 15, 104, -1, -16, 31, -6, 48, -1, -110, -15, -27, 71, 63, -80, -10, -113, -7, 38, -32, -6, -31, 27, -5, 15, 107, -1, -110, 110, 15, -82, 17, -65, -80, -1, -2, -125, 94, -31, -65, -1, -16, -1, 121, 17, 48, -1, 2, -120, -5, 15, 105, -65, -33, -97, -1, -25, 87, 31, -1, -16, -1, 124, 25, -5, -6, -92, -32, -1, 69, -57, 63, -80, -10, -101, -10, -33, 105, -65, -13, -1, 63, -27, -17, -80, 15, -27, -20, -110, 52, 87, -5, 0, -1, -4, 41, -5, 15, -1, -62, -100, 31, -80, -1, -9, 116, 122, 47, 84, 49, -80, 89, -65, -15, 30, 86, 48, 72, 15, 107, 15, 17, 38, -1, -5, -1, -5, -1, -5, -16, -1, 31, -27, -20, -110, 52, 87, -5, 15, -1, 111, -8, -1, 63, -13, -1, 63, -8, -1, 63, -13, -1, 63, -15, 30, 86, 48, 72, 13, -58, 97, 115, -1, -110, 103, 71, -14, -5, 15, -3, -14, 117, 100, 127, 32, -57, 31, -6, -31, -45, 27, 11, 35, 32, 47, 51, 22, 15, -4, -1, -11, -1, 127, 79, -1, -63, 104, 69, 112, -10, -65, 79, 111, -13, -1, -7, -65, 109, -1, 33, 38, -5, 15, 107, -10, -48, 15, -16, 24, -126, -14, 24, -5, 15, 107, 5, -13, 15, 107, -1, 33, 38, -5, 15, 107, -10, -48, 15, -16, 24, -126, -14, 24, -5, 15, -1, -25, 87, 31, -1, -16, -1, -1, -16, -1, 97, -13, 44, -109, -1, -1, -15, -1, 76, -125, 95, 4, -1, -1, 17, 15, -1, -4, 78, 15, -1, 86, -79, 104, -1, 76, -125, 95, 4, -1, -1, 17, 15, -26, 91, -51, 52, 87, 15, -111, -16, -23, 35, 24, -1, 17, -123, -58, -47, 15, -3, 127, 53, -1, 73, 18, 111, -80, 15, -15, 31, 5, -9, 16, 41, -112, 54, 39, -114, 86, 48, 86, -79, 104, -12, -1, -110, 67, -1, -12, 82, -65, -80, 15, -7, 36, 48, -13, 86, 2, 15, 60, -103, 9, 82, -80, 95, 48, -16, 71, 22, 41, -113, 79, -1, -3, -60, -3, -1, -12, 82, -65, -80, 15, -1, 69, 43, 2, -103, 15, 4, 113, 98, -104, 2, -9, 36, -110, -11, -111, -12, -1, -1, -36, 79, -33, -10, 101, -17, -80, 15, -1, 119, -107, 43, 1, -9, 22, -15, 58, 71, -14, 3, -95, 15, 57, 17, 48, 72, 13, 38, 111, 20, 127, 47, 79, 92, 51, 87, -1, -128, 58, 23, 13, -108, -33, -48, 87, 3, -95, 5, 107, 22, 5, -13, 15, 21, -58, 13, -91, 77, 31, 66, 15, -1, -4, 78, -1, -11, 107, -1, -128, -39, 77, -3, 5, 112, 58, 72, 11, 66, -16, 87, -80, -8, 67, -96, 58, 16, 100, -14, -93, 15, 5, -56, 19, 98, 120, -27, 99, 5, 107, 22, -128, 53, 5, 113, 5, -13, 15, -1, -10, 13, 95, 15, 5, 112, -127, 56, -12, 0, -7, 80, -127, -111, -45, -1, -1, -60, -17, -1, 86, -80, -26, 95, 116, -79, -128, 58, 16, 47, 84, -108, 63, 16, 53, 15, -1, 44, 77, -3, -97, 16, -127, 48, 32, -13, -111, 19, -4, -128, 5, -13, 15, 21, -58, 13, 89, 87, 72, 56, -12, -116, -18, 86, 48, -50, 3, 80, -1, -128, 67, 15, -123, -55, -65, -3, -13, 15, 21, -64, -8, 22, 16, 53, 13, 89, 87, 79, -1, -15, 16, -1, 37, -58, 14, 94, -55, 35, 69, 112, 87, 15, -102, 16, 23, 31, 15, 16, -27, -20, -110, 52, 87, 5, 112, 4, -128, 46, -26, 95, -6, 79, 2, 49, -97, 16, 4, -128, -57, -3, 117, -8, 112, 72, 12, 116, 122, 47, 84, 49, -65, 64, -8, 73, -112, -3, 73, -112, 95, 63, 48, 46, -26, 95, -6, 79, 2, 49, -97, 16, -15, 92, 96, -43, -107, 116, -125, -128, 18, -38, 3, -58, 127, 69, -13, 2, -103, 13, 89, 87, 72, 56, 15, 21, -64, -127, 51, -111, 5, 112, 67, 1, -9, 22, -15, 3, -58, 127, 64, -8, 73, -112, -116, -18, 86, 48, 32, -27, -20, -110, 52, 87, 5, -13, 12, -32, 53, 15, -124, 58, 71, 3, -95, 6, 39, -14, 16, 95, 48, 5, -13, 4, -128, 3, 80, 5, 112, -16, 91, 79, 63, 16, 58, 16, 13, -58, 97, 115, -97, 16, 72, 15, -1, 119, -3, 117, -8, 127, -14, 92, 96, -43, -107, 116, -125, -128, 38, 16, 79, 15, 12, 113, 3, 83, 80, 58, 16, 31, 63, 49, -45, -128, 95, 48, -1, 37, -58, 13, 89, 87, 72, 56, 14, 97, -13, 22, 14, -110, 113, 56, 15, -118, 22, 16, 58, 16, 4, -128, -11, 19, -8, 17, 112, 2, 123, 15, -14, 92, 13, -58, 97, 115, -97, 16, -27, -120, 24, -128, 49, -38, 117, -107, -14, -15, 3, 95, -86, 78, 15, -1, 2, -16, 31, -23, 39, 19, -5, 15, -1, -65, -1, -65, -1, -65, -1, -65, -16, 71, 22, 41, 15, -12, 87, -47, 115, 98, 52, 87, -5, 15, -13, -1, 63, -13, -1, 63, -13, -1, 63, -13, -3, -7, -1, 47, -80, -1, -1, -12, -5, 15, -3, -1, 111, -80, -2, -110, -15, 22, 15, -1, -1, 63, 107, -1, -16, 87, 31, -16, 71, 22, 41, 15, -12, 87, -47, 115, 98, 52, 87, -5, 15, -1, 87, 15, -84, 111, 50, -47, -5, 15, -16, 71, 71, -14, 15, -15, 35, 31, -80, -1, -1, -60, -17, -1, 86, -80, -7, -61, 86, 66, -97, -80, -1, 37, -64, -94, -9, 16, -14, 79, 113, 112, 39, 4, 125, 86, 97, -45, 3, 98, 120, -13, 22, 5, 107, 22, -12, 15, -23, 18, -127, 6, 22, 18, -80, 58, 16, 60, 53, 100, 41, 3, 31, -6, 48, 39, -80, 54, -15, 2, -14, 36, 127, 79, -100, 53, 100, 41, -5, 15, -14, 92, 10, 47, 113, 15, 36, -9, 23, 2, 112, 71, -43, 102, 29, 48, -1, -14, -62, 115, 67, -15, 4, 112, 32, 54, 39, -113, 49, 96, 86, -79, 111, 64, -2, -111, 40, 16, 97, 97, 43, 3, -95, 3, -61, 86, 66, -112, 49, -1, -93, 2, 123, 3, 111, 16, 47, 34, 71, -12, -1, 86, 16, -15, 92, 8, -58, 16, -15, 92, 15, -124, -118, 3, 80, -14, 23, 22, 35, 16, 117, -8, -1, -3, 0, -7, -92, -128, 94, 52, 87, 11, 81, -128, -1, -16, -1, -11, -7, 15, 44, 38, 39, 49, 16, 58, 35, 2, -103, 14, -110, -15, 22, -128, -94, -9, 16, 60, 103, 27, 4, 112, 58, 20, 96, 60, 103, -113, 79, -14, 92, 13, -58, 97, 115, -97, 16, -94, -9, 16, -10, -80, -10, -113, 104, 2, 123, 15, 107, 4, 112, -26, 91, -51, 52, 87, -10, -113, 64, -1, -33, 48, -15, 92, 11, 25, 19, 16, 58, 72, 11, 24, 79, 39, -1, -128, 58, 24, 16, -118, 78, -128, -8, 73, -112, -11, 16, -79, -125, 101, -15, 27, 2, 123, -1, -1, 37, 96, 97, -16, 95, 113, -80, -13, 101, -16, 3, -95, 15, -1, 44, 28, 24, -12, 15, -11, 97, 15, 21, -64, -116, 97, -1, -3, -1, 37, -64, -36, 102, 23, 57, -15, 10, 47, 113, 15, 107, 15, 104, -10, -128, 71, 14, 101, -68, -45, 69, 112, -1, -14, -63, -63, -113, 104, -12, 15, -3, -13, 15, 21, -64, -79, -111, 49, 3, -92, -128, -79, -124, -14, 127, -8, 3, -95, -127, 8, -92, -24, 15, -124, -103, 15, 81, 6, 31, 5, -9, 27, 15, 54, 95, 0, 58, 16, -1, -14, -63, -63, -113, 64, -1, 86, 16, -15, 92, 8, -58, 31, -1, -33, -14, 92, 13, -58, 97, 115, -97, 16, -94, -9, 16, -10, -80, -10, -113, 104, -12, 15, -3, -13, 15, 21, -64, -79, -111, 49, 3, -92, -128, -79, -124, -14, 127, -8, 3, -95, -127, 8, -92, -24, 15, -124, -103, 15, 81, 11, 24, 54, 95, 17, -65, 64, -1, 86, 16, -15, 92, 8, -58, 31, -1, -33, -14, 92, 13, -58, 97, 115, -97, 16, -94, -9, 16, -10, -80, -10, -113, 104, 2, 123, 15, 107, 4, 112, -26, 91, -51, 52, 87, -10, -113, 64, -1, -33, 48, -15, 92, 11, 25, 19, 16, 58, 72, 11, 24, 79, 39, -1, -128, 58, 24, 16, -125, 38, -11, 40, 24, 15, -124, -103, 15, 81, 11, 24, 54, 95, 17, -80, 39, -65, -1, -14, 86, 6, 31, 5, -9, 27, 15, 54, 95, 0, 58, 16, -1, -14, -63, -63, -113, 64, -1, 86, 16, -15, 92, 8, -58, 31, -1, -33, -14, 92, 13, -58, 97, 115, -97, 16, -94, -9, 16, -10, -80, -10, -113, 104, 4, 112, -26, 91, -51, 52, 87, 15, -1, 44, 28, 24, -10, -113, 64, -1, -33, 48, -15, 92, 11, 25, 19, 16, 58, 72, 11, 24, 79, 39, -1, -128, 58, 24, 16, -125, 38, -11, 40, 24, 15, -124, -103, 15, 81, 6, 31, 5, -9, 27, 15, 54, 95, 0, 58, 16, -1, -14, -63, -63, -113, 64, -1, 86, 16, -15, 92, 8, -58, 31, -1, -33, -14, 92, 13, -58, 97, 115, -97, 16, -94, -9, 16, -10, -80, -10, -113, 104, -12, 15, -3, -13, 15, 21, -64, -79, -111, 49, 3, -92, -128, -79, -124, -14, 127, -8, 3, -95, -127, 8, 50, 111, 82, -127, -128, -8, 73, -112, -11, 16, -79, -125, 101, -15, 27, -12, 15, -11, 97, 15, 21, -64, -116, 97, -1, -3, -1, 37, -64, -36, 102, 23, 57, -15, 10, 47, 113, 15, 107, 15, 104, -10, -128, 71, 14, 101, -68, -45, 69, 112, -1, -14, -63, -63, -113, 104, -12, 15, -3, -13, 15, 21, -64, 27, 67, 3, -92, -128, -79, -124, -14, 127, -8, 8, 95, 1, 5, -13, 3, -95, -127, 8, -92, -24, 15, 2, -15, 15, 81, 6, 31, 5, -9, 27, 15, 54, 95, 0, 58, 16, -1, -14, -63, -63, -113, 64, -1, 86, 16, -15, 92, 8, -58, 31, -1, -33, -110, -113, -33, -80, -10, -113, -7, -2, -5, 15, 104, -1, -110, 110, -5, 15, 107, -1, -110, 110, -5, 15, -1, -24, 53, -18, 27, -1, -1, 15, -16, 40, -113, -80, -10, -101, -3, -7, -1, 97, -124, -14, 112, 39, -80, -2, 101, -14, 98, -16, -16, 71, -14, -1, -1, 81, -13, -13, 15, -1, -11, 90, 120, 87, -1, -1, 81, -13, -13, 15, -16, -33, -2, 100, -79, -1, 91, -76, 52, 87, 41, 15, -11, -1, -33, -1, -11, 31, 63, 54, 31, 16, -1, -1, -74, 44, -120, -1, 86, 63, -123, 111, -33, -16, 77, -94, 25, 15, -12, -12, 15, -16, 73, -111, 111, -4, -16, -11, -110, -1, -1, 21, 112, -1, 12, -109, 79, 1, -76, 32, -1, -41, -33, 79, -4, 100, -48, -1, 74, 39, -14, -1, 4, -38, 33, -112, -1, 17, 77, -81, 2, 119, -1, -13, 25, -32, -1, 116, -111, -1, -1, -68, 99, 15, -1, -5, 97, -16, 22, -1, -26, 19, 48, -1, -1, -74, 31, 1, 111, -111, -38, 116, -46, -112, -1, 91, -9, 77, 31, -10, 47, 116, -80, -2, -49, 42, -1, 12, -124, -33, -4, -16, 73, 15, -1, 49, 109, 31, 47, -91, -57, -80, -1, -49, 63, 49, -45, -113, -16, 42, 23, -74, 32, -6, 47, 14, 35, -81, -23, 47, 16, -7, 24, 49, 104, -6, 47, 0, -1, -31, -99, -95, 111, -2, 73, -112, -1, -27, -107, -113, -33, 31, -10, 47, 113, 15, -2, -51, -93, -94, -97, -1, -5, 23, 48, -1, 65, -75, -110, -2, 19, 22, 15, -12, 25, 25, -110, -1, 98, 116, 25, 15, -12, -95, 114, -55, 63, -30, -55, 15, -4, 127, 52, 25, -65, -16, 77, -94, 25, 15, -1, -122, 65, 111, -31, 49, 96, -1, -13, 23, 100, -3, -127, 127, -7, 73, -108, 47, 0, -1, -13, 22, -110, 127, -31, 49, 15, -1, 53, 101, -78, 127, -2, 97, 115, 15, -1, -11, 23, -127, 127, -16, 38, -3, 15, -1, -5, 23, -8, 86, 58, -15, -6, 60, 15, -1, -5, -108, 127, 47, 2, 127, -93, 31, 113, 15, -1, -5, 108, -15, -1, 21, -11, 22, 48, -1, -12, 47, 15, 95, -1, -11, 79, 0, -1, -12, 39, 31, -1, 52, -109, 87, 15, -1, 66, 127, 33, -1, -1, 85, 112, -1, -12, 31, -1, -63, 31, -12, -90, 72, 15, -16, -33, -2, 100, -79, -1, -1, 81, -13, -13, 15, -16, -33, -12, 40, -87, 39, -65, -2, 19, -96, -1, 5, -58, -116, 123, -1, 74, 100, -128, -1, -16, 85, 127, -107, 127, 16, -2, 45, -95, -43, -1, 74, 100, -128, -2, 25, 63, -1, -15, -7, 87, -15, 15, -15, 31, 23, 89, -72, -1, -1, 81, 119, 79, 49, 96, -6, -38, -108, -33, -33, 81, 103, -65, -4, 100, -3, 15, -89, 46, -31, 111, -11, 123, 97, -8, 15, -93, 22, 66, 127, -1, -11, 31, 63, 48, -6, 53, 113, -1, 20, -38, 38, -80, -6, -57, -1, 98, -9, 75, 15, -102, 65, -97, -2, 98, -80, -7, -91, -16, -24, 87, -7, -91, -16, 40, 15, -1, -59, 79, 35, -1, 21, -120, 15, -14, 92, 127, 40, 15, -102, 16, 113, -8, 3, -58, 112, 72, 2, -9, 36, -110, -11, -111, -12, 15, -7, 92, -101, 15, 21, -64, -108, -3, 16, 53, 9, 82, -80, 67, -1, -3, -7, -95, 7, 31, -128, 60, 103, 4, -128, 47, 114, 73, 47, 89, 31, 79, -91, 102, -15, -1, -128, -11, -61, 3, -95, 3, -58, 112, -94, -128, 41, 97, 43, -15, 15, 81, 23, 15, 33, 113, 98, 49, -65, 64, -1, 87, -15, 13, -94, 127, 33, -128, 117, 48, 41, 97, 43, -15, 8, 47, 113, -80, -94, -9, 16, -11, 17, 112, -107, -125, -12, 15, -7, 92, -101, 15, 21, -64, -108, -3, 16, 53, 9, 82, -80, 58, 16, 113, -8, 3, -58, 127, -1, -33, -11, -61, 80, -1, -8, 23, 22, 35, 16, 72, 11, 72, 47, 89, 27, 15, 81, -46, -56, 16, 41, -112, 95, 48, 58, 16, -84, -16, 39, 14, -110, -15, 22, -128, 38, 16, -79, 43, 5, 96, 71, 45, 52, -9, 31, 79, -1, 5, 49, -5, 15, -93, 38, -113, -1, -13, 14, 97, -13, 22, -128, 32, -115, 97, 23, 6, 24, 89, -61, 69, 112, 95, 48, 35, 9, 18, -125, 15, -1, -1, 47, -13, -1, 63, -6, -1, -1, -81, -13, -1, 48, -8, 67, -96, -1, -7, -1, -6, -1, -1, -96, -43, -107, 104, -12, 15, -91, -16, 16, -9, 72, -62, -112, 25, 31, 1, 115, -128, -16, 47, 16, 46, -31, 38, 9, 24, -128, 58, 39, 5, -29, 79, 2, -112, 71, 15, 21, -58, 13, -58, 97, 115, 15, 116, -79, 80, -16, 91, 31, 79, -102, 16, -13, 73, 16, -1, -1, 79, -128, -8, 40, 13, 97, 35, 27, 15, -124, 58, 2, 7, 31, -127, 96, -9, 22, -124, 87, 5, -13, 15, -93, 38, -113, -1, -13, 15, -14, 92, 15, 12, -125, 12, -17, 38, 43, 16, 53, 15, 81, 2, -11, -111, 3, 80, 97, 43, 3, -92, -128, -13, 73, 31, 75, 18, -77, -58, 113, -80, 71, -125, 73, -112, 92, 62, 38, 52, 41, -97, 16, -75, 113, -43, 102, -50, 49, -73, 83, 5, 112, 58, 16, 100, -14, -93, 15, 17, 38, 117, 48, 71, 3, -95, 6, 79, 42, 48, -14, 47, 1, -1, -12, 93, 35, 69, 127, -80, 15, -1, -17, 107, -1, -128, -10, -65, -1, -16, -1, 116, 25, -80, -7, -15, -31, -5, 0, -10, -113, -9, 65, -101, 15, -15, 43, 76, -113, -80, 15, 107, 9, -12, -15, -12, 15, -1, -17, 105, -80, -16, 71, 24, -1, -1, 15, -10, 29, 47, 16, 98, 49, -5, 0, -10, -101, 15, -1, -14, 15, 17, 38, -1, 4, 113, -128, -110, 75, 14, 22, 15, 17, 38, -5, 15, -16, 47, -6, 79, 12, -16, 8, 47, 49, 8, -31, 27, -5, 15, -12, -94, 125, 16, -1, -1, 32, -97, 79, 31, 64, 95, 48, 32, -92, 63, -80, -1, 111, 15, 32, -75, 113, 3, 80, 18, -38, 8, -92, -17, -80, -1, 4, 112, -78, -16, 47, 33, 11, 87, 16, 53, 15, 57, 17, 63, -80, -1, -16, -49, 15, 81, 104, 4, 112, -30, 97, 115, -95, -124, -128, 38, 16, -13, 86, 15, 57, 17, 56, 13, 87, 50, 71, 71, -14, 2, 8, -92, -32, -8, 67, -96, 98, -16, 8, -43, 94, 1, 127, 36, 113, -113, 64, -1, -16, 83, 16, 58, 35, 3, -95, 13, -94, 125, 16, 95, 48, -92, 51, 71, -14, 2, 15, 4, 113, 15, 37, 24, 12, -32, 58, 16, -10, 9, 72, 49, -80, -13, 86, 15, -4, -1, 95, -12, -1, -13, 15, -126, 110, 15, 21, -64, 31, -6, -47, 27, 3, -95, 8, 47, 49, 8, -31, 27, -12, -1, 17, 114, -16, 16, -1, 121, 17, 63, -102, 72, 8, 50, 111, 82, -127, 10, -55, -112, 97, -1, -14, -60, 97, -128, 58, 16, -111, -120, 22, 6, 45, 66, -112, 54, 36, 63, -8, 15, -49, -3, -16, -26, 95, 113, -80, -6, 50, 111, 82, -127, -113, -49, 79, -102, 72, 8, 50, 111, 82, -127, 10, -55, -112, -94, -128, 32, -114, 45, 16, -75, -33, -48, 39, -80, -46, 112, -11, -60, -101, 8, -92, -24, -12, -7, -92, -128, -125, 38, -11, 40, 16, -84, -103, 11, 81, -128, 117, 48, -94, -9, 16, 32, -114, 45, 16, -75, -33, -48, 39, -80, -46, 112, 117, 48, -11, -60, -101, 8, -92, -24, -12, -1, 89, -107, -8, -128, -13, -111, 19, -128, -8, 67, -91, -61, 13, 38, -14, 80, 53, 15, -1, -9, -49, 14, 3, 80, 39, -15, 5, 58, 22, 14, -110, 113, 48, -8, 67, -96, 32, -6, 50, 111, 34, 49, 4, 112, 32, -124, 127, 41, 16, -15, 18, 111, 79, -11, -103, 95, -120, 14, -110, 113, 56, 3, 80, -13, -108, 127, 32, -16, 71, 22, 41, 14, 45, -3, 19, -128, 35, 5, 58, 22, 14, -110, 113, 56, -12, -1, 101, 113, -1, 66, 125, 25, -1, 97, -124, -14, 127, -1, -60, 31, -113, -10, 25, 19, 16, -1, 97, -124, -14, 127, -4, -76, 48, -1, 97, -124, -14, 112, -8, 67, -96, -123, -16, 16, -8, 86, -3, 11, 87, 31, -12, 38, -14, 80, -1, 124, 25, 15, -10, 93, -3, -16, 47, -6, -1, -9, 121, 79, 4, 49, -65, 107, 5, -13, 15, 107, -10, -101, 5, -13, 15, 105, -65, 107, -1, -65, -1, -1, 63, 107, -5, -1, -1, -13, -1, -10, -1, -1, -81, -73, 17, -72, 15, 107, -50, 3, 80, -10, -65, 107, 8, 29, 87, -72, -10, -65, -65, 111, -13, -1, -7, -65, 107, -5, -10, -1, 63, -1, -101, -5, -10, -1, 63, -1, -101, -10, -80, -78, -15, -113, -8, 15, 107, -5, -10, -1, 63, -1, -101, -5, -10, -1, 63, -1, -101, -1, 17, -1, -14, -60, 97, -128, 31, -6, 45, 57, -15, 15, -12, 39, 10, 89, -80, -50, 3, 80, 87, 16, 5, 96, -10, -128, 38, 16, -10, -113, 64, 0, 0, 0, 0, 0, 0, 0, 0, 15, -33, -97, -13, -1, 48, -1, 69, -125, 5, -13, 15, 104, 15, -1, 60, -103, -1, 69, -125, 5, -13, 5, 113, 15, 104, -10, -113, -16, 47, -6, 15, -9, -63, -97, -65, -11, 111, 5, 111, -65, -86, 65, -101, -113, -65, -15, 35, 71, -14, -5, -1, 98, -16, 47, 33, -5, -2, 97, -79, -13, 71, 27, 15, -15, 45, 31, -12, -56, 53, -16, 15, -15, 45, 31, -12, 95, 14, -61, 22, 15, -23, 47, 17, 111, -1, 5, 15, -23, 47, 17, 111, -1, 31, -1, 31, -1, 16, -1, -16, 80, -2, -110, -15, 22, 15, -1, 31, -1, 31, -1, 31, -4, -76, 48, -1, 18, -47, -12, -12, -12, -1, -16, 31, -113, 79, 79, 79, -1, 94, 23, -12, -12, -12, -7, -95, 15, 104, -7, -95, 15, 104, 15, -1, -17, 104, -1, -1, 15, 104, 15, -1, -17, 104, 13, 95, 14, -61, 22, 14, -110, -15, 22, -1, -1, 15, 104, -12, -1, -81, 107, -10, -113, 74, -10, -65, -1, -126, -16, 31, 79, -6, -15, -6, 50, 104, -1, -1, 48, -1, -8, 47, 1, 15, -9, 73, 24, -1, -1, -97, -5, -12, -1, -1, -12, -1, 47, -1, -7, -6, 50, 104, -1, -1, 48, -1, -8, 47, 1, 15, -9, 73, 24, -1, -1, -97, -5, -12, -1, 31, -5, -1, -1, -97, -11, -103, 15, -9, 73, 24, -1, -1, -97, -5, -12, -1, -65, -1, -7, -6, 50, 104, -1, -1, 48, -1, -8, 47, 1, 15, -9, 73, 24, -1, -1, -97, -5, -12, -1, 15, -5, -1, -1, -10, -1, -65, 79, -1, 63, -81, -97, -1, -1, 111, -5, -12, -1, 31, -5, -1, -1, -97, -93, 38, -113, -1, -13, 15, -1, 53, -125, 15, -9, 73, 24, -1, -1, -97, -5, -12, -1, -13, -6, -7, -1, -1, -97, -11, -103, 15, -9, 73, 24, -1, -1, -97, -5, -12, -1, -65, -1, -7, -2, -110, -15, 22, 15, -1, -1, 63, -1, 111, -1, -6, -5, -1, -16, 31, -128, -7, -58, 112, -1, 95, 114, 73, 47, 89, 31, -1, 53, -125, 15, -16, 91, 16, -10, -80, -2, -110, -15, 22, 15, -1, 92, 63, 109, -10, -1, 63, -1, -8, -65, 111, -13, -1, -1, -117, -10, -1, 63, -1, -8, -65, 111, -13, -1, -1, -117, -10, -33, 109, -10, -65, -15, 30, 18, 48, -1, -11, 107, 22, -113, -10, 29, 18, -127, -65, -16, 71, 22, 41, -128, -1, -11, 112, -1, -13, 39, -65, -16, 71, 24, -1, 114, -45, 86, 65, -113, -15, 24, 92, 109, 24, -1, -1, 47, -14, 18, 96, -2, 94, -55, 35, 69, 127, -83, 39, 113, 96, -7, -15, -31, -6, -46, 119, 22, 15, -15, 39, -14, 31, 107, -1, -1, 47, 107, 9, -12, -15, -12, -10, -80, -108, -14, -93, 15, 17, 38, -113, 107, 9, -12, -15, -12, -1, 97, -13, 23, -127, -113, -10, 31, 49, 120, 16, -7, -15, -31, -1, 97, -13, 15, -12, 95, 113, 98, -14, 31, -26, 91, -51, 52, 87, -10, -80, -1, -15, 15, -1, -33, -1, -33, -1, -48, -15, 18, 104, -10, -80, -1, -15, 15, 107, 15, 17, 38, -113, 107, 15, 17, 38, -1, -16, 31, 113, 111, -81, -44, -18, 27, -1, 88, 15, -1, 1, 27, 27, -1, 98, 127, 33, 111, -1, 119, -107, 43, -1, -9, 125, 22, 50, 71, -1, 121, 17, 56, 4, 112, -1, -11, 111, 84, 63, -1, 83, -95, 96, -1, 121, 17, 56, 15, -1, 49, 97, -2, -110, 113, 48, -1, -4, 65, -8, -2, -110, 113, 48, 0, 0, 0, -1, -15, -1, -15, -1, -15, 15, -1, -3, -63, -63, 4, -128, -1, -49, 14, 63, 16, -1, -15, -1, -15, -1, -15, 0, 0, 0, -1, -15, -1, -15, -1, -15, 15, -107, -32, 95, 48, 58, 16, -1, -1, -36, 28, 16, -1, -15, -1, -15, -1, -15, -2, 101, -68, -45, 69, 112, -1, -1, -36, 28, 16, -13, 86, 15, 104, -1, 17, -1, -14, -60, 97, -80, -1, 4, 113, 98, -104, -5, -10, -65, 111, 96, -1, 101, 113, -1, -128, 0, -1, 69, -16, -23, 19, 69, 112, -6, -30, -47, -1, 69, -125, -5, -1, -1, -16, 7, 80, -125, 38, -11, 40, 16, -1, -1, -15, -1, 101, -33, -48, -1, 66, -30, -44, 63, 31, -11, 111, 5, 111, -86, 65, -101, -113, -10, 47, 2, -14, 31, 105, -69, -17, -16, 40, -128, -1, 102, 79, 113, 111, -16, 47, -6, 27, 15, -1, 92, 63, -1, 1, -9, 22, 0, 0, 0, 15, 105, -80, -15, 18, 111, 109, 0, 15, -1, 5, 113, 15, -11, -9, 36, -110, -11, -111, -7, 29, -96, -1, 17, -1, -14, -5, -1, -15, -1, -15, -1, -15, 15, -1, 5, 113, 15, -1, 31, -1, 31, -1, 31, -12, 88, 63, -80, -10, -101, -3, -1, 69, -125, -5, 15, 105, -65, -1, 119, -1, 95, 114, 73, -1, 95, 114, 73, 47, 89, 31, -16, 40, -113, -80, 15, 107, -3, -7, -1, -110, 110, -5, 0, -6, -92, 25, -80, -6, 54, 23, -14, 58, -5, 0, -1, 86, -16, 86, 15, -93, 97, 127, 35, -81, -80, 15, -27, -8, 22, -5, 0, -1, 18, 127, 33, -5, 0, -1, 93, -36, 98, -33, 31, -80, 15, -14, 92, 13, -58, 97, 115, -97, 16, -94, -9, 16, -13, -111, 19, -128, -56, 71, -14, 3, -92, -128, -11, 35, 57, 16, -23, 39, -12, 15, -3, -13, 15, 21, -64, -79, -111, 49, 3, -92, -128, -23, 39, 3, -95, -15, 15, -124, -103, 15, 81, 2, -120, 79, 39, 27, 3, -95, 7, 31, -6, 48, -23, 39, 12, -32, 71, 3, -95, 9, 72, 63, 79, -1, 5, 49, -5, 15, -1, 1, -8, 14, 40, -113, -123, 107, 15, -124, -103, 15, -1, 15, -1, 95, -112, 50, -3, 16, 31, 63, 49, -45, 15, -1, 127, -1, 15, -97, -3, -1, -12, 3, -95, 15, -1, 15, -4, -1, -1, -12, -7, 3, -58, 127, 79, -1, 5, 49, -5, 15, -30, -120, -8, 86, -80, 72, 1, -13, -13, 29, 52, -9, 16, 79, 15, 1, -76, 35, 25, -15, -12, -1, 74, 39, -14, 16, -1, -13, 88, 48, -2, 40, -113, -123, 107, -1, -57, 49, 96, 58, 16, -30, -120, -8, 86, -65, -65, 105, -65, 79, 105, -80, 15, -1, 68, -14, -93, 15, -14, 18, 104, -10, -101, -12, -10, -101, 0, -97, 79, 31, 79, -10, 17, -32, -6, -30, -47, -6, -30, -47, 15, -1, -17, 107, -1, -128, -10, -65, -1, -16, -10, -113, 104, 15, -16, 71, 16, -1, 116, 25, -65, -1, 86, -11, 67, 71, -14, 15, 104, -10, -128, -1, -80, -10, -65, -86, 78, 15, -106, 39, -113, 49, 111, -93, 94, -31, -65, -1, -13, -1, -110, 110, 15, 105, -65, -7, 38, -32, -10, -65, 105, -80, 95, 48, -10, -101, -3, -7, -10, -101, 5, -13, 15, 105, -65, 15, 47, -31, 109, 23, 48, -1, 73, 82, -3, 27, -1, -41, -13, 71, 67, 31, -4, -125, -12, 15, -15, 39, -14, 31, 105, -80, -97, 79, 31, 79, -2, 24, 48, -1, -110, 110, 15, -9, -111, 19, 15, -12, 95, 14, 88, 67, 69, 112, -1, -5, -1, -5, -1, -5, -1, -5, 9, -12, -15, -12, -1, 124, 25, 15, -1, -2, 15, -12, 38, -14, 95, -1, -2, -1, -1, 81, 51, 72, 87, -1, -1, -12, -1, -1, -17, 49, 111, -3, 112, -1, 97, 30, 15, -82, 45, 31, -16, 71, 71, -14, 15, -15, 35, 16, -31, 96, -1, 33, 38, -5, 15, -1, -65, -1, -65, -1, -65, -1, -65, -1, -80, -3, -7, -1, -110, -15, -27, 71, 48, -7, 40, -3, -1, -56, 48, -1, 124, 25, 15, -1, 120, 47, 33, -10, -101, -3, -7, -10, -101, -16, -14, -1, -110, 110, 15, -9, 45, 53, 111, -106, 47, 113, -112, -7, 79, 1, -1, 100, -125, 39, -47, -1, 121, 17, 48, -1, -110, -15, -27, 71, 56, -1, 69, -16, 71, -14, 15, -9, 101, -16, 15, -1, 1, -1, -93, 15, -7, 47, 16, -2, 48, 0, 15, -2, 35, 57, 16, -2, -110, 120, -12, -12, -12, 15, 53, 96, -10, -80, -15, 18, 111, 109, 68, 123, 31, 52, 116, 49, -97, 31, -15, 25, 35, 69, 120, -12, -12, -12, -1, 17, -110, 52, 87, -6, 50, 60, -113, -95, 48, -1, 97, -125, -1, 21, -61, 31, -106, 47, 113, -108, 127, 32, 35, 15, -7, 38, -32, -10, -65, 104, -5, 15, -10, 24, 52, 114, 52, 87, -5, 15, -1, -65, -1, -65, -1, -65, -1, -65, -1, -65, -1, -65, 111, 107, -12, -10, -65, 111, 111, 107, 15, -1, -17, 107, -1, -1, 15, 107, 15, -1, -17, 107, -1, -1, 0, -1, -1, 32, 23, -14, 71, 31, 107, -10, -10, -1, -1, 47, 107, -10, -10, -1, -9, -127, 15, -93, 38, -14, 35, 31, 104, -1, 4, 113, 98, -112, -2, 45, -3, 19, -6, 41, -9, 47, 33, 15, -102, 72, 11, 31, 116, -47, 6, 31, -1, 44, 70, 24, 3, -95, 14, 100, -16, 38, -15, 6, 45, 66, -112, 54, 36, 48, 95, 48, -4, -1, -41, 113, 96, -6, 54, 23, -14, 58, -4, -12, -7, -92, -128, -79, -9, 77, 16, 97, -1, -14, -60, 97, -128, 58, 16, -26, 79, 2, 111, 16, 98, -44, 41, 3, 98, 67, 5, -13, 15, -49, -82, 45, 16, -1, 97, -16, 89, 67, 69, 127, -49, 79, -102, 72, 11, 31, 116, -47, 6, 31, -1, 44, 70, 24, 3, -95, 14, 100, -16, 38, -15, 6, 45, 66, -112, 54, 36, 48, 95, 48, -4, -1, -41, 49, 104, 49, -103, 38, 15, -106, 47, 113, -111, 111, -49, 79, -102, 72, 11, 31, 116, -47, 6, 31, -1, 44, 70, 24, 3, -95, 14, 100, -16, 38, -15, 6, 45, 66, -112, 54, 36, 48, 95, 48, -4, -1, -13, -15, -31, 96, -1, -49, -6, -30, 120, 69, 127, -49, 79, -87, 95, -120, 2, -103, 8, -92, -24, 4, 112, -43, -16, -11, 35, 15, 95, 16, -1, -10, 8, -1, -14, -62, 97, 5, -13, 15, 5, -9, 31, 1, 115, -12, -1, 17, -68, -47, -128, 58, 16, 31, 63, 49, -45, 79, 113, 113, -120, 5, -13, 5, 58, 22, 14, -110, -15, 22, -128, -39, 82, -3, -128, -11, -15, 15, -1, -81, 111, -11, -45, -128, 40, 2, 15, -1, -97, -13, -1, 63, 15, 32, 39, 52, -1, -15, -16, 35, 49, 96, -13, -63, -112, 50, 127, -48, 39, -80, -14, 23, 22, 35, 24, 15, -1, -81, -13, -16, -14, 5, -13, 15, 60, 25, 1, -9, 22, -15, 15, 17, 38, -12, -1, -41, -42, 18, -127, -128, 58, 16, -78, -16, 47, 33, 11, 87, 16, -11, -15, 2, -103, 15, 81, 47, 0, -8, 18, -27, 120, 5, 112, 58, 16, -118, 78, 15, 95, 16, -10, -65, 111, 111, 79, -102, 72, 15, -1, -9, 47, 15, 4, 127, 32, -79, -9, 77, 16, 97, -1, -14, -60, 97, -128, 58, 16, -26, 79, 2, 111, 16, 98, -44, 41, 3, 98, 67, 5, -13, 15, -49, -3, 119, 22, 15, -93, 97, 127, 35, -81, -49, 79, -1, 50, -128, 32, -10, -65, 111, 96, -38, 39, -47, 5, -13, 11, 31, 57, 29, 52, 127, 32, 71, -43, -16, 71, -14, 3, 86, -31, -75, 24, -12, 15, -10, 31, 57, 29, 49, -80, 53, 110, 27, 81, -128, -8, 73, -112, -125, 73, -112, 97, -68, -47, 8, -92, 25, -72, 15, -1, -28, -13, 2, 127, 16, -11, -15, 15, -1, 111, -1, -14, -1, -1, -14, 3, -95, 11, 47, 2, -14, 16, -9, 41, -63, -1, -1, 15, 79, -102, 16, -16, 91, -55, 16, 71, -42, 18, -127, -128, 58, 16, 45, -36, 98, -33, 16, 95, 48, -15, 92, 96, 53, 110, 27, 81, -128, -11, -15, 15, 107, -10, -10, 2, 123, 4, 125, 97, 40, 24, 15, 21, -58, 4, 116, 52, 35, 79, 113, 15, 95, 16, -10, -65, 64, -1, -33, 48, 39, 1, 113, -16, -15, 8, -92, -32, -94, -128, -1, -1, 114, -16, -16, 22, -128, 58, 16, -43, -16, -20, 49, 96, 45, 56, 3, 80, 95, 63, 56, 19, 3, -95, 70, 1, -13, -13, 29, 56, -12, -7, -95, 5, 100, -14, 71, 5, -13, 3, -92, -128, -30, 99, 4, -128, -57, -3, 117, -8, 127, 79, -102, 16, 86, 79, 36, 112, 95, 48, 58, 72, 10, -55, -112, 72, 12, 127, -41, 95, -121, -12, -7, -95, 5, 100, -14, 71, 5, -13, 3, -92, -128, -26, 93, 24, -128, 72, 12, 127, -41, 95, -121, -12, -7, -95, 5, 100, -14, 71, 5, -13, 3, -92, -128, 23, -14, 71, 16, 72, 12, 127, -41, 95, -121, -12, 15, -11, -69, -128, -1, -10, -1, -1, 47, -1, -8, 8, -1, -14, -62, 97, 5, -13, 15, 5, -9, 31, 1, 115, 2, 123, 14, 101, -9, 75, 24, 15, -1, 111, -13, -10, 13, -107, 47, -44, 127, 47, 79, -102, 72, 14, 38, 48, 41, -123, 2, -45, -128, 40, 2, 15, -1, 111, -13, -1, 59, -32, -118, 65, -101, -1, -128, -1, -7, -1, 63, 96, -39, 82, -3, -1, -128, -1, -7, -1, 63, 96, 53, 110, 27, 80, -1, -1, 114, -16, -16, 22, -1, -128, -1, 95, -1, 15, -10, 2, 15, -1, -1, 47, -13, -1, -1, 47, -1, -8, -1, 48, -97, 79, 31, 64, -115, 39, 113, 111, 79, -102, 72, 14, 38, 48, 41, -123, 2, -45, -128, 40, 2, 15, -1, 111, -13, -10, 13, -107, 47, -33, -8, 4, 125, 97, 40, 24, 3, 86, -31, -75, 2, -35, -58, 45, -15, 12, -32, 53, 15, -1, 111, -13, -10, -1, -128, -1, 95, -1, 15, -10, 2, 15, -1, 111, -1, -81, -13, -1, -1, 47, -1, -1, 95, -1, -96, -97, 79, 31, 64, -115, 39, 113, 111, 79, -102, 72, 15, -127, 46, 87, 13, 39, 2, -104, 80, -11, 95, 15, 80, -23, 39, 19, -128, -1, -2, -1, -7, -10, 13, 89, 87, 72, 56, 15, -44, -103, 27, -1, -128, -1, -6, 4, 120, 50, -103, 35, 69, 120, 11, 24, 54, 95, 17, -65, -1, -16, 2, 123, 9, 47, 16, -1, -1, -113, -13, 8, 50, 123, 38, -80, -16, 71, 24, -1, -1, 47, 17, 38, -12, -7, -92, -128, -26, 93, 24, -128, -14, 79, 113, -128, 32, -23, 39, 19, 2, 7, 31, -128, -11, 70, 58, -12, 15, -11, -103, 3, 98, -47, -128, 95, 48, -44, -9, 73, 79, -1, -15, 35, 69, 112, -1, -2, 40, 75, 16, -13, 101, -16, 3, -95, 14, 21, -23, 31, -1, -16, 2, 97, 1, -108, -16, 71, 35, 27, 2, -128, 58, 16, -23, 39, 19, 6, 31, 116, 50, -108, -1, -1, 17, -128, 67, -127, -97, 48, 71, 53, 2, 112, 23, 52, 97, -97, 16, 113, -8, 15, -123, 105, -65, 79, -1, 95, -121, -128, 95, 48, 41, -112, -23, 39, 19, -113, 64, -1, 83, 50, 71, -128, -7, 29, -96, 71, 15, 52, 25, -72, -12, -1, -49, -6, -47, 27, -128, 32, -115, 86, 16, 95, 48, -12, 15, -4, -1, -83, 17, -72, 8, 29, 87, -80, -23, 45, 16, -115, 86, 16, -11, -15, 15, 64, -1, -13, 40, 2, 14, 101, -68, -45, 69, 112, -46, -30, -44, 63, 16, 95, 48, 58, 92, -126, 123, -12, 15, -1, 95, -121, -128, -46, -28, 50, -112, -118, 78, -113, 64, -1, -13, 40, 3, -95, 10, 79, 42, 24, 48, -115, 86, 16, 47, 51, 22, 15, 17, 38, -113, 64, -1, -108, 119, 22, 15, 12, -125, 15, 1, 19, 0, 95, 48, 58, 16, 47, 85, -9, 16, -127, -111, -45, 27, 13, 100, 49, 100, 47, 64, -1, 83, 9, 18, -125, 0, -15, 18, 104, 15, 12, -125, 14, 40, -128, -11, 31, 53, 97, 2, 15, -124, 119, 22, 4, -128, -79, -39, 38, 27, -12, 0, -23, 39, 19, -113, 79, -1, 52, -125, 86, -15, 5, -13, 15, -15, 93, -3, 15, -91, -108, -65, -93, 47, 89, 31, -16, 88, 57, -15, 15, -93, 47, 89, 31, -11, -9, 22, 47, 33, -6, -108, -14, -93, -97, 16, -1, -4, 89, 35, 73, 31, -1, -59, -110, 52, -111, -1, -49, -6, 54, 31, 1, -97, 16, -1, -4, 89, 35, 73, 31, -1, 69, -46, 52, 87, -5, -1, 97, -125, 71, 35, 69, 127, -65, -93, 47, 84, -108, 63, 31, -65, -1, -17, 107, -1, -128, -10, -65, -1, -16, -7, -95, 3, 98, -79, 96, 97, -1, -14, -63, -125, -128, 71, 49, 97, -125, 27, 14, 38, 52, 24, 3, 80, -127, 123, 4, 48, 32, -13, -111, 19, 15, -124, 58, 2, 48, -111, 40, 48, -1, -6, -1, 63, -13, -1, 63, -33, -112, 95, 48, -16, 71, 22, 41, -128, 87, 15, 85, 38, -80, 53, 15, 81, 2, -11, -123, 111, 81, -80, 71, 53, 3, -95, 3, 98, -79, 111, 64, -1, -45, 5, -13, -13, 22, -128, 49, -38, 117, -107, -14, 77, 41, 2, -120, 72, 50, 125, 16, 71, 6, 19, -58, 127, 79, -106, 43, 22, 4, -128, 54, 47, 113, -108, 127, 32, 35, 15, -7, 38, -32, -10, -65, 79, -4, 40, 49, 96, -1, -20, 119, -15, -1, -1, -76, -103, -1, -1, 117, -15, -1, 5, -16, -16, 47, -56, 10, 25, -31, 111, -100, 99, -111, -2, 85, -71, 31, -16, 67, 31, -1, -121, 35, -1, 21, -11, 71, -1, -11, -125, 100, -38, -1, -8, 85, -127, -1, -12, -15, 71, -14, 15, -2, 40, 50, 107, -2, 67, 15, -2, -55, -97, -107, 83, -87, 24, -128, -7, 79, 33, 111, -15, -91, -79, 15, -3, -119, 39, -80, -1, 17, -65, -15, 47, 0, -1, 21, -65, -82, 67, 52, 127, 32, -1, 69, -11, 98, -1, -4, 23, 95, 5, -56, 15, -10, 97, 43, 117, -49, 42, 63, -12, 101, -8, 112, -1, -1, 81, -8, 25, -6, 73, -9, 22, 15, -95, 110, 23, 63, -1, -1, 65, 117, -44, -79, -7, -15, -22, 85, 127, -1, -3, -62, 111, -33, -7, -92, -17, -1, 66, -118, -7, 22, 101, 111, -10, 95, 32, 95, 48, -1, -110, 111, -28, -65, 33, 87, -1, 18, -14, 71, -14, 15, -15, -49, -38, -1, 2, 116, -13, 24, 48, -1, 97, -125, 71, -15, -1, 121, -15, 71, -14, 15, -12, 95, -113, -2, 67, 49, 96, -1, -13, 38, -9, 24, 63, -31, 45, 93, -3, -6, 47, 44, 38, 95, -2, 43, -110, 123, -128, -1, -49, -6, -26, 24, -113, -2, 100, -14, -93, 15, -82, 83, -6, 54, 39, -14, 16, -1, -12, 95, 113, -1, 102, -12, 15, -10, 18, 58, -6, -43, 109, -81, -1, -122, 92, 123, 15, -1, 53, -14, -1, -16, 47, -47, -80, -1, 5, -111, 15, -15, 35, -7, 22, 100, 22, -2, 77, -3, -1, -8, 92, -14, 31, -1, -123, 111, 33, -1, -8, -61, -1, 84, 107, 41, 31, -4, -14, -14, -1, -20, -113, 16, -1, -31, 31, -95, 27, 22, -6, -27, 97, -2, -91, 23, 79, -6, -2, -97, 31, 5, -61, -81, -10, -61, -15, -1, -4, 40, -126, -97, -1, -119, 95, 113, -11, 95, -6, -2, 22, -13, 29, 48, -1, -12, 95, 36, -33, -2, 95, -6, -46, 111, -2, 85, 63, -31, 19, -1, 79, -1, -1, 95, -1, -8, -1, -12, 86, -1, -23, 45, -3, 15, -1, 53, -101, -2, 100, -33, -39, -15, 15, -31, 38, -1, -26, 72, 57, -15, 15, -1, 73, 47, 2, -6, 73, 23, 48, -1, 12, -111, -6, 47, 44, 38, 95, -12, 108, 125, -81, 16, -1, 70, 67, 49, 111, -1, 69, 127, 32, -1, -1, 85, -89, 15, -92, -97, 113, 111, -2, -110, -33, -33, 81, 38, -65, -102, 72, 57, 31, -1, -4, 95, 15, 84, 31, -97, 30, -91, 75, -1, -1, -63, -18, 95, -1, 76, -33, -33, 16, -1, -53, -76, 31, -7, 75, -14, 19, -2, 89, -15, -1, 5, -14, -1, 18, 127, 33, 111, -83, 98, -18, 22, -1, -27, -14, 31, 31, -1, 53, 104, 16, -1, 121, -15, -1, -13, 86, 113, 63, -10, 98, -14, 87, 15, -9, -97, 31, -7, 40, -17, -3, 115, 108, -79, 111, -3, 115, 22, -47, -29, 86, -1, -1, -36, 24, 63, -3, 127, 52, 116, 49, 15, -1, -60, -124, 87, -1, -26, 40, -128, -1, -1, -73, -51, -3, -111, -7, 41, 87, -1, -16, 34, -14, 98, -1, 66, 51, -111, 15, -26, 91, -1, 88, -57, -79, 111, -2, -110, -79, -1, -8, -62, 107, 66, 112, -1, 87, -14, 25, -6, -3, -15, 15, -9, 86, 63, -92, -97, 113, 96, -7, 95, -127, 111, -31, 115, 47, 37, 127, -16, 87, 89, 67, -81, -15, 93, -3, 5, -13, 15, -1, -124, -11, 98, -109, 38, -2, 83, 35, 95, -12, -49, 81, -1, 97, 35, -96, 87, 15, -10, 31, 2, 123, -1, -13, 78, 3, 80, -11, 16, -6, -1, -14, -62, 97, -6, -22, 22, 16, 95, 48, -1, 101, 95, 15, -1, -126, 49, -8, 47, 16, 53, 15, -1, 49, -103, -1, -49, 116, -112, -6, -30, -8, 127, -11, -103, -1, 86, -16, 86, -1, -31, 47, 0, -1, -111, 46, 87, -113, -2, 95, 15, 88, -1, -55, 29, 54, 77, 41, -1, -57, -14, 71, 24, -1, 1, -38, 39, 77, 41, -1, 4, 113, 15, -1, 66, -15, 22, -113, -16, 71, 71, -14, 15, -15, 95, 85, 56, -1, -11, 111, 84, 50, -97, -23, 39, 19, 38, -15, -6, -46, 119, 22, -113, -86, 65, -101, -113, -86, 78, 15, -1, 60, -103, -113, -93, 38, -11, 40, 16, -1, -13, -55, -104, -7, 22, 98, -13, 86, -16, 71, -14, -7, 86, -31, -75, 24, -1, -111, 46, 87, -113, -10, 31, 116, -47, -113, -94, -13, 16, -84, -103, 15, 2, -120, -5, 0, -6, 47, 49, 6, 39, -14, 31, -80, 15, -7, 38, 116, 127, 47, -80, -6, -92, -24, 12, -32, 53, 15, 107, -3, -7, 15, 4, -14, -93, 15, 81, 8, -51, -47, -120, -13, -55, -97, 16, -14, 35, 27, 12, -32, 53, 15, 107, 9, -12, -15, -12, 15, 92, 48, 31, -6, -47, 27, 71, -14, 3, -95, 8, 50, 49, -80, -108, -16, 67, -128, -8, 73, -112, -46, -56, 16, -78, -16, 47, 33, 3, 80, 58, 16, -13, -111, 19, -12, -1, -110, 103, 71, -14, -5, 15, -86, 78, -128, -46, 112, -11, 16, -116, -35, 24, -113, 60, -103, -15, 15, 34, 49, -80, -50, 3, 80, -10, -80, -97, 79, 31, 64, -11, -61, 1, -1, -83, 17, -76, 127, 32, 58, 16, -125, 35, 27, 9, 79, 4, 56, 15, 2, -15, 13, 44, -127, 11, 47, 2, -14, 16, 53, 3, -95, 15, 57, 17, 63, 79, -7, 38, 116, 127, 47, -80, -6, -92, -24, 12, -32, 53, 15, 107, -3, -7, 13, 39, 15, 81, 8, -51, -47, -120, -13, -55, -97, 16, -14, 35, 27, 15, 92, 48, 31, -6, -47, 27, 71, -14, 3, -95, 8, 50, 49, -80, -108, -16, 67, -128, -16, 47, 16, -46, -56, 16, -78, -16, 47, 33, 3, 80, 58, 16, -13, -111, 19, -12, -1, -110, 103, 71, -14, -5, 15, -102, 16, 97, -47, 79, 116, 127, 32, -23, 39, 19, 15, 12, -125, 10, 47, 113, 2, 15, 2, -120, 11, 100, -9, 22, 5, 96, 67, 15, -124, -103, 3, 47, -47, 11, 47, 2, -14, 31, 79, -7, 38, 116, 127, 47, -80, -7, -95, 6, 29, 20, -9, 71, -14, 14, -110, 113, 48, -16, -56, 48, -94, -9, 16, 32, -16, 40, -128, -74, 79, 113, 96, 35, 9, 18, -125, 2, -128, -46, -30, -11, -111, 5, 96, 67, 15, -124, -103, 3, 47, -47, 11, 47, 2, -14, 31, 79, -23, 39, 19, 15, -1, 2, -16, 31, -93, 38, -11, 40, 31, -27, -20, -110, 52, 87, -1, 66, -17, -1, -62, -100, 31, -26, 91, -51, 52, 87, -1, 4, 113, -1, 114, -45, -1, 97, -13, 23, -127, -1, 4, 113, 98, -104, -1, 4, 116, 127, 32, -1, 18, 49, -1, 4, 112, -1, 69, 125, -1, 17, -123, -58, -47, -113, -10, 100, -9, 22, 15, -10, 24, 63, -15, 92, 52, 127, 32, -1, 97, -125, -1, -10, -1, 63, -13, -10, 15, -1, -17, -1, 111, -13, -1, 63, 111, -1, -16, -1, -10, -1, 63, -13, -10, -1, -10, -1, 63, -13, -1, 48, -1, -1, 47, -1, 111, -13, -1, 63, -13, -1, -10, -1, 63, -13, -1, 48, -1, -1, 47, 107, 15, -1, -14, -6, 86, 48, -11, -15, 15, -15, 31, 113, 104, 16, -6, 86, 48, -11, -15, 15, -1, 52, -79, 3, -95, 0, -43, -100, -16, 127, -86, 95, -128, 58, 16, -1, 121, 17, 48, -1, -16, 47, 1, -1, -33, -10, -1, -12, 93, 35, 69, 127, -10, 24, 52, 114, 52, 87, -1, -49, -97, -11, -7, 40, -3, -1, 124, 25, -1, 66, 111, 37, -1, 69, -16, -27, -124, 52, 87, -1, 73, 82, -3, -1, -30, 51, -111, 15, -23, 39, -1, 2, -120, -1, 121, 17, 48, -1, -16, 47, 1, -1, -33, -10, -1, -12, 93, 35, 69, 127, -7, 38, -17, -16, 40, -113, -12, 95, 14, 88, 67, 69, 127, -1, -1, 48, 95, 48, -6, -92, -24, -1, -9, 114, 111, 1, -65, -83, 92, 63, -7, 38, -118, 78, -1, -27, -16, -11, 22, -1, -9, 52, -108, 63, 31, -1, 69, -46, 52, 87, -6, -1, -17, -92, -79, -113, -1, 119, 67, -113, -1, 92, 104, -7, -95, 70, -113, -1, 119, 38, -16, 27, -6, -43, -61, -1, -110, 104, -92, -17, -2, 95, 15, 81, 111, -1, 115, 73, 67, -15, -1, -11, -58, 15, -10, 18, -65, -102, 20, 96, -1, 97, 43, -1, -11, -58, -128, -1, -12, 31, 51, -7, -95, 70, -128, -1, -12, 31, 51, -2, -110, 113, 48, -6, -49, 15, 2, 111, 16, -1, 17, -27, 99, 15, -1, 31, -1, 16, -10, -80, -2, -110, 113, 63, 109, -1, 121, 17, 48, -6, -49, 15, 2, 111, 16, -1, 17, -27, 99, 15, -1, 31, -1, 16, -10, -80, -1, 121, 17, 63, 109, -1, -11, 58, 22, -113, -64, -1, 121, 17, 56, 15, -84, -16, -16, 38, -15, 15, -15, 30, 86, 48, -1, -15, -1, -15, 15, 107, 15, -9, -111, 19, -10, -33, -2, 35, 57, 16, -6, -49, 15, 2, 111, 16, -1, 17, -27, 99, 15, -1, 31, -1, 16, -10, -80, -1, -30, 51, -111, -10, -33, -1, -17, -10, 25, 47, 17, -65, -1, -16, -10, -65, 31, -1, -127, 113, 98, 52, 127, 32, -78, 50, 15, 53, 96, 58, 16, -1, 33, 38, 15, 107, -10, -101, -1, -1, -8, -10, -65, 111, 107, 24, 54, 95, 20, 127, 32, -10, -80, -118, 78, -10, -101, 11, 47, 2, -14, 16, 53, 8, -92, 25, -72, -10, -113, 105, -80, -78, -16, 47, 33, 3, 80, 38, -16, 86, -10, -33, -95, -111, -45, 69, 127, -80, 15, -1, -17, 107, -1, -128, -10, -65, -1, -16, -6, -92, 25, -72, -5, 15, 105, -65, -86, 65, -101, -113, -80, -1, -2, 117, 113, -1, -1, 15, -10, 47, 2, -14, 31, -80, -10, -101, -1, -1, -8, -10, -65, 111, 111, -10, 47, 2, -14, 31, -80, -10, -65, 111, 111, -10, 47, 2, -14, 31, -80, -1, -2, 117, 113, -1, -1, 15, -11, 111, 5, 111, -80, -10, -101, -1, 5, -9, 31, 1, 115, -5, 15, 104, -1, -41, 67, 66, 52, -9, 31, -1, -14, -1, 5, -9, 24, -5, -1, -41, 67, -1, -1, 47, -16, 95, 113, -5, -1, 73, 82, -3, -1, -1, 47, -1, -11, 47, 15, -65, -83, 39, 113, 96, -1, 18, 127, 33, -5, -6, -46, 119, 22, -5, -10, -80, -1, -1, 32, -10, -65, 107, -1, -1, 47, 107, -1, -1, 47, 107, -10, -10, -10, -80, -1, -1, 32, -10, -126, 48, -1, -2, -10, -65, -8, 15, 107, -1, -1, 15, -8, 11, 84, 127, 32, -8, 67, -92, 112, -10, -80, -97, 79, 31, 64, 39, -15, 1, 113, -16, -15, -7, -92, -128, -84, -103, 15, -124, -103, 15, 2, 124, -13, 45, 60, 97, 15, -1, -97, -13, -1, 48, -57, 67, -128, 95, 48, -13, -63, -112, 18, -38, 15, 17, 38, -12, 15, -86, 78, -128, 71, 3, -95, 8, 47, 1, 15, 57, 17, 48, -8, 73, -112, -95, 41, 15, 107, -10, -10, 15, 50, -125, 22, -12, -7, -92, -128, -84, -103, 15, -124, -103, 11, 92, -11, -111, 3, -95, 1, -13, -13, 77, 65, 125, -15, 5, -13, 3, -95, 2, -103, 15, 4, 113, 9, 47, 20, 127, 32, -27, -72, 14, -110, -47, -80, 71, 4, 63, 79, -1, -1, 15, -10, 18, -65, -1, -1, 31, -23, 47, 17, 96, -6, -43, 97, -113, -1, -60, -45, 86, -15, 15, -12, 87, -76, 52, 87, -113, -26, 95, 38, 24, -128, -7, 79, 1, -108, 113, -1, 97, 53, 114, 49, 15, -16, 71, 16, -1, 116, 25, -80, -1, -16, 31, -6, 48, -1, 33, 38, -1, -1, -16, -1, -9, 124, -127, -80, -10, -65, -1, -1, 31, -12, -56, 53, -16, 15, -1, -1, 63, 107, -1, -1, -16, -1, 76, -125, 95, 4, -1, -1, 17, -1, -1, -15, -1, 76, -125, 95, 0, -1, -11, 107, 22, -113, -15, 23, 47, 1, 15, -1, -4, 78, 15, -1, 86, -79, 111, -15, 23, 47, 1, 15, -26, 91, -51, 52, 87, 15, -111, -16, -23, 35, 31, -1, -1, 15, -1, 5, 15, -11, -61, 80, -1, -20, 73, -80, -1, -11, 107, 22, -113, -1, -1, 31, 104, 15, -1, -17, 107, -1, -1, 15, -12, 87, 54, 79, 92, 49, 3, 80, 97, -127, 38, -38, -1, 101, 127, -61, 13, 87, 54, 79, 92, 49, 3, 80, 97, -127, 38, -38, -1, -49, 14, 63, 16, -1, 76, -125, 95, 0, -6, -107, 63, -12, -5, -1, -1, 79, -5, -12, -1, -65, -23, 18, -127, 1, 115, 22, 3, -95, 12, 116, -1, -14, -63, 1, 79, 42, 48, -38, 38, 45, 49, 96, -127, 100, 41, 7, -49, 15, 81, 96, 58, 35, 13, 47, 1, 15, -124, 58, 15, 21, -58, 13, 94, -15, 5, -13, 15, -93, 38, -113, -1, -13, -12, -1, 37, -58, 15, 2, -38, 71, 16, -43, 127, 52, -14, -58, 35, 69, 112, 46, -31, 38, -128, 53, 10, 47, 113, 13, -94, 127, 33, -65, 64, -2, -111, 40, 16, 97, -1, -15, 23, 49, 96, 58, 16, -127, 100, 41, 7, -49, 15, 81, 96, -13, 86, 15, 21, -58, 13, 94, -15, 5, -13, 15, -93, 38, -113, -1, -13, -12, -2, -111, 40, 16, 23, 49, 96, -15, 92, 96, 95, -121, 15, -1, 127, -1, 15, -3, -1, -1, -33, -1, 127, -4, 8, 22, 66, -112, 124, -16, -11, 22, 3, 80, -26, 31, 113, 115, 15, 60, 60, 97, 3, 98, -14, 27, 65, -113, 64, -2, 97, -120, 71, -14, 13, 39, -47, -112, -8, 73, -112, 41, -107, -8, 3, -92, -128, -11, -108, -14, -93, 3, 80, -43, 115, 71, -63, -12, -7, -95, 8, 22, 66, -112, 124, -16, -11, 22, 15, 21, -64, -94, -9, 16, 23, 49, 97, -80, 72, 7, 83, 15, 114, -108, -65, 79, -93, 38, -113, -1, -13, 15, -100, 53, 96, -1, -15, 15, -30, -14, 16, -10, -80, 95, 48, -1, -1, -14, -1, 63, -100, 53, 100, 41, -5, 15, -14, 92, 10, 47, 113, 15, 36, -9, 23, 3, -92, -128, -13, -111, 19, 3, -95, 15, -122, 87, -14, 7, 47, 1, -12, 15, -23, 18, -127, 11, 92, -11, -111, 13, -95, -33, -48, 58, 16, -79, -115, 100, -29, 69, 112, 71, 3, -95, 15, -100, 53, 96, -8, 71, -75, -8, 2, 123, 3, 111, 16, 47, 34, 71, -12, -1, -2, -123, -16, 16, 53, 110, 27, 81, -128, -79, -13, -111, -45, 27, -1, -1, 15, -1, -11, 47, 15, 4, 127, 47, -80, -10, -65, 111, 111, -7, 38, 116, 127, 47, -80, -7, -95, 11, 24, 52, 114, 52, 87, 15, -126, -15, -27, 71, 48, 72, 7, 83, 2, 15, 57, 17, 63, 64, -7, -95, 15, 1, 111, 33, 15, -124, -103, 7, 83, 15, 81, 8, -51, 24, -113, 60, -97, 79, -91, 102, -15, -1, -128, 58, 16, -13, 73, 16, -1, -1, 79, -128, -8, 40, 13, 97, 35, 27, 15, -124, 58, 2, 112, 89, -79, 96, -9, 22, -124, 87, 5, -13, 15, -93, 38, -113, -1, -13, 2, 123, 4, -128, 71, -43, -16, -30, 52, -11, -111, 15, -124, 58, 3, -92, -128, -9, 22, -124, 87, -12, -7, -92, -128, 38, -16, 86, 6, 31, -1, 44, 70, 24, 3, -95, 14, 100, -16, 38, -15, 6, 45, 66, -112, 54, 36, 48, -4, -1, -41, 113, 111, -1, 31, -93, 97, 127, 35, -81, -49, 79, -1, -2, -1, 89, -112, -4, -1, 69, -125, -128, -1, -1, -11, -1, -6, -10, -10, 1, -1, -93, 98, -4, 6, 24, 18, 109, -96, -13, 65, -101, -128, -125, 38, 48, 35, 15, -111, -38, 15, 107, -7, -95, 12, 116, -9, 22, -127, 11, 31, 52, 116, 52, 87, 10, 40, 15, 81, 23, 8, -51, -47, -120, -13, -55, -97, 16, -8, 100, 51, 23, 3, 80, -4, -10, -113, 79, 2, -17, -49, 79, -1, 119, 47, 89, 16, 53, 15, -122, 67, 16, 58, 16, -57, 79, 113, 104, 16, -79, -13, 71, 67, 69, 112, 53, 15, -49, 104, -12, -16, 46, -4, -12, 15, -1, 94, 22, 35, 69, 112, 49, 111, 4, 114, 49, -65, 79, -1, -5, 117, -8, 112, -23, 39, 19, 4, 127, 53, 111, 2, 52, 87, 10, 40, 15, 81, 23, 8, -51, -47, -120, -13, -55, -97, 16, -8, 100, 51, 23, 3, 80, -4, -10, -113, -49, 79, -1, 119, 47, 89, 16, 53, 15, -122, 67, 16, -23, 39, 19, 4, 127, 53, 111, 2, 52, 87, 3, 80, -4, -10, -113, -49, 64, -1, -11, -31, 98, 52, 87, 3, 22, -16, 71, 35, 27, -12, -1, -1, -73, 95, -121, 15, 57, 17, 48, 71, -13, 86, -16, 35, 69, 112, -94, -128, -11, 17, 112, -116, -35, 24, -113, 60, -103, -15, 15, -122, 67, 49, 112, 53, 15, -49, 104, -4, -12, -1, -9, 114, -11, -111, 3, 80, -8, 100, 49, 15, 57, 17, 48, 71, -13, 86, -16, 35, 69, 112, 53, 15, -49, 104, -4, -12, 15, -1, 94, 22, 35, 69, 112, 49, 111, 4, 114, 49, -65, 79, -23, 39, 19, 15, -1, 2, -16, 31, -5, -1, -11, -8, 113, 111, -5, -6, 50, 111, 82, -127, 15, -97, 30, 31, -5, -1, 17, -27, 99, 15, -11, -14, 31, -5, -2, 94, -55, 35, 69, 127, -5, -1, -4, 41, -63, -1, -65, -26, 91, -51, 52, 87, 15, -1, -3, -63, -63, -1, -65, -16, 71, 24, -1, -65, -9, 45, 53, 100, 24, -1, -65, -10, 31, 48, -10, -1, -65, -96, -1, -42, 87, -1, -65, -96, -1, -27, 98, -1, -65, -96, -1, -8, 22, -16, -1, -65, -3, 101, 112, -1, 15, -15, -1, -65, -2, 86, 32, -1, 15, -15, -1, -65, -1, -127, 111, 0, -1, 15, -15, -1, -65, -3, 101, 112, -1, 15, -12, -1, -65, -2, 86, 32, -1, 15, -12, -1, -65, -1, -127, 111, 0, -1, 15, -12, -1, -65, -15, 24, 92, 109, 24, -1, -65, -1, -122, 47, 127, -5, -7, 31, 14, -1, -65, -15, 43, -1, -65, -1, -122, 47, 127, -1, 86, 79, 47, -5, -7, 31, 14, -1, -11, 100, -14, -1, -65, -15, 43, -1, -11, 100, -14, -1, -65, -111, 102, 47, -5, -1, 66, -17, -5, -6, -46, 127, -5, -2, 23, -1, -65, -10, 100, -9, 22, -1, -65, -7, 38, -17, -5, -1, 21, -61, 31, -5, -1, -8, 35, 31, -15, 39, -14, 31, -5, -1, -8, 35, 31, -16, 40, -113, -5, -2, -45, -1, 111, 15, 47, -9, -111, 19, 15, -1, 2, -16, 31, -5, -1, -1, -12, -1, -65, -14, -1, -65, -23, 39, 19, -1, -65, -10, 24, 52, 114, 52, 87, -1, -65, -2, 35, 57, 16, -2, -110, 127, -5, -6, -92, -32, -1, 71, 63, -5, -1, -42, 87, -1, -65, -2, 86, 47, -5, -1, -8, 22, -16, -1, -65, -12, 89, -1, -65, -9, -63, -97, -5, -1, -11, -8, 113, 111, -5, -1, -49, -97, -11, -1, -65, -7, 38, -17, -5, -1, 2, -120, -1, -65, -12, -107, 47, -33, -5, -6, -46, 127, -5, -2, 23, -1, -65, -110, -113, -33, -5, -1, 4, 116, 127, 47, -5, -6, -8, 17, -17, -5, -1, -12, 47, 20, 127, 47, -5, -7, 22, 98, -1, -65, -1, 119, 38, -16, 27, -1, -65, -83, 92, 63, -5, -1, -110, 104, -92, -17, -5, -1, -9, 52, -108, 63, 31, -5, -1, -27, -16, -11, 22, -1, 4, 113, 15, -9, 65, -101, -1, 4, 113, 98, -112, -2, 45, -3, 19, -1, -107, 111, 10, 89, 31, -16, -15, -125, 22, -15, 15, -106, 43, 22, -6, 41, -9, 47, 33, 15, -9, 65, -101, -1, 15, 24, 49, 111, 16, -1, -11, -11, -1, -1, 113, -45, -1, 121, 17, 63, -15, 92, 49, 3, 87, -1, -1, 34, -1, 37, -58, 6, 45, 16, 72, 4, 125, 46, 47, 89, 16, 95, 48, -11, -60, -101, 71, -14, 15, 50, -45, 86, 65, -113, 79, -14, 92, 96, 98, -47, 4, -128, 71, -46, -30, -11, -111, 5, -13, 15, 92, 73, -76, 127, 32, -16, 71, 24, -12, 15, -1, 53, -8, 31, 113, 111, -8, 15, 21, -58, 13, 89, 87, 72, 56, 10, 47, 113, 2, 112, 71, 114, 49, 15, 4, 116, 127, 32, 47, 84, -108, 63, 16, 31, -1, 44, 41, 3, 80, 87, 16, 49, 115, -96, 58, 16, -113, -1, 44, 38, 16, 101, 83, 5, -13, 3, -95, 8, 50, 111, 82, -127, 14, 94, -55, 35, 69, 127, 79, -1, 86, -14, 39, 77, -1, 37, -58, 6, 45, 16, -46, 119, 83, 15, 92, 73, -80, -23, 39, 19, 38, -15, 8, -46, 119, 22, -113, 64, -1, 37, -58, 8, 50, 111, 82, -127, -128, -94, -9, 16, 39, 4, 119, 35, 16, -115, 39, 116, 127, 32, 47, 84, -108, 63, 16, -8, -91, -127, 11, 72, 50, 125, 16, 72, 1, -1, -14, -62, -112, 53, 3, -95, 8, -1, -14, -62, 97, 6, 85, 48, 95, 48, 87, 16, 49, 115, -96, 58, 16, -125, 38, -11, 40, 16, -27, -20, -110, 52, 87, -12, -2, -110, 113, 50, 111, 16, -115, 39, 113, 104, 2, 123, 11, 31, 49, 120, 24, 2, 97, 7, 83, 2, -9, 36, -110, -11, -111, 3, 80, -4, -1, 89, 49, 103, 35, 16, -1, 17, 41, 67, -15, -4, 6, 45, 24, -12, -1, -3, -1, -3, -1, -3, -1, 101, -33, -48, -1, 66, -30, -44, 63, 31, -80, 15, -22, 40, 16, -10, -80, 95, 48, -10, -80, 0, 15, -15, 92, 123, 15, 107, 5, -13, 15, 107, -2, -110, -15, -11, 45, -3, 15, -82, 17, -65, -80, -10, -80, -7, -92, -128, -8, 18, -27, 112, -8, 73, -112, 87, -97, 16, -78, -16, 47, 33, 8, -92, 25, -72, -12, 15, -3, 48, -94, -128, 117, 1, -13, -13, 29, 48, 87, 2, 111, 5, 111, 79, -102, 72, 15, -127, 46, 87, 10, 67, -128, 41, -112, 50, 111, 33, 56, 4, 112, 98, 127, 33, 1, 45, -96, 52, -16, 16, 67, 4, -128, -13, 70, 27, -12, -7, -92, -128, -8, 18, -27, 112, 41, -123, 15, 2, -3, 24, 2, 112, 31, -6, -47, -103, 23, 48, -16, 71, 16, -113, -127, 30, 22, 13, 46, 47, 89, 16, 95, 48, -113, -127, 30, 71, -14, 15, 107, 15, 4, 113, -128, -31, 96, -15, 18, 111, 79, -16, 47, -6, 15, -27, -20, -110, 52, 87, -5, -1, 2, -1, -96, -2, 94, -5, -1, -30, 51, -111, 15, -23, 39, -5, 15, -3, 115, 22, -47, -29, -1, 89, -112, -1, 97, -124, -14, 120, -1, -41, -9, 22, 48, -1, 116, -109, 22, -1, -16, 80, -1, 97, -124, -14, 120, -1, 89, -112, -1, 4, 113, 15, -9, 65, -101, -113, -1, 5, 15, -16, 71, 16, -1, 116, 25, -72, -1, 4, 113, 15, -9, 65, -101, -128, 95, 48, -1, 37, -58, -113, -16, 71, 16, -1, 116, 25, -72, 5, -13, 15, -9, 100, 23, -72, -1, 4, 113, 15, -9, 65, -101, -128, 95, 48, -1, -16, 28, 54, 41, -113, -16, 71, 16, -1, 116, 25, -72, 5, -13, 15, -4, 113, -16, 65, -113, -110, -45, 77, -5, 15, 104, -7, 45, 52, -33, -80, -10, -128, 71, 15, 107, 15, 5, -9, 24, -12, -2, 100, -16, 47, 16, -7, 38, -14, 19, -5, 15, 104, -6, 29, 87, -78, 111, 16, -7, 38, -14, 19, -5, 15, 104, -1, 92, 53, -16, 35, 77, -1, -41, 67, 66, 52, -9, 31, -80, -10, -65, -14, 92, 96, 98, -47, 10, 40, 15, -1, -65, -1, -65, -1, -65, -1, -65, -1, -65, -1, -1, -113, -1, -65, -1, -65, 111, -4, -9, 22, -15, 10, 92, 104, -12, 0, -16, 71, -61, 24, 2, -13, 49, 96, -23, 47, 17, 111, -1, -24, -1, -1, 0, 38, 16, -111, -13, 48, 92, 63, 79, -14, 92, 13, 39, -4, 48, -43, -17, 16, 58, 72, 8, -92, -32, -79, -124, -14, 112, -11, 29, 44, -127, 15, 21, -64, -46, 127, -61, 15, 92, 73, -80, 58, 16, -84, -103, 4, 63, -56, 15, 82, -127, -80, 87, -12, 15, -81, 2, 99, 15, 85, -16, -11, -128, 38, 16, 117, 48, -125, 100, -45, -97, 16, 43, -76, 52, -9, 16, 39, -80, -94, -9, 16, 117, 15, 4, 116, -16, -49, 0, -3, 73, -112, -9, 41, -63, -12, 15, -10, 31, 49, 120, 24, 2, 97, 9, 24, -128, 31, 63, 49, -45, 79, 113, 2, -14, 36, 120, 48, 58, 24, 16, -11, 95, 15, 88, -12, -7, -92, -128, -30, 99, 4, -128, -57, 47, 114, 73, -11, -111, 3, 80, 58, 16, -4, -1, -110, 96, -1, 5, 127, 33, 111, -49, 79, -14, 92, 96, 43, -9, 39, 50, -14, 16, -27, 71, 56, 2, 97, 13, -58, 97, 115, -97, 16, 71, 3, -95, 10, 89, 16, -11, -15, 15, 107, 14, 84, 115, -113, 64, -1, 37, -64, -46, 119, 83, 8, 47, 113, 2, 6, 45, 16, -79, -13, 71, 67, 69, 112, -8, -92, -38, 10, 40, 2, 7, 31, 34, 52, -9, 16, -11, 41, 39, -47, -12, -1, 37, -64, -46, 127, -61, 10, 47, 113, 15, 5, 97, 3, -94, 112, -10, -80, -8, 47, 30, 84, 115, -113, 79, -95, 123, 15, -16, 24, -126, -14, 24, 15, -1, -17, 107, 5, -13, 15, 107, -1, -1, 15, -1, 126, 3, 80, -7, -61, 86, 66, -97, -80, -7, -95, 15, -49, -12, 87, 54, 79, 92, 49, 5, 121, -15, 9, 31, 51, 95, 113, 111, 79, 79, 79, -64, -38, 29, -3, -11, 95, -6, 4, 112, 58, 16, -26, 91, -51, 52, 87, 15, -1, 44, 28, 16, -75, 24, 7, 83, 10, 47, 113, 3, -95, 6, 79, 42, 48, -9, 41, -63, -12, 15, -23, 18, -127, 5, -31, 112, 58, 16, -26, 91, -51, 52, 87, 11, 66, -107, -14, 2, 123, 3, 111, 16, 47, 34, 71, -12, -7, 80, -16, 47, -47, 3, -95, 3, -61, 86, 66, -112, 97, 46, -31, 38, 13, 95, 14, -111, 49, 15, 21, -58, 3, 40, -3, 5, 96, -38, 85, -127, 15, -100, 53, 100, 41, 15, 54, 95, 0, 58, 16, -1, -13, 25, -32, -16, 23, -49, 79, -23, 39, 19, 38, -15, 15, -83, 39, 113, 111, -1, -30, -103, 3, 86, -31, -75, 24, 11, 31, 57, 29, 49, -65, -1, -16, 117, 11, 47, 2, -14, 31, 64, -1, -2, -1, -13, -1, -97, -1, -16, 15, -1, -17, -1, -10, -1, 63, -1, -16, -6, 50, 104, -1, -1, 48, -1, -9, 116, -9, 22, -127, 15, -16, 46, -1, 33, 38, -5, 15, 107, 0, 15, -1, -1, 112, -1, 37, -58, 15, -23, 39, 19, 0, 15, -1, -1, 112, -1, -11, 111, 84, 50, -112, -1, 117, 99, 0, 15, -1, -1, 112, -6, 50, 111, 82, -127, 0, 15, -1, -1, 112, -1, -9, 117, -35, -50, 65, -80, -2, -110, 113, 48, 0, -1, -1, -9, 15, -23, 47, 17, 96, -1, -1, -13, -1, -7, -4, -128, -2, -110, 113, 63, -14, 92, 15, 12, -125, 8, -31, -44, -13, -15, 2, 7, -49, 15, 81, 96, -11, 19, -8, 17, 112, -1, -10, 2, 123, 15, -1, -65, 79, -1, 119, 47, 89, 16, 53, 14, 100, 115, 3, -95, 15, 34, -16, 16, -16, 46, -12, 15, -14, 92, 96, -26, 71, 49, 96, -16, 47, 16, -11, 16, 95, 63, 63, -8, 5, -13, -13, -1, -15, -108, 113, -1, -128, 117, 48, -43, 119, 29, 49, -65, -8, 5, -61, 5, -13, 14, 46, 22, -1, -128, 19, -33, 79, -12, 46, 67, 41, 8, -92, -32, -16, 72, -124, -111, -128, -75, 3, -8, 77, 16, 58, 16, -125, 35, 27, 11, 47, 2, -14, 16, 79, 48, 58, 16, 23, 31, 15, 16, -118, 78, 10, 40, 7, 80, 97, -16, 36, 116, 127, 32, -118, 65, -101, -113, 79, -102, 72, 11, 31, 5, 15, 113, 104, 69, 112, 95, 48, -6, 50, 104, -1, -1, 48, 72, 9, 79, 4, 49, -80, 53, 15, 34, -16, 24, 5, -13, 15, -1, -1, 47, -13, 15, 17, 38, -128, 86, 9, 24, -113, 64, -1, 37, -64, -46, 112, -43, 115, 71, -63, 3, -92, -128, -14, 47, 1, 12, -124, 127, 32, 32, 97, 50, 73, 13, 94, -15, 5, -13, 15, -93, 38, -113, -1, -13, -12, -6, 50, 104, -1, -1, 48, -1, -15, -1, -15, 15, 104, 15, -1, 31, -1, 16, -1, -13, 88, 48, -1, 5, -79, -1, -110, 67, 71, -14, 15, 53, 96, 32, 113, -8, 3, -58, 127, -111, -16, -31, 98, 60, 97, -5, 15, -15, 24, 18, 109, -81, -11, -65, 114, 115, 47, 33, -2, 84, 115, -128, -1, -12, 31, 51, -6, 50, 104, -1, -1, 48, -1, 18, -47, 15, -9, 73, 24, -1, -1, -97, -5, -12, -1, 31, -5, -1, -1, -97, -15, 39, -75, -16, -2, 97, -79, -13, 71, 27, 15, -15, 45, 24, -1, -16, -1, -1, 47, -11, 53, -7, 95, -65, -11, 100, 41, -1, 86, 66, -112, -1, -27, -101, -1, 86, 66, -112, -1, -45, 41, 77, -1, 86, 66, -112, -1, -27, -101, 15, -3, 50, -108, -46, 51, 45, -3, -128, -10, -128, 39, -65, 107, -16, -14, -1, -12, 31, 113, -97, 104, -1, -128, -7, 29, -96, -1, -12, 31, 113, -112, -10, -80, -1, -23, 17, -76, 127, 32, -1, -53, -14, 31, -1, 12, -16, -6, 50, 123, 38, -65, -81, 2, 99, -79, -42, 18, -127, -76, 125, 97, 40, 27, 5, -13, 0, 86, 79, 36, 127, -9, -1, -33, -1, 79, -97, -4, -1, 31, -4, -1, 111, -4, -9, 22, -15, -11, 91, -15, -1, 118, 95, 15, -80, 15, 104, -10, -33, 109, -7, 95, -80, 15, 104, -10, -33, 109, -2, 97, -9, -1, -8, 83, 95, -1, 1, -1, -93, -1, 97, -111, 49, -1, 17, -23, -15, -10, -101, -3, -7, -1, -1, 47, 22, -10, -128, -1, -41, -13, 80, 89, -80, -6, -49, 15, 2, 111, 31, -10, 17, -32, -6, -30, -47, 15, -7, 47, 30, 84, 115, -97, 25, 79, 42, 48, -15, 18, 104, 15, 54, 95, 0, -1, -16, 80, -1, -16, 47, 1, 10, 47, 113, 2, 97, 10, 40, 4, -113, -23, 47, 17, 96, -10, -65, -7, 20, -14, -93, 27, 15, -11, -9, 22, 47, 33, 117, 113, -1, 116, 25, -65, -80, -10, -80, 95, 48, -10, -65, -11, 97, 15, 21, -64, -116, 97, 15, 21, -64, -8, 39, 48, 53, 15, 53, 109, 16, -14, 23, 22, 35, 16, -10, -80, 60, 103, -128, 71, 2, 6, 95, -113, -1, -33, -1, -127, 113, 98, 52, 127, 32, -15, 18, 96, -10, -65, -9, 36, -111, -65, -84, -35, 17, -79, -65, -12, 39, -4, 48, -13, 71, -80, -91, -125, 15, 52, -111, -1, -13, -49, 2, 117, 75, -1, 18, -11, -11, 67, 84, -65, -3, 120, 29, 53, 75, -1, -16, -51, -111, 83, 75, -6, 73, 77, 39, 84, -65, -11, 115, 19, -95, 98, -97, -15, 39, -75, -16, -1, -31, 104, 22, -3, 22, -1, -20, -100, -118, 79, -1, -123, -111, -16, -1, -16, -55, 87, -7, 100, 52, -1, -1, 21, 75, -1, -4, 41, 43, 66, -33, -1, 127, 81, 99, -1, 113, -108, 49, -1, 113, 102, 19, -1, -13, 92, -127, 15, -12, 35, -1, 70, -56, -95, 111, -28, -46, 107, 79, -15, -56, -81, -57, -1, 95, 1, 100, -46, 127, -1, 50, -8, -3, -1, -62, -14, -111, -1, 1, 120, 84, -65, -1, 69, 98, -1, -91, 75, -1, -13, 77, 38, -76, -1, -16, 36, 103, 66, 127, -12, -111, 47, 113, 111, -1, 53, 95, 113, 101, 127, -1, 1, 31, -1, -5, -58, -3, 87, 66, 112}; /* MEMORY_STRINGS:0x0000 */
 uint8_t acSTR[1414] = {0x4d, 0x4d, 0x62, 0x4b, 0x1d, 0x3f, 0x24, 0x48, 0x49, 0x49, 0x37, 0x3e, 0x4b, 0x45, 0x20, 0x43, 0x67, 0x2d, 0x30, 0x2c, 0x3e, 0x84, 0x27, 0x21, 0x28, 0x2a, 0x1a, 0x2f, 0x1f, 0x2a, 0x6d, 0x84, 0x4b, 0xc9, 0x9f, 0x97, 0x63, 0x69, 0x67, 0x24, 0x2e, 0x99, 0xb8, 0x58, 0x83, 0x56, 0x5a, 0x57, 0x7a, 0x5b, 0x6f, 0x78, 0xc8, 0xbe, 0x74, 0xd9, 0x4a, 0x49, 0x53, 0x4f, 0x5d, 0x5c, 0x55, 0x61, 0x8b, 0x63, 0x60, 0x0b, 0x15, 0x23, 0x1b, 0x17, 0x16, 0x18, 0x17, 0x11, 0x23, 0x25, 0x29, 0x31, 0x28, 0x36, 0x20, 0x19, 0x0a, 0x09, 0x0b, 0x0e, 0x0d, 0x11, 0x1d, 0x0a, 0x0a, 0x09, 0x0b, 0x0b, 0x09, 0x3f, 0x7e, 0x16, 0x0a, 0x0e, 0x13, 0x16, 0x0e, 0x16, 0x07, 0x07, 0x12, 0x12, 0x1b, 0x0f, 0x1a, 0x1c, 0x18, 0x14, 0x12, 0x17, 0x19, 0x13, 0x0b, 0x0a, 0x1c, 0x0c, 0x14, 0x19, 0x07, 0x0b, 0x0b, 0x0b, 0x12, 0x14, 0x13, 0x0a, 0x06, 0x0b, 0x01, 0x15, 0x1c, 0x14, 0x1d, 0x1e, 0x21, 0x1c, 0x0a, 0x0b, 0x06, 0x10, 0x06, 0x0b, 0x0d, 0x0e, 0x0a, 0x07, 0x06, 0x0a, 0x05, 0x17, 0x19, 0x1c, 0x0c, 0x0c, 0x0f, 0x0a, 0x14, 0x12, 0x15, 0x19, 0x12, 0x15, 0x19, 0x09, 0x0e, 0x0c, 0x14, 0x0a, 0x0a, 0x12, 0x14, 0x17, 0x12, 0x12, 0x12, 0x14, 0x14, 0x17, 0x15, 0x12, 0x12, 0x16, 0x0f, 0x12, 0x10, 0x07, 0x08, 0x07, 0x07, 0x07, 0x0d, 0x0f, 0x15, 0x10, 0x15, 0x0a, 0x0d, 0x0c, 0x04, 0x1d, 0x51, 0x0c, 0x2a, 0xd3, 0x43, 0x44, 0x85, 0x90, 0xdb, 0x96, 0x63, 0x65, 0x5d, 0x6a, 0x4b, 0x3b, 0xb2, 0x72, 0x7f, 0x49, 0x4f, 0x36, 0x36, 0x40, 0x37, 0x2d, 0x46, 0x5b, 0xc6, 0x0c, 0x19, 0x38, 0x10, 0x25, 0x57, 0x47, 0x74, 0x32, 0x36, 0x0c, 0x25, 0x17, 0x17, 0x16, 0x3c, 0x0d, 0x27, 0x22, 0x13, 0x16, 0x3c, 0x09, 0x63, 0x07, 0x13, 0x18, 0x07, 0x0b, 0x0b, 0x4f, 0x77, 0x72, 0x36, 0x29, 0x42, 0x38, 0x1a, 0x18, 0x97, 0xa6, 0x5e, 0xc0, 0xbb, 0xd0, 0xa8, 0x71, 0x99, 0xe5, 0xf9, 0x22, 0xac, 0x9b, 0xcd, 0xb8, 0xdb, 0x75, 0xaf, 0xdd, 0xe1, 0xd8, 0xcb, 0xa6, 0xef, 0xf3, 0x76, 0x8d, 0xfa, 0x01, 0x23, 0x17, 0x1f, 0x18, 0x1d, 0x1a, 0x15, 0x1e, 0x12, 0x24, 0x1b, 0x1e, 0x21, 0x19, 0xb7, 0xae, 0xd2, 0xe6, 0xf5, 0xf2, 0x9b, 0xf4, 0xf9, 0xd3, 0x8d, 0x36, 0xf7, 0xee, 0x5d, 0x5d, 0x80, 0x51, 0x6e, 0x56, 0x6d, 0x51, 0x4b, 0x4b, 0x4b, 0x51, 0x52, 0x83, 0x5a, 0x43, 0x52, 0x53, 0xf2, 0xf5, 0x7c, 0x5c, 0x6e, 0x4e, 0x20, 0x2d, 0x48, 0x48, 0x13, 0x1c, 0x22, 0x19, 0x14, 0x1f, 0x1b, 0x22, 0x1c, 0x1b, 0x18, 0x1e, 0x18, 0x19, 0x20, 0x21, 0x10, 0x1b, 0x1a, 0x09, 0x0c, 0x06, 0x09, 0x0b, 0x0a, 0x07, 0x11, 0x39, 0x7f, 0x51, 0x33, 0x3f, 0x4a, 0x1e, 0x6f, 0xbd, 0x9d, 0x61, 0x19, 0x06, 0x0a, 0x0f, 0x1d, 0x12, 0x12, 0x0d, 0x0d, 0x1d, 0x21, 0x1e, 0x20, 0x1a, 0x0d, 0x08, 0x07, 0x08, 0x07, 0x06, 0x09, 0x09, 0x0c, 0x06, 0x0c, 0x08, 0x09, 0x07, 0x06, 0x10, 0x0a, 0x0b, 0x0e, 0x0b, 0x0f, 0x0a, 0x0d, 0x14, 0x11, 0x12, 0x12, 0x0d, 0x08, 0x09, 0x09, 0x16, 0x18, 0x3f, 0x60, 0x5e, 0x43, 0x7c, 0x19, 0x16, 0x0f, 0x0a, 0x13, 0x14, 0xc1, 0x1f, 0x19, 0x1d, 0x13, 0x11, 0x0f, 0x1f, 0x21, 0x1a, 0x14, 0x17, 0x0f, 0x0e, 0x11, 0x1d, 0x0f, 0x10, 0x0d, 0x17, 0x16, 0x1b, 0x1b, 0x18, 0x19, 0x2b, 0x46, 0x5c, 0x08, 0x12, 0x6f, 0x63, 0x79, 0x84, 0x95, 0x91, 0x91, 0x76, 0x82, 0x52, 0x5a, 0x74, 0x76, 0x55, 0x85, 0x56, 0x91, 0x9f, 0xd6, 0xb5, 0xb2, 0xd7, 0x84, 0x84, 0x8a, 0x92, 0x79, 0x90, 0x8a, 0x10, 0x09, 0x08, 0x80, 0x0b, 0x74, 0x23, 0x2f, 0x15, 0x3c, 0x14, 0x11, 0x27, 0x15, 0x3a, 0x20, 0x2d, 0x28, 0x24, 0x10, 0x18, 0x1b, 0x13, 0x20, 0x19, 0x0d, 0x08, 0x14, 0x0d, 0x08, 0x0f, 0x09, 0x0b, 0x0f, 0x04, 0x15, 0x11, 0x2a, 0x13, 0x3f, 0x1d, 0x2a, 0x2c, 0x16, 0x22, 0x28, 0x12, 0x0b, 0x21, 0x11, 0x28, 0x14, 0x23, 0x13, 0x32, 0x36, 0x42, 0x3d, 0x45, 0x16, 0x0e, 0x0d, 0x21, 0x15, 0x1b, 0x16, 0x0d, 0x12, 0x25, 0x1b, 0x32, 0x26, 0x17, 0x04, 0x04, 0x04, 0x04, 0x0e, 0x0f, 0x0c, 0x20, 0x15, 0x2c, 0x0e, 0x05, 0x28, 0x0e, 0x0a, 0x10, 0x35, 0x06, 0x09, 0x09, 0x12, 0x07, 0x1c, 0x12, 0x13, 0x0e, 0x73, 0x85, 0x89, 0xbf, 0xab, 0x7c, 0xc4, 0xb0, 0x81, 0xb3, 0x0c, 0x0b, 0x0c, 0x19, 0x11, 0x1e, 0x00, 0x16, 0x16, 0x00, 0x00, 0x13, 0x00, 0x19, 0x00, 0x00, 0x0b, 0x00, 0x18, 0x26, 0x0f, 0x16, 0x00, 0x00, 0x0e, 0x00, 0x14, 0x13, 0x00, 0x00, 0x14, 0x00, 0x0f, 0x00, 0x00, 0x07, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x14, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x12, 0x12, 0x11, 0x10, 0x13, 0x10, 0x12, 0x14, 0x14, 0x10, 0x12, 0x17, 0x13, 0x11, 0x13, 0x10, 0x13, 0x13, 0x13, 0x19, 0x11, 0x0f, 0x0f, 0x12, 0x12, 0x1d, 0x10, 0x12, 0x11, 0x0e, 0x0f, 0x11, 0x12, 0x10, 0x01, 0x41, 0x1f, 0x9c, 0x5c, 0xd0, 0x7e, 0x04, 0x09, 0x09, 0x0f, 0x09, 0x17, 0x18, 0x22, 0x15, 0x34, 0x21, 0x19, 0x1c, 0x23, 0x1c, 0x20, 0xd8, 0x11, 0x5a, 0x3d, 0x4c, 0x6b, 0x41, 0x06, 0x08, 0x09, 0x08, 0x12, 0x10, 0x18, 0x09, 0x07, 0x07, 0x06, 0x0d, 0x0b, 0x0d, 0x06, 0x0b, 0x11, 0x09, 0x09, 0x0b, 0x0f, 0x1b, 0x28, 0x19, 0x11, 0x04, 0x04, 0x1f, 0x04, 0x06, 0x0e, 0x08, 0x15, 0x10, 0x0a, 0x0a, 0x0b, 0x0c, 0x13, 0x10, 0x14, 0x0e, 0x28, 0x13, 0x0d, 0x0d, 0x08, 0x15, 0x22, 0x0b, 0x09, 0x0f, 0x34, 0x50, 0xa6, 0x1a, 0x1b, 0x1b, 0x07, 0x2f, 0x09, 0x12, 0x0a, 0x18, 0x07, 0x0b, 0x17, 0x0b, 0x0f, 0x11, 0x13, 0x11, 0x0b, 0x0b, 0x11, 0x13, 0x0b, 0x1c, 0x13, 0x09, 0x09, 0x09, 0x0e, 0x09, 0x09, 0x0c, 0x15, 0x19, 0x10, 0x08, 0x36, 0x36, 0x1e, 0x1a, 0x22, 0x06, 0x08, 0x1a, 0x13, 0x08, 0x08, 0x0a, 0x06, 0x10, 0x10, 0x10, 0x10, 0x15, 0x10, 0x21, 0x0f, 0x0d, 0x0d, 0x0d, 0x11, 0x0a, 0x16, 0x17, 0x0b, 0x0c, 0x0f, 0x90, 0x68, 0x35, 0x1c, 0x17, 0x1d, 0x13, 0x0d, 0x1a, 0x15, 0x11, 0x0b, 0x10, 0x0d, 0x0b, 0x0a, 0x11, 0x11, 0x13, 0x0b, 0x10, 0x0c, 0x0e, 0x16, 0x19, 0x15, 0x11, 0x0f, 0x12, 0x1d, 0x1a, 0x12, 0x16, 0x08, 0x08, 0x0f, 0x0f, 0x0a, 0x14, 0x13, 0x18, 0x15, 0x12, 0x0f, 0x11, 0x0a, 0x07, 0x0b, 0x07, 0x1a, 0x06, 0x10, 0x1a, 0x0c, 0x10, 0x1e, 0x13, 0x11, 0x15, 0x0b, 0x51, 0x53, 0x58, 0x56, 0x43, 0x45, 0x6b, 0x51, 0x60, 0xae, 0xc9, 0x29, 0x29, 0x2c, 0x81, 0x9c, 0x96, 0x97, 0xc9, 0x09, 0x11, 0x01, 0x10, 0x03, 0x09, 0x18, 0x02, 0x01, 0x24, 0x02, 0x01, 0x22, 0x0a, 0x01, 0x09, 0x0f, 0x01, 0x21, 0x08, 0x01, 0x15, 0x23, 0x01, 0x0b, 0x33, 0x01, 0x0a, 0x10, 0x0e, 0x08, 0x12, 0x0b, 0x17, 0x0b, 0x1b, 0x0d, 0x0f, 0x0e, 0x13, 0xcf, 0x26, 0x11, 0x10, 0x13, 0x07, 0x07, 0x06, 0x07, 0x08, 0x0a, 0x08, 0x14, 0x0b, 0x12, 0x16, 0x0c, 0x13, 0x1b, 0x13, 0x11, 0x0d, 0x09, 0x0a, 0x06, 0x07, 0x07, 0x10, 0x09, 0x12, 0x16, 0x11, 0x14, 0x09, 0x09, 0x16, 0x0f, 0x12, 0x0e, 0x07, 0x11, 0x16, 0x08, 0x06, 0x09, 0x09, 0x06, 0x09, 0x07, 0x0d, 0x07, 0x06, 0x0a, 0x0b, 0x07, 0x09, 0x0f, 0x13, 0x0a, 0x06, 0x05, 0x0e, 0x06, 0x10, 0x10, 0x14, 0x0e, 0x09, 0x14, 0x1a, 0x0e, 0x08, 0x0c, 0x09, 0x09, 0x12, 0x09, 0x06, 0x06, 0x09, 0x09, 0x09, 0x0f, 0x09, 0x10, 0x06, 0x0a, 0x0d, 0x09, 0x15, 0x14, 0x06, 0x0a, 0x0e, 0x09, 0x07, 0x14, 0x0d, 0x10, 0x0a, 0x0a, 0x19, 0x07, 0x07, 0x14, 0x18, 0x13, 0x17, 0x0f, 0x05, 0x08, 0x11, 0x09, 0x0c, 0x0a, 0x0c, 0x11, 0x13, 0x0b, 0x0b, 0x09, 0x08, 0x0e, 0x13, 0x10, 0x0a, 0x09, 0x0a, 0x15, 0x11, 0x9f, 0x8d, 0x89, 0x5d, 0x72, 0x10, 0x0a, 0x0b, 0x05, 0x08, 0x0b, 0x06, 0x06, 0x0a, 0x0a, 0x10, 0x0c, 0x0b, 0x10, 0x11, 0x22, 0x0c, 0x20, 0x13, 0x09, 0x0b, 0x16, 0x0c, 0x08, 0x0b, 0x10, 0x06, 0x0b, 0x0d, 0x08, 0x06, 0x06, 0x08, 0x0e, 0x08, 0x0e, 0x06, 0x10, 0x06, 0x0b, 0x06, 0x06, 0x0e, 0x11, 0x0b, 0x06, 0x09, 0x0a, 0x0b, 0x0b, 0x05, 0x06, 0x08, 0x07, 0x07, 0x0b, 0x06, 0x09, 0x0a, 0x0b, 0x0d, 0x0d, 0x10, 0x10, 0x34, 0x34, 0x41, 0x36, 0x13, 0x05, 0x27, 0x11, 0x15, 0x1b, 0x1a, 0x21, 0x0f, 0x18, 0x1e, 0x14, 0x1a, 0x0f, 0x12, 0x1c, 0x14, 0x17, 0x13, 0x0a, 0x0d, 0x17, 0x0d, 0x20, 0x14, 0x0d, 0x7e, 0x59, 0x12, 0x10, 0x18, 0x15, 0x2a, 0x19, 0x13, 0x1c, 0x13, 0x1a, 0x20, 0x2a, 0x10, 0x19, 0x20, 0x19, 0x12, 0x6b, 0x86, 0x9c, 0x37, 0x30, 0x8f, 0x23, 0x18, 0x62, 0x7d, 0x4f, 0x51, 0x4f, 0x5c, 0x4e, 0x51, 0x4e, 0x51, 0xbd, 0x72, 0xbf, 0x4a, 0x3c, 0xb7, 0x0e, 0x12, 0x0b, 0x13, 0x12, 0x1a, 0x07, 0x0a, 0x07, 0x35, 0xbc, 0x0b, 0xc0, 0x5c, 0x0c, 0x17, 0x29, 0x1a, 0x4d, 0x43, 0x67, 0x15, 0x0e, 0x11, 0x0b, 0x10, 0x12, 0x10, 0x15, 0x15, 0x1b, 0x1d, 0x1f, 0x1e, 0x0d, 0x1e, 0x18, 0x1a, 0x0c, 0x13, 0x10, 0x24, 0x0a, 0x07, 0x01, 0x01, 0x10, 0x21, 0x5b, 0x90, 0x37, 0x8f, 0x2f, 0x26, 0x09, 0xba, 0x65, 0x14, 0x21, 0x0d, 0x11, 0x12, 0x1e, 0x0c, 0x18, 0x1c, 0x14, 0x1f, 0x28, 0x3a, 0x80, 0x68, 0xa1, 0x30, 0x1b, 0x0f, 0x0b, 0x0d, 0x10, 0x2f, 0x09, 0x14, 0x0c, 0x02, 0x05, 0x07, 0x0e, 0x10, 0x17, 0x0c, 0x04, 0x07, 0x09, 0x1a, 0x13, 0x07, 0x09, 0x07, 0x09, 0x09, 0x05, 0x08, 0x18, 0x0f, 0x14, 0x10, 0x06, 0x07, 0x09, 0x08, 0x08, 0x10, 0x0b, 0x04, 0x0c, 0x19, 0x03, 0x0d, 0x08, 0x0e, 0x06, 0x04, 0x04, 0x03, 0x0c, 0x17, 0x04, 0x15, 0x46, 0x18, 0x08, 0x0a, 0x19, 0x0c, 0x0d, 0x0b, 0x0c, 0x0b, 0x0c, 0x09, 0x0c, 0x09, 0x09, 0x08, 0x0e, 0x0b, 0x09, 0x08, 0x08, 0x0e, 0x09, 0x08, 0x09, 0x0b, 0x09, 0x08, 0x09, 0x0d, 0x0a, 0x0b, 0x0a, 0x0c, 0x06, 0x0e};
 int16_t aiSTRChunkOffset[23] = {0, 2823, 3685, 4215, 6143, 9368, 12415, 13333, 15667, 16953, 18222, 18642, 19717, 20411, 21074, 22414, 22980, 23369, 24057, 24758, 26667, 27795, 28177};
 char rgSTRLookupTable[84] = " eatiornslhducpmygf.b%vwTS:'kPMRY0CADF,Wx*EIBN-qHLO1UG259V?()z/!\\J3j4|6KZQ&<>8#X7;=@";
 
-extern const char *const aSTRUncompressed[];
+#ifndef STARS_STRINGS_UNCOMPRESSED
+/* Strings decoded so far, by id. A nibble decodes to at most one char, so
+ * the arena holds every string without running out. */
+static char *rgpszSTRCache[sizeof(acSTR)];
+static char rgchSTRArena[sizeof(aSTRCmpr) * 2 + sizeof(acSTR)];
+static int32_t ichSTRArena;
+#endif
+
 /* functions */
+#ifdef STARS_STRINGS_UNCOMPRESSED
+extern const char *const aSTRUncompressed[];
+
+char *PszGetCompressedString(int16_t ids)
+{
+    return (char *)aSTRUncompressed[ids];
+}
+#else
 char *PszGetCompressedString(int16_t ids)
 {
     int16_t iChunk;
@@ -24,6 +39,66 @@ char *PszGetCompressedString(int16_t ids)
     int16_t iOffset;
     int16_t fHigh;
 
-    // TODO: implement actual decompression, but for now all the strings are uncompressed in string_uncompressed.c for simplicity
-    return aSTRUncompressed[ids];
+    if (rgpszSTRCache[ids] != NULL)
+    {
+        return rgpszSTRCache[ids];
+    }
+
+    pszOut = &rgchSTRArena[ichSTRArena];
+    i = CchDecodeNibbleString(pszOut, aSTRCmpr, acSTR, aiSTRChunkOffset, rgSTRLookupTable, ids);
+    ichSTRArena += i + 1;
+    rgpszSTRCache[ids] = pszOut;
+    return pszOut;
+}
+#endif
+
+/* String id of a nibble-packed catalog (STR or MSG) into pszOut. Chunks of
+ * 64 ids start on a byte at rgibChunk; within a chunk the strings follow
+ * each other nibble by nibble, rgcLen giving each one's length. An 0xF
+ * nibble adds 15 to the next one; any other nibble ends the lookup table
+ * index of one char. pszOut needs room for the nibble count and the NUL.
+ * Returns the length. */
+int16_t CchDecodeNibbleString(char *pszOut, char *pchCmpr, uint8_t *rgcLen, int16_t *rgibChunk, char *pchLookup, int16_t id)
+{
+    uint8_t *pcLen;
+    char *pch;
+    int16_t iChunk;
+    int16_t iNibble;
+    int16_t iBuild;
+    int16_t iLen;
+    int16_t fHigh;
+    int16_t i;
+
+    iChunk = (int16_t)(id >> 6);
+    pcLen = &rgcLen[iChunk << 6];
+    iNibble = 0;
+    for (i = (int16_t)(iChunk << 6); i < id; i++)
+    {
+        iNibble = (int16_t)(iNibble + *pcLen++);
+    }
+    iLen = *pcLen;
+    pch = &pchCmpr[rgibChunk[iChunk] + (iNibble >> 1)];
+    fHigh = (int16_t)((iNibble & 1) == 0);
+
+    iBuild = 0;
+    for (i = 0; iLen > 0; iLen--)
+    {
+        if (fHigh)
+        {
+            iNibble = (int16_t)((uint8_t)*pch >> 4);
+        }
+        else
+        {
+            iNibble = (int16_t)(*pch++ & 0x0f);
+        }
+        fHigh = (int16_t)!fHigh;
+        iBuild = (int16_t)(iBuild + iNibble);
+        if (iNibble != 0x0f)
+        {
+            pszOut[i++] = pchLookup[iBuild];
+            iBuild = 0;
+        }
+    }
+    pszOut[i] = '\0';
+    return i;
 }
@@ -11,6 +11,7 @@ extern char rgSTRLookupTable[84];    /* MEMORY_STRINGS:0x73e6 */
 
 /* functions */
 char *PszGetCompressedString(int16_t ids); /* MEMORY_STRINGS:0x743a */
+int16_t CchDecodeNibbleString(char *pszOut, char *pchCmpr, uint8_t *rgcLen, int16_t *rgibChunk, char *pchLookup, int16_t id);
 
 typedef enum StringId
 {
@@ -0,0 +1,217 @@
+/* test_aictx.c
+ *
+ * Unit tests for the per-player AI contexts (aictx.c).
+ */
+
+#include "acutest.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "types.h"
+#include "globals.h"
+#include "../aictx.h"
+#include "../aiutil.h"
+#include "../utilgen.h"
+
+enum { cplTest = 300 };
+
+static PLANET rgplTest[cplTest];
+static int16_t cCall;
+
+static int16_t enum_test_closest(PLANET *lppl, PLANET *lpplT)
+{
+    cCall++;
+    return lpplT != lppl && lpplT->id % 7 == 3;
+}
+
+static int16_t enum_test_best(PLANET *lppl, PLANET *lpplT)
+{
+    cCall++;
+    return lpplT != lppl ? lpplT->id % 5 : 0;
+}
+
+static void setup_planets(void)
+{
+    int16_t i;
+
+    lRandSeed1 = 0x11d7a3b5;
+    lRandSeed2 = 0x00042c17;
+    memset(rgplTest, 0, sizeof(rgplTest));
+    for (i = 0; i < cplTest; i++)
+    {
+        rgplTest[i].id = i;
+        rgptPlan[i].x = (int16_t)(1000 + Random(400));
+        rgptPlan[i].y = (int16_t)(1000 + Random(400));
+    }
+    lpPlanets = rgplTest;
+    cPlanet = cplTest;
+}
+
+static int compare_test_ord(const void *pv1, const void *pv2)
+{
+    const AIORD *paiord1 = (const AIORD *)pv1;
+    const AIORD *paiord2 = (const AIORD *)pv2;
+
+    if (paiord1->d2 != paiord2->d2)
+    {
+        return paiord1->d2 < paiord2->d2 ? -1 : 1;
+    }
+    return paiord1->i - paiord2->i;
+}
+
+static void test_context_swap(void)
+{
+    AICTX *lpaictx0;
+    AICTX *lpaictx1;
+    uint8_t *lpbData0;
+
+    lpaictx0 = LpaictxFromPlayer(0);
+    lpaictx1 = LpaictxFromPlayer(1);
+    TEST_ASSERT(lpaictx0 != NULL && lpaictx1 != NULL && lpaictx0 != lpaictx1);
+    TEST_CHECK(LpaictxFromPlayer(0) == lpaictx0);
+    TEST_CHECK(LpaictxFromPlayer(16) == NULL);
+
+    /* player 0 builds some scratch state */
+    EnterAiCtx(lpaictx0);
+    TEST_CHECK(vlpaictxCur == lpaictx0);
+    lpbData0 = (uint8_t *)malloc(32);
+    vlpbAiData = lpbData0;
+    vclpplAi = 3;
+    vrgAiArmadaPotency[2] = 7;
+    LeaveAiCtx(lpaictx0);
+
+    /* the globals are clear between players */
+    TEST_CHECK(vlpaictxCur == NULL);
+    TEST_CHECK(vlpbAiData == NULL && vclpplAi == 0 && vrgAiArmadaPotency[2] == 0);
+    TEST_CHECK(lpaictx0->lpbData == lpbData0 && lpaictx0->cpl == 3);
+
+    /* player 1 sees none of it */
+    EnterAiCtx(lpaictx1);
+    TEST_CHECK(vlpbAiData == NULL && vclpplAi == 0 && vrgAiArmadaPotency[2] == 0);
+    vclpplAi = 5;
+    LeaveAiCtx(lpaictx1);
+
+    /* player 0 gets its own state back */
+    EnterAiCtx(lpaictx0);
+    TEST_CHECK(vlpbAiData == lpbData0 && vclpplAi == 3 && vrgAiArmadaPotency[2] == 7);
+    LeaveAiCtx(lpaictx0);
+    TEST_CHECK(lpaictx1->cpl == 5);
+
+    FreeAiCtxs();
+}
+
+/* FDoAiTurns only runs computer players, leaves the globals clear and puts
+ * fAi back. */
+static void test_FDoAiTurns_runs_ai_players_only(void)
+{
+    int16_t fAiSav;
+
+    memset(rgplr, 0, sizeof(rgplr));
+    game.cPlayer = 3;
+    game.turn = 7;
+    rgplr[1].fAi = 1;
+    fAiSav = fAi = 0;
+
+    TEST_CHECK(FDoAiTurns());
+    TEST_CHECK(fAi == fAiSav);
+    TEST_CHECK(vlpaictxCur == NULL && vlpbAiData == NULL);
+
+    /* only player 1's world model was brought up to date */
+    TEST_CHECK(LpaictxFromPlayer(1)->world.iPlayer == 1 && LpaictxFromPlayer(1)->world.turn == 7);
+    TEST_CHECK(LpaictxFromPlayer(0)->world.turn == 0 && LpaictxFromPlayer(2)->world.turn == 0);
+
+    FreeAiCtxs();
+}
+
+/* Popping the heap gives the same order as a full sort, ties by index. */
+static void test_heap_pops_nearest_first(void)
+{
+    AIORD rgaiordHeap[200];
+    AIORD rgaiordSort[200];
+    int16_t caiord;
+    int16_t i;
+
+    lRandSeed1 = 0x3f2e1d0c;
+    lRandSeed2 = 0x0012ab34;
+    for (i = 0; i < 200; i++)
+    {
+        rgaiordSort[i].d2 = Random(50); /* plenty of ties */
+        rgaiordSort[i].i = i;
+    }
+    memcpy(rgaiordHeap, rgaiordSort, sizeof(rgaiordHeap));
+    qsort(rgaiordSort, 200, sizeof(AIORD), compare_test_ord);
+
+    caiord = 200;
+    HeapifyAiOrd(rgaiordHeap, caiord);
+    for (i = 0; i < 200; i++)
+    {
+        TEST_CHECK(IPopAiOrd(rgaiordHeap, &caiord) == rgaiordSort[i].i);
+    }
+    TEST_CHECK(caiord == 0 && IPopAiOrd(rgaiordHeap, &caiord) == -1);
+}
+
+/* A budget changes how far the searches look, not what they find. */
+static void test_budgeted_search_matches_scan(void)
+{
+    AICTX *lpaictx;
+    PLANET *lpplClosest;
+    PLANET *lpplBest;
+    int16_t cCallScan;
+    int16_t ipl;
+
+    setup_planets();
+    lpaictx = LpaictxFromPlayer(0);
+    for (ipl = 0; ipl < cplTest; ipl += 37)
+    {
+        cCall = 0;
+        lpplClosest = LpplFindClosestEnum(&lpPlanets[ipl], enum_test_closest);
+        cCallScan = cCall;
+        lpplBest = LpplFindBestEnum(&lpPlanets[ipl], enum_test_best);
+
+        SetAiBudget(60000);
+        EnterAiCtx(lpaictx);
+        StartAiBudget(lpaictx);
+        cCall = 0;
+        TEST_CHECK(LpplFindClosestEnum(&lpPlanets[ipl], enum_test_closest) == lpplClosest);
+        /* nearest first stops at the first hit instead of scanning on */
+        TEST_CHECK(cCall < cCallScan);
+        TEST_MSG("planet %d: %d calls budgeted, %d scanning", ipl, cCall, cCallScan);
+        TEST_CHECK(LpplFindBestEnum(&lpPlanets[ipl], enum_test_best) == lpplBest);
+        LeaveAiCtx(lpaictx);
+        SetAiBudget(0);
+    }
+    FreeAiCtxs();
+    lpPlanets = NULL;
+    cPlanet = 0;
+}
+
+static void test_SetAiBudget_reaches_every_context(void)
+{
+    AICTX *lpaictx;
+
+    lpaictx = LpaictxFromPlayer(3);
+    TEST_CHECK(lpaictx->msBudget == 0);
+    SetAiBudget(250);
+    TEST_CHECK(lpaictx->msBudget == 250);
+    TEST_CHECK(LpaictxFromPlayer(4)->msBudget == 250);
+
+    /* an expired budget stops the search, outside a context it never does */
+    lpaictx->clkDeadline = 0;
+    EnterAiCtx(lpaictx);
+    TEST_CHECK(FAiBudgetExpired());
+    LeaveAiCtx(lpaictx);
+    TEST_CHECK(!FAiBudgetExpired());
+
+    SetAiBudget(0);
+    FreeAiCtxs();
+}
+
+TEST_LIST = {
+    {"AI contexts swap scratch state per player", test_context_swap},
+    {"FDoAiTurns runs only the computer players", test_FDoAiTurns_runs_ai_players_only},
+    {"Candidate heap pops nearest first", test_heap_pops_nearest_first},
+    {"Budgeted searches find what a full scan finds", test_budgeted_search_matches_scan},
+    {"SetAiBudget reaches every context", test_SetAiBudget_reaches_every_context},
+    {NULL, NULL},
+};
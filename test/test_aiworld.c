@@ -0,0 +1,177 @@
+/* test_aiworld.c
+ *
+ * Unit tests for the per-AI world model (aiworld.c) and its file.
+ */
+
+#include "acutest.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "types.h"
+#include "globals.h"
+#include "../aictx.h"
+#include "../aiworld.h"
+
+enum { cplTest = 4, cflTest = 4 };
+
+static PLANET rgplTest[cplTest];
+static FLEET rgflTest[cflTest];
+static FLEET *rglpflTest[cflTest];
+
+/* Player 0 owns planet 0; player 1 has a fleet in orbit there (0), one in
+ * deep space far away (1), and one sitting on player 0's fleet (2, 3). */
+static void setup_world(void)
+{
+    int16_t i;
+
+    memset(rgplTest, 0, sizeof(rgplTest));
+    memset(rgflTest, 0, sizeof(rgflTest));
+    for (i = 0; i < cplTest; i++)
+    {
+        rgplTest[i].id = i;
+        rgplTest[i].iPlayer = -1;
+        rgptPlan[i].x = (int16_t)(1000 + 200 * i);
+        rgptPlan[i].y = 1000;
+    }
+    rgplTest[0].iPlayer = 0;
+    lpPlanets = rgplTest;
+    cPlanet = cplTest;
+    game.cPlanMax = cplTest;
+    game.turn = 10;
+
+    for (i = 0; i < cflTest; i++)
+    {
+        rgflTest[i].id = i;
+        rgflTest[i].iPlayer = 1;
+        rgflTest[i].idPlanet = -1;
+        rgflTest[i].rgcsh[0] = (int16_t)(i + 1);
+        rglpflTest[i] = &rgflTest[i];
+    }
+    rgflTest[0].idPlanet = 0;
+    rgflTest[0].pt = rgptPlan[0];
+    rgflTest[1].pt.x = 1900;
+    rgflTest[1].pt.y = 1900;
+    rgflTest[2].pt.x = 1500;
+    rgflTest[2].pt.y = 1500;
+    rgflTest[3].iPlayer = 0;
+    rgflTest[3].pt = rgflTest[2].pt;
+    rglpfl = rglpflTest;
+    cFleet = cflTest;
+}
+
+static void test_only_visible_fleets(void)
+{
+    AIWORLD world;
+
+    setup_world();
+    memset(&world, 0, sizeof(world));
+    TEST_CHECK(UpdateAiWorld(&world, 0) > 0);
+
+    TEST_CHECK(LpflmodFromAiWorld(&world, 0) != NULL);
+    TEST_CHECK(LpflmodFromAiWorld(&world, 1) == NULL);
+    TEST_CHECK(LpflmodFromAiWorld(&world, 2) != NULL);
+    TEST_CHECK(LpflmodFromAiWorld(&world, 3) == NULL); /* our own */
+    TEST_CHECK(world.cfl == 2);
+    TEST_CHECK(LpplmodFromAiWorld(&world, &lpPlanets[0])->cshThreat == 1);
+
+    FreeAiWorld(&world);
+}
+
+/* A second update with nothing moved changes nothing; a fleet leaving our
+ * sight takes its threat with it. */
+static void test_update_applies_changes(void)
+{
+    AIWORLD world;
+
+    setup_world();
+    memset(&world, 0, sizeof(world));
+    TEST_CHECK(UpdateAiWorld(&world, 0) > 0);
+    TEST_CHECK(UpdateAiWorld(&world, 0) == 0);
+
+    rgflTest[0].idPlanet = -1;
+    rgflTest[0].pt.x = 1700;
+    TEST_CHECK(UpdateAiWorld(&world, 0) == 1);
+    TEST_CHECK(LpflmodFromAiWorld(&world, 0) == NULL);
+    TEST_CHECK(LpplmodFromAiWorld(&world, &lpPlanets[0])->cshThreat == 0);
+
+    /* it comes back with more ships */
+    rgflTest[0].idPlanet = 0;
+    rgflTest[0].pt = rgptPlan[0];
+    rgflTest[0].rgcsh[0] = 5;
+    TEST_CHECK(UpdateAiWorld(&world, 0) == 1);
+    TEST_CHECK(LpplmodFromAiWorld(&world, &lpPlanets[0])->cshThreat == 5);
+
+    FreeAiWorld(&world);
+}
+
+static void test_pack_round_trip(void)
+{
+    AIWORLD world;
+    AIWORLD worldLoad;
+    uint8_t rgb[512];
+    uint32_t cb;
+
+    setup_world();
+    memset(&world, 0, sizeof(world));
+    memset(&worldLoad, 0, sizeof(worldLoad));
+    TEST_CHECK(UpdateAiWorld(&world, 0) > 0);
+    cb = CbPackAiWorld(&world, NULL, 0);
+    TEST_ASSERT(cb <= sizeof(rgb));
+    TEST_CHECK(CbPackAiWorld(&world, rgb, sizeof(rgb)) == cb);
+    /* 14-byte header, 10 bytes a planet, 12 a fleet, little-endian */
+    TEST_CHECK(cb == 14 + cplTest * 10 + 2 * 12);
+    TEST_CHECK(rgb[0] == (uint8_t)cb && rgb[1] == 0 && rgb[8] == 10 && rgb[9] == 0);
+    TEST_CHECK(!FUnpackAiWorld(&worldLoad, rgb, cb - 1));
+    TEST_CHECK(FUnpackAiWorld(&worldLoad, rgb, cb));
+    TEST_CHECK(worldLoad.iPlayer == 0 && worldLoad.turn == 10 && worldLoad.cfl == 2);
+    TEST_CHECK(memcmp(worldLoad.rgplmod, world.rgplmod, cplTest * sizeof(AIPLMOD)) == 0);
+
+    /* the loaded model picks up where the saved one left off */
+    TEST_CHECK(UpdateAiWorld(&worldLoad, 0) == 0);
+
+    FreeAiWorld(&world);
+    FreeAiWorld(&worldLoad);
+}
+
+/* FWriteAiWorlds/FReadAiWorlds carry the models from one host run to the
+ * next through szBase.ai. */
+static void test_worlds_survive_the_file(void)
+{
+    char szFile[256 + 4];
+
+    setup_world();
+    (void)snprintf(szBase, sizeof(szBase), "test_aiworld_tmp");
+    (void)snprintf(szFile, sizeof(szFile), "%s.ai", szBase);
+
+    TEST_CHECK(UpdateAiWorld(&LpaictxFromPlayer(0)->world, 0) > 0);
+    TEST_CHECK(FWriteAiWorlds());
+    FreeAiCtxs();
+
+    TEST_CHECK(FReadAiWorlds());
+    TEST_CHECK(LpaictxFromPlayer(0)->world.cfl == 2);
+    TEST_CHECK(UpdateAiWorld(&LpaictxFromPlayer(0)->world, 0) == 0);
+    FreeAiCtxs();
+
+    /* a torn file is refused */
+    {
+        FILE *fp = fopen(szFile, "ab");
+        uint32_t cb = 100;
+
+        TEST_ASSERT(fp != NULL);
+        fwrite(&cb, sizeof(cb), 1, fp);
+        fclose(fp);
+    }
+    TEST_CHECK(!FReadAiWorlds());
+    FreeAiCtxs();
+    remove(szFile);
+    TEST_CHECK(FReadAiWorlds());
+}
+
+TEST_LIST = {
+    {"UpdateAiWorld keeps only the fleets in view", test_only_visible_fleets},
+    {"UpdateAiWorld applies only what changed", test_update_applies_changes},
+    {"AIWORLD packs and unpacks", test_pack_round_trip},
+    {"World models survive szBase.ai", test_worlds_survive_the_file},
+    {NULL, NULL},
+};
@@ -0,0 +1,166 @@
+/* test_btlexp.c
+ *
+ * Unit tests for the NDJSON battle exporter (btlexp.c): a synthetic turn file
+ * with a BOF, encrypted battle records split across rtBtlData/rtBtlCont, and
+ * an unrelated record in between.
+ */
+
+#include "acutest.h"
+
+#include "types.h"
+#include "turnfile.h"
+#include "../btlexp.h"
+
+#define lidTest 0x12345678
+#define turnTest 42
+#define iPlayerTest 3
+#define lSaltTest 0x155
+
+static void put_w(uint8_t *pb, uint16_t w)
+{
+    pb[0] = (uint8_t)w;
+    pb[1] = (uint8_t)(w >> 8);
+}
+
+/* id 9 at planet 17: 2 toks, round 0 tok 0 fires at tok 1 (2 hits),
+ * round 1 tok 1 moves. Written as BTLDATA+TOKs, then the records. */
+static void write_battle(FILE *pf)
+{
+    uint8_t rgb[0x200];
+    uint8_t *pb;
+    uint16_t cbHdr;
+
+    memset(rgb, 0, sizeof(rgb));
+    put_w(rgb, 9);
+    rgb[2] = 2;
+    rgb[3] = 2;
+    put_w(rgb + 4, 0x0009);
+    put_w(rgb + 8, 17);
+    put_w(rgb + 10, 1200);
+    put_w(rgb + 12, 1300);
+    pb = rgb + cbBtlDataDisk;
+    put_w(pb, 0x0101), pb[2] = 0, pb[4] = 3, put_w(pb + 0x13, 5);
+    pb += cbTokDisk;
+    put_w(pb, 0x2000), pb[2] = 3, pb[4] = 1, put_w(pb + 0x13, 8);
+    pb += cbTokDisk;
+    cbHdr = (uint16_t)(pb - rgb);
+
+    pb[0] = 0, pb[1] = 0x22, put_w(pb + 2, 2), put_w(pb + 4, (uint16_t)((1 << 8) | (1 << 4) | 0));
+    pb += cbBtlRecDisk;
+    pb[0] = 1, pb[1] = 1, put_w(pb + 2, 2), put_w(pb + 4, 30), put_w(pb + 6, 0x0085);
+    pb += cbKillDisk;
+    pb[0] = 1, pb[1] = 2, put_w(pb + 2, 1), put_w(pb + 4, 12), put_w(pb + 6, 0x0100);
+    pb += cbKillDisk;
+    pb[0] = 1, pb[1] = 0x33, put_w(pb + 2, 0), put_w(pb + 4, (uint16_t)(1 | (2 << 4)));
+    pb += cbBtlRecDisk;
+    put_w(rgb + 6, (uint16_t)(pb - rgb));
+
+    put_rt(pf, rtBtlData, cbHdr, rgb, 1);
+    put_rt(pf, rtBtlCont, (uint16_t)(pb - rgb - cbHdr), rgb + cbHdr, 1);
+}
+
+/* Single-tok battle with no actions, written in one record. */
+static void write_quiet_battle(FILE *pf)
+{
+    uint8_t rgb[cbBtlDataDisk + cbTokDisk];
+
+    memset(rgb, 0, sizeof(rgb));
+    put_w(rgb, 10);
+    rgb[2] = 1;
+    rgb[3] = 1;
+    put_w(rgb + 6, sizeof(rgb));
+    put_w(rgb + 8, 0xffff);
+    put_rt(pf, rtBtlData, sizeof(rgb), rgb, 1);
+}
+
+static FILE *write_turn_file(int fTruncate)
+{
+    FILE *pf = tmpfile();
+    uint8_t rgb[6] = {1, 2, 3, 4, 5, 6};
+    RTBOF bof;
+
+    init_bof(&bof, lidTest, turnTest, iPlayerTest, lSaltTest);
+    put_bof(pf, &bof);
+    put_rt(pf, 13, sizeof(rgb), rgb, 1);
+    write_battle(pf);
+    if (!fTruncate)
+    {
+        write_quiet_battle(pf);
+        put_eof(pf);
+    }
+    else
+    {
+        /* lose the continuation */
+        fseek(pf, -(long)(2 + 2 * cbBtlRecDisk + 2 * cbKillDisk), SEEK_END);
+        put_eof(pf);
+    }
+    rewind(pf);
+    return pf;
+}
+
+static void test_export_battles(void)
+{
+    FILE *pfIn = write_turn_file(0);
+    FILE *pfOut = tmpfile();
+    char szLine[1024];
+    int cLine;
+
+    TEST_CHECK(CExportBattlesNdjson(pfIn, pfOut) == 2);
+    rewind(pfOut);
+
+    cLine = 0;
+    while (fgets(szLine, sizeof(szLine), pfOut) != NULL)
+    {
+        TEST_CHECK(szLine[0] == '{' && strstr(szLine, "}\n") != NULL);
+        switch (cLine)
+        {
+        case 0:
+            TEST_CHECK(strstr(szLine, "\"type\":\"battle\",\"turn\":42,\"player\":3,\"battle\":0,\"id\":9,\"planet\":17") != NULL);
+            TEST_CHECK(strstr(szLine, "\"x\":1200,\"y\":1300") != NULL);
+            TEST_CHECK(strstr(szLine, "{\"itok\":1,\"owner\":3,\"id\":8192,\"design\":1,\"ships\":8}") != NULL);
+            break;
+        case 1:
+            TEST_CHECK(strstr(szLine, "\"round\":0,\"attacker\":{\"itok\":0,\"owner\":0,\"id\":257}") != NULL);
+            TEST_CHECK(strstr(szLine, "\"target\":1,\"kills\":3,\"shield_damage\":42") != NULL);
+            TEST_CHECK(strstr(szLine, "{\"itok\":1,\"owner\":3,\"weapon\":2,\"kills\":1,\"shield\":12,\"dv\":256}") != NULL);
+            break;
+        case 2:
+            TEST_CHECK(strstr(szLine, "\"round\":1,\"attacker\":{\"itok\":1,") != NULL);
+            TEST_CHECK(strstr(szLine, "\"move\":51,\"dz\":2,") != NULL);
+            TEST_CHECK(strstr(szLine, "\"hits\":[]}") != NULL);
+            break;
+        case 3:
+            TEST_CHECK(strstr(szLine, "\"battle\":1,\"id\":10,\"planet\":-1") != NULL);
+            break;
+        }
+        cLine++;
+    }
+    TEST_CHECK(cLine == 4);
+    TEST_MSG("lines: %d", cLine);
+
+    fclose(pfIn);
+    fclose(pfOut);
+}
+
+static void test_export_rejects_bad_files(void)
+{
+    FILE *pfIn = write_turn_file(1);
+    FILE *pfOut = tmpfile();
+    uint8_t rgb[4] = {0};
+
+    TEST_CHECK(CExportBattlesNdjson(pfIn, pfOut) == -1);
+    fclose(pfIn);
+
+    /* no BOF */
+    pfIn = tmpfile();
+    put_rt(pfIn, 13, sizeof(rgb), rgb, 1);
+    rewind(pfIn);
+    TEST_CHECK(CExportBattlesNdjson(pfIn, pfOut) == -1);
+    fclose(pfIn);
+    fclose(pfOut);
+}
+
+TEST_LIST = {
+    {"export battles from a turn file as NDJSON", test_export_battles},
+    {"reject truncated or headerless files", test_export_rejects_bad_files},
+    {NULL, NULL}};
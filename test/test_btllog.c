@@ -0,0 +1,242 @@
+/* test_btllog.c
+ *
+ * Unit tests for the indexed battle log (btllog.c) and the htBattle heap walk
+ * in vcr.c (CBattles / BtlDataGet).
+ */
+
+#include "acutest.h"
+
+#include "types.h"
+#include "globals.h"
+#include "../memory.h"
+#include "../vcr.h"
+#include "../btllog.h"
+#include "../file.h"
+
+/* Battle blob layout inside an htBattle block: HB, size word, BTLDATAs. */
+static uint8_t *lpbBattleStart(HB *lphb)
+{
+    return (uint8_t *)lphb + sizeof(HB) + 2;
+}
+
+static BTLREC *add_rec(uint8_t **plpb, uint8_t itok, uint8_t iRound, uint8_t itokTarget, uint16_t cshKill, uint16_t dv)
+{
+    BTLREC *lpbr = (BTLREC *)*plpb;
+
+    memset(lpbr, 0, sizeof(BTLREC) + sizeof(KILL));
+    lpbr->itok = itok;
+    lpbr->brcDest = 0x33;
+    lpbr->iRound = iRound;
+    lpbr->itokAttack = itokTarget;
+    lpbr->ctok = 1;
+    lpbr->rgkill[0].itok = itokTarget;
+    lpbr->rgkill[0].grfWeapon = 1;
+    lpbr->rgkill[0].cshKill = cshKill;
+    lpbr->rgkill[0].dpShield = 7;
+    lpbr->rgkill[0].dv.dp = dv;
+    *plpb += sizeof(BTLREC) + sizeof(KILL);
+    return lpbr;
+}
+
+/* Two battles in one block:
+ *   #0 id 5: 2 toks, rounds 0,0,2 (round 1 idle)
+ *   #1 id 6: 1 tok, no actions */
+static HB *build_heap(void)
+{
+    HB *lphb;
+    uint8_t *lpb;
+    BTLDATA *lpbd;
+
+    for (int i = 0; i < (int)htCount; i++)
+    {
+        rglphb[i] = NULL;
+        mphtcbAlloc[i] = 0x0100;
+    }
+
+    lphb = LphbAlloc(0x0800, htBattle);
+    lpb = lpbBattleStart(lphb);
+
+    lpbd = (BTLDATA *)lpb;
+    memset(lpbd, 0, sizeof(BTLDATA) + 2 * sizeof(TOK));
+    lpbd->id = 5;
+    lpbd->ctok = 2;
+    lpbd->rgtok[0].csh = 10;
+    lpbd->rgtok[1].csh = 4;
+    lpb += sizeof(BTLDATA) + 2 * sizeof(TOK);
+    add_rec(&lpb, 0, 0, 1, 1, 0x0085);
+    add_rec(&lpb, 1, 0, 0, 3, 0x0100);
+    add_rec(&lpb, 0, 2, 1, 5, 0x0000);
+    lpbd->cbData = (uint16_t)(lpb - (uint8_t *)lpbd);
+
+    lpbd = (BTLDATA *)lpb;
+    memset(lpbd, 0, sizeof(BTLDATA) + sizeof(TOK));
+    lpbd->id = 6;
+    lpbd->ctok = 1;
+    lpbd->rgtok[0].csh = 1;
+    lpbd->cbData = (uint16_t)(sizeof(BTLDATA) + sizeof(TOK));
+    lpb += lpbd->cbData;
+
+    *(uint16_t *)lpb = 0xffff;
+    lpb += 2;
+    lphb->ibTop = (uint16_t)(lpb - (uint8_t *)lphb);
+    return lphb;
+}
+
+static void free_heap(HB *lphb)
+{
+    rglphb[htBattle] = NULL;
+    FreeHb(lphb);
+}
+
+static void test_CBattles_and_BtlDataGet(void)
+{
+    HB *lphb = build_heap();
+
+    TEST_CHECK(CBattles() == 2);
+    TEST_CHECK(BtlDataGet(0) != NULL && BtlDataGet(0)->id == 5);
+    TEST_CHECK(BtlDataGet(1) != NULL && BtlDataGet(1)->id == 6);
+    TEST_CHECK(BtlDataGet(2) == NULL);
+    TEST_CHECK(BtlDataGet(-1) == NULL);
+
+    free_heap(lphb);
+    TEST_CHECK(CBattles() == 0);
+}
+
+static void test_BtlLog_index_and_rounds(void)
+{
+    HB *lphb = build_heap();
+    BTLLOG log;
+    BTLTOKST *rgtokst;
+
+    TEST_ASSERT(FBuildBtlLog(&log));
+    TEST_CHECK(log.cBattle == 2);
+    TEST_CHECK(LpbdFromBtlLog(&log, 1)->id == 6);
+    TEST_CHECK(log.rgent[0].cbr == 3);
+    TEST_CHECK(log.rgent[0].cRound == 3);
+    TEST_CHECK(log.rgent[1].cbr == 0);
+
+    TEST_CHECK(IbrFromBtlLogRound(&log, 0, 0) == 0);
+    TEST_CHECK(IbrFromBtlLogRound(&log, 0, 1) == 2);
+    TEST_CHECK(IbrFromBtlLogRound(&log, 0, 2) == 2);
+    TEST_CHECK(IbrFromBtlLogRound(&log, 0, 3) == 3);
+    TEST_CHECK(LpbrFromBtlLog(&log, 0, 2)->iRound == 2);
+    TEST_CHECK(LpbrFromBtlLog(&log, 0, 3) == NULL);
+
+    rgtokst = LptokstFromBtlLog(&log, 0, 0);
+    TEST_CHECK(rgtokst[0].csh == 10 && rgtokst[1].csh == 4);
+
+    rgtokst = LptokstFromBtlLog(&log, 0, 1);
+    TEST_CHECK(rgtokst[0].csh == 7);
+    TEST_CHECK(rgtokst[0].dv.dp == 0x0100);
+    TEST_CHECK(rgtokst[1].csh == 3);
+    TEST_CHECK(rgtokst[1].dpShield == 7);
+
+    /* past the end: final state, kill clamps at zero */
+    rgtokst = LptokstFromBtlLog(&log, 0, 15);
+    TEST_CHECK(rgtokst[1].csh == 0);
+    TEST_CHECK(rgtokst[1].dpShield == 14);
+
+    FreeBtlLog(&log);
+    free_heap(lphb);
+}
+
+/* The live index follows the heap: rebuilt after it is freed and after
+ * blocks are added. */
+static void test_live_index_follows_heap(void)
+{
+    HB *lphb = build_heap();
+    HB *lphb2;
+    uint8_t *lpb;
+    BTLDATA *lpbd;
+
+    TEST_CHECK(CBattles() == 2);
+    TEST_CHECK(vbtllog.fValid);
+    TEST_CHECK(BtlDataGet(1) == vbtllog.rgent[1].lpbd);
+
+    lphb2 = LphbAlloc(0x0100, htBattle);
+    TEST_CHECK(!vbtllog.fValid);
+    lpb = lpbBattleStart(lphb2);
+    lpbd = (BTLDATA *)lpb;
+    memset(lpbd, 0, sizeof(BTLDATA));
+    lpbd->id = 9;
+    lpbd->cbData = sizeof(BTLDATA);
+    *(uint16_t *)(lpb + lpbd->cbData) = 0xffff;
+    lphb2->ibTop = (uint16_t)(lpb + lpbd->cbData + 2 - (uint8_t *)lphb2);
+
+    /* the new block is at the head of the chain */
+    TEST_CHECK(CBattles() == 3);
+    TEST_CHECK(BtlDataGet(0)->id == 9 && BtlDataGet(2)->id == 6);
+    /* reverse lookup across blocks, whatever their address order */
+    TEST_CHECK(IBattleFromBtlLog(&vbtllog, BtlDataGet(0)) == 0);
+    TEST_CHECK(IBattleFromBtlLog(&vbtllog, BtlDataGet(1)) == 1);
+    TEST_CHECK(IBattleFromBtlLog(&vbtllog, BtlDataGet(2)) == 2);
+    TEST_CHECK(IBattleFromBtlLog(&vbtllog, (BTLDATA *)lpb + 1) == -1);
+
+    free_heap(lphb2);
+    TEST_CHECK(!vbtllog.fValid);
+    TEST_CHECK(CBattles() == 0);
+}
+
+static void test_CBattleKills_from_final_state(void)
+{
+    HB *lphb = build_heap();
+    BTLDATA *lpbd;
+
+    lpbd = BtlDataGet(0);
+    lpbd->rgtok[0].iplr = 0;
+    lpbd->rgtok[1].iplr = 1;
+    idPlayer = 0;
+    /* tok 0 lost 3 of 10; tok 1 lost all 4 (6 kills clamp at 0) */
+    InvalidateBtlLog();
+    TEST_CHECK(CBattleKills(lpbd, 1) == 3);
+    TEST_CHECK(CBattleKills(lpbd, 0) == 4);
+    TEST_CHECK(CBattleKills(BtlDataGet(1), 0) == 0);
+
+    free_heap(lphb);
+}
+
+static void test_UpdateBattleRecords_converts_26_records(void)
+{
+    HB *lphb = build_heap();
+    BTLDATA *lpbd;
+    BTLREC26 *lpbr26;
+    BTLREC *lpbr;
+    uint8_t rgitokAttack[3];
+    uint8_t *lpb;
+    int ibr;
+
+    /* rewrite battle 0's records in the 2.6 layout */
+    lpbd = BtlDataGet(0);
+    lpb = (uint8_t *)lpbd + sizeof(BTLDATA) + lpbd->ctok * sizeof(TOK);
+    for (ibr = 0; ibr < 3; ibr++, lpb += sizeof(BTLREC) + sizeof(KILL))
+    {
+        lpbr = (BTLREC *)lpb;
+        lpbr26 = (BTLREC26 *)lpb;
+        rgitokAttack[ibr] = (uint8_t)lpbr->itokAttack;
+        lpbr26->unused = 0;
+        lpbr26->itokAttack = rgitokAttack[ibr];
+        lpbr26->ctok = 1;
+    }
+
+    UpdateBattleRecords();
+    lpb = (uint8_t *)lpbd + sizeof(BTLDATA) + lpbd->ctok * sizeof(TOK);
+    for (ibr = 0; ibr < 3; ibr++, lpb += sizeof(BTLREC) + sizeof(KILL))
+    {
+        lpbr = (BTLREC *)lpb;
+        TEST_CHECK(lpbr->ctok == 1);
+        TEST_CHECK(lpbr->itokAttack == rgitokAttack[ibr]);
+    }
+    TEST_CHECK(LpbrFromBtlLog(&vbtllog, 0, 2)->iRound == 2);
+    TEST_CHECK(vbtllog.fValid && vbtllog.cBattle == 2);
+    TEST_CHECK(vbtllog.rgent[0].cbr == 3);
+
+    free_heap(lphb);
+}
+
+TEST_LIST = {
+    {"CBattles/BtlDataGet walk the htBattle heap", test_CBattles_and_BtlDataGet},
+    {"BtlLog round index and token state", test_BtlLog_index_and_rounds},
+    {"Live index follows the htBattle heap", test_live_index_follows_heap},
+    {"CBattleKills from the indexed final state", test_CBattleKills_from_final_state},
+    {"UpdateBattleRecords converts 2.6 records", test_UpdateBattleRecords_converts_26_records},
+    {NULL, NULL}};
@@ -0,0 +1,469 @@
+/* test_fleet.c
+ *
+ * Unit tests for phased fleet movement (flmove.c), the fleet location
+ * index (flloc.c), the minefield broadphase (minegrid.c) and the minefield
+ * sweep table (minetbl.c).
+ */
+
+#include "acutest.h"
+
+#include <math.h>
+#include <string.h>
+
+#include "types.h"
+#include "globals.h"
+#include "../flmove.h"
+#include "../flloc.h"
+#include "../turn.h"
+#include "../minegrid.h"
+#include "../minetbl.h"
+#include "../ship.h"
+#include "../util.h"
+#include "../utilgen.h"
+
+typedef union
+{
+    PLORD plord;
+    uint8_t rgb[sizeof(PLORD) + 4 * sizeof(ORDER)];
+} ORDBUF;
+
+static void set_fleet(FLEET *lpfl, ORDBUF *pob, int ifl, int x, int y, int xDst, int yDst, int iWarp, int idPlanetDst)
+{
+    memset(lpfl, 0, sizeof(FLEET));
+    memset(pob, 0, sizeof(ORDBUF));
+    lpfl->id = (int16_t)ifl;
+    lpfl->iPlayer = 0;
+    lpfl->idPlanet = -1;
+    lpfl->pt.x = (int16_t)x;
+    lpfl->pt.y = (int16_t)y;
+    lpfl->rgwtMin[4] = 100;
+    lpfl->lpplord = &pob->plord;
+    pob->plord.cbItem = sizeof(ORDER);
+    pob->plord.iordMax = 4;
+    pob->plord.iordMac = 2;
+    pob->plord.rgord[0].pt = lpfl->pt;
+    pob->plord.rgord[0].id = -1;
+    pob->plord.rgord[1].pt.x = (int16_t)xDst;
+    pob->plord.rgord[1].pt.y = (int16_t)yDst;
+    pob->plord.rgord[1].iWarp = (uint16_t)iWarp;
+    pob->plord.rgord[1].grobj = idPlanetDst >= 0 ? 1 : 0;
+    pob->plord.rgord[1].id = (int16_t)idPlanetDst;
+}
+
+/* The pass loop MoveFleets would run: keep gathering until no fleet is
+ * left waiting on another, forcing the rest through if they only follow
+ * each other round in a circle. */
+static void run_fleet_moves(void)
+{
+    int16_t ifl;
+    int16_t cPass;
+    int16_t fDone;
+
+    for (ifl = 0; ifl < cFleet; ifl++)
+    {
+        rglpfl[ifl]->fDone = 0;
+    }
+    fDone = 0;
+    for (cPass = 0; !fDone && cPass <= cFleet; cPass++)
+    {
+        if (!FGatherFleetMoves(&vflmove, 0))
+        {
+            break;
+        }
+        if (vflmove.cmv == 0 && vflmove.cDeferred > 0)
+        {
+            FGatherFleetMoves(&vflmove, 1);
+        }
+        CalcFleetMoves(&vflmove, 0, vflmove.cmv);
+        CalcFleetFuel(&vflmove, 0, vflmove.cmv);
+        ApplyFleetMoves(&vflmove);
+        fDone = (int16_t)(vflmove.cDeferred == 0 || vflmove.cmv == 0);
+    }
+}
+
+static void test_FleetMoves_moves_and_arrives(void)
+{
+    static FLEET rgfl[3];
+    static ORDBUF rgob[3];
+    FLEET *rglpflT[3] = {&rgfl[0], &rgfl[1], &rgfl[2]};
+    FLEET **rglpflOld = rglpfl;
+    int16_t cFleetOld = cFleet;
+    int16_t cThingOld = cThing;
+
+    set_fleet(&rgfl[0], &rgob[0], 0, 100, 100, 200, 100, 5, -1); /* 25 l.y. of 100 */
+    set_fleet(&rgfl[1], &rgob[1], 1, 300, 300, 310, 320, 9, 7);  /* arrives at planet 7 */
+    set_fleet(&rgfl[2], &rgob[2], 2, 50, 50, 80, 90, 4, -1);
+    rgob[2].plord.iordMac = 1;                                   /* no waypoint: stays put */
+    rglpfl = rglpflT;
+    cFleet = 3;
+    cThing = 0;
+
+    run_fleet_moves();
+
+    TEST_CHECK(rgfl[0].pt.x == 125 && rgfl[0].pt.y == 100);
+    TEST_CHECK(rgob[0].plord.iordMac == 2);
+    TEST_CHECK(rgob[0].plord.rgord[0].pt.x == 125);
+    TEST_CHECK(rgfl[0].idPlanet == -1);
+
+    TEST_CHECK(rgfl[1].pt.x == 310 && rgfl[1].pt.y == 320);
+    TEST_CHECK(rgob[1].plord.iordMac == 1);
+    TEST_CHECK_(rgfl[1].idPlanet == 7, "idPlanet %d", rgfl[1].idPlanet);
+
+    TEST_CHECK(rgfl[2].pt.x == 50 && rgfl[2].pt.y == 50);
+    TEST_CHECK(rgfl[0].fDone && rgfl[1].fDone && rgfl[2].fDone);
+
+    rglpfl = rglpflOld;
+    cFleet = cFleetOld;
+    cThing = cThingOld;
+}
+
+static void test_FleetMoves_kernel_split_is_stable(void)
+{
+    enum { cfl = 50 };
+    static FLEET rgfl[cfl];
+    static ORDBUF rgob[cfl];
+    static FLEET *rglpflT[cfl];
+    static int16_t rgxWhole[cfl];
+    static int16_t rgyWhole[cfl];
+    FLEET **rglpflOld = rglpfl;
+    int16_t cFleetOld = cFleet;
+    int16_t cThingOld = cThing;
+    int cBad = 0;
+
+    for (int ifl = 0; ifl < cfl; ifl++)
+    {
+        set_fleet(&rgfl[ifl], &rgob[ifl], ifl, ifl * 37 % 500, ifl * 53 % 500, (ifl * 91 + 40) % 700,
+                  (ifl * 17 + 11) % 700, 1 + ifl % 10, -1);
+        rglpflT[ifl] = &rgfl[ifl];
+    }
+    rglpfl = rglpflT;
+    cFleet = cfl;
+    cThing = 0;
+
+    TEST_CHECK(FGatherFleetMoves(&vflmove, 0));
+    TEST_CHECK(vflmove.cmv == cfl);
+    CalcFleetMoves(&vflmove, 0, vflmove.cmv);
+    memcpy(rgxWhole, vflmove.rgxEnd, sizeof(rgxWhole));
+    memcpy(rgyWhole, vflmove.rgyEnd, sizeof(rgyWhole));
+    CalcFleetMoves(&vflmove, 20, vflmove.cmv);
+    CalcFleetMoves(&vflmove, 0, 20);
+    for (int imv = 0; imv < cfl; imv++)
+    {
+        cBad += rgxWhole[imv] != vflmove.rgxEnd[imv] || rgyWhole[imv] != vflmove.rgyEnd[imv];
+        /* never past the warp's reach */
+        cBad += vflmove.rgdAct[imv] > vflmove.rgiWarp[imv] * vflmove.rgiWarp[imv];
+    }
+    TEST_CHECK_(cBad == 0, "%d rows differ", cBad);
+
+    FreeFleetMoves(&vflmove);
+    rglpfl = rglpflOld;
+    cFleet = cFleetOld;
+    cThing = cThingOld;
+}
+
+/* Ram-scoop fuel tops the tanks up to capacity and no further, even for a
+ * fleet that set out with more than it can hold. */
+static void test_FleetMoves_scooping_stops_at_capacity(void)
+{
+    static uint8_t rgbShdef[0x93];
+    static FLEET rgfl[2];
+    static ORDBUF rgob[2];
+    FLEET *rglpflT[2] = {&rgfl[0], &rgfl[1]};
+    FLEET **rglpflOld = rglpfl;
+    int16_t cFleetOld = cFleet;
+    int16_t cThingOld = cThing;
+    SHDEF *lpshdefOld = rglpshdef[0];
+    int32_t wtFuelMax;
+
+    memset(rgbShdef, 0, sizeof(rgbShdef));
+    rglpshdef[0] = (SHDEF *)rgbShdef;
+    wtFuelMax = WtMaxShdefStat(rglpshdef[0], 1);
+    TEST_ASSERT(wtFuelMax > 0);
+
+    set_fleet(&rgfl[0], &rgob[0], 0, 100, 100, 200, 100, 5, -1);
+    set_fleet(&rgfl[1], &rgob[1], 1, 300, 300, 400, 300, 5, -1);
+    rgfl[0].rgcsh[0] = 1;
+    rgfl[1].rgcsh[0] = 1;
+    rgfl[0].rgwtMin[4] = wtFuelMax - 10;
+    rgfl[1].rgwtMin[4] = wtFuelMax + 50;
+    rglpfl = rglpflT;
+    cFleet = 2;
+    cThing = 0;
+
+    TEST_CHECK(FGatherFleetMoves(&vflmove, 0));
+    CalcFleetMoves(&vflmove, 0, vflmove.cmv);
+    for (int imv = 0; imv < vflmove.cmv; imv++)
+    {
+        vflmove.rgwtFuelUsed[imv] = 5;
+        vflmove.rglFuelGain[imv] = 40;
+    }
+    TEST_CHECK(ApplyFleetMoves(&vflmove) == 2);
+    TEST_CHECK_(rgfl[0].rgwtMin[4] == wtFuelMax, "fuel %d of %d", rgfl[0].rgwtMin[4], wtFuelMax);
+    TEST_CHECK_(rgfl[1].rgwtMin[4] == wtFuelMax, "overfull fuel %d of %d", rgfl[1].rgwtMin[4], wtFuelMax);
+
+    FreeFleetMoves(&vflmove);
+    FreeFleetLocs(&vflloc);
+    rglpshdef[0] = lpshdefOld;
+    rglpfl = rglpflOld;
+    cFleet = cFleetOld;
+    cThing = cThingOld;
+}
+
+/* Every fleet is on exactly the chain for its point, in id order. */
+static int count_bad_chains(int cfl)
+{
+    int cBad = 0;
+    int cSeen = 0;
+
+    for (int ifl = 0; ifl < cfl; ifl++)
+    {
+        FLEET *lpfl = LpflFirstAtPoint(&vflloc, rglpfl[ifl]->pt);
+        int fFound = 0;
+
+        for (; lpfl != NULL; lpfl = lpfl->lpflNext)
+        {
+            cBad += lpfl->pt.x != rglpfl[ifl]->pt.x || lpfl->pt.y != rglpfl[ifl]->pt.y;
+            cBad += lpfl->lpflNext != NULL && lpfl->lpflNext->id <= lpfl->id;
+            fFound |= lpfl == rglpfl[ifl];
+            cSeen++;
+        }
+        cBad += !fFound;
+    }
+    return cBad + (cSeen == 0);
+}
+
+static void test_FleetLocs_follow_moves_and_deletes(void)
+{
+    enum { cfl = 300 };
+    static FLEET rgfl[cfl];
+    static FLEET *rglpflT[cfl];
+    FLEET **rglpflOld = rglpfl;
+    int16_t cFleetOld = cFleet;
+    POINT pt;
+    int cBad;
+
+    memset(rgfl, 0, sizeof(rgfl));
+    for (int ifl = 0; ifl < cfl; ifl++)
+    {
+        rgfl[ifl].id = (int16_t)ifl;
+        rgfl[ifl].pt.x = (int16_t)(ifl * 7 % 23); /* lots of shared points */
+        rgfl[ifl].pt.y = (int16_t)(ifl * 3 % 11);
+        rgfl[ifl].idPlanet = -1;
+        rglpflT[ifl] = &rgfl[ifl];
+    }
+    rglpfl = rglpflT;
+    cFleet = cfl;
+
+    TEST_CHECK(FRebuildFleetLocs(&vflloc));
+    TEST_CHECK(count_bad_chains(cfl) == 0);
+
+    /* scatter them, some onto new points, some onto each other */
+    for (int i = 0; i < 2000; i++)
+    {
+        FLEET *lpfl = &rgfl[i * 131 % cfl];
+
+        pt = lpfl->pt;
+        lpfl->pt.x = (int16_t)(i % 5 == 0 ? 1000 + i : i * 13 % 29);
+        lpfl->pt.y = (int16_t)(i % 5 == 0 ? 2000 - i : i * 17 % 13);
+        MoveFleetLoc(&vflloc, lpfl, pt);
+    }
+    TEST_CHECK(vflloc.fValid);
+    cBad = count_bad_chains(cfl);
+    TEST_CHECK_(cBad == 0, "%d bad after moves", cBad);
+
+    /* drop the last fleet */
+    UnlinkFleetLoc(&vflloc, &rgfl[cfl - 1]);
+    cFleet = cfl - 1;
+    TEST_CHECK(vflloc.fValid && vflloc.cflLoc == cFleet);
+    cBad = count_bad_chains(cfl - 1);
+    TEST_CHECK_(cBad == 0, "%d bad after delete", cBad);
+
+    FreeFleetLocs(&vflloc);
+    rglpfl = rglpflOld;
+    cFleet = cFleetOld;
+}
+
+/* Does the stretch [0, dMax] of the path from ptA towards ptB come within
+ * sqrt(r2) of ptC? */
+static int segment_hits_field(POINT ptA, POINT ptB, POINT ptC, int32_t r2, int16_t dMax)
+{
+    double dx = ptB.x - ptA.x;
+    double dy = ptB.y - ptA.y;
+    double dLen = sqrt(dx * dx + dy * dy);
+    double t = 0.0;
+    double xT;
+    double yT;
+
+    if (dLen > 0.0)
+    {
+        t = ((ptC.x - ptA.x) * dx + (ptC.y - ptA.y) * dy) / dLen;
+        t = t < 0.0 ? 0.0 : t > dMax ? dMax : t;
+        dx /= dLen;
+        dy /= dLen;
+    }
+    xT = ptA.x + dx * t - ptC.x;
+    yT = ptA.y + dy * t - ptC.y;
+    return xT * xT + yT * yT <= r2;
+}
+
+static void test_MineGrid_covers_every_hit_in_order(void)
+{
+    enum { cth = 400 };
+    static THING rgth[cth];
+    THING *lpThingsOld = lpThings;
+    int16_t cThingOld = cThing;
+    int16_t *rgith;
+    int cMissed = 0;
+    int cUnordered = 0;
+    int cHits = 0;
+    int cCand = 0;
+
+    memset(rgth, 0, sizeof(rgth));
+    for (int ith = 0; ith < cth; ith++)
+    {
+        rgth[ith].ith = ith % 5 == 4 ? 1 : 0; /* a few packets mixed in */
+        rgth[ith].iplr = ith % 3;
+        rgth[ith].pt.x = (int16_t)(1000 + ith * 397 % 2000);
+        rgth[ith].pt.y = (int16_t)(1000 + ith * 711 % 2000);
+        rgth[ith].thm.cMines = (ith * 977) % 6000;
+    }
+    lpThings = rgth;
+    cThing = cth;
+    InvalidateMineGrid(&vminegrid);
+
+    for (int iseg = 0; iseg < 500; iseg++)
+    {
+        POINT ptA = {(int16_t)(1000 + iseg * 131 % 2000), (int16_t)(1000 + iseg * 257 % 2000)};
+        POINT ptB = {(int16_t)(ptA.x + iseg % 101 - 50), (int16_t)(ptA.y + iseg * 7 % 101 - 50)};
+        int16_t dLen = (int16_t)DGetDistance(ptA.x, ptA.y, ptB.x, ptB.y);
+        int16_t dMax = (int16_t)(iseg % 100 + 1 < dLen ? iseg % 100 + 1 : dLen); /* never past ptB */
+        int16_t c = CMineFieldsNearSegment(&vminegrid, ptA, ptB, &rgith);
+
+        TEST_ASSERT(c >= 0);
+        cCand += c;
+        for (int i = 1; i < c; i++)
+        {
+            cUnordered += rgith[i - 1] >= rgith[i];
+        }
+        for (int ith = 0; ith < cth; ith++)
+        {
+            int fFound = 0;
+
+            if (rgth[ith].ith != 0 || rgth[ith].thm.cMines <= 0 ||
+                !segment_hits_field(ptA, ptB, rgth[ith].pt, rgth[ith].thm.cMines, dMax))
+            {
+                continue;
+            }
+            cHits++;
+            for (int i = 0; i < c; i++)
+            {
+                fFound |= rgith[i] == ith;
+            }
+            cMissed += !fFound;
+        }
+    }
+    TEST_CHECK_(cMissed == 0, "%d of %d hits missing from the candidates", cMissed, cHits);
+    TEST_CHECK(cUnordered == 0);
+    TEST_CHECK(cHits > 0);
+    TEST_CHECK_(cCand < 500 * cth / 10, "%d candidates for 500 segments", cCand);
+
+    FreeMineGrid(&vminegrid);
+    lpThings = lpThingsOld;
+    cThing = cThingOld;
+}
+
+static void test_MineTable_sweep_matches_nested_loop(void)
+{
+    enum { cth = 300, csw = 200 };
+    static THING rgth[cth];
+    static int32_t rglExpect[cth];
+    static POINT rgpt[csw];
+    static uint8_t rgiplr[csw];
+    static int32_t rglPow[csw];
+    THING *lpThingsOld = lpThings;
+    int16_t cThingOld = cThing;
+    int16_t cRemoved;
+    int16_t cLeft;
+    int cBad = 0;
+    int cSwept = 0;
+
+    memset(rgth, 0, sizeof(rgth));
+    for (int ith = 0; ith < cth; ith++)
+    {
+        rgth[ith].ith = ith % 7 == 6 ? 1 : 0;
+        rgth[ith].iplr = ith % 4;
+        rgth[ith].pt.x = (int16_t)(1000 + ith * 397 % 1500);
+        rgth[ith].pt.y = (int16_t)(1000 + ith * 711 % 1500);
+        rgth[ith].thm.cMines = 100 + (ith * 977) % 4000;
+    }
+    for (int isw = 0; isw < csw; isw++)
+    {
+        rgpt[isw].x = (int16_t)(1000 + isw * 233 % 1500);
+        rgpt[isw].y = (int16_t)(1000 + isw * 419 % 1500);
+        rgiplr[isw] = (uint8_t)(isw % 5);
+        rglPow[isw] = 50 + isw * 31 % 900;
+    }
+
+    /* one fleet at a time over every field */
+    for (int ith = 0; ith < cth; ith++)
+    {
+        rglExpect[ith] = rgth[ith].thm.cMines;
+    }
+    for (int isw = 0; isw < csw; isw++)
+    {
+        for (int ith = 0; ith < cth; ith++)
+        {
+            int32_t dx = rgpt[isw].x - rgth[ith].pt.x;
+            int32_t dy = rgpt[isw].y - rgth[ith].pt.y;
+
+            if (rgth[ith].ith != 0 || rgth[ith].iplr == rgiplr[isw] ||
+                dx * dx + dy * dy > rgth[ith].thm.cMines)
+            {
+                continue;
+            }
+            rglExpect[ith] -= rglPow[isw];
+            rglExpect[ith] = rglExpect[ith] < 0 ? 0 : rglExpect[ith];
+        }
+    }
+
+    lpThings = rgth;
+    cThing = cth;
+    InvalidateMineGrid(&vminegrid);
+    TEST_ASSERT(FBuildMineTable(&vminetbl));
+    SweepMineTable(&vminetbl, csw, rgpt, rgiplr, rglPow);
+    ApplyMineTable(&vminetbl);
+    for (int ith = 0; ith < cth; ith++)
+    {
+        cBad += rgth[ith].thm.cMines != rglExpect[ith];
+        cSwept += rgth[ith].ith == 0 && rglExpect[ith] != 100 + (ith * 977) % 4000;
+    }
+    TEST_CHECK_(cBad == 0, "%d fields differ", cBad);
+    TEST_CHECK(cSwept > 0);
+
+    cLeft = 0;
+    for (int ith = 0; ith < cth; ith++)
+    {
+        cLeft += rgth[ith].ith != 0 || rgth[ith].thm.cMines >= cMinesMin;
+    }
+    cRemoved = CRemoveSpentMineFields();
+    TEST_CHECK_(cThing == cLeft && cRemoved == cth - cLeft, "%d left, %d removed", cThing, cRemoved);
+    for (int ith = 0; ith < cThing; ith++)
+    {
+        cBad += rgth[ith].ith == 0 && rgth[ith].thm.cMines < cMinesMin;
+    }
+    TEST_CHECK(cBad == 0);
+
+    FreeMineTable(&vminetbl);
+    FreeMineGrid(&vminegrid);
+    lpThings = lpThingsOld;
+    cThing = cThingOld;
+}
+
+TEST_LIST = {
+    {"fleet move passes move fleets and drop reached waypoints", test_FleetMoves_moves_and_arrives},
+    {"fleet move kernel gives the same rows however it is split", test_FleetMoves_kernel_split_is_stable},
+    {"ram scoops fill the tanks only up to capacity", test_FleetMoves_scooping_stops_at_capacity},
+    {"fleet location chains follow moves and deletes", test_FleetLocs_follow_moves_and_deletes},
+    {"minefield grid finds every crossed field in lpThings order", test_MineGrid_covers_every_hit_in_order},
+    {"minefield sweep kernel matches sweeping one fleet at a time", test_MineTable_sweep_matches_nested_loop},
+    {NULL, NULL}};
@@ -0,0 +1,235 @@
+/* test_hist.c
+ *
+ * Unit tests for the per-turn planet history container (histdb.c).
+ */
+
+#include "acutest.h"
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "types.h"
+#include "globals.h"
+#include "../histdb.h"
+
+enum { cplT = 300, cturnT = 200 };
+
+static PLANET rgrgplT[cturnT][cplT];
+
+static uint16_t turn_of(int iturn)
+{
+    return (uint16_t)(2400 + 2 * iturn);
+}
+
+/* What a player learns in a game: a few planets a turn, now and then a lot. */
+static void build_turns(void)
+{
+    memset(rgrgplT, 0, sizeof(rgrgplT));
+    for (int ipl = 0; ipl < cplT; ipl++)
+    {
+        rgrgplT[0][ipl].id = (int16_t)ipl;
+        rgrgplT[0][ipl].iPlayer = -1;
+    }
+    for (int iturn = 1; iturn < cturnT; iturn++)
+    {
+        int cChg = iturn % 50 == 0 ? 200 : 5;
+
+        memcpy(rgrgplT[iturn], rgrgplT[iturn - 1], sizeof(rgrgplT[0]));
+        for (int i = 0; i < cChg; i++)
+        {
+            PLANET *ppl = &rgrgplT[iturn][((unsigned)iturn * 7919u + (unsigned)i * 131u) % cplT];
+
+            ppl->iPlayer = (int16_t)(iturn % 16);
+            ppl->rgwtMin[i % 4] += iturn;
+            ppl->turn = (int16_t)turn_of(iturn);
+        }
+    }
+}
+
+static int same_turn(PLANET *rgpl, int iturn)
+{
+    if (rgpl == NULL)
+    {
+        return 0;
+    }
+    for (int ipl = 0; ipl < cplT; ipl++)
+    {
+        /* the test planets start zeroed, so unpacking gives the same bytes */
+        if (memcmp(&rgpl[ipl], &rgrgplT[iturn][ipl], offsetof(PLANET, lpplprod)) != 0)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static FILE *write_history_turns(int cturn)
+{
+    HISTDB hd;
+    FILE *fp;
+
+    TEST_ASSERT(FInitHistDb(&hd, tmpfile(), 3, cplT));
+    for (int iturn = 0; iturn < cturn; iturn++)
+    {
+        TEST_ASSERT(FAppendHistTurn(&hd, turn_of(iturn), rgrgplT[iturn]));
+    }
+    TEST_CHECK(!FAppendHistTurn(&hd, turn_of(cturn - 1), rgrgplT[0]));
+
+    /* keep the file, drop the rest */
+    fp = hd.fp;
+    hd.fp = NULL;
+    CloseHistDb(&hd);
+    return fp;
+}
+
+static FILE *write_history(void)
+{
+    return write_history_turns(cturnT);
+}
+
+static void test_history_round_trip(void)
+{
+    HISTDB hd;
+    long cbFile;
+    int cBad;
+
+    game.lid = 0x5151;
+    build_turns();
+    TEST_ASSERT(FAttachHistDb(&hd, write_history()));
+    TEST_CHECK(hd.hdr.cturn == cturnT && hd.hdr.iPlayer == 3);
+
+    fseek(hd.fp, 0, SEEK_END);
+    cbFile = ftell(hd.fp);
+    TEST_CHECK_(cbFile * 10 < (long)cturnT * cplT * cbHistPlanet, "%ld bytes for %d turns", cbFile, cturnT);
+
+    /* opening only rebuilt the newest turn */
+    TEST_CHECK_(hd.cchunkRead <= cturnHistKey, "%d chunks read on open", hd.cchunkRead);
+    TEST_CHECK(same_turn(LpplHistTurn(&hd, turn_of(cturnT - 1)), cturnT - 1));
+
+    cBad = 0;
+    for (int i = 0; i < 60; i++)
+    {
+        int iturn = (i * 37) % cturnT;
+
+        cBad += !same_turn(LpplHistTurn(&hd, turn_of(iturn)), iturn);
+        cBad += !same_turn(LpplHistTurn(&hd, (uint16_t)(turn_of(iturn) + 1)), iturn);
+    }
+    TEST_CHECK_(cBad == 0, "%d turns rebuilt wrong", cBad);
+    TEST_CHECK(LpplHistTurn(&hd, turn_of(0) - 1) == NULL);
+    CloseHistDb(&hd);
+}
+
+static void test_history_walk_forward_reads_one_chunk_a_turn(void)
+{
+    HISTDB hd;
+    int16_t cchunk;
+    int cBad = 0;
+
+    game.lid = 0x5151;
+    build_turns();
+    TEST_ASSERT(FAttachHistDb(&hd, write_history()));
+    TEST_CHECK(same_turn(LpplHistTurn(&hd, turn_of(0)), 0));
+    cchunk = hd.cchunkRead;
+    for (int iturn = 1; iturn < cturnT - 1; iturn++)
+    {
+        cBad += !same_turn(LpplHistTurn(&hd, turn_of(iturn)), iturn);
+    }
+    TEST_CHECK(cBad == 0);
+    TEST_CHECK_(hd.cchunkRead - cchunk == cturnT - 2, "%d chunks", hd.cchunkRead - cchunk);
+    CloseHistDb(&hd);
+}
+
+static void test_history_refuses_other_game(void)
+{
+    HISTDB hd;
+    FILE *fp;
+
+    game.lid = 0x5151;
+    build_turns();
+    fp = write_history();
+    game.lid++;
+    TEST_CHECK(!FAttachHistDb(&hd, fp));
+    TEST_CHECK(hd.fp == NULL);
+}
+
+/* An append that dies before its header is written leaves the turns that
+ * were there readable, whether it was filling a spare index slot or moving
+ * the index; the next append carries on from them. */
+static void test_history_survives_interrupted_append(void)
+{
+    static const int rgcturn[] = {5, 16};
+    uint8_t rgbHdr[cbHistDbHdr];
+    HISTDB hd;
+    FILE *fp;
+    int cBad;
+
+    game.lid = 0x5151;
+    build_turns();
+    for (int i = 0; i < 2; i++)
+    {
+        int cturn = rgcturn[i];
+
+        fp = write_history_turns(cturn);
+        TEST_ASSERT(fseek(fp, 0, SEEK_SET) == 0 && fread(rgbHdr, sizeof(rgbHdr), 1, fp) == 1);
+        TEST_ASSERT(FAttachHistDb(&hd, fp));
+        TEST_ASSERT(FAppendHistTurn(&hd, turn_of(cturn), rgrgplT[cturn]));
+        TEST_ASSERT(fseek(fp, 0, SEEK_SET) == 0 && fwrite(rgbHdr, sizeof(rgbHdr), 1, fp) == 1);
+        hd.fp = NULL;
+        CloseHistDb(&hd);
+
+        TEST_ASSERT(FAttachHistDb(&hd, fp));
+        TEST_CHECK_(hd.hdr.cturn == cturn, "%d turns after a lost header, %d before", hd.hdr.cturn, cturn);
+        cBad = 0;
+        for (int iturn = 0; iturn < cturn; iturn++)
+        {
+            cBad += !same_turn(LpplHistTurn(&hd, turn_of(iturn)), iturn);
+        }
+        TEST_CHECK(FAppendHistTurn(&hd, turn_of(cturn), rgrgplT[cturn]));
+        TEST_CHECK(FAppendHistTurn(&hd, turn_of(cturn + 1), rgrgplT[cturn + 1]));
+        hd.fp = NULL;
+        CloseHistDb(&hd);
+
+        TEST_ASSERT(FAttachHistDb(&hd, fp));
+        for (int iturn = 0; iturn < cturn + 2; iturn++)
+        {
+            cBad += !same_turn(LpplHistTurn(&hd, turn_of(iturn)), iturn);
+        }
+        TEST_CHECK_(cBad == 0, "%d turns rebuilt wrong around turn %d", cBad, cturn);
+        CloseHistDb(&hd);
+    }
+}
+
+/* The file holds the packed little-endian layout, not native structs. */
+static void test_history_file_layout(void)
+{
+    HISTDB hd;
+    PLANET rgpl[2];
+    uint8_t rgb[cbHistDbHdr + 2 * cbHistPlanet];
+    FILE *fp;
+
+    game.lid = 0x5151;
+    memset(rgpl, 0, sizeof(rgpl));
+    rgpl[1].id = 1;
+    rgpl[1].iPlayer = 2;
+    rgpl[1].rgwtMin[0] = 0x01020304;
+    rgpl[1].turn = 9;
+    TEST_ASSERT(FInitHistDb(&hd, tmpfile(), 3, 2));
+    TEST_ASSERT(FAppendHistTurn(&hd, 9, rgpl));
+    fp = hd.fp;
+    TEST_ASSERT(fseek(fp, 0, SEEK_SET) == 0 && fread(rgb, sizeof(rgb), 1, fp) == 1);
+    TEST_CHECK(memcmp(rgb, "HDB3", 4) == 0);
+    TEST_CHECK(rgb[8] == 3 && rgb[9] == 0 && rgb[10] == 2);
+    TEST_CHECK(rgb[cbHistDbHdr + cbHistPlanet] == 1 && rgb[cbHistDbHdr + cbHistPlanet + 2] == 2);
+    TEST_CHECK(memcmp(rgb + cbHistDbHdr + cbHistPlanet + 32, "\x04\x03\x02\x01", 4) == 0);
+    TEST_CHECK(rgb[cbHistDbHdr + cbHistPlanet + 56] == 9);
+    CloseHistDb(&hd);
+}
+
+TEST_LIST = {
+    {"history rebuilds any stored turn", test_history_round_trip},
+    {"history walks forward one chunk a turn", test_history_walk_forward_reads_one_chunk_a_turn},
+    {"history from another game is refused", test_history_refuses_other_game},
+    {"history survives an append cut off before its header", test_history_survives_interrupted_append},
+    {"history file is packed little-endian", test_history_file_layout},
+    {NULL, NULL}};
@@ -0,0 +1,169 @@
+/* test_ids.c
+ *
+ * Unit tests for the dense id tables behind LpflFromId / LpthFromId
+ * (idtbl.c).
+ */
+
+#include "acutest.h"
+
+#include <string.h>
+
+#include "types.h"
+#include "globals.h"
+#include "../idtbl.h"
+#include "../minetbl.h"
+#include "../util.h"
+
+enum { cflT = 16 * 64, cthT = 2000 };
+
+static FLEET rgflT[cflT];
+static FLEET *rglpflT[cflT + 1];
+static THING rgthT[cthT];
+
+/* 64 fleets per player, rglpfl sorted by id like the game keeps it */
+static void setup_universe(void)
+{
+    memset(rgflT, 0, sizeof(rgflT));
+    memset(rgthT, 0, sizeof(rgthT));
+    for (int ifl = 0; ifl < cflT; ifl++)
+    {
+        rgflT[ifl].ifl = (uint16_t)(ifl % 64 * 7);
+        rgflT[ifl].iplr = (uint16_t)(ifl / 64);
+        rgflT[ifl].iPlayer = (int16_t)(ifl / 64);
+        rglpflT[ifl] = &rgflT[ifl];
+    }
+    for (int ith = 0; ith < cthT; ith++)
+    {
+        rgthT[ith].id = (uint16_t)(ith % 500);
+        rgthT[ith].iplr = (uint16_t)(ith / 500);
+        rgthT[ith].ith = 0;
+        rgthT[ith].thm.cMines = ith % 3 == 0 ? 5 : 1000;
+    }
+    rglpfl = rglpflT;
+    cFleet = cflT;
+    lpThings = rgthT;
+    cThing = cthT;
+    vidtbl.fFleetValid = 0;
+    vidtbl.fThingValid = 0;
+}
+
+static void test_LpflFromId_direct(void)
+{
+    FLEET flNew;
+    int16_t idOld;
+
+    setup_universe();
+    for (int ifl = 0; ifl < cflT; ifl++)
+    {
+        TEST_CHECK(LpflFromId(rgflT[ifl].id) == &rgflT[ifl]);
+    }
+    TEST_CHECK(LpflFromId(1) == NULL); /* ifl 1 never used */
+    TEST_CHECK(LpflFromId(-1) == NULL);
+
+    /* create and delete keep the table without a rebuild */
+    memset(&flNew, 0, sizeof(flNew));
+    flNew.ifl = 1;
+    flNew.iplr = 3;
+    rglpflT[cflT] = &flNew;
+    cFleet = cflT + 1;
+    LinkFleetId(&vidtbl, &flNew);
+    TEST_CHECK(vidtbl.cFleetIds == cFleet);
+    TEST_CHECK(LpflFromId(flNew.id) == &flNew);
+    UnlinkFleetId(&vidtbl, &flNew);
+    cFleet = cflT;
+    TEST_CHECK(vidtbl.fFleetValid && vidtbl.cFleetIds == cFleet);
+    TEST_CHECK(LpflFromId(flNew.id) == NULL);
+
+    /* a fleet renumbered behind the table's back is not returned for its
+     * old id, and the rebuild that notices finds it under the new one */
+    idOld = rgflT[5].id;
+    rgflT[5].iplr = 15;
+    rgflT[5].ifl = 500;
+    TEST_CHECK(LpflFromId(idOld) == NULL);
+    TEST_CHECK(LpflFromId(rgflT[5].id) == &rgflT[5]);
+}
+
+static void test_LpthFromId_survives_compaction(void)
+{
+    int cBad = 0;
+
+    setup_universe();
+    for (int ith = 0; ith < cthT; ith++)
+    {
+        cBad += LpthFromId((int16_t)rgthT[ith].idFull) != &rgthT[ith];
+    }
+    TEST_CHECK(cBad == 0);
+
+    /* the small fields go, everything after them moves down */
+    TEST_CHECK(CRemoveSpentMineFields() == (cthT + 2) / 3);
+    for (int ith = 0; ith < cThing; ith++)
+    {
+        cBad += LpthFromId((int16_t)rgthT[ith].idFull) != &rgthT[ith];
+    }
+    TEST_CHECK_(cBad == 0, "%d wrong after compaction", cBad);
+    TEST_CHECK(LpthFromId(0) == NULL); /* thing 0 had 5 mines */
+}
+
+/* What LpflFromId used to have to do: binary search rglpfl by id. */
+static FLEET *lpfl_bsearch(int16_t idFleet)
+{
+    int16_t iLo = -1;
+    int16_t iHi = cFleet;
+
+    while (iHi > iLo + 1)
+    {
+        int16_t iGuess = (int16_t)((iLo + iHi) >> 1);
+
+        if (rglpfl[iGuess]->id < idFleet)
+        {
+            iLo = iGuess;
+        }
+        else if (rglpfl[iGuess]->id > idFleet)
+        {
+            iHi = iGuess;
+        }
+        else
+        {
+            return rglpfl[iGuess];
+        }
+    }
+    return NULL;
+}
+
+static THING *lpth_scan(int16_t idth)
+{
+    for (int ith = 0; ith < cThing; ith++)
+    {
+        if (lpThings[ith].idFull == (uint16_t)idth)
+        {
+            return &lpThings[ith];
+        }
+    }
+    return NULL;
+}
+
+/* Every id, used or not, resolves to what searching rglpfl and lpThings
+ * finds. */
+static void test_ids_match_search(void)
+{
+    int cBad = 0;
+
+    setup_universe();
+    for (int id = 0; id < cFleetIdMax; id++)
+    {
+        cBad += LpflFromId((int16_t)id) != lpfl_bsearch((int16_t)id);
+    }
+    TEST_CHECK_(cBad == 0, "%d fleet ids differ", cBad);
+    cBad = 0;
+    for (int id = 0; id < cThingIdMax; id += 7)
+    {
+        cBad += LpthFromId((int16_t)id) != lpth_scan((int16_t)id);
+    }
+    TEST_CHECK_(cBad == 0, "%d thing ids differ", cBad);
+}
+
+TEST_LIST = {
+    {"LpflFromId indexes directly and follows create/delete", test_LpflFromId_direct},
+    {"LpthFromId stays right when lpThings is compacted", test_LpthFromId_survives_compaction},
+    {"every id resolves like a search of rglpfl and lpThings", test_ids_match_search},
+    {NULL, NULL}};
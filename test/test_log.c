@@ -0,0 +1,796 @@
+/* test_log.c
+ *
+ * Unit tests for order-log replay: FRunLogFile over lpLog, the
+ * streaming reader (logstrm.c) and the decode/apply batches (logbat.c),
+ * dispatching through vrgpfnRunLogRt, and record coalescing in WriteMemRt.
+ */
+
+#include "acutest.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "types.h"
+#include "globals.h"
+#include "../log.h"
+#include "../logbat.h"
+#include "../logstrm.h"
+#include "../save.h"
+#include "turnfile.h"
+
+#define rtTest1 20
+#define rtTest2 33
+
+enum { crecMax = 128 };
+
+typedef struct
+{
+    int16_t rt;
+    int16_t cb;
+    uint32_t lSum;
+} SEEN;
+
+static SEEN rgseen[2][crecMax];
+static int cseen[2];
+static int iseenCur;
+static int cApplied;
+static int cCheckedLate;
+
+static int16_t run_test_rt(int16_t rt, int16_t cb, uint8_t *lpb)
+{
+    SEEN *pseen = &rgseen[iseenCur][cseen[iseenCur]++];
+
+    cApplied++;
+    pseen->rt = rt;
+    pseen->cb = cb;
+    pseen->lSum = 0;
+    for (int i = 0; i < cb; i++)
+    {
+        pseen->lSum = pseen->lSum * 31 + lpb[i];
+    }
+    return 1;
+}
+
+/* BOF, log header, the records in lpLog layout, a message, EOF. */
+static FILE *write_log(int iPlayer, uint8_t *pbLog, int cbLog)
+{
+    FILE *fp = tmpfile();
+    RTBOF bof;
+    uint8_t rgbHdr[17];
+    uint8_t rgbMsg[6] = {1, 2, 3, 4, 5, 6};
+    int16_t cbLog16 = (int16_t)cbLog;
+
+    init_bof(&bof, game.lid, game.turn, iPlayer, 123 + iPlayer * 77);
+    bof.dt = 1;
+    bof.wGen = game.wGen;
+    put_bof(fp, &bof);
+
+    memset(rgbHdr, 0, sizeof(rgbHdr));
+    memcpy(rgbHdr, &cbLog16, 2);
+    put_rt(fp, 9, sizeof(rgbHdr), rgbHdr, 1);
+    for (int i = 0; i < cbLog;)
+    {
+        HDR *phdr = (HDR *)(pbLog + i);
+
+        put_rt(fp, phdr->rt, phdr->cb, pbLog + i + 2, 1);
+        i += phdr->cb + 2;
+    }
+    put_rt(fp, 0x28, sizeof(rgbMsg), rgbMsg, 1);
+    put_eof(fp);
+    rewind(fp);
+    return fp;
+}
+
+static int build_log(uint8_t *pb, int seed)
+{
+    int cb = 0;
+
+    for (int irec = 0; irec < 40; irec++)
+    {
+        HDR *phdr = (HDR *)(pb + cb);
+        int cbRec = (irec * 37 + seed) % 60 + (irec == 7 ? 900 : 0);
+
+        phdr->rt = irec % 3 == 0 ? rtTest2 : rtTest1;
+        phdr->cb = (uint16_t)cbRec;
+        for (int i = 0; i < cbRec; i++)
+        {
+            pb[cb + 2 + i] = (uint8_t)(i * 13 + irec + seed);
+        }
+        cb += cbRec + 2;
+    }
+    return cb;
+}
+
+static void reset_seen(void)
+{
+    memset(rgseen, 0, sizeof(rgseen));
+    cseen[0] = cseen[1] = 0;
+    cApplied = 0;
+    cCheckedLate = 0;
+    vrgpfnRunLogRt[rtTest1] = run_test_rt;
+    vrgpfnRunLogRt[rtTest2] = run_test_rt;
+    game.lid = 0x12345678;
+    game.turn = 42;
+}
+
+static void test_stream_matches_memory_replay(void)
+{
+    static uint8_t rgbLog[8192];
+    uint8_t *lpLogOld = lpLog;
+    int16_t imemLogCurOld = imemLogCur;
+    LOGSTREAM ls;
+    int cb;
+
+    reset_seen();
+    cb = build_log(rgbLog, 5);
+
+    iseenCur = 0;
+    lpLog = rgbLog;
+    imemLogCur = (int16_t)cb;
+    TEST_CHECK(FRunLogFile());
+
+    iseenCur = 1;
+    TEST_ASSERT(FAttachLogStream(&ls, write_log(3, rgbLog, cb), 3));
+    TEST_CHECK(ls.rtlh.cbLog == cb);
+    TEST_CHECK(FRunLogStream(&ls));
+    CloseLogStream(&ls);
+
+    TEST_CHECK_(cseen[0] == 40 && cseen[1] == 40, "%d / %d records", cseen[0], cseen[1]);
+    TEST_CHECK(memcmp(rgseen[0], rgseen[1], sizeof(rgseen[0])) == 0);
+
+    lpLog = lpLogOld;
+    imemLogCur = imemLogCurOld;
+}
+
+static void test_streams_interleave(void)
+{
+    static uint8_t rgbLogA[8192];
+    static uint8_t rgbLogB[8192];
+    LOGSTREAM lsA;
+    LOGSTREAM lsB;
+    SEEN rgseenA[crecMax];
+    int cbA;
+    int cbB;
+    int fA;
+    int fB;
+
+    reset_seen();
+    cbA = build_log(rgbLogA, 1);
+    cbB = build_log(rgbLogB, 2);
+
+    /* A alone */
+    iseenCur = 0;
+    TEST_ASSERT(FAttachLogStream(&lsA, write_log(1, rgbLogA, cbA), 1));
+    TEST_CHECK(FRunLogStream(&lsA));
+    CloseLogStream(&lsA);
+    memcpy(rgseenA, rgseen[0], sizeof(rgseenA));
+    cseen[0] = 0;
+
+    /* A and B a record at a time, each into its own list */
+    TEST_ASSERT(FAttachLogStream(&lsA, write_log(1, rgbLogA, cbA), 1));
+    TEST_ASSERT(FAttachLogStream(&lsB, write_log(2, rgbLogB, cbB), 2));
+    do
+    {
+        fA = FNextLogStreamRt(&lsA);
+        if (fA)
+        {
+            iseenCur = 0;
+            FRunLogRecord((int16_t)lsA.hdr.rt, (int16_t)lsA.hdr.cb, lsA.rgb);
+        }
+        fB = FNextLogStreamRt(&lsB);
+        if (fB)
+        {
+            iseenCur = 1;
+            FRunLogRecord((int16_t)lsB.hdr.rt, (int16_t)lsB.hdr.cb, lsB.rgb);
+        }
+    } while (fA || fB);
+    TEST_CHECK(!lsA.fError && !lsB.fError);
+    CloseLogStream(&lsA);
+    CloseLogStream(&lsB);
+
+    TEST_CHECK(cseen[0] == 40 && cseen[1] == 40);
+    TEST_CHECK(memcmp(rgseenA, rgseen[0], sizeof(rgseenA)) == 0);
+    TEST_CHECK(memcmp(rgseen[0], rgseen[1], sizeof(rgseenA)) != 0);
+}
+
+static void test_stream_rejects_bad_logs(void)
+{
+    static uint8_t rgbLog[8192];
+    LOGSTREAM ls;
+    FILE *fp;
+    uint8_t rgb[4096];
+    size_t cbFile;
+    int cb;
+
+    reset_seen();
+    cb = build_log(rgbLog, 3);
+
+    /* another game */
+    fp = write_log(0, rgbLog, cb);
+    game.lid++;
+    TEST_CHECK(!FAttachLogStream(&ls, fp, 0));
+    game.lid--;
+
+    /* another player's log */
+    TEST_CHECK(!FAttachLogStream(&ls, write_log(1, rgbLog, cb), 0));
+
+    /* written against another generation of the turn, fine in the tutorial */
+    fp = write_log(0, rgbLog, cb);
+    game.wGen++;
+    TEST_CHECK(!FAttachLogStream(&ls, fp, 0));
+    game.wGen--;
+    fp = write_log(0, rgbLog, cb);
+    game.wGen++;
+    game.fTutorial = 1;
+    TEST_CHECK(FAttachLogStream(&ls, fp, 0));
+    CloseLogStream(&ls);
+    game.fTutorial = 0;
+    game.wGen--;
+
+    /* a version FOpenFile wouldn't take */
+    fp = write_log(0, rgbLog, cb);
+    cbFile = fread(rgb, 1, sizeof(rgb), fp);
+    fclose(fp);
+    ((RTBOF *)(rgb + 2))->verMinor = 0x54;
+    fp = tmpfile();
+    fwrite(rgb, 1, cbFile, fp);
+    rewind(fp);
+    TEST_CHECK(!FAttachLogStream(&ls, fp, 0));
+
+    /* cut off halfway through the records */
+    fp = write_log(0, rgbLog, cb);
+    cbFile = fread(rgb, 1, sizeof(rgb), fp);
+    fclose(fp);
+    fp = tmpfile();
+    fwrite(rgb, 1, cbFile / 2, fp);
+    rewind(fp);
+    iseenCur = 0;
+    TEST_ASSERT(FAttachLogStream(&ls, fp, 0));
+    TEST_CHECK(!FRunLogStream(&ls));
+    TEST_CHECK(ls.fError);
+    TEST_CHECK(cseen[0] > 0 && cseen[0] < 40);
+    CloseLogStream(&ls);
+
+    /* no handler for a record type: replayed, but reported */
+    vrgpfnRunLogRt[rtTest2] = NULL;
+    TEST_ASSERT(FAttachLogStream(&ls, write_log(0, rgbLog, cb), 0));
+    TEST_CHECK(!FRunLogStream(&ls));
+    TEST_CHECK(!ls.fError);
+    CloseLogStream(&ls);
+}
+
+/* player 1 may not send rtTest2; counts checks made after an apply */
+static int16_t check_test_rt(int16_t iplr, int16_t rt, int16_t cb, uint8_t *lpb)
+{
+    cCheckedLate += cApplied != 0;
+    return (int16_t)(iplr != 1 || rt != rtTest2);
+}
+
+static void test_batches_validate_then_apply(void)
+{
+    static uint8_t rgbLogA[8192];
+    static uint8_t rgbLogB[8192];
+    LOGBATCH rglb[2];
+    LOGSTREAM ls;
+    int16_t fError;
+    int cbA;
+    int cbB;
+    int cBad;
+
+    reset_seen();
+    vrgpfnCheckLogRt[rtTest1] = check_test_rt;
+    vrgpfnCheckLogRt[rtTest2] = check_test_rt;
+    cbA = build_log(rgbLogA, 1);
+    cbB = build_log(rgbLogB, 2);
+    memset(rglb, 0, sizeof(rglb));
+
+    /* decode both players before anything is applied */
+    TEST_ASSERT(FAttachLogStream(&ls, write_log(0, rgbLogA, cbA), 0));
+    TEST_CHECK(FDecodeLogBatch(&rglb[0], 0, &ls));
+    CloseLogStream(&ls);
+    TEST_ASSERT(FAttachLogStream(&ls, write_log(1, rgbLogB, cbB), 1));
+    TEST_CHECK(FDecodeLogBatch(&rglb[1], 1, &ls));
+    CloseLogStream(&ls);
+    TEST_CHECK(cApplied == 0);
+    TEST_CHECK(rglb[0].crt == 40 && rglb[0].crtBad == 0 && rglb[0].cb == cbA);
+    TEST_CHECK_(rglb[1].crt == 26 && rglb[1].crtBad == 14, "%d kept, %d rejected", rglb[1].crt, rglb[1].crtBad);
+
+    /* then one serial pass, player 0 first */
+    iseenCur = 0;
+    TEST_CHECK(FApplyLogBatches(rglb, 2));
+    TEST_CHECK(cseen[0] == 66);
+    TEST_CHECK(cCheckedLate == 0);
+    cBad = 0;
+    for (int i = 0; i < 40; i++)
+    {
+        cBad += rgseen[0][i].cb != ((i * 37 + 1) % 60 + (i == 7 ? 900 : 0));
+    }
+    for (int i = 40; i < 66; i++)
+    {
+        cBad += rgseen[0][i].rt != rtTest1;
+    }
+    TEST_CHECK(cBad == 0);
+
+    /* a log that isn't there is nothing to check, not an error */
+    strcpy(szBase, "no-such-dir/no-such-game");
+    TEST_CHECK(!FCheckLogFile(0, &fError));
+    TEST_CHECK(!fError);
+
+    vrgpfnCheckLogRt[rtTest1] = NULL;
+    vrgpfnCheckLogRt[rtTest2] = NULL;
+    FreeLogBatch(&rglb[0]);
+    FreeLogBatch(&rglb[1]);
+}
+
+/* A log of 32K or more, whose cbLog reads negative as an int16, decodes
+ * in full; a record type with no validator is turned down. */
+static void test_batch_takes_long_logs(void)
+{
+    static uint8_t rgbLog[41 * 1002];
+    LOGBATCH lb;
+    LOGSTREAM ls;
+    int cb = 0;
+
+    reset_seen();
+    vrgpfnCheckLogRt[rtTest1] = check_test_rt;
+    vrgpfnCheckLogRt[rtTest2] = NULL;
+    for (int irec = 0; irec < 41; irec++)
+    {
+        HDR *phdr = (HDR *)(rgbLog + cb);
+
+        phdr->rt = irec == 20 ? rtTest2 : rtTest1;
+        phdr->cb = 1000;
+        memset(rgbLog + cb + 2, irec, 1000);
+        cb += 1002;
+    }
+    TEST_ASSERT(cb >= 0x8000);
+
+    memset(&lb, 0, sizeof(lb));
+    TEST_ASSERT(FAttachLogStream(&ls, write_log(0, rgbLog, cb), 0));
+    TEST_CHECK(FDecodeLogBatch(&lb, 0, &ls));
+    CloseLogStream(&ls);
+    TEST_CHECK_(lb.crt == 40 && lb.crtBad == 1, "%d kept, %d rejected", lb.crt, lb.crtBad);
+    TEST_CHECK(lb.cb == 40 * 1002 && lb.cbMax >= lb.cb);
+
+    iseenCur = 0;
+    TEST_CHECK(FApplyLogBatch(&lb));
+    TEST_CHECK(cseen[0] == 40 && rgseen[0][39].rt == rtTest1 && rgseen[0][39].cb == 1000);
+
+    vrgpfnCheckLogRt[rtTest1] = NULL;
+    FreeLogBatch(&lb);
+}
+
+static BTLPLAN rgbtlplanTest[16];
+
+/* A session of plan edits with the odd unrelated record in between. */
+static int16_t write_plan_session(void)
+{
+    BTLPLAN plan;
+    uint8_t rgb[4] = {9, 8, 7, 6};
+
+    imemLogCur = 0;
+    imemLogPrev = -1;
+    for (int step = 0; step < 100; step++)
+    {
+        memset(&plan, 0, sizeof(plan));
+        plan.iplr = 2;
+        plan.iplan = (uint16_t)(step % 3);
+        plan.mdTactic = (uint16_t)(step % 4);
+        plan.fDelete = step % 7 == 0 && plan.iplan == 1;
+        snprintf(plan.szName, sizeof(plan.szName), "Plan %d", step);
+        LogChangeBtlplan(&plan);
+        if (step % 10 == 9)
+        {
+            WriteMemRt(rtTest1, sizeof(rgb), rgb);
+        }
+    }
+    return imemLogCur;
+}
+
+/* Fleets of players 2 and 1 on plans 1, 2 and 0 in turn. */
+static void set_plan_fleets(FLEET *rgfl, FLEET **rglpflT, int cfl)
+{
+    memset(rgfl, 0, cfl * sizeof(FLEET));
+    for (int ifl = 0; ifl < cfl; ifl++)
+    {
+        rgfl[ifl].iPlayer = (int16_t)(ifl < 3 ? 2 : 1);
+        rgfl[ifl].iplan = (uint8_t)((ifl + 1) % 3);
+        rglpflT[ifl] = &rgfl[ifl];
+    }
+}
+
+/* Edit plan 1, delete it and set it up again, back to back. */
+static void write_delete_session(void)
+{
+    BTLPLAN plan;
+
+    imemLogCur = 0;
+    imemLogPrev = -1;
+    memset(&plan, 0, sizeof(plan));
+    plan.iplr = 2;
+    plan.iplan = 1;
+    strcpy(plan.szName, "Old");
+    LogChangeBtlplan(&plan);
+    plan.fDelete = 1;
+    LogChangeBtlplan(&plan);
+    plan.fDelete = 0;
+    strcpy(plan.szName, "New");
+    LogChangeBtlplan(&plan);
+}
+
+static void test_coalesced_log_replays_same(void)
+{
+    static uint8_t rgbLog[32000];
+    static FLEET rgfl[6];
+    FLEET *rglpflT[6];
+    FLEET **rglpflOld = rglpfl;
+    int16_t cFleetOld = cFleet;
+    BTLPLAN rgbtlplanRaw[16];
+    int rgiplanRaw[6];
+    uint8_t *lpLogOld = lpLog;
+    int16_t imemLogCurOld = imemLogCur;
+    PFNLOGRTKEY pfnKey = vrgpfnLogRtKey[rtBtlPlan];
+    int16_t cbRaw;
+    int16_t cbNet;
+
+    reset_seen();
+    game.cPlayer = 3;
+    rglpbtlplan[2] = rgbtlplanTest;
+    lpLog = rgbLog;
+    fLogOff = 0;
+    rglpfl = rglpflT;
+    cFleet = 6;
+
+    /* every edit written */
+    vrgpfnLogRtKey[rtBtlPlan] = NULL;
+    cbRaw = write_plan_session();
+    memset(rgbtlplanTest, 0, sizeof(rgbtlplanTest));
+    set_plan_fleets(rgfl, rglpflT, 6);
+    iseenCur = 0;
+    TEST_CHECK(FRunLogFile());
+    memcpy(rgbtlplanRaw, rgbtlplanTest, sizeof(rgbtlplanRaw));
+    for (int ifl = 0; ifl < 6; ifl++)
+    {
+        rgiplanRaw[ifl] = rgfl[ifl].iplan;
+    }
+
+    /* only the net change per plan between the unrelated records */
+    vrgpfnLogRtKey[rtBtlPlan] = pfnKey;
+    cbNet = write_plan_session();
+    memset(rgbtlplanTest, 0, sizeof(rgbtlplanTest));
+    set_plan_fleets(rgfl, rglpflT, 6);
+    iseenCur = 1;
+    TEST_CHECK(FRunLogFile());
+
+    TEST_CHECK_(cbNet * 2 < cbRaw, "%d bytes coalesced, %d raw", cbNet, cbRaw);
+    TEST_CHECK(memcmp(rgbtlplanRaw, rgbtlplanTest, sizeof(rgbtlplanRaw)) == 0);
+    TEST_CHECK(cseen[0] == 10 && cseen[1] == 10);
+
+    /* plan 1 is deleted and then edited again: its fleets still end up on
+     * plan 0, the other player's and other plans' fleets stay put */
+    for (int ifl = 0; ifl < 6; ifl++)
+    {
+        TEST_CHECK_(rgfl[ifl].iplan == rgiplanRaw[ifl], "fleet %d on plan %d, %d raw", ifl, rgfl[ifl].iplan,
+                    rgiplanRaw[ifl]);
+    }
+    TEST_CHECK(rgfl[0].iplan == 0 && rgfl[1].iplan == 2 && rgfl[3].iplan == 1);
+
+    /* the same with nothing in between to stop the delete coalescing */
+    for (int fKey = 0; fKey < 2; fKey++)
+    {
+        vrgpfnLogRtKey[rtBtlPlan] = fKey ? pfnKey : NULL;
+        write_delete_session();
+        set_plan_fleets(rgfl, rglpflT, 6);
+        TEST_CHECK(FRunLogFile());
+        TEST_CHECK_(rgfl[0].iplan == 0, "fleet on plan %d, %s", rgfl[0].iplan, fKey ? "coalesced" : "raw");
+        TEST_CHECK(rgfl[3].iplan == 1);
+    }
+
+    /* the last edit of each plan is what's left */
+    TEST_CHECK(strcmp(rgbtlplanTest[0].szName, "Plan 99") == 0);
+    TEST_CHECK(strcmp(rgbtlplanTest[2].szName, "Plan 98") == 0 && rgbtlplanTest[2].mdTactic == 98 % 4);
+    TEST_CHECK(rgbtlplanTest[2].iplr == 2 && rgbtlplanTest[2].iplan == 2);
+    TEST_CHECK(rgcbtlplan[2] == 3);
+
+    rglpfl = rglpflOld;
+    cFleet = cFleetOld;
+    lpLog = lpLogOld;
+    imemLogCur = imemLogCurOld;
+    imemLogPrev = -1;
+    rglpbtlplan[2] = NULL;
+    rgcbtlplan[2] = 0;
+}
+
+/* Deleting a plan clears it and moves its fleets back to plan 0; records
+ * for a player with no plans, or a name running off the end, are refused. */
+static void test_btlplan_records_apply(void)
+{
+    FLEET rgflT[2];
+    FLEET *rglpflT[2] = {&rgflT[0], &rgflT[1]};
+    BTLPLAN plan;
+    uint8_t rgb[8] = {0x32, 0, 0, 0, 0, 'a', 'b', 'c'};
+
+    game.cPlayer = 3;
+    rglpbtlplan[2] = rgbtlplanTest;
+    memset(rgbtlplanTest, 0, sizeof(rgbtlplanTest));
+    strcpy(rgbtlplanTest[3].szName, "Sniper");
+    memset(rgflT, 0, sizeof(rgflT));
+    rgflT[0].iPlayer = 2;
+    rgflT[0].iplan = 3;
+    rgflT[1].iPlayer = 1;
+    rgflT[1].iplan = 3;
+    rglpfl = rglpflT;
+    cFleet = 2;
+
+    memset(&plan, 0, sizeof(plan));
+    plan.iplr = 2;
+    plan.iplan = 3;
+    plan.fDelete = 1;
+    TEST_CHECK(FRunLogRecord(rtBtlPlan, 2, (uint8_t *)&plan));
+    TEST_CHECK(rgbtlplanTest[3].szName[0] == '\0');
+    TEST_CHECK(rgflT[0].iplan == 0 && rgflT[1].iplan == 3);
+
+    TEST_CHECK(!FRunLogRecord(rtBtlPlan, sizeof(rgb), rgb)); /* no NUL */
+    rgb[0] = 0x31;
+    TEST_CHECK(!FRunLogRecord(rtBtlPlan, 2, rgb)); /* player 1 has no plans */
+
+    rglpfl = NULL;
+    cFleet = 0;
+    rglpbtlplan[2] = NULL;
+    rgcbtlplan[2] = 0;
+}
+
+/* Player 1 may set its own plans, not player 2's, and may not delete
+ * plan 0. Decoding leaves the global file seeds where they were. */
+static void test_batch_checks_btlplan_owner(void)
+{
+    static uint8_t rgbLog[1024];
+    uint8_t *lpLogOld = lpLog;
+    PFNLOGRTKEY pfnKey = vrgpfnLogRtKey[rtBtlPlan];
+    LOGBATCH lb;
+    LOGSTREAM ls;
+    BTLPLAN plan;
+    int32_t lSeed1;
+    int32_t lSeed2;
+    int32_t lSeed1After;
+    int32_t lSeed2After;
+    int cb;
+
+    reset_seen();
+    lpLog = rgbLog;
+    imemLogCur = 0;
+    imemLogPrev = -1;
+    fLogOff = 0;
+    vrgpfnLogRtKey[rtBtlPlan] = NULL;
+    memset(&plan, 0, sizeof(plan));
+    plan.iplr = 1;
+    plan.iplan = 2;
+    strcpy(plan.szName, "Mine");
+    LogChangeBtlplan(&plan);
+    plan.iplr = 2;
+    LogChangeBtlplan(&plan);
+    plan.iplr = 1;
+    plan.iplan = 0;
+    plan.fDelete = 1;
+    LogChangeBtlplan(&plan);
+    vrgpfnLogRtKey[rtBtlPlan] = pfnKey;
+    cb = imemLogCur;
+    lpLog = lpLogOld;
+    imemLogCur = 0;
+
+    SetFileSeeds(0x1234, 0x5678);
+    memset(&lb, 0, sizeof(lb));
+    TEST_ASSERT(FAttachLogStream(&ls, write_log(1, rgbLog, cb), 1));
+    GetFileSeeds(&lSeed1, &lSeed2);
+    TEST_CHECK(FDecodeLogBatch(&lb, 1, &ls));
+    CloseLogStream(&ls);
+    GetFileSeeds(&lSeed1After, &lSeed2After);
+    TEST_CHECK(lSeed1After == lSeed1 && lSeed2After == lSeed2);
+    TEST_CHECK_(lb.crt == 1 && lb.crtBad == 2, "%d kept, %d rejected", lb.crt, lb.crtBad);
+    FreeLogBatch(&lb);
+}
+
+static int count_log_rts(uint8_t *pb, int cb)
+{
+    int c = 0;
+
+    for (int i = 0; i < cb; i += ((HDR *)(pb + i))->cb + 2)
+    {
+        c++;
+    }
+    return c;
+}
+
+/* Changing the same waypoint, or the same queue, again leaves one record,
+ * unless an unkeyed record (a waypoint add) came in between. */
+static void test_waypoints_and_queues_coalesce(void)
+{
+    static uint8_t rgbLog[4096];
+    static struct
+    {
+        PLORD plord;
+        ORDER rgord[3];
+    } ordOld, ordNew;
+    static struct
+    {
+        PLPROD plprod;
+        PROD rgprod[8];
+    } qOld, qNew, qReplay;
+    static PLANET rgplT[3];
+    uint8_t *lpLogOld = lpLog;
+    FLEET flOld;
+    FLEET flNew;
+    uint8_t rgbAdd[4] = {0};
+
+    lpLog = rgbLog;
+    imemLogCur = 0;
+    imemLogPrev = -1;
+    fLogOff = 0;
+    ResetLogRecent();
+
+    memset(&ordOld, 0, sizeof(ordOld));
+    ordOld.plord.iordMax = 3;
+    ordOld.plord.iordMac = 3;
+    ordNew = ordOld;
+    memset(&flOld, 0, sizeof(flOld));
+    flOld.id = (1 << 9) | 3;
+    flOld.lpplord = &ordOld.plord;
+    flNew = flOld;
+    flNew.lpplord = &ordNew.plord;
+
+    ordNew.rgord[1].pt.x = 100;
+    LogChangeFleet(&flOld, &flNew);
+    ordOld = ordNew;
+    ordNew.rgord[2].pt.x = 200;
+    LogChangeFleet(&flOld, &flNew);
+    ordOld = ordNew;
+    ordNew.rgord[1].pt.x = 150;
+    LogChangeFleet(&flOld, &flNew);
+    ordOld = ordNew;
+    TEST_CHECK(count_log_rts(rgbLog, imemLogCur) == 2);
+
+    memset(rgplT, 0, sizeof(rgplT));
+    memset(&qOld, 0, sizeof(qOld));
+    qOld.plprod.cbItem = sizeof(PROD);
+    qOld.plprod.iprodMax = 8;
+    qNew = qOld;
+    rgplT[2].id = 2;
+    rgplT[2].lpplprod = &qOld.plprod;
+    rgplT[1] = rgplT[2];
+    rgplT[1].lpplprod = &qNew.plprod;
+    qNew.plprod.iprodMac = 1;
+    qNew.plprod.rgprod[0].cItem = 5;
+    LogChangePlanet(&rgplT[2], &rgplT[1]);
+    qOld = qNew;
+    qNew.plprod.iprodMac = 2;
+    qNew.plprod.rgprod[1].cItem = 7;
+    LogChangePlanet(&rgplT[2], &rgplT[1]);
+    qOld = qNew;
+    TEST_CHECK(count_log_rts(rgbLog, imemLogCur) == 3);
+
+    /* a waypoint add renumbers what follows: no coalescing across it */
+    WriteMemRt(4, sizeof(rgbAdd), rgbAdd);
+    ordNew.rgord[1].pt.x = 175;
+    LogChangeFleet(&flOld, &flNew);
+    TEST_CHECK(count_log_rts(rgbLog, imemLogCur) == 5);
+
+    /* a queue record replays to that queue */
+    imemLogCur = 0;
+    imemLogPrev = -1;
+    ResetLogRecent();
+    qOld.plprod.iprodMac = 0;
+    LogChangePlanet(&rgplT[2], &rgplT[1]);
+    memset(&qReplay, 0, sizeof(qReplay));
+    qReplay.plprod.iprodMax = 8;
+    rgplT[2].lpplprod = &qReplay.plprod;
+    lpPlanets = rgplT;
+    cPlanet = 3;
+    game.cPlanMax = 3;
+    TEST_CHECK(FRunLogFile());
+    TEST_CHECK(qReplay.plprod.iprodMac == 2 && qReplay.plprod.rgprod[1].cItem == 7);
+
+    lpPlanets = NULL;
+    cPlanet = 0;
+    game.cPlanMax = 0;
+    lpLog = lpLogOld;
+    imemLogCur = 0;
+    imemLogPrev = -1;
+}
+
+/* Offsets remembered for one lpLog mean nothing in another, even where
+ * the last record happens to sit at the same place. */
+static void test_new_lpLog_forgets_recent(void)
+{
+    static uint8_t rgbA[256];
+    static uint8_t rgbB[256];
+    uint8_t *lpLogOld = lpLog;
+    PFNLOGRTKEY pfnKey = vrgpfnLogRtKey[rtBtlPlan];
+    uint8_t rgbPad[18] = {0};
+    BTLPLAN planX;
+    BTLPLAN planY;
+    int16_t imemY;
+    int16_t imemEnd;
+
+    fLogOff = 0;
+    game.cPlayer = 3;
+    memset(&planX, 0, sizeof(planX));
+    planX.iplr = 2;
+    memset(&planY, 0, sizeof(planY));
+    planY.iplr = 2;
+    planY.iplan = 1;
+
+    /* B: short X, something unkeyed, then Y */
+    lpLog = rgbB;
+    imemLogCur = 0;
+    imemLogPrev = -1;
+    strcpy(planX.szName, "A");
+    vrgpfnLogRtKey[rtBtlPlan] = NULL;
+    LogChangeBtlplan(&planX);
+    WriteMemRt(rtTest1, sizeof(rgbPad), rgbPad);
+    LogChangeBtlplan(&planY);
+    imemEnd = imemLogCur;
+    vrgpfnLogRtKey[rtBtlPlan] = pfnKey;
+
+    /* A: long X, then Y at the same offset as in B */
+    lpLog = rgbA;
+    imemLogCur = 0;
+    imemLogPrev = -1;
+    strcpy(planX.szName, "Plan with a long name");
+    LogChangeBtlplan(&planX);
+    imemY = imemLogCur;
+    LogChangeBtlplan(&planY);
+    TEST_ASSERT(imemLogCur == imemEnd);
+
+    /* back to B: X must not be dropped over the unkeyed record */
+    lpLog = rgbB;
+    imemLogPrev = imemY;
+    LogChangeBtlplan(&planX);
+    TEST_CHECK(count_log_rts(rgbB, imemLogCur) == 4);
+    TEST_CHECK(((HDR *)rgbB)->rt == rtBtlPlan && ((HDR *)rgbB)->cb == 7);
+
+    lpLog = lpLogOld;
+    imemLogCur = 0;
+    imemLogPrev = -1;
+}
+
+static void test_CancelMemRt_takes_back_last(void)
+{
+    static uint8_t rgbLog[1024];
+    uint8_t *lpLogOld = lpLog;
+    uint8_t rgb[64];
+    BTLPLAN plan;
+    HDR hdr;
+
+    lpLog = rgbLog;
+    imemLogCur = 0;
+    imemLogPrev = -1;
+    fLogOff = 0;
+    memset(&plan, 0, sizeof(plan));
+    WriteMemRt(rtTest1, 3, "abc");
+    LogChangeBtlplan(&plan);
+    TEST_CHECK(FGetPrevLogRt(&hdr, rgb) && hdr.rt == rtBtlPlan);
+
+    CancelMemRt(rtTest1); /* not the last record: no-op */
+    TEST_CHECK(imemLogPrev == 5);
+    CancelMemRt(rtBtlPlan);
+    TEST_CHECK(imemLogCur == 5 && imemLogPrev == 0);
+    TEST_CHECK(FGetPrevLogRt(&hdr, rgb) && hdr.rt == rtTest1 && hdr.cb == 3 && memcmp(rgb, "abc", 3) == 0);
+
+    lpLog = lpLogOld;
+    imemLogCur = 0;
+    imemLogPrev = -1;
+}
+
+TEST_LIST = {
+    {"streamed log replays the same records as lpLog", test_stream_matches_memory_replay},
+    {"log streams can be read interleaved", test_streams_interleave},
+    {"log stream rejects foreign and truncated logs", test_stream_rejects_bad_logs},
+    {"log batches are all validated before any is applied", test_batches_validate_then_apply},
+    {"log batches take logs of 32K and more and reject unchecked record types", test_batch_takes_long_logs},
+    {"coalesced log replays to the same plans and fleet plans", test_coalesced_log_replays_same},
+    {"battle plan records set and delete plans", test_btlplan_records_apply},
+    {"log batches turn down other players' battle plans", test_batch_checks_btlplan_owner},
+    {"changed waypoints and queues coalesce", test_waypoints_and_queues_coalesce},
+    {"a new lpLog forgets the recent records", test_new_lpLog_forgets_recent},
+    {"CancelMemRt takes back only the last record", test_CancelMemRt_takes_back_last},
+    {NULL, NULL}};
@@ -0,0 +1,426 @@
+#include "acutest.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "globals.h"
+#include "types.h"
+#include "msg.h" /* PszGetCompressedMessage, PszFormatMessage */
+#include "msgfmt.h"
+#include "msgidx.h"
+
+#ifndef STARS_STRINGS_UNCOMPRESSED
+/* the reference tables, extracted from the executable */
+#include "strings_uncompressed.c"
+#else
+extern const char *const aMSGUncompressed[];
+#endif
+
+static void test_msg_templates_match_uncompressed(void)
+{
+    int16_t idm;
+
+    for (idm = 0; idm < (int16_t)sizeof(acMSG); idm++)
+    {
+        TEST_CHECK(strcmp(PszGetCompressedMessage(idm), aMSGUncompressed[idm]) == 0);
+        TEST_MSG("idm %d", idm);
+    }
+    TEST_CHECK(PszGetCompressedMessage(14) == PszGetCompressedMessage(14));
+}
+
+static void test_format_string_into_buffer(void)
+{
+    int16_t rgParam[3] = {5, 2, 3};
+    char szOut[160];
+    char szSmall[12];
+    int16_t cch;
+
+    cch = CchFormatString(szOut, sizeof(szOut), PszGetCompressedMessage(80), rgParam);
+    TEST_CHECK(strcmp(szOut, "Your scientists have completed research into Tech Level 5 for Propulsion. "
+                             "They will continue their efforts in the Construction field.") == 0);
+    TEST_MSG("got \"%s\"", szOut);
+    TEST_CHECK(cch == (int16_t)strlen(szOut));
+
+    /* \m names the cargo */
+    rgParam[1] = 2;
+    CchFormatString(szOut, sizeof(szOut), "a deposit of \\m", rgParam + 1);
+    TEST_CHECK(strcmp(szOut, "a deposit of Germanium") == 0);
+
+    /* \v is unsigned; the 00 after it is template text */
+    rgParam[0] = -1;
+    CchFormatString(szOut, sizeof(szOut), "from \\v00 to \\i", rgParam);
+    TEST_CHECK(strcmp(szOut, "from 6553500 to 2") == 0);
+
+    /* an exact fit fits; one char more does not */
+    TEST_CHECK(CchFormatString(szSmall, sizeof(szSmall), "A long line", NULL) == (int16_t)sizeof(szSmall) - 1);
+    TEST_CHECK(CchFormatString(szSmall, sizeof(szSmall), "A long line of text", NULL) == cchFmtTrunc);
+    TEST_CHECK(strcmp(szSmall, "A long line") == 0);
+    rgParam[0] = 12345;
+    TEST_CHECK(CchFormatString(szSmall, sizeof(szSmall), "line of \\i", rgParam) == cchFmtTrunc);
+    TEST_CHECK(strcmp(szSmall, "line of 123") == 0);
+    TEST_CHECK(CchFormatString(szSmall, 0, "", NULL) == cchFmtTrunc);
+}
+
+/* An escape with no handler, or a parameter out of range, fails the whole
+ * expansion instead of leaving a hole. */
+static void test_format_string_fails_loudly(void)
+{
+    int16_t rgParam[3] = {9, 5, 3};
+    char szOut[128];
+
+    TEST_CHECK(CchFormatString(szOut, sizeof(szOut), PszGetCompressedMessage(14), rgParam) == cchFmtBad);
+    TEST_CHECK(strcmp(szOut, "There was a massive blood bath at ") == 0);
+    TEST_CHECK(CchFormatString(szOut, sizeof(szOut), "research in \\j", rgParam) == cchFmtBad);
+    TEST_CHECK(CchFormatString(szOut, sizeof(szOut), "a \\\\j", rgParam) == 4);
+    TEST_CHECK(strcmp(szOut, "a \\j") == 0);
+
+    /* the static formatter shows the template as it is */
+    TEST_CHECK(strcmp(PszFormatMessage(14, rgParam), PszGetCompressedMessage(14)) == 0);
+}
+
+static uint8_t *put_turn_msg(uint8_t *pb, int iPlr, int iMsg, int iObj, const int16_t *rgParam, int cParam)
+{
+    uint8_t *pbParam;
+    uint16_t w;
+    int i;
+
+    w = (uint16_t)iMsg;
+    pbParam = pb + cbMsgTurn;
+    for (i = 0; i < cParam; i++)
+    {
+        if ((rgParam[i] & 0xff00) == 0)
+        {
+            *pbParam++ = (uint8_t)rgParam[i];
+        }
+        else
+        {
+            w |= (uint16_t)(1u << (9 + i));
+            pbParam[0] = (uint8_t)rgParam[i];
+            pbParam[1] = (uint8_t)(rgParam[i] >> 8);
+            pbParam += 2;
+        }
+    }
+    pb[0] = (uint8_t)(iPlr | ((pbParam - pb - cbMsgTurn) << 4));
+    pb[1] = (uint8_t)w;
+    pb[2] = (uint8_t)(w >> 8);
+    pb[3] = (uint8_t)iObj;
+    pb[4] = (uint8_t)(iObj >> 8);
+    return pbParam;
+}
+
+static void test_format_turn_msgs_digest(void)
+{
+    static const int16_t rgParamA[2] = {300, 7};
+    static const int16_t rgParamB[2] = {4, 7};
+    int16_t rgw[96];
+    char rgchA[256];
+    char rgchB[256];
+    char rgchC[256];
+    char szA[128];
+    char szB[128];
+    MSGDIGEST rgmd[3];
+    MSGBIG mb;
+    uint8_t *pb;
+    int16_t iPlr;
+    int16_t cchA;
+    int16_t cchB;
+    int16_t cRendered;
+    char *psz;
+
+    cchA = CchFormatString(szA, sizeof(szA), PszGetCompressedMessage(5), (int16_t *)rgParamA);
+    cchB = CchFormatString(szB, sizeof(szB), PszGetCompressedMessage(5), (int16_t *)rgParamB);
+    TEST_ASSERT(cchB > 0 && cchA > cchB);
+
+    pb = (uint8_t *)rgw;
+    pb = put_turn_msg(pb, 0, 5, 7, rgParamA, 2);
+    pb = put_turn_msg(pb, 1, 5, 7, rgParamB, 2);
+    pb = put_turn_msg(pb, 0, 14, 7, rgParamB, 2); /* \n: cannot be expanded */
+    pb = put_turn_msg(pb, 2, 5, 7, rgParamA, 2);  /* does not fit in C */
+    pb = put_turn_msg(pb, 0, 5, 7, rgParamB, 2);
+    pb = put_turn_msg(pb, 1, 5, 7, rgParamB, 2);  /* exactly fills B */
+    pb = put_turn_msg(pb, 1, 5, 7, rgParamA, 2);  /* no room left in B */
+    pb = put_turn_msg(pb, 2, 5, 7, rgParamB, 2);  /* would fit, but comes after */
+    pb = put_turn_msg(pb, 5, 5, 7, rgParamA, 2);  /* no digest for player 5 */
+    lpMsg = rgw;
+    imemMsgCur = (int16_t)(pb - (uint8_t *)rgw);
+
+    TEST_CHECK(CbUnpackTurnMsg((uint8_t *)rgw, &iPlr, &mb) == cbMsgTurn + 3);
+    TEST_CHECK(iPlr == 0 && mb.iMsg == 5 && mb.wGoto == 7);
+    TEST_CHECK(mb.rgParam[0] == 300 && mb.rgParam[1] == 7);
+
+    memset(rgmd, 0, sizeof(rgmd));
+    rgmd[0].pch = rgchA;
+    rgmd[0].cchMax = sizeof(rgchA);
+    rgmd[1].pch = rgchB;
+    rgmd[1].cchMax = (int16_t)(2 * (cchB + 1));
+    rgmd[2].pch = rgchC;
+    rgmd[2].cchMax = (int16_t)(cchB + 1);
+    cRendered = CFormatTurnMsgs(rgmd, 3);
+
+    TEST_CHECK(cRendered == 4);
+    TEST_CHECK(rgmd[0].cMsg == 2 && rgmd[0].cMsgTrunc == 0 && rgmd[0].cMsgBad == 1);
+    TEST_CHECK(rgmd[1].cMsg == 2 && rgmd[1].cMsgTrunc == 1 && rgmd[1].cch == rgmd[1].cchMax);
+    TEST_CHECK(rgmd[2].cMsg == 0 && rgmd[2].cMsgTrunc == 2 && rgmd[2].cch == 0);
+
+    psz = rgchA;
+    TEST_CHECK(strcmp(psz, szA) == 0);
+    psz += strlen(psz) + 1;
+    TEST_CHECK(strcmp(psz, szB) == 0);
+    TEST_CHECK(psz + strlen(psz) + 1 == rgchA + rgmd[0].cch);
+    TEST_CHECK(strcmp(rgchB, szB) == 0 && strcmp(rgchB + cchB + 1, szB) == 0);
+
+    lpMsg = NULL;
+    imemMsgCur = 0;
+}
+
+static uint8_t *put_msg_hdr(uint8_t *pb, int iMsg, int wGoto, const int16_t *rgParam)
+{
+    MSGHDR *pmh;
+    int i;
+
+    pmh = (MSGHDR *)pb;
+    pmh->iMsg = (uint16_t)iMsg;
+    pmh->grWord = 0;
+    pmh->wGoto = (uint16_t)wGoto;
+    pb += sizeof(MSGHDR);
+    for (i = 0; i < rgcMsgArgs[iMsg]; i++)
+    {
+        if ((rgParam[i] & 0xff00) == 0)
+        {
+            *pb++ = (uint8_t)rgParam[i];
+        }
+        else
+        {
+            pmh->grWord = (uint16_t)(pmh->grWord | (1u << i));
+            pb[0] = (uint8_t)rgParam[i];
+            pb[1] = (uint8_t)(rgParam[i] >> 8);
+            pb += 2;
+        }
+    }
+    return pb;
+}
+
+static void test_msg_next_prev_indexed(void)
+{
+    static const int16_t rgParam[4] = {7, 300, 2, 1000};
+    static const int rgidm[6] = {14, 1, 2, 14, 1, 2};
+    int16_t rgw[64];
+    uint8_t *pb;
+    MSGBIG mb;
+    int i;
+
+    ResetMessages();
+    pb = (uint8_t *)rgw;
+    for (i = 0; i < 6; i++)
+    {
+        pb = put_msg_hdr(pb, rgidm[i], 100 + i, rgParam);
+    }
+    lpMsg = rgw;
+    imemMsgCur = (int16_t)(pb - (uint8_t *)rgw);
+    cMsg = 6;
+    fViewFilteredMsg = 0;
+
+    TEST_CHECK(FGetNMsgbig(4, &mb));
+    TEST_CHECK(mb.iMsg == 1 && mb.wGoto == 104);
+    TEST_CHECK(mb.rgParam[0] == 7 && mb.rgParam[1] == 300 && mb.rgParam[2] == 2 && mb.rgParam[3] == 1000);
+    TEST_CHECK(!FGetNMsgbig(6, &mb));
+    TEST_CHECK(IdmGetMessageN(5) == 2);
+
+    /* filter msg 1 */
+    bitfMsgFiltered[0] = 1 << 1;
+    iMsgCur = -1;
+    TEST_CHECK(IMsgNext(0) == 0);
+    iMsgCur = 0;
+    TEST_CHECK(IMsgNext(0) == 2);
+    TEST_CHECK(IMsgNext(1) == 1);
+    iMsgCur = 5;
+    TEST_CHECK(IMsgNext(0) == -1);
+    TEST_CHECK(IMsgPrev(0) == 3);
+    TEST_CHECK(IMsgPrev(1) == 4);
+    iMsgCur = 1;
+    TEST_CHECK(IMsgPrev(1) == -1);
+
+    /* the index re-splits when the filters change */
+    bitfMsgFiltered[0] = 1 << 2;
+    iMsgCur = 0;
+    TEST_CHECK(IMsgNext(0) == 1);
+    TEST_CHECK(IMsgNext(1) == 2);
+
+    /* player messages follow the turn messages */
+    vcmsgplrIn = 2;
+    iMsgCur = 5;
+    TEST_CHECK(IMsgNext(0) == 6);
+    iMsgCur = 7;
+    TEST_CHECK(IMsgNext(0) == -1);
+    TEST_CHECK(IMsgPrev(0) == 6);
+    iMsgCur = 6;
+    TEST_CHECK(IMsgPrev(0) == 4);
+
+    /* viewing everything just steps */
+    fViewFilteredMsg = 1;
+    iMsgCur = 2;
+    TEST_CHECK(IMsgNext(0) == 3);
+    TEST_CHECK(IMsgPrev(0) == 1);
+    fViewFilteredMsg = 0;
+
+    ResetMessages();
+    TEST_CHECK(cMsg == 0 && iMsgCur == -1 && bitfMsgFiltered[0] == 0);
+    lpMsg = NULL;
+}
+
+/* Records in lpMsg, or -1 if one of them is a removed one. */
+static int count_turn_msgs(void)
+{
+    uint8_t *lpb = (uint8_t *)lpMsg;
+    uint8_t *lpbMax = lpb + imemMsgCur;
+    MSGBIG mb;
+    int16_t iPlr;
+    int c = 0;
+
+    while (lpb + cbMsgTurn <= lpbMax)
+    {
+        lpb += CbUnpackTurnMsg(lpb, &iPlr, &mb);
+        if (mb.iMsg == idmMsgDeleted)
+        {
+            return -1;
+        }
+        c++;
+    }
+    return lpb == lpbMax ? c : -1;
+}
+
+static void test_find_remove_turn_msgs(void)
+{
+    static const int16_t rgParam[3] = {7, 300, 2};
+    int16_t rgw[64];
+    MSGDIGEST rgmd[2];
+    char rgchA[256];
+    char rgchB[256];
+    MSGKEY *pmk;
+    MSGBIG mb;
+    uint8_t *pb;
+    int16_t iPlr;
+
+    ResetMessages();
+    pb = (uint8_t *)rgw;
+    pb = put_turn_msg(pb, 0, 5, 7, rgParam, 3);
+    pb = put_turn_msg(pb, 1, 5, 7, rgParam, 3);
+    pb = put_turn_msg(pb, 0, 2, 7, rgParam, 2);
+    lpMsg = rgw;
+    imemMsgCur = (int16_t)(pb - (uint8_t *)rgw);
+    cMsg = 3;
+
+    TEST_CHECK(FFindPlayerMessage(0, 5, 7));
+    TEST_CHECK(FFindPlayerMessage(1, 5, 7));
+    TEST_CHECK(!FFindPlayerMessage(1, 2, 7));
+    TEST_CHECK(!FFindPlayerMessage(0, 5, 8));
+
+    /* appended records are found without a rebuild */
+    pb = put_turn_msg(pb, 0, 5, 7, rgParam, 3);
+    imemMsgCur = (int16_t)(pb - (uint8_t *)rgw);
+    cMsg++;
+    TEST_CHECK(FRemovePlayerMessage(0, 5, 7) == 2);
+    TEST_CHECK(cMsg == 2);
+    TEST_CHECK(!FFindPlayerMessage(0, 5, 7));
+    TEST_CHECK(FFindPlayerMessage(0, 2, 7));
+
+    /* half of lpMsg was dead, so the marked records were squeezed out */
+    TEST_CHECK(count_turn_msgs() == cMsg);
+    TEST_CHECK(imemMsgCur == 2 * cbMsgTurn + 4 + 3);
+
+    /* and the index still points at the records that moved */
+    TEST_CHECK(vmsgtidx.fValid);
+    TEST_CHECK(CFindTurnMsgs(&vmsgtidx, 0, 2, 7, &pmk) == 1);
+    TEST_CHECK(CbUnpackTurnMsg((uint8_t *)lpMsg + pmk->ib, &iPlr, &mb) == cbMsgTurn + 3);
+    TEST_CHECK(iPlr == 0 && mb.iMsg == 2 && mb.rgParam[1] == 300);
+
+    /* removing the first record moves the other one to the front */
+    TEST_CHECK(FRemovePlayerMessage(1, 5, 7) == 1);
+    TEST_CHECK(count_turn_msgs() == cMsg && cMsg == 1);
+    TEST_CHECK(CFindTurnMsgs(&vmsgtidx, 0, 2, 7, &pmk) == 1 && pmk->ib == 0);
+    TEST_CHECK(FRemovePlayerMessage(1, 5, 7) == 0 && cMsg == 1);
+    pb = put_turn_msg((uint8_t *)lpMsg + imemMsgCur, 1, 5, 7, rgParam, 3);
+    imemMsgCur = (int16_t)(pb - (uint8_t *)rgw);
+    cMsg++;
+
+    memset(rgmd, 0, sizeof(rgmd));
+    rgmd[0].pch = rgchA;
+    rgmd[0].cchMax = sizeof(rgchA);
+    rgmd[1].pch = rgchB;
+    rgmd[1].cchMax = sizeof(rgchB);
+    TEST_CHECK(CFormatTurnMsgs(rgmd, 2) == 2);
+    TEST_CHECK(rgmd[0].cMsg == 1 && rgmd[1].cMsg == 1);
+    TEST_CHECK(FFindPlayerMessage(1, 5, 7));
+    TEST_CHECK(FFindPlayerMessage(0, 2, 7));
+    TEST_CHECK(!FFindPlayerMessage(0, 5, 7));
+
+    ResetMessages();
+    lpMsg = NULL;
+}
+
+/* A removal only marks; lookups, re-sends and rendering see through the
+ * marks until CompactTurnMsgs squeezes them out. */
+static void test_remove_turn_msgs_marks_until_compacted(void)
+{
+    static const int16_t rgParam[3] = {7, 300, 2};
+    int16_t rgw[256];
+    MSGDIGEST rgmd[1];
+    char rgch[2048];
+    MSGKEY *pmk;
+    MSGBIG mb;
+    uint8_t *pb;
+    int16_t iPlr;
+    int16_t imemMsgOld;
+
+    ResetMessages();
+    pb = (uint8_t *)rgw;
+    for (int i = 0; i < 20; i++)
+    {
+        pb = put_turn_msg(pb, 0, (int16_t)(i % 4 == 0 ? 5 : 2), (int16_t)i, rgParam, 3);
+    }
+    lpMsg = rgw;
+    imemMsgCur = (int16_t)(pb - (uint8_t *)rgw);
+    cMsg = 20;
+
+    imemMsgOld = imemMsgCur;
+    TEST_CHECK(FRemovePlayerMessage(0, 5, 4) == 1);
+    TEST_CHECK(FRemovePlayerMessage(0, 2, 9) == 1);
+    TEST_CHECK(cMsg == 18 && imemMsgCur == imemMsgOld);
+    TEST_CHECK(count_turn_msgs() == -1);
+    TEST_CHECK(!FFindPlayerMessage(0, 5, 4) && !FFindPlayerMessage(0, 2, 9));
+    TEST_CHECK(FFindPlayerMessage(0, 5, 8) && FFindPlayerMessage(0, 2, 10));
+    TEST_CHECK(FRemovePlayerMessage(0, 5, 4) == 0 && cMsg == 18);
+
+    /* sent again after the removal: found, and behind the tombstone */
+    pb = put_turn_msg((uint8_t *)lpMsg + imemMsgCur, 0, 5, 4, rgParam, 3);
+    imemMsgCur = (int16_t)(pb - (uint8_t *)rgw);
+    cMsg++;
+    TEST_CHECK(CFindTurnMsgs(&vmsgtidx, 0, 5, 4, &pmk) == 1 && pmk->ib == imemMsgOld);
+
+    memset(rgmd, 0, sizeof(rgmd));
+    rgmd[0].pch = rgch;
+    rgmd[0].cchMax = sizeof(rgch);
+    TEST_CHECK(CFormatTurnMsgs(rgmd, 1) == cMsg);
+
+    CompactTurnMsgs(&vmsgtidx);
+    TEST_CHECK(count_turn_msgs() == cMsg);
+    TEST_CHECK(CFindTurnMsgs(&vmsgtidx, 0, 2, 10, &pmk) == 1);
+    TEST_CHECK(CbUnpackTurnMsg((uint8_t *)lpMsg + pmk->ib, &iPlr, &mb) == cbMsgTurn + 4);
+    TEST_CHECK(mb.iMsg == 2 && mb.wGoto == 10);
+    TEST_CHECK(CFindTurnMsgs(&vmsgtidx, 0, 5, 4, &pmk) == 1);
+    TEST_CHECK(!FFindPlayerMessage(0, 2, 9));
+
+    ResetMessages();
+    lpMsg = NULL;
+}
+
+TEST_LIST = {
+    {"Message templates match the uncompressed table", test_msg_templates_match_uncompressed},
+    {"CchFormatString expands into the caller's buffer", test_format_string_into_buffer},
+    {"CchFormatString fails on escapes it cannot expand", test_format_string_fails_loudly},
+    {"CFormatTurnMsgs renders each player's digest in order", test_format_turn_msgs_digest},
+    {"Message next/prev use the index", test_msg_next_prev_indexed},
+    {"Turn messages are found and removed", test_find_remove_turn_msgs},
+    {"Turn message removals are marked until compacted", test_remove_turn_msgs_marks_until_compacted},
+    {NULL, NULL},
+};
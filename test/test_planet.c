@@ -6,6 +6,18 @@
 #include "globals.h"
 #include "types.h"
 #include "planet.h" /* PctPlanetDesirability */
+#include "habmat.h" /* PctHabFromCache, ScoreHabPlanets */
+#include "econsnap.h"
+#include "turn2.h"  /* UpdatePopulations */
+#include "util.h"   /* ChgPopFromPlanet */
+#include "mine.h"   /* EstMineralsMined */
+#include "produce.h" /* EstimateItemProdSched */
+#include "prodeta.h"
+#include "strings.h" /* PszGetCompressedString */
+#include "file.h"    /* FReadPlanet */
+#include "plidx.h"
+#include "utilgen.h" /* SkipFileXor, XorFileBuf */
+#include "turnfile.h"
 
 typedef struct HabCase
 {
@@ -141,6 +153,875 @@ static void test_PctPlanetDesirability_table_stars_defaults(void)
     }
 }
 
+static void set_player_env(int iPlr, int pref, int minv, int maxv, int maxv0)
+{
+    for (int i = 0; i < 3; i++)
+    {
+        rgplr[iPlr].rgEnvVar[i] = (char)pref;
+        rgplr[iPlr].rgEnvVarMin[i] = (char)minv;
+        rgplr[iPlr].rgEnvVarMax[i] = (char)(i == 0 ? maxv0 : maxv);
+    }
+}
+
+static void test_HabCache_matches_scalar(void)
+{
+    enum { step = 6, cAxis = 100 / step + 1, cpl = cAxis * cAxis * cAxis };
+    static PLANET rgpl[cpl];
+    static int16_t rgpct[cpl];
+    PLAYER rgplrOld[3];
+    PLANET *lpPlanetsOld = lpPlanets;
+    int16_t cPlanetOld = cPlanet;
+    int cBad = 0;
+
+    memcpy(rgplrOld, rgplr, sizeof(rgplrOld));
+    set_player_env(0, 50, 15, 85, 85);
+    set_player_env(1, 30, 5, 70, -1); /* immune axis 0 */
+    set_player_env(2, 80, 62, 97, 97);
+
+    memset(rgpl, 0, sizeof(rgpl));
+    for (int ipl = 0; ipl < cpl; ipl++)
+    {
+        rgpl[ipl].id = (int16_t)ipl;
+        rgpl[ipl].rgEnvVar[0] = (char)((ipl % cAxis) * step);
+        rgpl[ipl].rgEnvVar[1] = (char)((ipl / cAxis % cAxis) * step);
+        rgpl[ipl].rgEnvVar[2] = (char)((ipl / (cAxis * cAxis)) * step);
+    }
+    lpPlanets = rgpl;
+    cPlanet = cpl;
+
+    for (int16_t iPlr = 0; iPlr < 3; iPlr++)
+    {
+        ScoreHabPlanets(iPlr, rgpl, cpl, rgpct);
+        for (int ipl = 0; ipl < cpl; ipl++)
+        {
+            int16_t want = PctPlanetDesirability(&rgpl[ipl], iPlr);
+            cBad += rgpct[ipl] != want;
+            cBad += PctHabFromCache(&rgpl[ipl], iPlr) != want;
+            cBad += PctHabFromCache(&rgpl[ipl], iPlr) != want; /* second hit is cached */
+        }
+    }
+    TEST_CHECK_(cBad == 0, "%d mismatches against PctPlanetDesirability", cBad);
+
+    /* terraform one planet and change a race: both must be picked up */
+    rgpl[7].rgEnvVar[1] = 50;
+    TEST_CHECK(PctHabFromCache(&rgpl[7], 0) == PctPlanetDesirability(&rgpl[7], 0));
+    set_player_env(0, 40, 10, 90, 90);
+    TEST_CHECK(PctHabFromCache(&rgpl[100], 0) == PctPlanetDesirability(&rgpl[100], 0));
+
+    FreeHabCache();
+    lpPlanets = lpPlanetsOld;
+    cPlanet = cPlanetOld;
+    memcpy(rgplr, rgplrOld, sizeof(rgplrOld));
+}
+
+static void set_player_growth(int iPlr, int iPrt, int pctGrowth, int fLsp, int fCheater)
+{
+    rgplr[iPlr].rgAttr[0xe] = (char)iPrt;
+    rgplr[iPlr].pctIdealGrowth = (char)pctGrowth;
+    rgplr[iPlr].grbitAttr = fLsp ? (1u << 9) : 0;
+    rgplr[iPlr].fCheater = fCheater ? 1 : 0;
+}
+
+static void test_EconSnap_matches_scalar(void)
+{
+    enum { step = 12, cAxis = 100 / step + 1, cEnv = cAxis * cAxis * cAxis, cpl = cEnv * 4 };
+    static const int32_t rglPop[] = {0, 1, 7, 120, 999, 2500, 4100, 6000, 8700, 9950, 10004, 12000, 30000};
+    static PLANET rgplScalar[cpl];
+    static PLANET rgplBatch[cpl];
+    PLAYER rgplrOld[3];
+    PLANET *lpPlanetsOld = lpPlanets;
+    int16_t cPlanetOld = cPlanet;
+    int16_t cPlanMaxOld = game.cPlanMax;
+    int16_t fGenOld = gd.fGeneratingTurn;
+    int cBad = 0;
+
+    memcpy(rgplrOld, rgplr, sizeof(rgplrOld));
+    set_player_env(0, 50, 15, 85, 85);
+    set_player_env(1, 30, 5, 70, -1);
+    set_player_env(2, 80, 62, 97, 97);
+    set_player_growth(0, 1, 15, 0, 0);
+    set_player_growth(1, 0, 20, 0, 0); /* HE: double growth, half capacity */
+    set_player_growth(2, 9, 7, 1, 1);  /* JOAT + LSP, cheater while generating */
+    gd.fGeneratingTurn = 1;
+
+    memset(rgplScalar, 0, sizeof(rgplScalar));
+    for (int ipl = 0; ipl < cpl; ipl++)
+    {
+        int ienv = ipl % cEnv;
+        PLANET *lppl = &rgplScalar[ipl];
+
+        lppl->id = (int16_t)ipl;
+        lppl->iPlayer = (int16_t)(ipl / cEnv - 1);
+        lppl->rgEnvVar[0] = (char)((ienv % cAxis) * step);
+        lppl->rgEnvVar[1] = (char)((ienv / cAxis % cAxis) * step);
+        lppl->rgEnvVar[2] = (char)((ienv / (cAxis * cAxis)) * step);
+        lppl->rgwtMin[3] = rglPop[ipl % (sizeof(rglPop) / sizeof(rglPop[0]))];
+        lppl->iDeltaPop = (uint8_t)((ipl * 37) % 100);
+    }
+    memcpy(rgplBatch, rgplScalar, sizeof(rgplBatch));
+    cPlanet = cpl;
+    game.cPlanMax = cpl;
+
+    /* a few turns so the fractional carry gets exercised */
+    for (int turn = 0; turn < 3; turn++)
+    {
+        lpPlanets = rgplScalar;
+        for (int ipl = 0; ipl < cpl; ipl++)
+        {
+            ChgPopFromPlanet(&rgplScalar[ipl], 1);
+        }
+        lpPlanets = rgplBatch;
+        UpdatePopulations();
+        for (int ipl = 0; ipl < cpl; ipl++)
+        {
+            if (rgplBatch[ipl].rgwtMin[3] != rgplScalar[ipl].rgwtMin[3] ||
+                rgplBatch[ipl].iDeltaPop != rgplScalar[ipl].iDeltaPop)
+            {
+                cBad++;
+            }
+        }
+    }
+    TEST_CHECK_(cBad == 0, "%d mismatches against ChgPopFromPlanet", cBad);
+
+    /* some planets must actually have grown and some died, or the check is vacuous */
+    int cGrew = 0;
+    int cShrank = 0;
+    for (int ipl = 0; ipl < cpl; ipl++)
+    {
+        int32_t lPop0 = rglPop[ipl % (sizeof(rglPop) / sizeof(rglPop[0]))];
+        cGrew += rgplBatch[ipl].rgwtMin[3] > lPop0;
+        cShrank += rgplBatch[ipl].rgwtMin[3] < lPop0;
+    }
+    TEST_CHECK_(cGrew > 0 && cShrank > 0, "grew=%d shrank=%d", cGrew, cShrank);
+
+    FreeEconSnap(&vecon);
+    FreeHabCache();
+    lpPlanets = lpPlanetsOld;
+    cPlanet = cPlanetOld;
+    game.cPlanMax = cPlanMaxOld;
+    gd.fGeneratingTurn = fGenOld;
+    memcpy(rgplr, rgplrOld, sizeof(rgplrOld));
+}
+
+/* ChgPopFromGrowth worked by hand: an ideal world (100%, max pop 10000) for
+ * a 15% race, below a quarter full, tapering, carrying a fraction, and
+ * overcrowded; plus a hostile world at -20%. Both the scalar and the
+ * snapshot paths must land on these numbers. */
+static void test_growth_matches_hand_computed(void)
+{
+    static const struct
+    {
+        int32_t lPop;
+        uint8_t iDelta;
+        int32_t lPopNew;
+        uint8_t iDeltaNew;
+    } rgcase[] = {
+        {1000, 0, 1150, 0},     /* 1000 * 15% */
+        {777, 90, 894, 45},     /* 116.55, the carry makes it 117 */
+        {5000, 0, 5330, 0},     /* half full: 1500 * 250000 / 562500 -> 6.6% */
+        {12000, 0, 11899, 20},  /* 20% over: (99 - 120) * 4 -> -0.84% */
+    };
+    enum { ccase = sizeof(rgcase) / sizeof(rgcase[0]) };
+    static PLANET rgplScalar[ccase];
+    static PLANET rgplBatch[ccase];
+    PLAYER plrOld = rgplr[0];
+    PLANET *lpPlanetsOld = lpPlanets;
+    int16_t cPlanetOld = cPlanet;
+    int16_t cPlanMaxOld = game.cPlanMax;
+    int16_t iDelta;
+    int i;
+
+    set_player_env(0, 50, 15, 85, 85);
+    set_player_growth(0, 1, 15, 0, 0);
+    memset(rgplScalar, 0, sizeof(rgplScalar));
+    for (i = 0; i < ccase; i++)
+    {
+        rgplScalar[i].id = (int16_t)i;
+        rgplScalar[i].iPlayer = 0;
+        rgplScalar[i].rgEnvVar[0] = rgplScalar[i].rgEnvVar[1] = rgplScalar[i].rgEnvVar[2] = 50;
+        rgplScalar[i].rgwtMin[3] = rgcase[i].lPop;
+        rgplScalar[i].iDeltaPop = rgcase[i].iDelta;
+    }
+    memcpy(rgplBatch, rgplScalar, sizeof(rgplBatch));
+    cPlanet = ccase;
+    game.cPlanMax = ccase;
+
+    lpPlanets = rgplScalar;
+    TEST_CHECK(PctPlanetDesirability(&rgplScalar[0], 0) == 100);
+    TEST_CHECK(CalcPlanetMaxPop(0, 0) == 10000);
+    for (i = 0; i < ccase; i++)
+    {
+        ChgPopFromPlanet(&rgplScalar[i], 1);
+    }
+    lpPlanets = rgplBatch;
+    UpdatePopulations();
+    for (i = 0; i < ccase; i++)
+    {
+        TEST_CHECK_(rgplScalar[i].rgwtMin[3] == rgcase[i].lPopNew && rgplScalar[i].iDeltaPop == rgcase[i].iDeltaNew,
+                    "scalar case %d: %d/%d", i, (int)rgplScalar[i].rgwtMin[3], (int)rgplScalar[i].iDeltaPop);
+        TEST_CHECK_(rgplBatch[i].rgwtMin[3] == rgcase[i].lPopNew && rgplBatch[i].iDeltaPop == rgcase[i].iDeltaNew,
+                    "snapshot case %d: %d/%d", i, (int)rgplBatch[i].rgwtMin[3], (int)rgplBatch[i].iDeltaPop);
+    }
+
+    /* hostile: 1000 * 20 / 10 = 2000 hundredths lost */
+    iDelta = 0;
+    TEST_CHECK(ChgPopFromGrowth(1000, 0, -20, 0, 0, &iDelta) == -20 && iDelta == 0);
+
+    /* the snapshot goes with the game */
+    TEST_CHECK(vecon.pvBlock != NULL);
+    DestroyCurGame();
+    TEST_CHECK(vecon.pvBlock == NULL);
+    lpPlanets = lpPlanetsOld;
+    cPlanet = cPlanetOld;
+    game.cPlanMax = cPlanMaxOld;
+    rgplr[0] = plrOld;
+}
+
+/* AR capacity comes from the starbase hull; designs are 0x93 bytes apart
+ * in rglpshdefSB, not sizeof(SHDEF). */
+static void test_MaxPop_reads_starbase_at_file_stride(void)
+{
+    static uint8_t rgbShdef[4 * 0x93];
+    static PLANET rgpl[1];
+    PLAYER plrOld = rgplr[0];
+    PLANET *lpPlanetsOld = lpPlanets;
+    int16_t cPlanetOld = cPlanet;
+    int16_t cPlanMaxOld = game.cPlanMax;
+    SHDEF *lpshdefSBOld = rglpshdefSB[0];
+
+    memset(rgbShdef, 0, sizeof(rgbShdef));
+    ((SHDEF *)(rgbShdef + 2 * 0x93))->hul.ihuldef = 0x20 + 3;
+    rglpshdefSB[0] = (SHDEF *)rgbShdef;
+    memset(rgpl, 0, sizeof(rgpl));
+    rgpl[0].iPlayer = 0;
+    rgpl[0].fStarbase = 1;
+    rgpl[0].isb = 2;
+    lpPlanets = rgpl;
+    cPlanet = 1;
+    game.cPlanMax = 1;
+    set_player_growth(0, 8, 10, 0, 0);
+
+    TEST_CHECK(CalcPlanetMaxPop(0, 0) == rglPopMac[3]);
+    rgpl[0].isb = 1; /* an empty design slot */
+    TEST_CHECK(CalcPlanetMaxPop(0, 0) == 0);
+
+    rglpshdefSB[0] = lpshdefSBOld;
+    lpPlanets = lpPlanetsOld;
+    cPlanet = cPlanetOld;
+    game.cPlanMax = cPlanMaxOld;
+    rgplr[0] = plrOld;
+}
+
+static void test_EconTable_matches_scalar(void)
+{
+    enum { cpl = 240 };
+    static PLANET rgplScalar[cpl];
+    static PLANET rgplBatch[cpl];
+    PLAYER rgplrOld[2];
+    PLANET *lpPlanetsOld = lpPlanets;
+    int16_t cPlanetOld = cPlanet;
+    int16_t cPlanMaxOld = game.cPlanMax;
+    int16_t fGenOld = gd.fGeneratingTurn;
+    int32_t rglResPlr[16] = {0};
+    int32_t rglQuan[3];
+    int cBad = 0;
+
+    memcpy(rgplrOld, rgplr, sizeof(rgplrOld));
+    for (int iPlr = 0; iPlr < 2; iPlr++)
+    {
+        set_player_env(iPlr, 50, 15, 85, 85);
+        set_player_growth(iPlr, 1, 15, 0, 0);
+        rgplr[iPlr].rgAttr[0] = (char)(10 + iPlr * 5); /* colonists per resource */
+        rgplr[iPlr].rgAttr[1] = 10;                    /* factory output */
+        rgplr[iPlr].rgAttr[3] = (char)(10 + iPlr * 5); /* factories operated */
+        rgplr[iPlr].rgAttr[4] = (char)(10 + iPlr * 5); /* mine output */
+        rgplr[iPlr].rgAttr[6] = 10;                    /* mines operated */
+    }
+    gd.fGeneratingTurn = 0; /* keep Random() out of the comparison */
+
+    memset(rgplScalar, 0, sizeof(rgplScalar));
+    for (int ipl = 0; ipl < cpl; ipl++)
+    {
+        PLANET *lppl = &rgplScalar[ipl];
+
+        lppl->id = (int16_t)ipl;
+        lppl->iPlayer = (int16_t)(ipl % 3 - 1);
+        for (int i = 0; i < 3; i++)
+        {
+            lppl->rgEnvVar[i] = (char)(20 + (ipl * (7 + i * 5)) % 61);
+            lppl->rgMinConc[i] = (uint8_t)(1 + (ipl * (11 + i)) % 120);
+            lppl->rgpctMinLevel[i] = (uint8_t)((ipl * 29 + i) % 256);
+        }
+        lppl->fHomeworld = ipl % 17 == 0;
+        lppl->rgwtMin[3] = (ipl * 131) % 9000;
+        lppl->cMines = (ipl * 7) % 400;
+        lppl->cFactories = (ipl * 13) % 400;
+    }
+    memcpy(rgplBatch, rgplScalar, sizeof(rgplBatch));
+    cPlanet = cpl;
+    game.cPlanMax = cpl;
+
+    lpPlanets = rgplBatch;
+    TEST_CHECK(FBuildEconTable(&vecon));
+    for (int ipl = 0; ipl < cpl; ipl++)
+    {
+        PLANET *lppl = &rgplBatch[ipl];
+
+        if (lppl->iPlayer == -1 || lppl->rgwtMin[3] == 0)
+        {
+            continue;
+        }
+        cBad += vecon.rgcMinesOp[ipl] != CMinesOperating(lppl);
+        cBad += vecon.rgcFactOp[ipl] != CFactoriesOperating(lppl);
+        cBad += vecon.rgcRes[ipl] != CResourcesAtPlanet(lppl, lppl->iPlayer);
+        rglResPlr[lppl->iPlayer] += CResourcesAtPlanet(lppl, lppl->iPlayer);
+    }
+    TEST_CHECK_(cBad == 0, "%d table entries differ from the scalar helpers", cBad);
+    TEST_CHECK(memcmp(rglResPlr, vecon.rglResPlr, sizeof(rglResPlr)) == 0);
+    TEST_CHECK(rglResPlr[0] > 0 && rglResPlr[1] > 0);
+
+    /* mining through the table leaves the planets exactly as the scalar path */
+    MineMinerals();
+    lpPlanets = rgplScalar;
+    for (int ipl = 0; ipl < cpl; ipl++)
+    {
+        if (rgplScalar[ipl].iPlayer != -1 && rgplScalar[ipl].rgwtMin[3] != 0)
+        {
+            EstMineralsMined(&rgplScalar[ipl], rglQuan, -1, 1);
+        }
+    }
+    TEST_CHECK(memcmp(rgplScalar, rgplBatch, sizeof(rgplBatch)) == 0);
+    int32_t lMined = 0;
+    for (int ipl = 0; ipl < cpl; ipl++)
+    {
+        lMined += rgplBatch[ipl].rgwtMin[0];
+    }
+    TEST_CHECK_(lMined > 0, "nothing was mined");
+
+    /* a planet changing hands or losing colonists without anyone calling
+     * InvalidateEconTable still gets fresh numbers */
+    lpPlanets = rgplBatch;
+    TEST_CHECK(FBuildEconTable(&vecon));
+    rgplBatch[1].iPlayer = 1;
+    rgplBatch[1].rgwtMin[3] = 5000;
+    rgplBatch[4].rgwtMin[3] /= 3;
+    TEST_CHECK(FBuildEconTable(&vecon));
+    TEST_CHECK(vecon.rgcRes[1] == CResourcesAtPlanet(&rgplBatch[1], 1) && vecon.rgcRes[1] > 0);
+    TEST_CHECK(vecon.rgcRes[4] == CResourcesAtPlanet(&rgplBatch[4], rgplBatch[4].iPlayer));
+
+    FreeEconSnap(&vecon);
+    FreeHabCache();
+    lpPlanets = lpPlanetsOld;
+    cPlanet = cPlanetOld;
+    game.cPlanMax = cPlanMaxOld;
+    gd.fGeneratingTurn = fGenOld;
+    memcpy(rgplr, rgplrOld, sizeof(rgplrOld));
+}
+
+static void set_prod(PROD *pprod, int grobj, int iItem, int cItem)
+{
+    memset(pprod, 0, sizeof(PROD));
+    pprod->grobj = (uint32_t)grobj;
+    pprod->iItem = (uint32_t)iItem;
+    pprod->cItem = (uint32_t)cItem;
+}
+
+static void test_ProdEta_follows_queue_edits(void)
+{
+    static PLANET rgpl[4];
+    static union
+    {
+        PLPROD plprod;
+        uint8_t rgb[sizeof(PLPROD) + 8 * sizeof(PROD)];
+    } q;
+    PLAYER rgplrOld[1];
+    PLANET *lpPlanetsOld = lpPlanets;
+    int16_t cPlanetOld = cPlanet;
+    int16_t cPlanMaxOld = game.cPlanMax;
+    int16_t cPlayerOld = game.cPlayer;
+    int16_t fGenOld = gd.fGeneratingTurn;
+    int16_t iFirst;
+    int16_t iLast;
+    int16_t cRes;
+    char *psz;
+
+    memcpy(rgplrOld, rgplr, sizeof(rgplrOld));
+    set_player_env(0, 50, 15, 85, 85);
+    set_player_growth(0, 1, 15, 0, 0);
+    rgplr[0].rgAttr[0] = 10;
+    rgplr[0].rgAttr[1] = 10;
+    rgplr[0].rgAttr[3] = 10;
+    rgplr[0].rgAttr[4] = 10;
+    rgplr[0].rgAttr[6] = 10;
+    rgplr[0].pctResearch = 15;
+    gd.fGeneratingTurn = 0;
+
+    memset(rgpl, 0, sizeof(rgpl));
+    for (int ipl = 0; ipl < 4; ipl++)
+    {
+        rgpl[ipl].id = (int16_t)ipl;
+        rgpl[ipl].iPlayer = ipl == 2 ? 0 : -1;
+        for (int i = 0; i < 3; i++)
+        {
+            rgpl[ipl].rgEnvVar[i] = 50;
+            rgpl[ipl].rgMinConc[i] = 60;
+        }
+    }
+    rgpl[2].rgwtMin[3] = 25000;
+    rgpl[2].cMines = 50;
+    rgpl[2].cFactories = 100;
+    lpPlanets = rgpl;
+    cPlanet = 4;
+    game.cPlanMax = 4;
+    game.cPlayer = 1;
+
+    memset(&q, 0, sizeof(q));
+    q.plprod.cbItem = sizeof(PROD);
+    q.plprod.iprodMax = 8;
+    q.plprod.iprodMac = 1;
+    set_prod(&q.plprod.rgprod[0], 1, 3, 1); /* auto alchemy, last in the queue */
+    rgpl[2].lpplprod = &q.plprod;
+
+    /* negative items ask for the first year's resources */
+    cRes = CResourcesAtPlanet(&rgpl[2], 0);
+    EstimateItemProdSched(&rgpl[2], NULL, -1, &iFirst, &iLast);
+    TEST_CHECK_(iFirst == cRes, "resources %d, want %d", iFirst, cRes);
+    EstimateItemProdSched(&rgpl[2], NULL, -2, &iFirst, &iLast);
+    TEST_CHECK_(iFirst == cRes - cRes * 15 / 100, "resources %d after research", iFirst);
+
+    EstimateItemProdSched(&rgpl[2], NULL, 0, &iFirst, &iLast);
+    TEST_CHECK_(iFirst != -1, "alchemy at the end of the queue gets an ETA (%d)", iFirst);
+
+    /* anything appended behind alchemy turns it into a modifier with no ETA */
+    set_prod(&q.plprod.rgprod[1], 2, 5, 3);
+    q.plprod.iprodMac = 2;
+    EstimateItemProdSched(&rgpl[2], NULL, 0, &iFirst, &iLast);
+    TEST_CHECK_(iFirst == -1 && iLast == -1, "alchemy ahead of an item: %d/%d", iFirst, iLast);
+    psz = PszProductionETA(&rgpl[2], NULL, 0, NULL, NULL);
+    TEST_CHECK(strcmp(psz, PszGetCompressedString(idsSkipped)) == 0);
+
+    /* drop it again and the answer comes back */
+    q.plprod.iprodMac = 1;
+    EstimateItemProdSched(&rgpl[2], NULL, 0, &iFirst, &iLast);
+    TEST_CHECK_(iFirst != -1, "alchemy is last again (%d)", iFirst);
+
+    /* items past the end never finish */
+    EstimateItemProdSched(&rgpl[2], NULL, 5, &iFirst, &iLast);
+    TEST_CHECK(iFirst == 100 && iLast == 100);
+    TEST_CHECK(strcmp(PszProductionETA(&rgpl[2], NULL, 5, NULL, NULL), PszGetCompressedString(idsNever)) == 0);
+
+    /* a planet change is noticed without being told */
+    rgpl[2].cFactories = 200;
+    EstimateItemProdSched(&rgpl[2], NULL, -1, &iFirst, &iLast);
+    TEST_CHECK_(iFirst == CResourcesAtPlanet(&rgpl[2], 0) && iFirst != cRes, "resources %d after building", iFirst);
+
+    FreeProdEtaCache();
+    FreeHabCache();
+    lpPlanets = lpPlanetsOld;
+    cPlanet = cPlanetOld;
+    game.cPlanMax = cPlanMaxOld;
+    game.cPlayer = cPlayerOld;
+    gd.fGeneratingTurn = fGenOld;
+    memcpy(rgplr, rgplrOld, sizeof(rgplrOld));
+}
+
+/* CBuildProdItem is still a stub that builds nothing, so every ETA would be
+ * decided in the first year. This one pays 150 resources per item for item
+ * kind 0, 300 for kind 1 and so on, and stops the year when it runs dry. */
+static int cBuildTest;
+
+static int16_t build_prod_test(PLANET *lppl, PROD *lpprod, PROD *pprodPartial, int32_t *rgRes, int16_t fAlchemy,
+                              int16_t *pmdStatus, int16_t fCalcOnly)
+{
+    int32_t cost = 150 * ((int32_t)lpprod->iItem + 1);
+    int32_t c = rgRes[3] / cost;
+
+    (void)lppl;
+    (void)pprodPartial;
+    (void)fAlchemy;
+    (void)fCalcOnly;
+    cBuildTest++;
+    if (c > (int32_t)lpprod->cItem)
+    {
+        c = lpprod->cItem;
+    }
+    rgRes[3] -= c * cost;
+    lpprod->cItem -= (uint32_t)c;
+    *pmdStatus = lpprod->cItem == 0 ? 0 : 5;
+    return (int16_t)c;
+}
+
+/* Every item's ETA from one simulation. */
+static void get_eta_queue(PLANET *lppl, int16_t *rgFirst, int16_t *rgLast)
+{
+    PRODETA *ppe = LpprodetaSimulate(lppl, NULL);
+
+    TEST_ASSERT(ppe != NULL);
+    for (int16_t i = 0; i < lppl->lpplprod->iprodMac; i++)
+    {
+        GetProdEtaItem(ppe, i, &rgFirst[i], &rgLast[i]);
+    }
+}
+
+static void test_ProdEta_resume_matches_fresh_walk(void)
+{
+    static PLANET rgpl[3];
+    static union
+    {
+        PLPROD plprod;
+        uint8_t rgb[sizeof(PLPROD) + 8 * sizeof(PROD)];
+    } q;
+    static const int rgcItem[6] = {6, 4, 9, 3, 7, 5};
+    PLAYER rgplrOld[1];
+    PLANET *lpPlanetsOld = lpPlanets;
+    int16_t cPlanetOld = cPlanet;
+    int16_t cPlanMaxOld = game.cPlanMax;
+    int16_t cPlayerOld = game.cPlayer;
+    int16_t fGenOld = gd.fGeneratingTurn;
+    int16_t rgFirst[6], rgLast[6];
+    int16_t rgFirstFresh[6], rgLastFresh[6];
+    int cResumed, cFresh, cpassFresh;
+    static uint8_t rgbShdef[16 * 0x93];
+    SHDEF *lpshdefOld = rglpshdef[0];
+
+    memcpy(rgplrOld, rgplr, sizeof(rgplrOld));
+    set_player_env(0, 50, 15, 85, 85);
+    set_player_growth(0, 1, 15, 0, 0);
+    rgplr[0].rgAttr[0] = 10;
+    rgplr[0].rgAttr[1] = 10;
+    rgplr[0].rgAttr[3] = 10;
+    rgplr[0].rgAttr[4] = 10;
+    rgplr[0].rgAttr[6] = 10;
+    rgplr[0].pctResearch = 15;
+    gd.fGeneratingTurn = 0;
+
+    memset(rgpl, 0, sizeof(rgpl));
+    for (int ipl = 0; ipl < 3; ipl++)
+    {
+        rgpl[ipl].id = (int16_t)ipl;
+        rgpl[ipl].iPlayer = ipl == 2 ? 0 : -1;
+        for (int i = 0; i < 3; i++)
+        {
+            rgpl[ipl].rgEnvVar[i] = 50;
+            rgpl[ipl].rgMinConc[i] = 60;
+        }
+    }
+    rgpl[2].rgwtMin[3] = 25000;
+    rgpl[2].cMines = 50;
+    rgpl[2].cFactories = 100;
+    lpPlanets = rgpl;
+    cPlanet = 3;
+    game.cPlanMax = 3;
+    game.cPlayer = 1;
+
+    memset(&q, 0, sizeof(q));
+    q.plprod.cbItem = sizeof(PROD);
+    q.plprod.iprodMax = 8;
+    q.plprod.iprodMac = 6;
+    for (int i = 0; i < 6; i++)
+    {
+        set_prod(&q.plprod.rgprod[i], 2, i, rgcItem[i]);
+    }
+    rgpl[2].lpplprod = &q.plprod;
+    lpfnEtaBuildProd = build_prod_test;
+
+    get_eta_queue(&rgpl[2], rgFirst, rgLast);
+    TEST_CHECK_(rgLast[5] > 10 && rgLast[5] < 100, "the queue takes several years (%d)", rgLast[5]);
+
+    /* edit each item in turn; picking up from the checkpoint gives what a
+     * walk from scratch gives, and for later items with less work */
+    for (int k = 0; k < 6; k++)
+    {
+        q.plprod.rgprod[k].cItem += 3;
+        cBuildTest = 0;
+        get_eta_queue(&rgpl[2], rgFirst, rgLast);
+        cResumed = cBuildTest;
+
+        FreeProdEtaCache();
+        cBuildTest = 0;
+        get_eta_queue(&rgpl[2], rgFirstFresh, rgLastFresh);
+        cFresh = cBuildTest;
+        cpassFresh = LpprodetaSimulate(&rgpl[2], NULL)->cpass;
+
+        TEST_CHECK(memcmp(rgFirst, rgFirstFresh, sizeof(rgFirst)) == 0);
+        TEST_CHECK(memcmp(rgLast, rgLastFresh, sizeof(rgLast)) == 0);
+        TEST_MSG("edit at %d: item 5 %d..%d resumed, %d..%d fresh", k, rgFirst[5], rgLast[5], rgFirstFresh[5],
+                 rgLastFresh[5]);
+        TEST_CHECK(cpassFresh == rgLastFresh[5]);
+        TEST_CHECK_(k < 3 || cResumed < cFresh, "edit at %d: %d builds resumed, %d fresh", k, cResumed, cFresh);
+    }
+
+    /* dropping the last item and appending one resume too */
+    q.plprod.iprodMac = 5;
+    get_eta_queue(&rgpl[2], rgFirst, rgLast);
+    FreeProdEtaCache();
+    get_eta_queue(&rgpl[2], rgFirstFresh, rgLastFresh);
+    TEST_CHECK(memcmp(rgFirst, rgFirstFresh, 5 * sizeof(int16_t)) == 0);
+    TEST_CHECK(memcmp(rgLast, rgLastFresh, 5 * sizeof(int16_t)) == 0);
+    q.plprod.iprodMac = 6;
+    get_eta_queue(&rgpl[2], rgFirst, rgLast);
+    FreeProdEtaCache();
+    get_eta_queue(&rgpl[2], rgFirstFresh, rgLastFresh);
+    TEST_CHECK(memcmp(rgFirst, rgFirstFresh, sizeof(rgFirst)) == 0);
+    TEST_CHECK(memcmp(rgLast, rgLastFresh, sizeof(rgLast)) == 0);
+
+    /* nothing changed: nothing is simulated; a design edit starts over */
+    rglpshdef[0] = (SHDEF *)rgbShdef;
+    get_eta_queue(&rgpl[2], rgFirst, rgLast);
+    cBuildTest = 0;
+    get_eta_queue(&rgpl[2], rgFirst, rgLast);
+    TEST_CHECK(cBuildTest == 0);
+    rgbShdef[5 * 0x93 + 10]++;
+    get_eta_queue(&rgpl[2], rgFirst, rgLast);
+    TEST_CHECK_(cBuildTest == cFresh, "%d builds after a design edit, %d fresh", cBuildTest, cFresh);
+    rglpshdef[0] = lpshdefOld;
+
+    lpfnEtaBuildProd = CBuildProdItem;
+    FreeProdEtaCache();
+    FreeHabCache();
+    lpPlanets = lpPlanetsOld;
+    cPlanet = cPlanetOld;
+    game.cPlanMax = cPlanMaxOld;
+    game.cPlayer = cPlayerOld;
+    gd.fGeneratingTurn = fGenOld;
+    memcpy(rgplr, rgplrOld, sizeof(rgplrOld));
+}
+
+static void test_SkipFileXor_matches_stepping(void)
+{
+    static const int32_t rgcStep[] = {0, 1, 16, 17, 1000, 123457};
+    int32_t lA1, lA2, lB1, lB2;
+
+    for (size_t i = 0; i < sizeof(rgcStep) / sizeof(rgcStep[0]); i++)
+    {
+        SetFileXorStream(0x1234567 + (int32_t)i, (int16_t)(i * 301), 7, 3, 0);
+        GetFileSeeds(&lA1, &lA2);
+        for (int32_t n = 0; n < rgcStep[i]; n++)
+        {
+            (void)LGetNextFileXor();
+        }
+        GetFileSeeds(&lB1, &lB2);
+        SetFileSeeds(lA1, lA2);
+        SkipFileXor(rgcStep[i]);
+        GetFileSeeds(&lA1, &lA2);
+        TEST_CHECK_(lA1 == lB1 && lA2 == lB2, "skip %d", (int)rgcStep[i]);
+    }
+}
+
+enum { cplLazy = 800 };
+
+/* One planet record the way WritePlanet lays it out. Every fourth planet
+ * is owned and fully known, the rest only partly. */
+static int16_t encode_planet(int id, uint8_t *pb, int16_t *prt)
+{
+    uint8_t *pbStart = pb;
+    int iplr = id % 4 == 0 ? id % 16 : 31;
+    uint16_t w0 = (uint16_t)(id | (iplr << 11));
+    uint16_t w;
+
+    if (id % 4 != 0 && id % 3 != 0)
+    {
+        w = 1; /* seen, nothing more */
+        *prt = 0x0e;
+        memcpy(pb, &w0, 2);
+        memcpy(pb + 2, &w, 2);
+        return 4;
+    }
+    w = (uint16_t)(7 | (1 << 13));
+    if (iplr != 31)
+    {
+        w |= (1 << 8) | (1 << 9) | (1 << 11) | (1 << 14);
+    }
+    if (id % 5 == 0)
+    {
+        w |= 1 << 10; /* terraformed */
+    }
+    *prt = 0x0d;
+    memcpy(pb, &w0, 2);
+    memcpy(pb + 2, &w, 2);
+    pb += 4;
+    *pb++ = 0x15;
+    for (int i = 0; i < 3; i++)
+    {
+        *pb++ = (uint8_t)(id * 3 + i);
+    }
+    for (int i = 0; i < 3; i++)
+    {
+        *pb++ = (uint8_t)(id + i * 7);
+    }
+    for (int i = 0; i < 3; i++)
+    {
+        *pb++ = (uint8_t)((id + i * 11) % 101);
+    }
+    if (w & (1 << 10))
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            *pb++ = (uint8_t)((id * 2 + i) % 101);
+        }
+    }
+    if (iplr != 31)
+    {
+        *pb++ = (uint8_t)id;
+        *pb++ = 0x12;
+    }
+    *pb++ = 0x79; /* byte, word, dword, byte */
+    *pb++ = (uint8_t)id;
+    *pb++ = 0x34;
+    *pb++ = 0x12;
+    memcpy(pb, &(int32_t){100000 + id}, 4);
+    pb += 4;
+    *pb++ = 9;
+    if (iplr != 31)
+    {
+        for (int i = 0; i < 8; i++)
+        {
+            *pb++ = (uint8_t)(id + i);
+        }
+        memcpy(pb, &(int32_t){0x3000 + id}, 4);
+        pb += 4;
+        memcpy(pb, &(uint16_t){(uint16_t)(id / 2)}, 2);
+        pb += 2;
+    }
+    return (int16_t)(pb - pbStart);
+}
+
+/* BOF, then planets in id order with a fleet-sized record now and then.
+ * rgplEager comes in as what lpPlanets held before the load (the history
+ * planets when fPreInited, which also leaves some planets out of the
+ * file) and goes out as what an eager load of iPlayer's file makes of it. */
+static FILE *write_planet_file(PLANET *rgplEager, int16_t iPlayer, int16_t fPreInited)
+{
+    FILE *fp = tmpfile();
+    RTBOF bof;
+    uint8_t rgb[128];
+    int16_t rt;
+    int16_t cb;
+
+    init_bof(&bof, game.lid, game.turn, 0, 321);
+    put_bof(fp, &bof);
+
+    for (int id = 0; id < cplLazy; id++)
+    {
+        if (fPreInited && id % 11 == 10)
+        {
+            continue;
+        }
+        cb = encode_planet(id, rgb, &rt);
+
+        /* what an eager load makes of it */
+        hdrCur.rt = (uint16_t)rt;
+        hdrCur.cb = (uint16_t)cb;
+        memcpy(rgbCur, rgb, cb);
+        TEST_ASSERT(FReadPlanet(iPlayer, &rgplEager[id], 0, fPreInited));
+
+        put_rt(fp, rt, cb, rgb, 1);
+        if (id % 7 == 0)
+        {
+            memset(rgb, id, 23);
+            put_rt(fp, 0x10, 23, rgb, 1);
+        }
+    }
+    put_eof(fp);
+    rewind(fp);
+    return fp;
+}
+
+static void test_lazy_planets_match_eager_load(void)
+{
+    static PLANET rgplEager[cplLazy];
+    static PLANET rgplLazy[cplLazy];
+    PLANET *lpPlanetsSav = lpPlanets;
+    int16_t cPlanetSav = cPlanet;
+    int16_t cPlanMaxSav = game.cPlanMax;
+    int cBad = 0;
+
+    memset(rgplEager, 0, sizeof(rgplEager));
+    game.turn = 30;
+    game.cPlanMax = cplLazy;
+    lpPlanets = rgplLazy;
+    cPlanet = cplLazy;
+
+    TEST_ASSERT(FIndexPlanetRecords(&vplidx, write_planet_file(rgplEager, -1, 0), -1, 0, 0));
+    TEST_CHECK(vplidx.cplLoaded == 0);
+
+    /* a single planet report decodes one planet */
+    TEST_CHECK(memcmp(LpplFromId(517), &rgplEager[517], sizeof(PLANET)) == 0);
+    TEST_CHECK(vplidx.cplLoaded == 1);
+
+    for (int i = 0; i < cplLazy; i++)
+    {
+        int id = (i * 373) % cplLazy;
+
+        cBad += memcmp(LpplFromId((int16_t)id), &rgplEager[id], sizeof(PLANET)) != 0;
+    }
+    TEST_CHECK_(cBad == 0, "%d planets differ", cBad);
+    TEST_CHECK(FLoadAllIndexedPlanets(&vplidx));
+    TEST_CHECK(rgplLazy[4].fStarbase && rgplLazy[4].idRoute == 2 && rgplLazy[4].rgwtMin[2] == 100004);
+
+    FreePlanetIndex(&vplidx);
+    lpPlanets = lpPlanetsSav;
+    cPlanet = cPlanetSav;
+    game.cPlanMax = cPlanMaxSav;
+}
+
+/* A player's own view over the history planets, the way FLoadGame reads
+ * it: fFirstYear follows the history, unsent planets keep theirs. */
+static void test_lazy_player_view_matches_eager_load(void)
+{
+    static PLANET rgplHist[cplLazy];
+    static PLANET rgplEager[cplLazy];
+    static PLANET rgplLazy[cplLazy];
+    PLANET *lpPlanetsSav = lpPlanets;
+    int16_t cPlanetSav = cPlanet;
+    int16_t cPlanMaxSav = game.cPlanMax;
+    int cBad = 0;
+
+    game.turn = 30;
+    game.cPlanMax = cplLazy;
+    memset(rgplHist, 0, sizeof(rgplHist));
+    for (int id = 0; id < cplLazy; id++)
+    {
+        rgplHist[id].id = (int16_t)id;
+        rgplHist[id].iPlayer = -1;
+        rgplHist[id].det = (uint16_t)(id % 3 == 0 ? 5 : 1);
+        rgplHist[id].fFirstYear = id % 3 != 2;
+        rgplHist[id].turn = (int16_t)(id % 3 == 0 ? game.turn : game.turn - 4);
+        rgplHist[id].rgwtMin[3] = id;
+    }
+    memcpy(rgplEager, rgplHist, sizeof(rgplHist));
+    memcpy(rgplLazy, rgplHist, sizeof(rgplHist));
+    lpPlanets = rgplLazy;
+    cPlanet = cplLazy;
+
+    TEST_ASSERT(FIndexPlanetRecords(&vplidx, write_planet_file(rgplEager, 0, 1), 0, 0, 1));
+    TEST_CHECK(memcmp(&rgplLazy[32], &rgplHist[32], sizeof(PLANET)) == 0);
+    for (int i = 0; i < cplLazy; i++)
+    {
+        int id = (i * 373) % cplLazy;
+
+        cBad += memcmp(LpplFromId((int16_t)id), &rgplEager[id], sizeof(PLANET)) != 0;
+    }
+    TEST_CHECK_(cBad == 0, "%d planets differ", cBad);
+    TEST_CHECK(rgplLazy[3].fFirstYear && !rgplLazy[4].fFirstYear && !rgplLazy[5].fFirstYear);
+    TEST_CHECK(rgplLazy[32].turn == game.turn - 4 && rgplLazy[32].rgwtMin[3] == 32);
+
+    FreePlanetIndex(&vplidx);
+    lpPlanets = lpPlanetsSav;
+    cPlanet = cPlanetSav;
+    game.cPlanMax = cPlanMaxSav;
+}
+
 TEST_LIST = {
     {"PctPlanetDesirability table (Stars defaults)", test_PctPlanetDesirability_table_stars_defaults},
+    {"cached/batched habitability matches PctPlanetDesirability", test_HabCache_matches_scalar},
+    {"economy snapshot gathers the same growth inputs as ChgPopFromPlanet", test_EconSnap_matches_scalar},
+    {"population growth matches hand-computed values", test_growth_matches_hand_computed},
+    {"AR max population reads the starbase at the 0x93 stride", test_MaxPop_reads_starbase_at_file_stride},
+    {"economy table matches the per-planet helpers", test_EconTable_matches_scalar},
+    {"production ETAs follow queue and planet edits", test_ProdEta_follows_queue_edits},
+    {"resumed production ETAs match a fresh walk", test_ProdEta_resume_matches_fresh_walk},
+    {"SkipFileXor jumps like stepping the stream", test_SkipFileXor_matches_stepping},
+    {"lazily decoded planets match an eager load", test_lazy_planets_match_eager_load},
+    {"a lazy player view matches an eager load", test_lazy_player_view_matches_eager_load},
     {NULL, NULL}};
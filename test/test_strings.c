@@ -0,0 +1,52 @@
+#include "acutest.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "types.h"
+#include "strings.h" /* PszGetCompressedString */
+
+#ifndef STARS_STRINGS_UNCOMPRESSED
+/* the reference tables, extracted from the executable */
+#include "strings_uncompressed.c"
+#else
+extern const char *const aSTRUncompressed[];
+#endif
+
+static void test_strings_known_ids(void)
+{
+    TEST_CHECK(strcmp(PszGetCompressedString(idsNoGameLoaded), "No game currently loaded.") == 0);
+    TEST_CHECK(strcmp(PszGetCompressedString(idsCantOpenFile), "Can't open file \\w.") == 0);
+    TEST_CHECK(strcmp(PszGetCompressedString(idsKurkonian), aSTRUncompressed[idsKurkonian]) == 0);
+}
+
+static void test_strings_match_uncompressed(void)
+{
+    int16_t ids;
+
+    for (ids = 0; ids < (int16_t)sizeof(acSTR); ids++)
+    {
+        TEST_CHECK(strcmp(PszGetCompressedString(ids), aSTRUncompressed[ids]) == 0);
+        TEST_MSG("ids %d: got \"%s\"", ids, PszGetCompressedString(ids));
+    }
+}
+
+static void test_strings_stable_pointers(void)
+{
+    char *psz1;
+    char *psz2;
+
+    /* callers hold several strings at once (formatting, dialogs) */
+    psz1 = PszGetCompressedString(idsOutOfMemory);
+    psz2 = PszGetCompressedString(idsGameFileCorrupt);
+    TEST_CHECK(psz1 != psz2);
+    TEST_CHECK(PszGetCompressedString(idsOutOfMemory) == psz1);
+    TEST_CHECK(strcmp(psz1, aSTRUncompressed[idsOutOfMemory]) == 0);
+}
+
+TEST_LIST = {
+    {"strings_known_ids", test_strings_known_ids},
+    {"strings_match_uncompressed", test_strings_match_uncompressed},
+    {"strings_stable_pointers", test_strings_stable_pointers},
+    {NULL, NULL},
+};
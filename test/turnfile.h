@@ -0,0 +1,62 @@
+/* turnfile.h
+ *
+ * Shared fixture for tests that write a Stars! file to a tmpfile: record
+ * headers, the BOF and the file XOR stream it seeds.
+ */
+
+#ifndef TURNFILE_H_
+#define TURNFILE_H_
+
+#include <stdio.h>
+#include <string.h>
+
+#include "types.h"
+#include "../utilgen.h"
+
+/* One record: its HDR, then cb bytes of pb, encrypted when fXor is set.
+ * pb itself is left alone. */
+static void put_rt(FILE *fp, int rt, int cb, const uint8_t *pb, int fXor)
+{
+    HDR hdr;
+    uint32_t rgl[1024 / 4];
+
+    hdr.rt = (uint16_t)rt;
+    hdr.cb = (uint16_t)cb;
+    if (cb > 0)
+    {
+        memcpy(rgl, pb, cb);
+    }
+    if (fXor)
+    {
+        XorFileBuf((uint8_t *)rgl, (int16_t)cb);
+    }
+    fwrite(&hdr, sizeof(HDR), 1, fp);
+    fwrite(rgl, 1, cb, fp);
+}
+
+/* A 2.60 BOF; callers adjust the rest before put_bof. */
+static void init_bof(RTBOF *pbof, int32_t lidGame, int turn, int iPlayer, int lSalt)
+{
+    memset(pbof, 0, sizeof(RTBOF));
+    memcpy(pbof->rgid, "J3J3", 4);
+    pbof->lidGame = lidGame;
+    pbof->verMajor = 2;
+    pbof->verMinor = 0x3c;
+    pbof->turn = (uint16_t)turn;
+    pbof->iPlayer = (int16_t)iPlayer;
+    pbof->lSaltTime = (int16_t)lSalt;
+}
+
+/* Write the BOF in the clear and seed the XOR stream for what follows. */
+static void put_bof(FILE *fp, RTBOF *pbof)
+{
+    put_rt(fp, 8, sizeof(RTBOF), (uint8_t *)pbof, 0);
+    SetFileXorStream(pbof->lidGame, pbof->lSaltTime, (int16_t)pbof->turn, pbof->iPlayer, 0);
+}
+
+static void put_eof(FILE *fp)
+{
+    put_rt(fp, 0, 0, NULL, 0);
+}
+
+#endif /* TURNFILE_H_ */
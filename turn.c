@@ -2,6 +2,7 @@
 #include "types.h"
 
 #include "turn.h"
+#include "aictx.h"
 
 /* globals */
 int16_t rgiWarpSafe[3] = {4, 6, 5};
@@ -75,8 +76,18 @@ int16_t FGenerateTurn(void)
     /* label FreeStuffUp @ MEMORY_TURN:0x16a6 */
     /* label LUnmark @ MEMORY_TURN:0x0a8e */
 
+    /* the computer players write their orders before anything is run,
+     * starting from the world models they kept last turn */
+    fSuccess = 0;
+    if (!FReadAiWorlds() || !FDoAiTurns() || !FWriteAiWorlds())
+    {
+        goto FreeStuffUp;
+    }
+
     /* TODO: implement */
-    return 0;
+
+FreeStuffUp:
+    return fSuccess;
 }
 
 void MoveFleets(void)
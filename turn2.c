@@ -2,6 +2,10 @@
 #include "types.h"
 
 #include "turn2.h"
+#include "globals.h"
+#include "econsnap.h"
+#include "mine.h"
+#include "util.h"
 
 /* functions */
 void Produce(void)
@@ -34,6 +38,9 @@ void Produce(void)
     /* label LCantBuildP2 @ MEMORY_TURN2:0x0628 */
 
     /* TODO: implement */
+
+    /* production changes populations and factories */
+    InvalidateEconTable(&vecon);
 }
 
 void CreateBackupDir(void)
@@ -102,6 +109,9 @@ void DropColonists(void)
     /* label WritePlanet @ MEMORY_TURN2:0x42fc */
 
     /* TODO: implement */
+
+    /* invasions change owners and populations */
+    InvalidateEconTable(&vecon);
 }
 
 void TossNonAutoBuildItems(PLANET *lppl)
@@ -182,7 +192,19 @@ void UpdatePopulations(void)
     /* block (block) @ MEMORY_TURN2:0x5278 */
     /* label NextPlanet @ MEMORY_TURN2:0x5254 */
 
-    /* TODO: implement */
+    if (FBuildEconSnap(&vecon))
+    {
+        CalcEconPopGrowth(&vecon);
+        ApplyEconPopGrowth(&vecon);
+        return;
+    }
+
+    /* Out of memory for the snapshot: one planet at a time. */
+    lpplMac = lpPlanets + cPlanet;
+    for (lppl = lpPlanets; lppl < lpplMac; lppl++)
+    {
+        ChgPopFromPlanet(lppl, 1);
+    }
 }
 
 void SweepForMines(void)
@@ -339,8 +361,28 @@ void MineMinerals(void)
     int32_t rglQuan[3];
     PLANET * lppl;
     PLANET * lpplMac;
-
-    /* TODO: implement */
+    int16_t ipl;
+
+    if (!FBuildEconTable(&vecon))
+    {
+        lpplMac = lpPlanets + cPlanet;
+        for (lppl = lpPlanets; lppl < lpplMac; lppl++)
+        {
+            if (lppl->iPlayer != -1 && lppl->rgwtMin[3] != 0)
+            {
+                EstMineralsMined(lppl, rglQuan, -1, 1);
+            }
+        }
+        return;
+    }
+    for (ipl = 0; ipl < vecon.cpl; ipl++)
+    {
+        if (vecon.rgiMineEff[ipl] == 0)
+        {
+            continue;
+        }
+        MinePlanetMinerals(&lpPlanets[ipl], rglQuan, vecon.rgcMinesOp[ipl], vecon.rgiMineEff[ipl], 0, 1);
+    }
 }
 
 int16_t FBuildObject(PLANET *lppl, int16_t grobj, int16_t iItem, int16_t cBuilt, int32_t *rgMinerals)
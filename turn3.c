@@ -2,6 +2,7 @@
 #include "types.h"
 
 #include "turn3.h"
+#include "econsnap.h"
 
 /* functions */
 void SatisfyOrders(int16_t iPass)
@@ -94,4 +95,7 @@ void SatisfyOrders(int16_t iPass)
     /* label LDoMerge @ MEMORY_TURN:0x91e2 */
 
     /* TODO: implement */
+
+    /* colonizing and unloading colonists change owners and populations */
+    InvalidateEconTable(&vecon);
 }
@@ -5,6 +5,10 @@
 #include "parts.h"
 #include "globals.h"
 #include "strings.h"
+#include "planet.h"
+#include "race.h"
+#include "idtbl.h"
+#include "plidx.h"
 
 /* globals */
 uint32_t rgcrDrawStars[5] = {0x007f7f7f, 0x00ffffff, 0x000000ff, 0x0000ff00, 0x00ff0000};
@@ -76,8 +80,8 @@ FLEET *LpflFromId(int16_t idFleet)
     int16_t iplrCur;
     int16_t iHi;
 
-    /* TODO: implement */
-    return NULL;
+    /* fleet ids are dense (ifl:9 iplr:4): direct index, see idtbl.h */
+    return LpflLookupId(&vidtbl, idFleet);
 }
 
 PLANET *LpplFromId(int16_t idPlanet)
@@ -93,6 +97,12 @@ PLANET *LpplFromId(int16_t idPlanet)
         return NULL;
     }
 
+    /* planets still in the file are decoded on first use */
+    if (vplidx.fValid)
+    {
+        return LpplIndexedPlanet(&vplidx, idPlanet);
+    }
+
     /* If we have a dense array of all planets loaded, direct index. */
     if (cPlanet == game.cPlanMax)
     {
@@ -131,8 +141,7 @@ THING *LpthFromId(int16_t idth)
     THING *lpth;
     THING *lpthMac;
 
-    /* TODO: implement */
-    return NULL;
+    return LpthLookupId(&vidtbl, idth);
 }
 
 int32_t LCalcFuelGainFromRamScoops(FLEET *lpfl, int16_t iWarp, int32_t dTravel)
@@ -862,8 +871,124 @@ int32_t ChgPopFromPlanet(PLANET *lppl, int16_t fUpdate)
     /* block (block) @ MEMORY_UTIL:0x72b1 */
     /* label LUpdateAndExit @ MEMORY_UTIL:0x756b */
 
-    /* TODO: implement */
-    return 0;
+    lPopOld = lppl->rgwtMin[3];
+    if (lppl->iPlayer == -1 || lPopOld == 0)
+    {
+        return 0;
+    }
+    pctDesire = PctPlanetDesirability(lppl, lppl->iPlayer);
+    lMaxPop = pctDesire < 0 ? 0 : CalcPlanetMaxPop(lppl->id, lppl->iPlayer);
+    DeltaCur = lppl->iDeltaPop;
+    lPopInc = ChgPopFromGrowth(lPopOld, lMaxPop, pctDesire, pctDesire < 0 ? 0 : PctTrueMaxGrowth(lppl->iPlayer),
+                               (int16_t)(gd.fGeneratingTurn && rgplr[lppl->iPlayer].fCheater), &DeltaCur);
+    if (fUpdate)
+    {
+        lppl->iDeltaPop = (uint8_t)DeltaCur;
+        lppl->rgwtMin[3] = lPopOld + lPopInc;
+    }
+    return lPopInc;
+}
+
+/* ChgPopFromPlanet's arithmetic with everything it looks up passed in, so
+ * the economy snapshot can run it over its arrays. *pDeltaCur is the
+ * fractional population carried between turns and is updated in place.
+ * Returns the change in population. */
+int32_t ChgPopFromGrowth(int32_t lPopOld, int32_t lMaxPop, int16_t pctDesire, int16_t pctGrow, int16_t fHalfGrow,
+                         int16_t *pDeltaCur)
+{
+    int32_t lPopIncDelta;
+    int16_t DeltaCur;
+    int32_t pctGrow100;
+    int32_t lPopInc100;
+    int32_t lPopInc;
+    int32_t pctRetard;
+    int32_t pctFull;
+
+    DeltaCur = *pDeltaCur;
+    if (pctDesire < 0)
+    {
+        /* Hostile world: lose a tenth of a percent per point below zero. */
+        lPopInc100 = lPopOld * -pctDesire / 10;
+        if (lPopInc100 < 1)
+        {
+            lPopInc100 = 1;
+        }
+        lPopInc = lPopInc100 / 100;
+        lPopIncDelta = lPopInc100 % 100;
+        if (lPopInc == 0 && lPopIncDelta == 0)
+        {
+            lPopIncDelta = 1;
+        }
+        DeltaCur = (int16_t)(DeltaCur - lPopIncDelta);
+        if (DeltaCur < 0)
+        {
+            lPopInc++;
+            DeltaCur += 100;
+        }
+        *pDeltaCur = DeltaCur;
+        return -lPopInc;
+    }
+
+    pctGrow100 = (int16_t)(pctGrow * pctDesire);
+    if (fHalfGrow)
+    {
+        pctGrow100 >>= 1;
+    }
+    if (lMaxPop / 4 < lPopOld)
+    {
+        /* Past a quarter full growth tapers off as (16/9)(1 - full)^2. */
+        pctFull = lMaxPop > 0 ? lPopOld * 1000 / lMaxPop : 0x7fffffff;
+        if (lPopOld < lMaxPop)
+        {
+            pctRetard = (1000 - pctFull) * (1000 - pctFull);
+            if (pctGrow100 < 1000)
+            {
+                pctGrow100 = pctGrow100 * pctRetard / 562500;
+            }
+            else
+            {
+                pctGrow100 = pctGrow100 / 10 * pctRetard / 562500 * 10;
+            }
+        }
+        else
+        {
+            if (lPopOld < lMaxPop + 10)
+            {
+                return 0;
+            }
+            /* Overcrowded: 0.04% die per 1% over capacity, 12% at most. */
+            pctGrow100 = 99 - pctFull / 10;
+            if (pctGrow100 < -300)
+            {
+                pctGrow100 = -300;
+            }
+            pctGrow100 *= 4;
+        }
+    }
+    lPopInc100 = lPopOld * (pctGrow100 / 100);
+    if (lPopInc100 < 10000000)
+    {
+        lPopInc100 = lPopOld * pctGrow100 / 100;
+    }
+    lPopInc = lPopInc100 / 100;
+    lPopIncDelta = lPopInc100 % 100;
+    if (lPopInc == 0 && lPopIncDelta == 0)
+    {
+        lPopIncDelta = 1;
+    }
+    DeltaCur = (int16_t)(DeltaCur + lPopIncDelta);
+    if (DeltaCur >= 100)
+    {
+        lPopInc++;
+        DeltaCur -= 100;
+    }
+    else if (DeltaCur < 0)
+    {
+        lPopInc--;
+        DeltaCur += 100;
+    }
+    *pDeltaCur = DeltaCur;
+    return lPopInc;
 }
 
 int16_t FFleetCanJumpgate(FLEET *lpfl)
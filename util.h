@@ -71,6 +71,7 @@ void DrawPlanetPrintDot(uint16_t hdc, int16_t x, int16_t y, int16_t iSize);
 int16_t GetShdefScannerRange(SHDEF *lpshdef, int16_t iplr, int16_t *pdPlanRange, int16_t *ppctDetect, int16_t *piSteal);                                                   /* MEMORY_UTIL:0x50d0 */
 void ValidateWaypoints(void);                                                                                                                                              /* MEMORY_UTIL:0x68c6 */
 int32_t ChgPopFromPlanet(PLANET *lppl, int16_t fUpdate);                                                                                                                   /* MEMORY_UTIL:0x7082 */
+int32_t ChgPopFromGrowth(int32_t lPopOld, int32_t lMaxPop, int16_t pctDesire, int16_t pctGrow, int16_t fHalfGrow, int16_t *pDeltaCur);
 int16_t FFleetCanJumpgate(FLEET *lpfl);                                                                                                                                    /* MEMORY_UTIL:0x7960 */
 int32_t CalcPlayerScore(int16_t iPlr, SCORE *pscore);                                                                                                                      /* MEMORY_UTIL:0x58a6 */
 int16_t FLookupPlanet(int16_t iPlanet, PLANET *ppl);                                                                                                                       /* MEMORY_UTIL:0x04a6 */
@@ -1,4 +1,6 @@
 
+#include <math.h>
+
 #include "types.h"
 
 #include "utilgen.h"
@@ -446,14 +448,16 @@ void CopyFile(char *szSrc, char *szDst)
     /* TODO: implement */
 }
 
-uint32_t LGetNextFileXor(void)
+/* LGetNextFileXor on seeds of the caller's own, so several file streams
+ * can be read side by side without sharing lFileSeed1/lFileSeed2. */
+uint32_t LGetNextXor(int32_t *plSeed1, int32_t *plSeed2)
 {
     /* Same core generator as Random(), but driven by file seeds and returning raw s1-s2. */
     const uint32_t q1 = 53668u, r1 = 12211u, a1 = 40014u, m1 = 2147483563u; /* 0x7FFFFFAB */
     const uint32_t q2 = 52774u, r2 = 3791u, a2 = 40692u, m2 = 2147483399u;  /* 0x7FFFFF07 */
 
-    int32_t s1 = lFileSeed1;
-    int32_t s2 = lFileSeed2;
+    int32_t s1 = *plSeed1;
+    int32_t s2 = *plSeed2;
 
     /* Update seed 1 */
     {
@@ -477,13 +481,18 @@ uint32_t LGetNextFileXor(void)
         }
     }
 
-    lFileSeed1 = s1;
-    lFileSeed2 = s2;
+    *plSeed1 = s1;
+    *plSeed2 = s2;
 
     /* The decompile returns s1 - s2 without the "z<1 add m1-1" fixup. */
     return (uint32_t)(s1 - s2);
 }
 
+uint32_t LGetNextFileXor(void)
+{
+    return LGetNextXor(&lFileSeed1, &lFileSeed2);
+}
+
 void BoundPoints(RECT *prc, POINT *rgpt, int16_t cpt)
 {
     if (prc == NULL || rgpt == NULL || cpt <= 0)
@@ -590,7 +599,8 @@ void GetFileSeeds(int32_t *pl1, int32_t *pl2)
     *pl2 = lFileSeed2;
 }
 
-void SetFileXorStream(int32_t lid, int16_t lSalt, int16_t turn, int16_t iPlayer, int16_t fCrippled)
+void InitXorSeeds(int32_t *plSeed1, int32_t *plSeed2, int32_t lid, int16_t lSalt, int16_t turn, int16_t iPlayer,
+                  int16_t fCrippled)
 {
     /* Indices derived from salt (two 5-bit fields, then biased into 0..63). */
     uint16_t a = (uint16_t)(lSalt & 0x1F);
@@ -606,21 +616,63 @@ void SetFileXorStream(int32_t lid, int16_t lSalt, int16_t turn, int16_t iPlayer,
     }
 
     /* Seeds come from rgPrimes (sign-extended like the original CWD). */
-    lFileSeed1 = (int32_t)rgPrimes[a];
-    lFileSeed2 = (int32_t)rgPrimes[b];
+    *plSeed1 = (int32_t)rgPrimes[a];
+    *plSeed2 = (int32_t)rgPrimes[b];
 
     /* Advance the stream a small, deterministic number of steps. */
     {
         int16_t n = (int16_t)((((lid & 3) + 1) * ((turn & 3) + 1) * ((iPlayer & 3) + 1)) + fCrippled);
         while (n > 0)
         {
-            (void)LGetNextFileXor();
+            (void)LGetNextXor(plSeed1, plSeed2);
             n--;
         }
     }
 }
 
-void XorFileBuf(uint8_t *rgb, int16_t cb)
+void SetFileXorStream(int32_t lid, int16_t lSalt, int16_t turn, int16_t iPlayer, int16_t fCrippled)
+{
+    InitXorSeeds(&lFileSeed1, &lFileSeed2, lid, lSalt, turn, iPlayer, fCrippled);
+}
+
+static uint32_t LPowMod(uint32_t a, uint32_t n, uint32_t m)
+{
+    uint64_t r = 1;
+    uint64_t b = a;
+
+    while (n != 0)
+    {
+        if (n & 1)
+        {
+            r = r * b % m;
+        }
+        b = b * b % m;
+        n >>= 1;
+    }
+    return (uint32_t)r;
+}
+
+/* Advance the file XOR stream by cStep words, as cStep calls to
+ * LGetNextFileXor would. Each seed is a plain LCG, s' = a^n * s mod m, so
+ * a long skip is a pair of modular powers instead of a loop. */
+void SkipFileXor(int32_t cStep)
+{
+    const uint32_t a1 = 40014u, m1 = 2147483563u;
+    const uint32_t a2 = 40692u, m2 = 2147483399u;
+
+    if (cStep <= 16)
+    {
+        while (cStep-- > 0)
+        {
+            (void)LGetNextFileXor();
+        }
+        return;
+    }
+    lFileSeed1 = (int32_t)((uint64_t)(uint32_t)lFileSeed1 * LPowMod(a1, (uint32_t)cStep, m1) % m1);
+    lFileSeed2 = (int32_t)((uint64_t)(uint32_t)lFileSeed2 * LPowMod(a2, (uint32_t)cStep, m2) % m2);
+}
+
+void XorBufSeeds(uint8_t *rgb, int16_t cb, int32_t *plSeed1, int32_t *plSeed2)
 {
     int32_t *pl = (int32_t *)rgb;
     int32_t *plMac = (int32_t *)(rgb + ((cb >> 2) << 2));
@@ -629,7 +681,7 @@ void XorFileBuf(uint8_t *rgb, int16_t cb)
 
     while (pl < plMac)
     {
-        lPrev = (int32_t)LGetNextFileXor();
+        lPrev = (int32_t)LGetNextXor(plSeed1, plSeed2);
         pl[0] ^= lPrev;
         pl++;
     }
@@ -637,7 +689,7 @@ void XorFileBuf(uint8_t *rgb, int16_t cb)
     if ((cb & 3) != 0)
     {
         pch = (uint8_t *)pl;
-        lPrev = (int32_t)LGetNextFileXor();
+        lPrev = (int32_t)LGetNextXor(plSeed1, plSeed2);
         cb &= 3;
         while (cb--)
         {
@@ -647,6 +699,11 @@ void XorFileBuf(uint8_t *rgb, int16_t cb)
     }
 }
 
+void XorFileBuf(uint8_t *rgb, int16_t cb)
+{
+    XorBufSeeds(rgb, cb, &lFileSeed1, &lFileSeed2);
+}
+
 char *PszGetLine(char **ppszBeg)
 {
     char *pszStart;
@@ -59,6 +59,11 @@ void SetFileSeeds(int32_t l1, int32_t l2);  /* MEMORY_UTILGEN:0x1a7c */
 void GetFileSeeds(int32_t *pl1, int32_t *pl2);  /* MEMORY_UTILGEN:0x1a4e */
 void SetFileXorStream(int32_t lid, int16_t lSalt, int16_t turn, int16_t iPlayer, int16_t fCrippled);  /* MEMORY_UTILGEN:0x1aa6 */
 void XorFileBuf(uint8_t *rgb, int16_t cb);  /* MEMORY_UTILGEN:0x1cc4 */
+void SkipFileXor(int32_t cStep);
+uint32_t LGetNextXor(int32_t *plSeed1, int32_t *plSeed2);
+void InitXorSeeds(int32_t *plSeed1, int32_t *plSeed2, int32_t lid, int16_t lSalt, int16_t turn, int16_t iPlayer,
+                  int16_t fCrippled);
+void XorBufSeeds(uint8_t *rgb, int16_t cb, int32_t *plSeed1, int32_t *plSeed2);
 char * PszGetLine(char * *ppszBeg);  /* RETFAR */  /* MEMORY_UTILGEN:0x68ba */
 int16_t Random(int16_t c);  /* MEMORY_UTILGEN:0x16d2 */
 char * PszFromLong(int32_t l, int16_t *pcch);  /* MEMORY_UTILGEN:0x22b6 */
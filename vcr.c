@@ -2,6 +2,16 @@
 #include "types.h"
 
 #include "vcr.h"
+#include "battle.h"
+#include "btllog.h"
+#include "memory.h"
+#include "globals.h"
+
+/* Battles live in the htBattle heap as one LpAlloc'd blob per block: the
+ * blob's 2-byte size word follows the HB header, then back-to-back BTLDATA
+ * records terminated by id == 0xffff. The original hardcodes 0x12 (16-byte
+ * HB + size word); native HB is larger, so derive it. */
+#define LpbdFirstFromLphb(lphb) ((BTLDATA *)((uint8_t *)(lphb) + sizeof(HB) + 2))
 
 /* functions */
 void EnableVCRButtons(void)
@@ -92,8 +102,44 @@ BTLDATA * BtlDataGet(int16_t i)
     BTLDATA * lpbd;
     HB * lphb;
 
-    /* TODO: implement */
-    return NULL;
+    if (i < 0)
+    {
+        return NULL;
+    }
+    if (FSyncBtlLog())
+    {
+        return LpbdFromBtlLog(&vbtllog, i);
+    }
+
+    /* Same walk as CBattles, stopping at the i'th battle. */
+    lphb = rglphb[htBattle];
+    if (lphb == NULL)
+    {
+        return NULL;
+    }
+
+    lpbd = LpbdFirstFromLphb(lphb);
+    while (true)
+    {
+        while (lpbd->id != 0xffff)
+        {
+            if (lpbd->cbData == 0)
+            {
+                return NULL;
+            }
+            if (i-- == 0)
+            {
+                return lpbd;
+            }
+            lpbd = (BTLDATA *)((uint8_t *)lpbd + lpbd->cbData);
+        }
+        lphb = lphb->lphbNext;
+        if (lphb == NULL || lphb->ibTop <= sizeof(HB))
+        {
+            return NULL;
+        }
+        lpbd = LpbdFirstFromLphb(lphb);
+    }
 }
 
 void BattleVCR(int16_t iBattle)
@@ -106,7 +152,15 @@ void BattleVCR(int16_t iBattle)
     /* debug symbols */
     /* label LCleanup @ MEMORY_VCR:0x0201 */
 
-    /* TODO: implement */
+    if (!FSyncBtlLog() || (vlpbdVCR = LpbdFromBtlLog(&vbtllog, iBattle)) == NULL)
+    {
+        return;
+    }
+    vlpbdVCRNext = LpbdFromBtlLog(&vbtllog, (int16_t)(iBattle + 1));
+    vrgtok = vlpbdVCR->rgtok;
+    vlpbrVCR = LpbrFromBtlLog(&vbtllog, iBattle, 0);
+
+    /* TODO: implement (the VCR dialog) */
 }
 
 int32_t LdpFromItokDv(int16_t itok, DV *lpdv)
@@ -115,9 +169,26 @@ int32_t LdpFromItokDv(int16_t itok, DV *lpdv)
     uint16_t dpShdef;
     int16_t csh;
     int32_t dp;
-
-    /* TODO: implement */
-    return 0;
+    SHDEF *lpshdef;
+
+    dv.dp = (uint16_t)(lpdv == NULL ? 0 : lpdv->dp);
+    lpshdef = LpshdefFromTok(&vrgtok[itok]);
+    if (lpshdef == NULL)
+    {
+        return 0;
+    }
+    dpShdef = lpshdef->hul.dp;
+    dp = (int32_t)dpShdef * vrgtok[itok].csh;
+    if (dv.dp != 0)
+    {
+        csh = (int16_t)((int32_t)vrgtok[itok].csh * dv.pctSh / 100);
+        if (csh < 1)
+        {
+            csh = 1;
+        }
+        dp -= (int32_t)dpShdef * dv.pctDp / 10 * csh / 50;
+    }
+    return dp;
 }
 
 int32_t CBattleKills(BTLDATA *lpbd, int16_t fOurDead)
@@ -127,12 +198,31 @@ int32_t CBattleKills(BTLDATA *lpbd, int16_t fOurDead)
     int16_t i;
     BTLREC * lpbr;
     int16_t cKill;
+    BTLTOKST *rgtokst;
+    int16_t iBattle;
 
     /* debug symbols */
     /* block (block) @ MEMORY_VCR:0x0692 */
 
-    /* TODO: implement */
-    return 0;
+    /* Not decompiled; the locals say it sums the kills of the records up
+     * to lpbdNext. The index already holds every token's ship count after
+     * the battle, so the kills are the difference from the start. */
+    if (!FSyncBtlLog() || (iBattle = IBattleFromBtlLog(&vbtllog, lpbd)) < 0)
+    {
+        return 0;
+    }
+    rgtokst = LptokstFromBtlLog(&vbtllog, iBattle, cBtlRoundMax);
+    cKilled = 0;
+    for (i = 0; i < lpbd->ctok; i++)
+    {
+        if ((lpbd->rgtok[i].iplr == idPlayer) != (fOurDead != 0))
+        {
+            continue;
+        }
+        cKill = (int16_t)(lpbd->rgtok[i].csh - rgtokst[i].csh);
+        cKilled += cKill;
+    }
+    return cKilled;
 }
 
 int32_t CBattleUnits(BTLDATA *lpbd, uint16_t grbitBU)
@@ -153,8 +243,79 @@ int16_t CBattles(void)
     HB * lphb;
     int16_t cBattles;
 
-    /* TODO: implement */
-    return 0;
+    if (FSyncBtlLog())
+    {
+        return vbtllog.cBattle;
+    }
+
+    cBattles = 0;
+    lphb = rglphb[htBattle];
+    if (lphb == NULL)
+    {
+        return 0;
+    }
+
+    lpbd = LpbdFirstFromLphb(lphb);
+    while (true)
+    {
+        while (lpbd->id != 0xffff)
+        {
+            if (lpbd->cbData == 0)
+            {
+                return cBattles;
+            }
+            cBattles++;
+            lpbd = (BTLDATA *)((uint8_t *)lpbd + lpbd->cbData);
+        }
+        lphb = lphb->lphbNext;
+        /* original: ibTop < 0x11, i.e. nothing allocated past the header */
+        if (lphb == NULL || lphb->ibTop <= sizeof(HB))
+        {
+            break;
+        }
+        lpbd = LpbdFirstFromLphb(lphb);
+    }
+    return cBattles;
+}
+
+/* Not in the original: step to the battle after lpbd (or the first one when
+ * lpbd is NULL), walking blocks exactly like CBattles. *plphb tracks the
+ * block lpbd lives in. */
+BTLDATA * LpbdNextBattle(HB **plphb, BTLDATA *lpbd)
+{
+    HB * lphb;
+
+    if (lpbd == NULL)
+    {
+        lphb = rglphb[htBattle];
+        if (lphb == NULL)
+        {
+            return NULL;
+        }
+        lpbd = LpbdFirstFromLphb(lphb);
+    }
+    else
+    {
+        lphb = *plphb;
+        lpbd = (BTLDATA *)((uint8_t *)lpbd + lpbd->cbData);
+    }
+
+    while (lpbd->id == 0xffff)
+    {
+        lphb = lphb->lphbNext;
+        if (lphb == NULL || lphb->ibTop <= sizeof(HB))
+        {
+            return NULL;
+        }
+        lpbd = LpbdFirstFromLphb(lphb);
+    }
+    if (lpbd->cbData == 0)
+    {
+        return NULL;
+    }
+
+    *plphb = lphb;
+    return lpbd;
 }
 
 int16_t SetVCRBoard(int16_t iStep)
@@ -20,4 +20,7 @@ int16_t VCRDlg(uint16_t hwnd, uint16_t message, uint16_t wParam, int32_t lParam)
 void AnimateAttack(uint16_t hdc);  /* MEMORY_VCR:0x3ac2 */
 void Delay(int16_t ctick);  /* MEMORY_VCR:0x3a3e */
 
+/* not in the original */
+BTLDATA * LpbdNextBattle(HB **plphb, BTLDATA *lpbd);
+
 #endif /* VCR_H_ */